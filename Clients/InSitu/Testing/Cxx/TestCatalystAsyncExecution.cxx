@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTesting.h"
+#include "vtkXMLImageDataReader.h"
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPI.h"
+#endif
+
+#include <catalyst.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int Dimension = 4;
+constexpr int NumberOfSteps = 6;
+
+// Sets up the node passed to catalyst_execute for the given step. The field
+// values are not copied in the node.
+void FillExecuteNode(conduit_cpp::Node& node, int timestep, std::vector<double>& values)
+{
+  node["catalyst/state/timestep"].set(timestep);
+  node["catalyst/state/time"].set(static_cast<double>(timestep));
+  auto channel = node["catalyst/channels/grid"];
+  channel["type"].set("mesh");
+  auto mesh = channel["data"];
+  mesh["coordsets/coords/type"].set("uniform");
+  mesh["coordsets/coords/dims/i"].set(Dimension);
+  mesh["coordsets/coords/dims/j"].set(Dimension);
+  mesh["coordsets/coords/dims/k"].set(Dimension);
+  mesh["topologies/mesh/type"].set("uniform");
+  mesh["topologies/mesh/coordset"].set("coords");
+  mesh["fields/values/association"].set("vertex");
+  mesh["fields/values/topology"].set("mesh");
+  mesh["fields/values/volume_dependent"].set("false");
+  mesh["fields/values/values"].set_external(values.data(), values.size());
+}
+
+// Returns the range of the "values" point array written by the io pipeline
+// for the given step.
+bool GetWrittenRange(const std::string& prefix, int timestep, double range[2])
+{
+  char name[32];
+  std::snprintf(name, sizeof(name), "-%04d", timestep);
+  const std::string stem = prefix + name;
+  const size_t slash = stem.find_last_of('/');
+  const std::string fileName = stem + "/" + stem.substr(slash + 1) + "_0.vti";
+
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  auto array = reader->GetOutput()->GetPointData()->GetArray("values");
+  if (array == nullptr)
+  {
+    vtkLogF(ERROR, "Missing 'values' in '%s'.", fileName.c_str());
+    return false;
+  }
+  array->GetRange(range);
+  return true;
+}
+}
+
+int TestCatalystAsyncExecution(int argc, char* argv[])
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  // the pipelines are executed asynchronously only if MPI supports it.
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+  const bool async = provided >= MPI_THREAD_MULTIPLE;
+#else
+  const bool async = true;
+#endif
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  const std::string prefix =
+    std::string(testing->GetTempDirectory()) + "/TestCatalystAsyncExecution";
+
+  conduit_cpp::Node params;
+  params["catalyst/async/queue_depth"].set(2);
+  params["catalyst/pipelines/0/type"].set("io");
+  params["catalyst/pipelines/0/filename"].set(prefix + "-%04ts.vtpd");
+  params["catalyst/pipelines/0/channel"].set("grid");
+  params["catalyst_load/implementation"].set_string("paraview");
+  params["catalyst_load/search_paths/paraview"] = PARAVIEW_IMPL_DIR;
+  if (catalyst_initialize(conduit_cpp::c_node(&params)) != catalyst_status_ok)
+  {
+    vtkLogF(ERROR, "Failed to initialize Catalyst.");
+    return EXIT_FAILURE;
+  }
+
+  bool success = true;
+  std::vector<double> values(Dimension * Dimension * Dimension);
+  for (int timestep = 0; timestep < NumberOfSteps && success; ++timestep)
+  {
+    std::fill(values.begin(), values.end(), static_cast<double>(timestep));
+    conduit_cpp::Node node;
+    FillExecuteNode(node, timestep, values);
+    success = catalyst_execute(conduit_cpp::c_node(&node)) == catalyst_status_ok;
+
+    // the step was copied, the simulation may overwrite its buffers before
+    // the pipelines execute.
+    std::fill(values.begin(), values.end(), -1.0);
+  }
+
+  // waits for the queued steps and reports them.
+  conduit_cpp::Node results;
+  success = success && catalyst_results(conduit_cpp::c_node(&results)) == catalyst_status_ok;
+  const int expected = async ? NumberOfSteps : 0;
+  const int reported = results.has_path("catalyst/async/steps")
+    ? static_cast<int>(results["catalyst/async/steps"].number_of_children())
+    : 0;
+  if (reported != expected)
+  {
+    vtkLogF(ERROR, "Expected %d asynchronous steps, got %d.", expected, reported);
+    success = false;
+  }
+  for (int cc = 0; cc < reported && success; ++cc)
+  {
+    const auto step = results["catalyst/async/steps"].child(cc);
+    if (step["timestep"].to_int64() != cc || step["lag"].to_float64() < 0 ||
+      step["duration"].to_float64() < 0 || step["stall"].to_float64() < 0)
+    {
+      vtkLogF(ERROR, "Invalid metrics reported for step %d.", cc);
+      success = false;
+    }
+  }
+
+  // a failed step is reported by catalyst_execute when executed synchronously,
+  // and by the next call to catalyst_results otherwise.
+  conduit_cpp::Node invalid;
+  invalid["invalid/state/timestep"].set(NumberOfSteps);
+  const bool executeFailed = catalyst_execute(conduit_cpp::c_node(&invalid)) != catalyst_status_ok;
+  conduit_cpp::Node invalidResults;
+  const bool resultsFailed =
+    catalyst_results(conduit_cpp::c_node(&invalidResults)) != catalyst_status_ok;
+  if (executeFailed == async || resultsFailed != async)
+  {
+    vtkLogF(ERROR, "The failure of the invalid step was not reported as expected.");
+    success = false;
+  }
+
+  conduit_cpp::Node finalizeParams;
+  if (catalyst_finalize(conduit_cpp::c_node(&finalizeParams)) != catalyst_status_ok)
+  {
+    vtkLogF(ERROR, "Failed to finalize Catalyst.");
+    success = false;
+  }
+
+  // every step was executed, in order, on the data passed for that step.
+  for (int timestep = 0; timestep < NumberOfSteps && success; ++timestep)
+  {
+    double range[2];
+    success = GetWrittenRange(prefix, timestep, range);
+    if (success && (range[0] != timestep || range[1] != timestep))
+    {
+      vtkLogF(ERROR, "Step %d wrote values in [%g, %g].", timestep, range[0], range[1]);
+      success = false;
+    }
+  }
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  MPI_Finalize();
+#endif
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTesting.h"
+#include "vtkXMLImageDataReader.h"
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPI.h"
+#endif
+
+#include <catalyst.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int Dimension = 4;
+constexpr int NumberOfSteps = 3;
+
+// Returns the range of the "values" point array written by the io pipeline
+// for the given step.
+bool GetWrittenRange(const std::string& prefix, int timestep, double range[2])
+{
+  char name[32];
+  std::snprintf(name, sizeof(name), "-%04d", timestep);
+  const std::string stem = prefix + name;
+  const size_t slash = stem.find_last_of('/');
+  const std::string fileName = stem + "/" + stem.substr(slash + 1) + "_0.vti";
+
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  auto array = reader->GetOutput()->GetPointData()->GetArray("values");
+  if (array == nullptr)
+  {
+    vtkLogF(ERROR, "Missing 'values' in '%s'.", fileName.c_str());
+    return false;
+  }
+  array->GetRange(range);
+  return true;
+}
+}
+
+int TestCatalystRetainTopology(int argc, char* argv[])
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  const std::string prefix =
+    std::string(testing->GetTempDirectory()) + "/TestCatalystRetainTopology";
+
+  conduit_cpp::Node params;
+  params["catalyst/pipelines/0/type"].set("io");
+  params["catalyst/pipelines/0/filename"].set(prefix + "-%04ts.vtpd");
+  params["catalyst/pipelines/0/channel"].set("grid");
+  params["catalyst_load/implementation"].set_string("paraview");
+  params["catalyst_load/search_paths/paraview"] = PARAVIEW_IMPL_DIR;
+  if (catalyst_initialize(conduit_cpp::c_node(&params)) != catalyst_status_ok)
+  {
+    vtkLogF(ERROR, "Failed to initialize Catalyst.");
+    return EXIT_FAILURE;
+  }
+
+  // the same node, and the same buffers, are passed at every step: only the
+  // values of the field change, in place.
+  std::vector<double> values(Dimension * Dimension * Dimension);
+  conduit_cpp::Node node;
+  node["catalyst/state/retain_topology"].set(1);
+  auto channel = node["catalyst/channels/grid"];
+  channel["type"].set("mesh");
+  auto mesh = channel["data"];
+  mesh["coordsets/coords/type"].set("uniform");
+  mesh["coordsets/coords/dims/i"].set(Dimension);
+  mesh["coordsets/coords/dims/j"].set(Dimension);
+  mesh["coordsets/coords/dims/k"].set(Dimension);
+  mesh["topologies/mesh/type"].set("uniform");
+  mesh["topologies/mesh/coordset"].set("coords");
+  mesh["fields/values/association"].set("vertex");
+  mesh["fields/values/topology"].set("mesh");
+  mesh["fields/values/volume_dependent"].set("false");
+  mesh["fields/values/values"].set_external(values.data(), values.size());
+
+  bool success = true;
+  for (int timestep = 0; timestep < NumberOfSteps && success; ++timestep)
+  {
+    std::fill(values.begin(), values.end(), static_cast<double>(timestep));
+    node["catalyst/state/timestep"].set(timestep);
+    node["catalyst/state/time"].set(static_cast<double>(timestep));
+    success = catalyst_execute(conduit_cpp::c_node(&node)) == catalyst_status_ok;
+  }
+
+  // the mesh and its field are converted at the first step, then the topology
+  // and the field are reused at each of the following steps.
+  conduit_cpp::Node results;
+  success = success && catalyst_results(conduit_cpp::c_node(&results)) == catalyst_status_ok;
+  const auto reuse = results["catalyst/retain_topology/grid"];
+  const long long expectedReused = 2 * (NumberOfSteps - 1);
+  const long long expectedRebuilt = 2;
+  if (success &&
+    (!reuse.has_child("reused") || reuse["reused"].to_int64() != expectedReused ||
+      !reuse.has_child("rebuilt") || reuse["rebuilt"].to_int64() != expectedRebuilt))
+  {
+    vtkLogF(ERROR, "Expected %lld reused and %lld rebuilt arrays, got %lld and %lld.",
+      expectedReused, expectedRebuilt,
+      reuse.has_child("reused") ? static_cast<long long>(reuse["reused"].to_int64()) : -1,
+      reuse.has_child("rebuilt") ? static_cast<long long>(reuse["rebuilt"].to_int64()) : -1);
+    success = false;
+  }
+
+  conduit_cpp::Node finalizeParams;
+  if (catalyst_finalize(conduit_cpp::c_node(&finalizeParams)) != catalyst_status_ok)
+  {
+    vtkLogF(ERROR, "Failed to finalize Catalyst.");
+    success = false;
+  }
+
+  // the reused field was bound to the simulation buffer, so each step wrote
+  // the values of that step.
+  for (int timestep = 0; timestep < NumberOfSteps && success; ++timestep)
+  {
+    double range[2];
+    success = GetWrittenRange(prefix, timestep, range);
+    if (success && (range[0] != timestep || range[1] != timestep))
+    {
+      vtkLogF(ERROR, "Step %d wrote values in [%g, %g].", timestep, range[0], range[1]);
+      success = false;
+    }
+  }
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  MPI_Finalize();
+#endif
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTesting.h"
+#include "vtkXMLImageDataReader.h"
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPI.h"
+#endif
+
+#include <catalyst.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int Dimension = 4;
+
+// Layouts of the node passed to catalyst_execute.
+enum Layout
+{
+  ONE_FIELD,
+  TWO_FIELDS,
+  INVALID, // the topology references a missing coordset.
+};
+
+// Sets up the node passed to catalyst_execute for the given step. The field
+// values are not copied in the node.
+void FillExecuteNode(
+  conduit_cpp::Node& node, int timestep, Layout layout, std::vector<double>& values)
+{
+  node["catalyst/state/timestep"].set(timestep);
+  node["catalyst/state/time"].set(static_cast<double>(timestep));
+  auto channel = node["catalyst/channels/grid"];
+  channel["type"].set("mesh");
+  auto mesh = channel["data"];
+  mesh["coordsets/coords/type"].set("uniform");
+  mesh["coordsets/coords/dims/i"].set(Dimension);
+  mesh["coordsets/coords/dims/j"].set(Dimension);
+  mesh["coordsets/coords/dims/k"].set(Dimension);
+  mesh["topologies/mesh/type"].set("uniform");
+  mesh["topologies/mesh/coordset"].set(layout == INVALID ? "missing" : "coords");
+  mesh["fields/values/association"].set("vertex");
+  mesh["fields/values/topology"].set("mesh");
+  mesh["fields/values/volume_dependent"].set("false");
+  mesh["fields/values/values"].set_external(values.data(), values.size());
+  if (layout == TWO_FIELDS)
+  {
+    mesh["fields/other/association"].set("vertex");
+    mesh["fields/other/topology"].set("mesh");
+    mesh["fields/other/volume_dependent"].set("false");
+    mesh["fields/other/values"].set_external(values.data(), values.size());
+  }
+}
+
+// Returns the range of the "values" point array written by the io pipeline
+// for the given step.
+bool GetWrittenRange(const std::string& prefix, int timestep, double range[2])
+{
+  char name[32];
+  std::snprintf(name, sizeof(name), "-%04d", timestep);
+  const std::string stem = prefix + name;
+  const size_t slash = stem.find_last_of('/');
+  const std::string fileName = stem + "/" + stem.substr(slash + 1) + "_0.vti";
+
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->Update();
+  auto array = reader->GetOutput()->GetPointData()->GetArray("values");
+  if (array == nullptr)
+  {
+    vtkLogF(ERROR, "Missing 'values' in '%s'.", fileName.c_str());
+    return false;
+  }
+  array->GetRange(range);
+  return true;
+}
+}
+
+int TestCatalystVerificationCache(int argc, char* argv[])
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  MPI_Init(&argc, &argv);
+#endif
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  const std::string prefix =
+    std::string(testing->GetTempDirectory()) + "/TestCatalystVerificationCache";
+
+  conduit_cpp::Node params;
+  params["catalyst/verification"].set("cached");
+  params["catalyst/pipelines/0/type"].set("io");
+  params["catalyst/pipelines/0/filename"].set(prefix + "-%04ts.vtpd");
+  params["catalyst/pipelines/0/channel"].set("grid");
+  params["catalyst_load/implementation"].set_string("paraview");
+  params["catalyst_load/search_paths/paraview"] = PARAVIEW_IMPL_DIR;
+  if (catalyst_initialize(conduit_cpp::c_node(&params)) != catalyst_status_ok)
+  {
+    vtkLogF(ERROR, "Failed to initialize Catalyst.");
+    return EXIT_FAILURE;
+  }
+
+  // a layout is verified when it changes. An invalid layout is verified again
+  // at every step since only layouts that verified successfully are cached.
+  const std::vector<Layout> layouts = { ONE_FIELD, ONE_FIELD, TWO_FIELDS, TWO_FIELDS, INVALID,
+    INVALID };
+  const int expectedVerified = 4;
+  const int expectedSkipped = 2;
+  const int numberOfValidSteps = 4;
+
+  bool success = true;
+  std::vector<double> values(Dimension * Dimension * Dimension);
+  for (int timestep = 0; timestep < static_cast<int>(layouts.size()) && success; ++timestep)
+  {
+    std::fill(values.begin(), values.end(), static_cast<double>(timestep));
+    conduit_cpp::Node node;
+    FillExecuteNode(node, timestep, layouts[timestep], values);
+    success = catalyst_execute(conduit_cpp::c_node(&node)) == catalyst_status_ok;
+  }
+
+  conduit_cpp::Node results;
+  success = success && catalyst_results(conduit_cpp::c_node(&results)) == catalyst_status_ok;
+  const auto verification = results["catalyst/verification"];
+  const int verified =
+    verification.has_child("verified") ? static_cast<int>(verification["verified"].to_int64()) : -1;
+  const int skipped =
+    verification.has_child("skipped") ? static_cast<int>(verification["skipped"].to_int64()) : -1;
+  if (success && (verified != expectedVerified || skipped != expectedSkipped))
+  {
+    vtkLogF(ERROR, "Expected %d verified and %d skipped steps, got %d and %d.", expectedVerified,
+      expectedSkipped, verified, skipped);
+    success = false;
+  }
+
+  conduit_cpp::Node finalizeParams;
+  if (catalyst_finalize(conduit_cpp::c_node(&finalizeParams)) != catalyst_status_ok)
+  {
+    vtkLogF(ERROR, "Failed to finalize Catalyst.");
+    success = false;
+  }
+
+  // the steps whose verification was skipped were converted and executed as
+  // the verified ones.
+  for (int timestep = 0; timestep < numberOfValidSteps && success; ++timestep)
+  {
+    double range[2];
+    success = GetWrittenRange(prefix, timestep, range);
+    if (success && (range[0] != timestep || range[1] != timestep))
+    {
+      vtkLogF(ERROR, "Step %d wrote values in [%g, %g].", timestep, range[0], range[1]);
+      success = false;
+    }
+  }
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  MPI_Finalize();
+#endif
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -9,21 +9,39 @@
 
 #include "vtkCallbackCommand.h"
 #include "vtkCatalystBlueprint.h"
+#include "vtkCatalystHash.h"
+#include "vtkCellData.h"
 #include "vtkCommand.h"
+#include "vtkCompositeDataSet.h"
 #include "vtkConduitSource.h"
 #include "vtkDataObjectToConduit.h"
+#include "vtkDataSet.h"
+#include "vtkFieldData.h"
 #include "vtkInSituInitializationHelper.h"
 #include "vtkInSituPipelineIO.h"
 #include "vtkInSituPipelinePython.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkPVLogger.h"
+#include "vtkPVTrivialProducer.h"
 #include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkSMPluginManager.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMProxyManager.h"
 #include "vtkSMSessionProxyManager.h"
 #include "vtkSMSourceProxy.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTimerLog.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
 
 #if VTK_MODULE_ENABLE_VTK_ParallelMPI
 #include "vtkMPI.h"
@@ -39,6 +57,43 @@
 
 #include "catalyst_impl_paraview.h"
 
+// How the 'catalyst' node passed to catalyst_execute is verified, set using
+// 'catalyst/verification' in catalyst_initialize.
+enum class verification_mode
+{
+  full,    // verify at every step.
+  cached,  // verify when the layout of the node changes (default).
+  trusted, // verify the first step only.
+};
+
+static struct
+{
+  verification_mode mode = verification_mode::cached;
+  bool verified = false;
+  std::size_t fingerprint = 0;
+  // number of steps verified and skipped since catalyst_initialize, reported
+  // by catalyst_results.
+  int verified_steps = 0;
+  int skipped_steps = 0;
+} verification_cache;
+
+// Time spent converting Conduit meshes to VTK, accumulated by the Conduit
+// producers during pipeline execution and by update_producer_retained_mesh.
+static double conversion_start_time = 0;
+static double conversion_time = 0;
+
+static void conversion_callback(vtkObject*, unsigned long eventId, void*, void*)
+{
+  if (eventId == vtkCommand::StartEvent)
+  {
+    conversion_start_time = vtkTimerLog::GetUniversalTime();
+  }
+  else
+  {
+    conversion_time += vtkTimerLog::GetUniversalTime() - conversion_start_time;
+  }
+}
+
 static bool update_producer_mesh_blueprint(const std::string& channel_name,
   const conduit_node* node, const conduit_node* global_fields, bool multimesh,
   const conduit_node* assemblyNode, bool multiblock, bool amr)
@@ -55,6 +110,11 @@ static bool update_producer_mesh_blueprint(const std::string& channel_name,
     }
     vtkInSituInitializationHelper::SetProducer(channel_name, producer);
     producer->Delete();
+
+    vtkNew<vtkCallbackCommand> observer;
+    observer->SetCallback(&conversion_callback);
+    producer->GetClientSideObject()->AddObserver(vtkCommand::StartEvent, observer);
+    producer->GetClientSideObject()->AddObserver(vtkCommand::EndEvent, observer);
   }
 
   auto algo = vtkConduitSource::SafeDownCast(producer->GetClientSideObject());
@@ -68,6 +128,343 @@ static bool update_producer_mesh_blueprint(const std::string& channel_name,
   return true;
 }
 
+// State of the channels whose topology is retained across steps, see
+// 'state/retain_topology' and update_producer_retained_mesh.
+struct retained_mesh
+{
+  vtkNew<vtkConduitSource> converter;
+  vtkSmartPointer<vtkDataObject> output;
+  // signature of the coordsets and topologies the output was converted from,
+  // 0 if the output must be converted again.
+  std::size_t topology_signature = 0;
+  // signatures of the field buffers bound to the output arrays.
+  std::map<std::string, std::size_t> field_signatures;
+};
+static std::map<std::string, retained_mesh> retained_meshes;
+// channels for which 'state/retain_topology' was ignored, warned about once.
+static std::set<std::string> topology_not_retained;
+
+static void warn_topology_not_retained(const std::string& channel_name, const char* reason)
+{
+  if (topology_not_retained.insert(channel_name).second)
+  {
+    vtkLogF(WARNING,
+      "'state/retain_topology' is ignored for channel '%s' (%s); its mesh is converted at "
+      "every step.",
+      channel_name.c_str(), reason);
+  }
+}
+
+static void* element_ptr(const conduit_cpp::Node& node)
+{
+  return conduit_node_element_ptr(const_cast<conduit_node*>(conduit_cpp::c_node(&node)), 0);
+}
+
+static void hash_buffer_addresses(const conduit_cpp::Node& node, std::size_t& seed)
+{
+  const auto dtype = node.dtype();
+  if (dtype.is_object() || dtype.is_list())
+  {
+    for (conduit_index_t i = 0, max = node.number_of_children(); i < max; ++i)
+    {
+      hash_buffer_addresses(node.child(i), seed);
+    }
+  }
+  else if (dtype.is_number())
+  {
+    vtkCatalystHash::Combine(seed, reinterpret_cast<std::uintptr_t>(element_ptr(node)));
+    vtkCatalystHash::Combine(seed, static_cast<std::size_t>(dtype.stride()));
+  }
+}
+
+// Returns a hash of the layout of `node` and of the addresses of its buffers.
+static std::size_t buffer_signature(const conduit_cpp::Node& node)
+{
+  std::size_t seed = vtkCatalystBlueprint::ComputeFingerprint(node);
+  hash_buffer_addresses(node, seed);
+  return seed;
+}
+
+// Returns the signature of everything but the fields and state of a mesh.
+static std::size_t topology_signature(const conduit_cpp::Node& mesh)
+{
+  std::size_t seed = 0;
+  for (conduit_index_t i = 0, max = mesh.number_of_children(); i < max; ++i)
+  {
+    const auto child = mesh.child(i);
+    if (child.name() != "fields" && child.name() != "state")
+    {
+      vtkCatalystHash::Combine(seed, buffer_signature(child));
+    }
+  }
+  return seed == 0 ? 1 : seed;
+}
+
+static int vtk_type(const conduit_cpp::DataType& dtype)
+{
+  static const std::map<std::string, int> types = { { "int8", VTK_TYPE_INT8 },
+    { "int16", VTK_TYPE_INT16 }, { "int32", VTK_TYPE_INT32 }, { "int64", VTK_TYPE_INT64 },
+    { "uint8", VTK_TYPE_UINT8 }, { "uint16", VTK_TYPE_UINT16 }, { "uint32", VTK_TYPE_UINT32 },
+    { "uint64", VTK_TYPE_UINT64 }, { "float32", VTK_TYPE_FLOAT32 },
+    { "float64", VTK_TYPE_FLOAT64 } };
+  auto iter = types.find(dtype.name());
+  return iter != types.end() ? iter->second : -1;
+}
+
+template <typename T>
+static vtkSmartPointer<vtkDataArray> bind_soa_array(
+  const conduit_cpp::Node& values, vtkIdType num_values)
+{
+  vtkNew<vtkSOADataArrayTemplate<T>> array;
+  const int ncomps = static_cast<int>(values.number_of_children());
+  array->SetNumberOfComponents(ncomps);
+  for (int comp = 0; comp < ncomps; ++comp)
+  {
+    array->SetArray(
+      comp, static_cast<T*>(element_ptr(values.child(comp))), num_values, true, true);
+  }
+  return array;
+}
+
+// Wraps the buffers of the values of a field in a VTK array without copying
+// them. Returns nullptr if their layout cannot be wrapped.
+static vtkSmartPointer<vtkDataArray> bind_field_values(const conduit_cpp::Node& values)
+{
+  const auto dtype = values.dtype();
+  if (dtype.is_number())
+  {
+    const int type = vtk_type(dtype);
+    if (type < 0 || dtype.stride() != dtype.element_bytes())
+    {
+      return nullptr;
+    }
+    auto array = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(type));
+    array->SetVoidArray(element_ptr(values), dtype.number_of_elements(), 1);
+    return array;
+  }
+
+  // multi-component array, interleaved or with a buffer per component.
+  const conduit_index_t ncomps = values.number_of_children();
+  if ((!dtype.is_object() && !dtype.is_list()) || ncomps == 0)
+  {
+    return nullptr;
+  }
+  const auto first = values.child(0).dtype();
+  const int type = vtk_type(first);
+  const auto base = static_cast<char*>(element_ptr(values.child(0)));
+  bool interleaved = true;
+  bool contiguous = true;
+  for (conduit_index_t comp = 0; comp < ncomps && type >= 0; ++comp)
+  {
+    const auto component = values.child(comp);
+    const auto cdtype = component.dtype();
+    if (!cdtype.is_number() || cdtype.name() != first.name() ||
+      cdtype.number_of_elements() != first.number_of_elements())
+    {
+      return nullptr;
+    }
+    interleaved = interleaved && cdtype.stride() == ncomps * cdtype.element_bytes() &&
+      static_cast<char*>(element_ptr(component)) == base + comp * cdtype.element_bytes();
+    contiguous = contiguous && cdtype.stride() == cdtype.element_bytes();
+  }
+
+  vtkSmartPointer<vtkDataArray> array;
+  if (type < 0)
+  {
+    return nullptr;
+  }
+  else if (interleaved)
+  {
+    array = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(type));
+    array->SetNumberOfComponents(static_cast<int>(ncomps));
+    array->SetVoidArray(base, first.number_of_elements() * ncomps, 1);
+  }
+  else if (contiguous)
+  {
+    switch (type)
+    {
+      vtkTemplateMacro(array = bind_soa_array<VTK_TT>(values, first.number_of_elements()));
+    }
+  }
+  return array;
+}
+
+// Binds the fields of `mesh` to the arrays of `dataset`. Fields whose buffers
+// did not change since they were bound are reused. When `converted` is false,
+// i.e. `dataset` was retained from a previous step, all the fields must have
+// been bound before. Returns false if a field cannot be bound, in which case
+// the mesh must be converted again.
+static bool bind_fields(const conduit_cpp::Node& mesh, vtkDataSet* dataset,
+  retained_mesh& retained, bool converted, vtkIdType& reused, vtkIdType& rebuilt)
+{
+  const conduit_index_t nfields =
+    mesh.has_child("fields") ? mesh["fields"].number_of_children() : 0;
+  if (!converted && static_cast<std::size_t>(nfields) != retained.field_signatures.size())
+  {
+    return false;
+  }
+  for (conduit_index_t i = 0; i < nfields; ++i)
+  {
+    const auto field = mesh["fields"].child(i);
+    const std::string name = field.name();
+    if (!field.has_child("association") || !field.has_child("values"))
+    {
+      return false;
+    }
+    const std::string association = field["association"].as_string();
+    vtkDataSetAttributes* attributes = nullptr;
+    vtkIdType num_tuples = 0;
+    if (association == "vertex")
+    {
+      attributes = dataset->GetPointData();
+      num_tuples = dataset->GetNumberOfPoints();
+    }
+    else if (association == "element")
+    {
+      attributes = dataset->GetCellData();
+      num_tuples = dataset->GetNumberOfCells();
+    }
+    if (attributes == nullptr || attributes->GetArray(name.c_str()) == nullptr)
+    {
+      return false;
+    }
+
+    const auto values = field["values"];
+    const std::size_t signature = buffer_signature(values);
+    auto iter = retained.field_signatures.find(name);
+    if (iter != retained.field_signatures.end() && iter->second == signature)
+    {
+      // same buffers, the simulation updated the values in place.
+      attributes->GetArray(name.c_str())->Modified();
+      ++reused;
+      continue;
+    }
+    else if (!converted && iter == retained.field_signatures.end())
+    {
+      return false;
+    }
+
+    auto array = bind_field_values(values);
+    if (array == nullptr || array->GetNumberOfTuples() != num_tuples)
+    {
+      return false;
+    }
+    array->SetName(name.c_str());
+    attributes->AddArray(array);
+    retained.field_signatures[name] = signature;
+    ++rebuilt;
+  }
+  return true;
+}
+
+static void update_field_data(const conduit_cpp::Node& global_fields, vtkDataObject* dobj)
+{
+  vtkFieldData* fd = dobj->GetFieldData();
+  for (conduit_index_t i = 0, max = global_fields.number_of_children(); i < max; ++i)
+  {
+    const auto child = global_fields.child(i);
+    auto array = fd->GetAbstractArray(child.name().c_str());
+    if (array == nullptr || array->GetNumberOfValues() != 1)
+    {
+      continue;
+    }
+    if (child.dtype().is_string())
+    {
+      array->SetVariantValue(0, vtkVariant(child.as_string().c_str()));
+    }
+    else if (child.dtype().is_number())
+    {
+      array->SetVariantValue(0, vtkVariant(child.to_float64()));
+    }
+    array->Modified();
+  }
+}
+
+// Updates the producer of a "mesh" channel using 'state/retain_topology'. The
+// topology and coordinates converted to VTK are retained across steps as long
+// as the layout, addresses and sizes of their buffers do not change. In that
+// case, only the fields are bound again, without copying the simulation
+// buffers, otherwise the mesh is converted again.
+static bool update_producer_retained_mesh(const std::string& channel_name,
+  const conduit_cpp::Node& node, const conduit_cpp::Node& global_fields,
+  const conduit_node* assemblyNode, bool multiblock)
+{
+  auto producer = vtkInSituInitializationHelper::GetProducer(channel_name);
+  if (producer == nullptr)
+  {
+    auto pxm = vtkSMProxyManager::GetProxyManager()->GetActiveSessionProxyManager();
+    producer = vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "PVTrivialProducer"));
+    if (!producer)
+    {
+      vtkLogF(ERROR, "Failed to create 'PVTrivialProducer' proxy!");
+      return false;
+    }
+    vtkInSituInitializationHelper::SetProducer(channel_name, producer);
+    producer->Delete();
+  }
+
+  auto algo = vtkPVTrivialProducer::SafeDownCast(producer->GetClientSideObject());
+  if (algo == nullptr)
+  {
+    // the producer was created before 'state/retain_topology' was set.
+    return update_producer_mesh_blueprint(channel_name, conduit_cpp::c_node(&node),
+      conduit_cpp::c_node(&global_fields), false, assemblyNode, multiblock, false);
+  }
+
+  const double start_time = vtkTimerLog::GetUniversalTime();
+  auto& retained = retained_meshes[channel_name];
+  // 'state/fields' are converted to field data by vtkConduitSource.
+  const std::size_t signature = node.has_path("state/fields") ? 0 : topology_signature(node);
+  vtkIdType reused = 0;
+  vtkIdType rebuilt = 0;
+  bool retain = retained.output && signature != 0 && signature == retained.topology_signature;
+  if (retain)
+  {
+    auto datasets = vtkCompositeDataSet::GetDataSets(retained.output);
+    retain = datasets.size() == 1 &&
+      bind_fields(node, datasets[0], retained, false, reused, rebuilt);
+  }
+
+  if (retain)
+  {
+    ++reused; // the topology and coordinates.
+    update_field_data(global_fields, retained.output);
+  }
+  else
+  {
+    auto& converter = retained.converter;
+    converter->SetNode(conduit_cpp::c_node(&node));
+    converter->SetGlobalFieldsNode(conduit_cpp::c_node(&global_fields));
+    converter->SetAssemblyNode(assemblyNode);
+    converter->SetOutputMultiBlock(multiblock);
+    converter->Modified();
+    converter->Update();
+    retained.output = vtk::TakeSmartPointer(converter->GetOutputDataObject(0)->NewInstance());
+    retained.output->ShallowCopy(converter->GetOutputDataObject(0));
+
+    // bind the fields to the simulation buffers so that they can be reused.
+    retained.field_signatures.clear();
+    auto datasets = vtkCompositeDataSet::GetDataSets(retained.output);
+    vtkIdType bound = 0;
+    retained.topology_signature = datasets.size() == 1 &&
+        bind_fields(node, datasets[0], retained, true, reused, bound)
+      ? signature
+      : 0;
+    if (datasets.size() != 1)
+    {
+      warn_topology_not_retained(channel_name, "the mesh has several domains");
+    }
+    reused = 0;
+    rebuilt = 1 + (node.has_child("fields") ? node["fields"].number_of_children() : 0);
+  }
+
+  algo->SetOutput(retained.output);
+  vtkInSituInitializationHelper::MarkProducerModified(channel_name);
+  vtkInSituInitializationHelper::RecordArrayReuse(channel_name, reused, rebuilt);
+  conversion_time += vtkTimerLog::GetUniversalTime() - start_time;
+  return true;
+}
+
 static vtkSmartPointer<vtkInSituPipeline> create_precompiled_pipeline(const conduit_cpp::Node& node)
 {
   if (node["type"].as_string() == "io")
@@ -223,6 +620,208 @@ enum paraview_catalyst_status
 };
 #define pvcatalyst_err(name) static_cast<enum catalyst_status>(paraview_catalyst_status_##name)
 
+static enum catalyst_status execute_step(const conduit_node* params);
+
+// Asynchronous execution, enabled using 'catalyst/async/queue_depth' in
+// catalyst_initialize. catalyst_execute snapshots its node and queues it, and
+// a worker thread executes the queued steps while the simulation continues.
+struct async_step
+{
+  conduit_node* node;
+  int timestep;
+  double queue_time; // when the step was queued.
+  double stall;      // time the simulation waited for a free slot.
+};
+
+static struct
+{
+  std::size_t queue_depth = 0; // 0 for synchronous execution.
+  std::deque<async_step> queue;
+  bool busy = false;
+  bool stop = false;
+  // snapshot of the last executed step, kept as the producers may reference it.
+  conduit_node* current = nullptr;
+  // first failure of a step, not reported to the simulation yet.
+  enum catalyst_status failure = catalyst_status_ok;
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::thread worker;
+} async_execution;
+
+static void async_worker()
+{
+  vtkLogger::SetThreadName("catalyst async");
+  std::unique_lock<std::mutex> lock(async_execution.mutex);
+  while (true)
+  {
+    async_execution.condition.wait(
+      lock, [] { return async_execution.stop || !async_execution.queue.empty(); });
+    if (async_execution.queue.empty())
+    {
+      break; // stopped, with no pending steps.
+    }
+    const async_step step = async_execution.queue.front();
+    async_execution.queue.pop_front();
+    async_execution.busy = true;
+    lock.unlock();
+    async_execution.condition.notify_all();
+
+    const double start_time = vtkTimerLog::GetUniversalTime();
+    const enum catalyst_status status = execute_step(step.node);
+    const double end_time = vtkTimerLog::GetUniversalTime();
+    if (async_execution.current != nullptr)
+    {
+      conduit_node_destroy(async_execution.current);
+    }
+    async_execution.current = step.node;
+    vtkInSituInitializationHelper::RecordAsyncStep(
+      step.timestep, start_time - step.queue_time, end_time - start_time, step.stall);
+
+    if (status != catalyst_status_ok)
+    {
+      vtkLogF(ERROR, "Asynchronous execution of timestep=%d failed with status %d.",
+        step.timestep, static_cast<int>(status));
+    }
+
+    lock.lock();
+    if (status != catalyst_status_ok && async_execution.failure == catalyst_status_ok)
+    {
+      async_execution.failure = status;
+    }
+    async_execution.busy = false;
+    async_execution.condition.notify_all();
+  }
+}
+
+// Returns the first failure of a step executed asynchronously since the
+// previous call, if any.
+static enum catalyst_status take_async_failure()
+{
+  std::lock_guard<std::mutex> lock(async_execution.mutex);
+  const enum catalyst_status failure = async_execution.failure;
+  async_execution.failure = catalyst_status_ok;
+  return failure;
+}
+
+// Waits for the queued steps to be executed. Must be called before using
+// ParaView from the simulation thread in asynchronous mode.
+static void wait_for_async_steps()
+{
+  if (async_execution.queue_depth == 0)
+  {
+    return;
+  }
+  vtkVLogScopeFunction(PARAVIEW_LOG_CATALYST_VERBOSITY());
+  std::unique_lock<std::mutex> lock(async_execution.mutex);
+  async_execution.condition.wait(
+    lock, [] { return async_execution.queue.empty() && !async_execution.busy; });
+}
+
+// Called at exit when the simulation did not call catalyst_finalize. Discards
+// the steps not executed yet and waits for the step being executed, since a
+// joinable std::thread cannot be destroyed.
+static void abort_async_execution()
+{
+  if (!async_execution.worker.joinable())
+  {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(async_execution.mutex);
+    for (const auto& step : async_execution.queue)
+    {
+      conduit_node_destroy(step.node);
+    }
+    async_execution.queue.clear();
+    async_execution.stop = true;
+  }
+  async_execution.condition.notify_all();
+  async_execution.worker.join();
+}
+
+static void start_async_execution(std::size_t queue_depth)
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  // the pipelines communicate from the worker thread while the simulation
+  // may communicate from its own thread.
+  int isMPIInitialized = 0;
+  int provided = MPI_THREAD_SINGLE;
+  if (MPI_Initialized(&isMPIInitialized) == MPI_SUCCESS && isMPIInitialized &&
+    MPI_Query_thread(&provided) == MPI_SUCCESS && provided < MPI_THREAD_MULTIPLE)
+  {
+    vtkLogF(WARNING,
+      "Asynchronous execution requires MPI to be initialized with 'MPI_THREAD_MULTIPLE'. "
+      "Pipelines will be executed synchronously.");
+    return;
+  }
+#endif
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "Asynchronous execution with a queue depth of %d",
+    static_cast<int>(queue_depth));
+  static bool abort_registered = false;
+  if (!abort_registered)
+  {
+    // registered after async_execution is constructed, hence called before it
+    // is destroyed.
+    std::atexit(&abort_async_execution);
+    abort_registered = true;
+  }
+  async_execution.queue_depth = queue_depth;
+  async_execution.stop = false;
+  async_execution.worker = std::thread(&async_worker);
+}
+
+static void stop_async_execution()
+{
+  if (async_execution.queue_depth == 0)
+  {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(async_execution.mutex);
+    async_execution.stop = true;
+  }
+  async_execution.condition.notify_all();
+  async_execution.worker.join();
+  if (async_execution.current != nullptr)
+  {
+    conduit_node_destroy(async_execution.current);
+    async_execution.current = nullptr;
+  }
+  async_execution.queue_depth = 0;
+}
+
+static enum catalyst_status queue_step(const conduit_node* params)
+{
+  const double start_time = vtkTimerLog::GetUniversalTime();
+
+  async_step step;
+  step.node = conduit_node_create();
+  conduit_node_set_node(step.node, const_cast<conduit_node*>(params));
+  const conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(step.node);
+  step.timestep = cpp_params.has_path("catalyst/state/timestep")
+    ? cpp_params["catalyst/state/timestep"].to_int64()
+    : (cpp_params.has_path("catalyst/state/cycle") ? cpp_params["catalyst/state/cycle"].to_int64()
+                                                   : 0);
+
+  std::unique_lock<std::mutex> lock(async_execution.mutex);
+  const double wait_time = vtkTimerLog::GetUniversalTime();
+  // back-pressure: wait for the pipelines to catch up when the queue is full.
+  async_execution.condition.wait(
+    lock, [] { return async_execution.queue.size() < async_execution.queue_depth; });
+  step.queue_time = vtkTimerLog::GetUniversalTime();
+  step.stall = step.queue_time - wait_time;
+  async_execution.queue.push_back(step);
+  // report the failure of a previous step, since this one cannot fail yet.
+  const enum catalyst_status failure = async_execution.failure;
+  async_execution.failure = catalyst_status_ok;
+  lock.unlock();
+  async_execution.condition.notify_all();
+
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "queued timestep=%d in %fs (%fs waiting)",
+    step.timestep, step.queue_time - start_time, step.stall);
+  return failure;
+}
+
 //-----------------------------------------------------------------------------
 enum catalyst_status catalyst_initialize_paraview(const conduit_node* params)
 {
@@ -261,6 +860,25 @@ enum catalyst_status catalyst_initialize_paraview(const conduit_node* params)
 #endif
   vtkInSituInitializationHelper::Initialize(comm);
 
+  verification_cache.mode = verification_mode::cached;
+  verification_cache.verified = false;
+  verification_cache.verified_steps = 0;
+  verification_cache.skipped_steps = 0;
+  if (cpp_params.has_path("catalyst/verification"))
+  {
+    const auto mode = cpp_params["catalyst/verification"].as_string();
+    verification_cache.mode = mode == "full"
+      ? verification_mode::full
+      : (mode == "trusted" ? verification_mode::trusted : verification_mode::cached);
+  }
+
+  if (cpp_params.has_path("catalyst/async/queue_depth") &&
+    cpp_params["catalyst/async/queue_depth"].to_int64() > 0)
+  {
+    start_async_execution(
+      static_cast<std::size_t>(cpp_params["catalyst/async/queue_depth"].to_int64()));
+  }
+
   if (cpp_params.has_path("catalyst/scripts"))
   {
     if (vtkInSituInitializationHelper::IsPythonSupported())
@@ -339,10 +957,8 @@ enum catalyst_status catalyst_initialize_paraview(const conduit_node* params)
 }
 
 //-----------------------------------------------------------------------------
-enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
+static enum catalyst_status execute_step(const conduit_node* params)
 {
-  vtkVLogScopeFunction(PARAVIEW_LOG_CATALYST_VERBOSITY());
-
   const conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(const_cast<conduit_node*>(params));
   if (!cpp_params.has_path("catalyst"))
   {
@@ -351,11 +967,38 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
   }
 
   const auto& root = cpp_params["catalyst"];
-  if (!vtkCatalystBlueprint::Verify("execute", root))
+
+  // skip verification if a node with the same layout was already verified.
+  const double verification_start_time = vtkTimerLog::GetUniversalTime();
+  std::size_t fingerprint = 0;
+  bool verify = true;
+  if (verification_cache.mode == verification_mode::cached)
+  {
+    fingerprint = vtkCatalystBlueprint::ComputeFingerprint(root);
+    verify = !verification_cache.verified || fingerprint != verification_cache.fingerprint;
+  }
+  else if (verification_cache.mode == verification_mode::trusted)
+  {
+    verify = !verification_cache.verified;
+  }
+  if (verify)
+  {
+    ++verification_cache.verified_steps;
+  }
+  else
+  {
+    ++verification_cache.skipped_steps;
+  }
+  if (verify && !vtkCatalystBlueprint::Verify("execute", root))
   {
     vtkLogF(ERROR, "invalid 'catalyst' node passed to 'catalyst_execute'. Execution failed.");
     return pvcatalyst_err(invalid_node);
   }
+  vtkVLogIfF(PARAVIEW_LOG_CATALYST_VERBOSITY(), !verify,
+    "'catalyst' node layout already verified. Skipping verification.");
+  bool all_valid = true;
+  double verification_time = vtkTimerLog::GetUniversalTime() - verification_start_time;
+  conversion_time = 0;
 
   // catalyst/timestep or catalyst/cycle is used to indicate the timestep
   // catalyst/time is used to provide the time
@@ -367,6 +1010,12 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
   const int output_multiblock =
     root.has_path("state/multiblock") ? root["state/multiblock"].to_int() : 0;
 
+  // in asynchronous mode, the meshes are converted from a copy of the node
+  // whose buffers never match the retained ones, so topology is not retained.
+  const bool can_retain_topology = async_execution.queue_depth == 0;
+  const int retain_topology =
+    root.has_path("state/retain_topology") ? root["state/retain_topology"].to_int() : 0;
+
   vtkVLogScopeF(
     PARAVIEW_LOG_CATALYST_VERBOSITY(), "co-processing for timestep=%d, time=%f", timestep, time);
 
@@ -399,7 +1048,16 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
         ? channel_node["state/multiblock"].to_int()
         : output_multiblock;
 
-      if (type == "mesh")
+      const int channel_retain_topology = channel_node.has_path("state/retain_topology")
+        ? channel_node["state/retain_topology"].to_int()
+        : retain_topology;
+
+      const double channel_verification_start_time = vtkTimerLog::GetUniversalTime();
+      if ((type == "mesh" || type == "multimesh") && !verify)
+      {
+        // verified in a previous step.
+      }
+      else if (type == "mesh")
       {
         conduit_cpp::Node info;
         is_valid = conduit_cpp::Blueprint::verify("mesh", data_node, info);
@@ -469,9 +1127,11 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
         vtkLogF(ERROR, "channel '%s' has unsupported type '%s'; skipping.", channel_name.c_str(),
           type.c_str());
       }
+      verification_time += vtkTimerLog::GetUniversalTime() - channel_verification_start_time;
 
       if (!is_valid)
       {
+        all_valid = false;
         continue; // skip this channel.
       }
 
@@ -481,7 +1141,27 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
       fields["timestep"].set(channel_timestep);
       fields["cycle"].set(channel_timestep);
       fields["channel"].set(channel_name);
-      if (type == "mesh" || type == "multimesh" || type == "amrmesh")
+      if (channel_retain_topology != 0 && !can_retain_topology)
+      {
+        warn_topology_not_retained(channel_name, "steps are executed asynchronously");
+      }
+      else if (channel_retain_topology != 0 && type != "mesh")
+      {
+        warn_topology_not_retained(channel_name, "only 'mesh' channels are supported");
+      }
+
+      if (type == "mesh" && channel_retain_topology != 0 && can_retain_topology)
+      {
+        conduit_node* assembly = nullptr;
+        if (channel_node.has_path("assembly"))
+        {
+          auto anode = channel_node["assembly"];
+          assembly = conduit_cpp::c_node(&anode);
+        }
+        update_producer_retained_mesh(
+          channel_name, data_node, fields, assembly, channel_output_multiblock != 0);
+      }
+      else if (type == "mesh" || type == "multimesh" || type == "amrmesh")
       {
         conduit_node* assembly = nullptr;
         if (channel_node.has_path("assembly"))
@@ -517,11 +1197,31 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
       "No 'catalyst/channels' found. No meshes will be processed.");
   }
 
+  if (verify && all_valid)
+  {
+    verification_cache.verified = true;
+    verification_cache.fingerprint = fingerprint;
+  }
+
+  const double execution_start_time = vtkTimerLog::GetUniversalTime();
+  const double conversion_start = conversion_time;
   vtkInSituInitializationHelper::ExecutePipelines(params);
+  const double execution_time = vtkTimerLog::GetUniversalTime() - execution_start_time;
+
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "timestep=%d: verification %fs, conversion %fs, pipelines %fs", timestep, verification_time,
+    conversion_time, execution_time - (conversion_time - conversion_start));
 
   return catalyst_status_ok;
 }
 
+//-----------------------------------------------------------------------------
+enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
+{
+  vtkVLogScopeFunction(PARAVIEW_LOG_CATALYST_VERBOSITY());
+  return async_execution.queue_depth > 0 ? queue_step(params) : execute_step(params);
+}
+
 //-----------------------------------------------------------------------------
 enum catalyst_status catalyst_finalize_paraview(const conduit_node* params)
 {
@@ -534,9 +1234,13 @@ enum catalyst_status catalyst_finalize_paraview(const conduit_node* params)
     vtkLogF(ERROR, "invalid 'catalyst' node passed to 'catalyst_finalize'. Finalization may fail.");
   }
 
+  stop_async_execution();
+  const enum catalyst_status async_failure = take_async_failure();
+  retained_meshes.clear();
+  topology_not_retained.clear();
   vtkInSituInitializationHelper::Finalize();
 
-  return catalyst_status_ok;
+  return async_failure;
 }
 
 //-----------------------------------------------------------------------------
@@ -564,6 +1268,9 @@ enum catalyst_status catalyst_results_paraview(conduit_node* params)
     return stub_error_status;
   }
 
+  wait_for_async_steps();
+  const enum catalyst_status async_failure = take_async_failure();
+
   conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(params);
   auto catalyst_node = cpp_params["catalyst"];
 
@@ -577,5 +1284,12 @@ enum catalyst_status catalyst_results_paraview(conduit_node* params)
 
   vtkInSituInitializationHelper::GetResultsFromPipelines(params);
 
+  catalyst_node["verification/verified"].set(verification_cache.verified_steps);
+  catalyst_node["verification/skipped"].set(verification_cache.skipped_steps);
+
+  if (async_failure != catalyst_status_ok)
+  {
+    return async_failure;
+  }
   return is_success ? catalyst_status_ok : pvcatalyst_err(results);
 }
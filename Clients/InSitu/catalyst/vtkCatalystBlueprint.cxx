@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkCatalystBlueprint.h"
 
+#include "vtkCatalystHash.h"
 #include "vtkPVLogger.h"
 
 #include <catalyst_conduit_blueprint.hpp>
 #include <cinttypes>
+#include <functional>
 
 namespace
 {
@@ -28,6 +30,30 @@ void format_error(const conduit_cpp::Node& n)
     }
   }
 }
+
+void fingerprint(const conduit_cpp::Node& n, std::size_t& seed)
+{
+  const auto dtype = n.dtype();
+  vtkCatalystHash::Combine(seed, std::hash<std::string>{}(n.name()));
+  vtkCatalystHash::Combine(seed, std::hash<std::string>{}(dtype.name()));
+  if (dtype.is_string())
+  {
+    vtkCatalystHash::Combine(seed, std::hash<std::string>{}(n.as_string()));
+  }
+  else if (dtype.is_object() || dtype.is_list())
+  {
+    const conduit_index_t nchildren = n.number_of_children();
+    vtkCatalystHash::Combine(seed, static_cast<std::size_t>(nchildren));
+    for (conduit_index_t i = 0; i < nchildren; ++i)
+    {
+      fingerprint(n.child(i), seed);
+    }
+  }
+  else
+  {
+    vtkCatalystHash::Combine(seed, static_cast<std::size_t>(dtype.number_of_elements()));
+  }
+}
 }
 
 namespace initialize
@@ -240,6 +266,22 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
       return false;
     }
   }
+  if (n.has_path("async/queue_depth") && !n["async/queue_depth"].dtype().is_integer())
+  {
+    vtkLogF(ERROR, "'async/queue_depth' must be an integer.");
+    return false;
+  }
+  if (n.has_child("verification"))
+  {
+    const auto verification = n["verification"];
+    if (!verification.dtype().is_string() ||
+      (verification.as_string() != "full" && verification.as_string() != "cached" &&
+        verification.as_string() != "trusted"))
+    {
+      vtkLogF(ERROR, "'verification' must be one of 'full', 'cached' or 'trusted'.");
+      return false;
+    }
+  }
   return true;
 }
 
@@ -309,6 +351,12 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
       PARAVIEW_LOG_CATALYST_VERBOSITY(), "'multiblock' set to %" PRIi32, n["multiblock"].to_int());
   }
 
+  if (n.has_child("retain_topology") && !n["retain_topology"].dtype().is_integer())
+  {
+    vtkLogF(ERROR, "'retain_topology' must be an integral.");
+    return false;
+  }
+
   return true;
 }
 } // namespace state
@@ -589,6 +637,14 @@ bool vtkCatalystBlueprint::Verify(const std::string& protocol, const conduit_cpp
   return res;
 }
 
+//----------------------------------------------------------------------------
+std::size_t vtkCatalystBlueprint::ComputeFingerprint(const conduit_cpp::Node& n)
+{
+  std::size_t seed = 0;
+  ::fingerprint(n, seed);
+  return seed;
+}
+
 //----------------------------------------------------------------------------
 void vtkCatalystBlueprint::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -16,6 +16,7 @@
 #include "vtkObject.h"
 
 #include <catalyst_conduit.hpp> // for conduit_cpp::Node
+#include <cstddef>               // for std::size_t
 
 class vtkCatalystBlueprint : public vtkObject
 {
@@ -31,6 +32,15 @@ public:
    */
   static bool Verify(const std::string& protocol, const conduit_cpp::Node& n);
 
+  /**
+   * Returns a hash of the layout of the conduit::Node `n`: the names, types
+   * and number of elements of `n` and its descendants, and the values of its
+   * string leaves. Numeric values are ignored. Nodes with the same fingerprint
+   * are expected to verify identically, which is used to skip verification
+   * when the layout of the nodes passed to `catalyst_execute` does not change.
+   */
+  static std::size_t ComputeFingerprint(const conduit_cpp::Node& n);
+
 protected:
   vtkCatalystBlueprint();
   ~vtkCatalystBlueprint() override;
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @file vtkCatalystHash.h
+ * @brief hashing helpers shared by the ParaView Catalyst implementation.
+ *
+ * Internal header, used to compute the fingerprints of the nodes passed to
+ * `catalyst_execute` and the signatures of the buffers of retained meshes.
+ */
+
+#ifndef vtkCatalystHash_h
+#define vtkCatalystHash_h
+
+#include <cstddef> // for std::size_t
+
+namespace vtkCatalystHash
+{
+/**
+ * Mixes `value` into `seed`, as `boost::hash_combine` does.
+ */
+inline void Combine(std::size_t& seed, std::size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+}
+
+#endif
+// VTK-HeaderTest-Exclude: vtkCatalystHash.h
@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <cctype>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -68,11 +69,24 @@ public:
   vtkSmartPointer<vtkCPCxxHelper> CPCxxHelper;
 #if VTK_MODULE_ENABLE_VTK_ParallelMPI
   vtkSmartPointer<vtkMPIController> MPIController;
+  // duplicate of the simulation communicator, used by ParaView.
+  MPI_Comm Comm = MPI_COMM_NULL;
 #endif
   std::map<std::string, vtkSmartPointer<vtkSMSourceProxy>> Producers;
   std::vector<PipelineInfo> Pipelines;
   std::map<vtkSMProxy*, std::string> SteerableProxies;
   std::map<vtkSMProxy*, std::string> SteerableExtracts;
+  std::map<std::string, std::pair<vtkIdType, vtkIdType>> ArrayReuse;
+
+  struct AsyncStepInfo
+  {
+    int TimeStep;
+    double Lag;
+    double Duration;
+    double Stall;
+  };
+  std::vector<AsyncStepInfo> AsyncSteps;
+  std::mutex AsyncStepsMutex;
 
   bool InExecutePipelines = false;
   bool InResultsPipelines = false;
@@ -139,9 +153,11 @@ void vtkInSituInitializationHelper::Initialize(vtkTypeUInt64 comm)
   {
     vtkVLogScopeF(
       PARAVIEW_LOG_CATALYST_VERBOSITY(), "Initializing MPI communicator using 'comm' (%llu)", comm);
-    // convert comm to MPI handle.
-    MPI_Comm mpicomm = MPI_Comm_f2c(comm);
-    vtkMPICommunicatorOpaqueComm opaqueComm(&mpicomm);
+    // convert comm to MPI handle, and duplicate it so that the messages of
+    // ParaView never match those of the simulation, which may also be sent
+    // concurrently when pipelines are executed asynchronously.
+    MPI_Comm_dup(MPI_Comm_f2c(comm), &internals.Comm);
+    vtkMPICommunicatorOpaqueComm opaqueComm(&internals.Comm);
     vtkNew<vtkMPICommunicator> mpiCommunicator;
     mpiCommunicator->InitializeExternal(&opaqueComm);
     internals.MPIController = vtkSmartPointer<vtkMPIController>::New();
@@ -216,6 +232,16 @@ void vtkInSituInitializationHelper::Finalize()
     }
   }
 
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  int isMPIFinalized = 0;
+  if (internals.Comm != MPI_COMM_NULL && MPI_Finalized(&isMPIFinalized) == MPI_SUCCESS &&
+    !isMPIFinalized)
+  {
+    MPI_Comm comm = internals.Comm;
+    MPI_Comm_free(&comm);
+  }
+#endif
+
   vtkInSituInitializationHelper::WasFinalizedOnce = 1;
   delete vtkInSituInitializationHelper::Internals;
   vtkInSituInitializationHelper::Internals = nullptr;
@@ -381,6 +407,68 @@ void vtkInSituInitializationHelper::MarkProducerModified(vtkSMSourceProxy* produ
   producer->MarkModified(producer);
 }
 
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::RecordArrayReuse(
+  const std::string& channelName, vtkIdType reused, vtkIdType rebuilt)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR,
+      "'vtkInSituInitializationHelper::RecordArrayReuse' cannot be called before "
+      "'Initialize'.");
+    return;
+  }
+
+  auto& counts = vtkInSituInitializationHelper::Internals->ArrayReuse[channelName];
+  counts.first += reused;
+  counts.second += rebuilt;
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "channel '%s': %lld arrays reused, %lld rebuilt",
+    channelName.c_str(), static_cast<long long>(reused), static_cast<long long>(rebuilt));
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkInSituInitializationHelper::GetNumberOfReusedArrays(const std::string& channelName)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    return 0;
+  }
+  const auto& reuse = vtkInSituInitializationHelper::Internals->ArrayReuse;
+  auto iter = reuse.find(channelName);
+  return iter != reuse.end() ? iter->second.first : 0;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkInSituInitializationHelper::GetNumberOfRebuiltArrays(const std::string& channelName)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    return 0;
+  }
+  const auto& reuse = vtkInSituInitializationHelper::Internals->ArrayReuse;
+  auto iter = reuse.find(channelName);
+  return iter != reuse.end() ? iter->second.second : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::RecordAsyncStep(
+  int timestep, double lag, double duration, double stall)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr)
+  {
+    vtkLogF(ERROR,
+      "'vtkInSituInitializationHelper::RecordAsyncStep' cannot be called before 'Initialize'.");
+    return;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "timestep=%d executed asynchronously: lag %fs, duration %fs, stall %fs", timestep, lag,
+    duration, stall);
+  std::lock_guard<std::mutex> lock(internals.AsyncStepsMutex);
+  internals.AsyncSteps.push_back({ timestep, lag, duration, stall });
+}
+
 //----------------------------------------------------------------------------
 bool vtkInSituInitializationHelper::ExecutePipelines(const conduit_node* params)
 {
@@ -552,6 +640,37 @@ bool vtkInSituInitializationHelper::GetResultsFromPipelines(conduit_node* cataly
     }
   }
 
+  // report the metrics of the steps executed asynchronously since the last call.
+  {
+    std::lock_guard<std::mutex> lock(internals.AsyncStepsMutex);
+    if (!internals.AsyncSteps.empty())
+    {
+      conduit_cpp::Node results = conduit_cpp::cpp_node(catalyst_params);
+      auto steps = results["catalyst/async/steps"];
+      for (const auto& info : internals.AsyncSteps)
+      {
+        auto step = steps.append();
+        step["timestep"].set(info.TimeStep);
+        step["lag"].set(info.Lag);
+        step["duration"].set(info.Duration);
+        step["stall"].set(info.Stall);
+      }
+      internals.AsyncSteps.clear();
+    }
+  }
+
+  // report the arrays reused by the channels whose topology is retained.
+  if (!internals.ArrayReuse.empty())
+  {
+    conduit_cpp::Node results = conduit_cpp::cpp_node(catalyst_params);
+    for (const auto& reuse : internals.ArrayReuse)
+    {
+      auto channel = results["catalyst/retain_topology/" + reuse.first];
+      channel["reused"].set(static_cast<conduit_int64>(reuse.second.first));
+      channel["rebuilt"].set(static_cast<conduit_int64>(reuse.second.second));
+    }
+  }
+
   internals.InResultsPipelines = false;
 
   return true;
@@ -114,6 +114,29 @@ public:
   static void MarkProducerModified(vtkSMSourceProxy* producer);
   ///@}
 
+  ///@{
+  /**
+   * Statistics about the conversion of the mesh of a channel to VTK. When the
+   * topology of a channel is retained across steps, arrays whose buffers did
+   * not change are reused instead of being rebuilt. `RecordArrayReuse` adds
+   * to the numbers of reused and rebuilt arrays of the channel, while the
+   * getters return the totals since `Initialize`. The totals are also reported
+   * by `GetResultsFromPipelines` under "catalyst/retain_topology/<channel>".
+   */
+  static void RecordArrayReuse(const std::string& channelName, vtkIdType reused, vtkIdType rebuilt);
+  static vtkIdType GetNumberOfReusedArrays(const std::string& channelName);
+  static vtkIdType GetNumberOfRebuiltArrays(const std::string& channelName);
+  ///@}
+
+  /**
+   * Records the metrics of a step executed asynchronously: the time it waited
+   * in the queue before being executed, the duration of its execution and
+   * the time the simulation was stalled because the queue was full. The
+   * metrics of the steps executed since the previous call are reported by
+   * `GetResultsFromPipelines` under "catalyst/async/steps". Thread safe.
+   */
+  static void RecordAsyncStep(int timestep, double lag, double duration, double stall);
+
   /**
    * Executes pipelines.
    */
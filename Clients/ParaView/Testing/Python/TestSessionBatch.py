@@ -0,0 +1,81 @@
+from paraview import servermanager
+from paraview import simple
+
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+
+def getHost(url):
+    return url.split(':')[1][2:]
+
+
+def getPort(url):
+    return int(url.split(':')[2])
+
+
+def createProxies(session, count):
+    """Creates quadrics and pushes a property of each, returns the number of
+    messages sent to the server meanwhile."""
+    start = session.GetNumberOfMessagesSent()
+    proxies = []
+    for i in range(count):
+        proxy = servermanager.CreateProxy("implicit_functions", "Quadric", session)
+        proxy.UpdateVTKObjects()
+        proxy.GetProperty("QuadricCoefficients").SetElement(9, -i)
+        proxy.UpdateVTKObjects()
+        proxies.append(proxy)
+    return proxies, session.GetNumberOfMessagesSent() - start
+
+
+def runTest():
+    options = servermanager.vtkRemotingCoreConfiguration.GetInstance()
+    url = options.GetServerURL()
+
+    simple.Connect(getHost(url), getPort(url))
+    session = servermanager.ActiveConnection.Session
+    assert session.IsA("vtkSMSessionClient")
+
+    count = 100
+
+    proxies, unbatched = createProxies(session, count)
+
+    session.BeginBatch()
+    assert session.GetInBatch()
+    batchedProxies, batched = createProxies(session, count)
+    start = session.GetNumberOfMessagesSent()
+    session.EndBatch()
+    flushed = session.GetNumberOfMessagesSent() - start
+    assert not session.GetInBatch()
+
+    print("%d proxies created with %d messages unbatched, %d messages batched" %
+        (count, unbatched, batched + flushed))
+    print("last batch: %d messages, %d bytes" %
+        (session.GetLastBatchNumberOfMessages(), session.GetLastBatchSize()))
+
+    # at least a creation and a push for each proxy, each sent right away
+    # without a batch.
+    assert unbatched >= 2 * count
+    # nothing is sent until the batch ends, then the messages are sent in a
+    # single message for each server.
+    assert batched == 0
+    assert 1 <= flushed <= 2
+    assert session.GetLastBatchNumberOfMessages() >= 2 * count
+    assert session.GetLastBatchSize() > 0
+
+    # the proxies were created in the right order on the server: a pipeline
+    # using one of them updates fine.
+    session.BeginBatch()
+    sphere = simple.Sphere()
+    clip = simple.Clip(Input=sphere)
+    clip.ClipType = "Sphere"
+    clip.ClipType.Radius = 0.25
+    session.EndBatch()
+    clip.UpdatePipeline()
+    assert clip.GetDataInformation().GetNumberOfPoints() > 0
+
+    simple.Disconnect()
+
+
+if __name__ == "__main__":
+    runTest()
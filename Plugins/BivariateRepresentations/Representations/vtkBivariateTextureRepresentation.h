@@ -80,6 +80,12 @@ protected:
    */
   void UpdateColoringParameters() override{};
 
+  /**
+   * Streamed pieces would not have the texture coordinates computed in
+   * RequestData, hence streaming is not supported.
+   */
+  bool SupportsStreaming() override { return false; }
+
 private:
   vtkBivariateTextureRepresentation(const vtkBivariateTextureRepresentation&) = delete;
   void operator=(const vtkBivariateTextureRepresentation&) = delete;
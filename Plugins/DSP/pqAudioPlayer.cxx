@@ -433,7 +433,8 @@ bool pqAudioPlayer::pqInternals::fetchMetaData()
     return false;
   }
 
-  vtkPVArrayInformation* sampleRateArrayInfo = fieldInfo->GetArrayInformation("sample_rate");
+  vtkPVArrayInformation* sampleRateArrayInfo =
+    this->ActiveSourceProxy->GetArrayInformationWithRanges(0, "sample_rate", vtkDataObject::FIELD);
 
   if (sampleRateArrayInfo)
   {
@@ -472,7 +473,8 @@ bool pqAudioPlayer::pqInternals::fetchMetaData()
     // If "time" row data is present, extract sample rate from it
     if (vtksys::SystemTools::Strucmp(arrayName, "time") == 0)
     {
-      vtkPVArrayInformation* timeArrayInfo = rowInfo->GetArrayInformation(i);
+      vtkPVArrayInformation* timeArrayInfo =
+        this->ActiveSourceProxy->GetArrayInformationWithRanges(0, arrayName, vtkDataObject::ROW);
       if (timeArrayInfo->GetNumberOfComponents() != 1)
       {
         qInfo() << "Time data is ill-formed (number of components != 1) - skipping";
@@ -111,6 +111,12 @@ protected:
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  /**
+   * Streamed pieces cannot be rendered without the prism transformation, hence
+   * streaming is not supported.
+   */
+  bool SupportsStreaming() override { return false; }
+
   bool IsSimulationData = false;
   bool EnableThresholding = false;
   vtkNew<vtkSimulationPointCloudFilter> SimulationPointCloudFilter;
@@ -404,9 +404,9 @@ void pqSLACManager::showField(const char* name)
   }
 
   // Get information about the field we are supposed to be showing.
-  vtkPVDataInformation* dataInfo = repr->getInputDataInformation();
-  vtkPVDataSetAttributesInformation* pointInfo = dataInfo->GetPointDataInformation();
-  vtkPVArrayInformation* arrayInfo = pointInfo->GetArrayInformation(name);
+  vtkSMSourceProxy* meshReaderProxy = vtkSMSourceProxy::SafeDownCast(meshReader->getProxy());
+  vtkPVArrayInformation* arrayInfo =
+    meshReaderProxy->GetArrayInformationWithRanges(0, name, vtkDataObject::POINT);
   if (!arrayInfo)
     return;
 
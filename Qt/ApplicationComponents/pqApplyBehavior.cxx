@@ -278,6 +278,7 @@ void pqApplyBehavior::applied(pqPropertiesPanel* panel)
       // 'vtkBlockColors' array, if present.
       if (!vtkSMColorMapEditorHelper::GetUsingScalarColoring(reprProxy))
       {
+        // represented data information is always gathered with array ranges.
         auto dataInfo = reprProxy->GetRepresentedDataInformation();
         auto arrayInfo = dataInfo->GetArrayInformation("vtkBlockColors", vtkDataObject::FIELD);
         if (dataInfo->IsCompositeDataSet() && arrayInfo != nullptr &&
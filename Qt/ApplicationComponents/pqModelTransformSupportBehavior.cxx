@@ -185,9 +185,8 @@ vtkTuple<T, size> GetValues(const char* aname, vtkSMSourceProxy* producer, int p
   *pisvalid = false;
 
   vtkTuple<T, size> value;
-  vtkPVDataInformation* dinfo = producer->GetDataInformation(port);
   if (vtkPVArrayInformation* ainfo =
-        (dinfo ? dinfo->GetArrayInformation(aname, vtkDataObject::FIELD) : nullptr))
+        producer->GetArrayInformationWithRanges(port, aname, vtkDataObject::FIELD))
   {
     if (ainfo->GetNumberOfComponents() == size)
     {
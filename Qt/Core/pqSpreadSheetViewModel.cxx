@@ -211,7 +211,8 @@ void pqSpreadSheetViewModel::delayedUpdate()
 {
   if (this->Internal->ActiveRegion[0] >= 0)
   {
-    this->Internal->VTKView->GetValue(this->Internal->ActiveRegion[0], 0);
+    this->Internal->VTKView->FetchRows(
+      this->Internal->ActiveRegion[0], this->Internal->ActiveRegion[1]);
   }
 }
 
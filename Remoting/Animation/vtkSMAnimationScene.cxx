@@ -11,6 +11,7 @@
 #include "vtkPVLogger.h"
 #include "vtkSMProperty.h"
 #include "vtkSMPropertyHelper.h"
+#include "vtkSMSourceProxy.h"
 #include "vtkSMTransferFunctionManager.h"
 #include "vtkSMViewProxy.h"
 #include "vtkSmartPointer.h"
@@ -37,6 +38,19 @@ bool vtkSMAnimationScene::GetGlobalUseGeometryCache()
   return vtkSMAnimationScene::GlobalUseGeometryCache;
 }
 
+int vtkSMAnimationScene::GlobalNumberOfTimeStepsToPrefetch = 0;
+//----------------------------------------------------------------------------
+void vtkSMAnimationScene::SetGlobalNumberOfTimeStepsToPrefetch(int count)
+{
+  vtkSMAnimationScene::GlobalNumberOfTimeStepsToPrefetch = count;
+}
+
+//----------------------------------------------------------------------------
+int vtkSMAnimationScene::GetGlobalNumberOfTimeStepsToPrefetch()
+{
+  return vtkSMAnimationScene::GlobalNumberOfTimeStepsToPrefetch;
+}
+
 //----------------------------------------------------------------------------
 class vtkSMAnimationScene::vtkInternals
 {
@@ -487,6 +501,9 @@ void vtkSMAnimationScene::TickInternal(double currenttime, double deltatime, dou
 
   this->Internals->UpdateAllViews();
 
+  // readers can read the next timesteps while the views render this one.
+  this->PrefetchTimeSteps();
+
   std::for_each(cues.begin(), cues.end(),
     vtkTickOnCameraCue(this->StartTime, this->EndTime, currenttime, deltatime, clocktime,
       this->Direction, this->TimeKeeper));
@@ -505,6 +522,50 @@ void vtkSMAnimationScene::TickInternal(double currenttime, double deltatime, dou
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkSMAnimationScene::PrefetchTimeSteps()
+{
+  const int count = vtkSMAnimationScene::GlobalNumberOfTimeStepsToPrefetch;
+  if (count <= 0 || this->TimeKeeper == nullptr || !this->AnimationPlayer->GetInPlay())
+  {
+    return;
+  }
+
+  const double time = vtkSMPropertyHelper(this->TimeKeeper, "Time").GetAsDouble();
+  const bool backward = (this->Direction == vtkAnimationCue::PlayDirection::BACKWARD);
+
+  vtkSMPropertyHelper sourcesHelper(this->TimeKeeper, "TimeSources");
+  for (unsigned int cc = 0; cc < sourcesHelper.GetNumberOfElements(); ++cc)
+  {
+    auto source = vtkSMSourceProxy::SafeDownCast(sourcesHelper.GetAsProxy(cc));
+    if (source == nullptr || source->GetProperty("TimestepValues") == nullptr)
+    {
+      continue;
+    }
+
+    const std::vector<double> timesteps =
+      vtkSMPropertyHelper(source, "TimestepValues").GetDoubleArray();
+    std::vector<double> times;
+    if (backward)
+    {
+      auto iter = std::lower_bound(timesteps.begin(), timesteps.end(), time);
+      while (iter != timesteps.begin() && static_cast<int>(times.size()) < count)
+      {
+        times.push_back(*(--iter));
+      }
+    }
+    else
+    {
+      auto iter = std::upper_bound(timesteps.begin(), timesteps.end(), time);
+      for (; iter != timesteps.end() && static_cast<int>(times.size()) < count; ++iter)
+      {
+        times.push_back(*iter);
+      }
+    }
+    source->PrefetchTimeSteps(times);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkSMAnimationScene::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -195,6 +195,17 @@ public:
   static bool GetGlobalUseGeometryCache();
   ///@}
 
+  ///@{
+  /**
+   * Set the number of timesteps of the time sources to request ahead of the
+   * current time during playback. 0 (default) disables prefetching. Typically,
+   * one uses vtkPVGeneralSettings, which also enables prefetching on the
+   * readers, rather than using this API directly.
+   */
+  static void SetGlobalNumberOfTimeStepsToPrefetch(int count);
+  static int GetGlobalNumberOfTimeStepsToPrefetch();
+  ///@}
+
 protected:
   vtkSMAnimationScene();
   ~vtkSMAnimationScene() override;
@@ -217,6 +228,13 @@ protected:
   void TimeKeeperTimestepsChanged();
   ///@}
 
+  /**
+   * Called during playback to request the upcoming timesteps of the time
+   * sources to be read in the background.
+   * @sa SetGlobalNumberOfTimeStepsToPrefetch
+   */
+  void PrefetchTimeSteps();
+
   bool LockStartTime;
   bool LockEndTime;
   bool InTick;
@@ -239,6 +257,7 @@ private:
   unsigned long TimestepValuesObserverID;
 
   static bool GlobalUseGeometryCache;
+  static int GlobalNumberOfTimeStepsToPrefetch;
 };
 
 #endif
@@ -22,6 +22,7 @@
 #include "vtkSMProperty.h"
 #include "vtkSMProxyManager.h"
 #include "vtkSMSettings.h"
+#include "vtkSMTemporalRangeCache.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringList.h"
 
@@ -564,6 +565,8 @@ void vtkInitializationHelper::Finalize()
     }
   }
 
+  vtkSMTemporalRangeCache::GetInstance()->Flush();
+
   // pop GLOBAL scope
   vtkPVStringFormatter::PopScope();
   // pop ENV scope
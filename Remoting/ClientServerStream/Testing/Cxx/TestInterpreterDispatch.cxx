@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerStream.h"
+#include "vtkDoubleArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Command functions written the way vtkWrapClientServer generates them for
+// the hierarchy of vtkDoubleArray: each level tests the methods it implements
+// then falls back to its superclass.
+struct Level
+{
+  const char* Name;
+  const char* Superclass;
+  std::vector<std::string> Methods;
+};
+
+Level Levels[] = {
+  { "vtkDoubleArray", "vtkDataArray", {} },
+  { "vtkDataArray", "vtkAbstractArray", {} },
+  { "vtkAbstractArray", "vtkObject", { "SetNumberOfTuples", "GetNumberOfTuples" } },
+  { "vtkObject", "vtkObjectBase", { "Modified" } },
+  { "vtkObjectBase", nullptr, {} },
+};
+
+int LevelCommand(vtkClientServerInterpreter* arlu, vtkObjectBase* ob, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream& resultStream, void* ctx)
+{
+  const Level* level = static_cast<const Level*>(ctx);
+  for (const auto& name : level->Methods)
+  {
+    if (strcmp(name.c_str(), method) != 0)
+    {
+      continue;
+    }
+    vtkDoubleArray* op = vtkDoubleArray::SafeDownCast(ob);
+    vtkIdType count;
+    if (name == "SetNumberOfTuples" && msg.GetNumberOfArguments(0) == 3 &&
+      msg.GetArgument(0, 2, &count))
+    {
+      op->SetNumberOfTuples(count);
+      return 1;
+    }
+    if (name == "GetNumberOfTuples" && msg.GetNumberOfArguments(0) == 2)
+    {
+      resultStream.Reset();
+      resultStream << vtkClientServerStream::Reply << op->GetNumberOfTuples()
+                   << vtkClientServerStream::End;
+      return 1;
+    }
+    if (name == "Modified" && msg.GetNumberOfArguments(0) == 2)
+    {
+      op->Modified();
+      return 1;
+    }
+  }
+
+  if (level->Superclass && arlu->HasCommandFunction(level->Superclass) &&
+    arlu->CallCommandFunction(level->Superclass, ob, method, msg, resultStream))
+  {
+    return 1;
+  }
+  if (resultStream.GetNumberOfMessages() > 0 &&
+    resultStream.GetCommand(0) == vtkClientServerStream::Error &&
+    resultStream.GetNumberOfArguments(0) > 1)
+  {
+    return 0;
+  }
+  std::string error = std::string("Object type: ") + level->Name +
+    ", could not find requested method: \"" + method + "\"";
+  resultStream.Reset();
+  resultStream << vtkClientServerStream::Error << error.c_str() << vtkClientServerStream::End;
+  return 0;
+}
+
+vtkObjectBase* NewDoubleArray(void*)
+{
+  return vtkDoubleArray::New();
+}
+
+void Initialize(vtkClientServerInterpreter* interp, bool methodIds)
+{
+  interp->AddNewInstanceFunction("vtkDoubleArray", NewDoubleArray);
+  for (auto& level : Levels)
+  {
+    // pad the levels with methods that are never invoked.
+    if (level.Methods.size() < 40)
+    {
+      for (int cc = 0; cc < 40; ++cc)
+      {
+        level.Methods.push_back(std::string("Set") + level.Name + std::to_string(cc));
+      }
+    }
+    interp->AddCommandFunction(level.Name, LevelCommand, &level);
+    if (methodIds)
+    {
+      std::vector<vtkTypeUInt32> ids;
+      for (const auto& name : level.Methods)
+      {
+        ids.push_back(vtkClientServerInterpreter::GetMethodId(name.c_str()));
+      }
+      interp->AddCommandMethodIds(
+        level.Name, level.Superclass, ids.data(), static_cast<int>(ids.size()));
+    }
+  }
+}
+
+bool CheckDispatch(vtkClientServerInterpreter* interp)
+{
+  const vtkClientServerID id(1);
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::New << "vtkDoubleArray" << id << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << id << "SetNumberOfTuples" << vtkIdType(10)
+         << vtkClientServerStream::End;
+  stream << vtkClientServerStream::Invoke << id << "GetNumberOfTuples"
+         << vtkClientServerStream::End;
+  vtkIdType count = 0;
+  if (!interp->ProcessStream(stream) || !interp->GetLastResult().GetArgument(0, 0, &count) ||
+    count != 10)
+  {
+    vtkLogF(ERROR, "Failed to invoke superclass methods.");
+    return false;
+  }
+
+  // errors name the class of the object, whatever the level dispatched to.
+  const char* invalid[] = { "SetNumberOfTuples", "SetSomethingElse" };
+  for (const char* method : invalid)
+  {
+    stream.Reset();
+    stream << vtkClientServerStream::Invoke << id << method << vtkClientServerStream::End;
+    const char* error = nullptr;
+    if (interp->ProcessStream(stream) || !interp->GetLastResult().GetArgument(0, 0, &error) ||
+      !strstr(error, "Object type: vtkDoubleArray"))
+    {
+      vtkLogF(ERROR, "Unexpected result for invalid invocation of '%s'.", method);
+      return false;
+    }
+  }
+  return true;
+}
+
+double Benchmark(vtkClientServerInterpreter* interp, int count)
+{
+  const vtkClientServerID id(1);
+  vtkClientServerStream stream;
+  for (int cc = 0; cc < count; ++cc)
+  {
+    stream << vtkClientServerStream::Invoke << id << "Modified" << vtkClientServerStream::End;
+  }
+
+  vtkObjectBase* object = interp->GetObjectFromID(id);
+  const vtkMTimeType mtime = static_cast<vtkObject*>(object)->GetMTime();
+  const auto start = std::chrono::steady_clock::now();
+  const int status = interp->ProcessStream(stream);
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  if (!status || static_cast<vtkObject*>(object)->GetMTime() <= mtime)
+  {
+    vtkLogF(ERROR, "Failed to invoke methods.");
+    return 0;
+  }
+  return count / std::max(elapsed.count(), 1e-9);
+}
+}
+
+int TestInterpreterDispatch(int, char*[])
+{
+  const int count = 100000;
+
+  vtkNew<vtkClientServerInterpreter> chained;
+  Initialize(chained, false);
+  vtkNew<vtkClientServerInterpreter> resolved;
+  Initialize(resolved, true);
+  if (!CheckDispatch(chained) || !CheckDispatch(resolved))
+  {
+    return EXIT_FAILURE;
+  }
+
+  const double chainedRate = Benchmark(chained, count);
+  const double resolvedRate = Benchmark(resolved, count);
+  if (chainedRate == 0 || resolvedRate == 0)
+  {
+    return EXIT_FAILURE;
+  }
+  vtkLogF(INFO, "without method ids: %g invocations/s", chainedRate);
+  vtkLogF(INFO, "with method ids: %g invocations/s", resolvedRate);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkClientServerStream.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObject.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+// Builds a stream the way a property push does.
+void Build(vtkClientServerStream& stream, int cc)
+{
+  stream << vtkClientServerStream::Invoke << vtkClientServerID(cc + 1) << "SetValue"
+         << static_cast<double>(cc) << vtkClientServerStream::End;
+}
+
+bool Check(const vtkClientServerStream& stream, int cc)
+{
+  double value = -1;
+  return stream.GetNumberOfMessages() == 1 &&
+    stream.GetCommand(0) == vtkClientServerStream::Invoke &&
+    stream.GetArgument(0, 2, &value) && value == static_cast<double>(cc);
+}
+
+bool RoundTrip(const vtkClientServerStream& stream, vtkClientServerStream& copy)
+{
+  const unsigned char* data;
+  size_t length;
+  if (!stream.GetData(&data, &length))
+  {
+    return false;
+  }
+  memcpy(copy.BeginSetData(length), data, length);
+  return copy.EndSetData() != 0;
+}
+
+bool TestSemantics()
+{
+  vtkClientServerStream stream;
+  Build(stream, 1);
+  vtkClientServerStream moved(std::move(stream));
+  if (!Check(moved, 1) || stream.GetNumberOfMessages() != 0)
+  {
+    vtkLogF(ERROR, "Move construction failed.");
+    return false;
+  }
+
+  Build(stream, 2);
+  moved = std::move(stream);
+  if (!Check(moved, 2) || stream.GetNumberOfMessages() != 0)
+  {
+    vtkLogF(ERROR, "Move assignment failed.");
+    return false;
+  }
+
+  // streams with different owners copy the data, the moved-from stream is
+  // still left empty.
+  vtkNew<vtkObject> owner;
+  vtkClientServerStream owned(owner);
+  Build(stream, 4);
+  owned = std::move(stream);
+  if (!Check(owned, 4) || stream.GetNumberOfMessages() != 0)
+  {
+    vtkLogF(ERROR, "Move assignment between owners failed.");
+    return false;
+  }
+  Build(owned, 5);
+  vtkClientServerStream movedOwned(std::move(owned));
+  if (movedOwned.GetNumberOfMessages() != 2 || owned.GetNumberOfMessages() != 0)
+  {
+    vtkLogF(ERROR, "Move construction from an owned stream failed.");
+    return false;
+  }
+
+  vtkClientServerStream copy;
+  Build(copy, 3);
+  if (!RoundTrip(moved, copy) || !Check(copy, 2))
+  {
+    vtkLogF(ERROR, "Round-trip failed.");
+    return false;
+  }
+
+  // truncated data resets the stream.
+  const unsigned char* data;
+  size_t length;
+  moved.GetData(&data, &length);
+  memcpy(copy.BeginSetData(length - 1), data, length - 1);
+  if (copy.EndSetData() || copy.GetNumberOfMessages() != 0)
+  {
+    vtkLogF(ERROR, "Invalid data were accepted.");
+    return false;
+  }
+  return true;
+}
+
+double Benchmark(bool pool, int count)
+{
+  vtkClientServerStream::SetUseStoragePool(pool);
+  const auto start = std::chrono::steady_clock::now();
+  for (int cc = 0; cc < count; ++cc)
+  {
+    vtkClientServerStream stream;
+    Build(stream, cc);
+    vtkClientServerStream copy;
+    if (!RoundTrip(stream, copy) || !Check(copy, cc))
+    {
+      vtkLogF(ERROR, "Round-trip failed.");
+      return 0;
+    }
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return count / std::max(elapsed.count(), 1e-9);
+}
+}
+
+int TestStreamStoragePool(int, char*[])
+{
+  const int count = 100000;
+  for (bool pool : { false, true })
+  {
+    vtkClientServerStream::SetUseStoragePool(pool);
+    if (!TestSemantics())
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  const double withoutPool = Benchmark(false, count);
+  const double withPool = Benchmark(true, count);
+  if (withoutPool == 0 || withPool == 0)
+  {
+    return EXIT_FAILURE;
+  }
+  vtkLogF(INFO, "without storage pool: %g round-trips/s", withoutPool);
+  vtkLogF(INFO, "with storage pool: %g round-trips/s", withPool);
+  return EXIT_SUCCESS;
+}
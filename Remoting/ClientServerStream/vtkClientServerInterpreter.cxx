@@ -10,9 +10,10 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
-#include <map>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 vtkStandardNewMacro(vtkClientServerInterpreter);
@@ -58,12 +59,70 @@ public:
   };
   typedef FunctionWithContext<vtkClientServerNewInstanceFunction> NewInstanceFunction;
   typedef FunctionWithContext<vtkClientServerCommandFunction> CommandFunction;
-  typedef std::map<std::string, const NewInstanceFunction*> NewInstanceFunctionsType;
-  typedef std::map<std::string, const CommandFunction*> ClassToFunctionMapType;
-  typedef std::map<vtkTypeUInt32, vtkClientServerStream*> IDToMessageMapType;
+  typedef std::unordered_map<std::string, const NewInstanceFunction*> NewInstanceFunctionsType;
+  typedef std::unordered_map<std::string, const CommandFunction*> ClassToFunctionMapType;
+  typedef std::unordered_map<vtkTypeUInt32, vtkClientServerStream*> IDToMessageMapType;
   NewInstanceFunctionsType NewInstanceFunctions;
   ClassToFunctionMapType ClassToFunctionMap;
   IDToMessageMapType IDToMessageMap;
+
+  // Methods implemented by the command function of each class, as registered
+  // with AddCommandMethodIds.
+  struct ClassMethods
+  {
+    std::string Superclass;
+    std::unordered_set<vtkTypeUInt32> MethodIds;
+  };
+  std::unordered_map<std::string, ClassMethods> ClassToMethodsMap;
+
+  // The command function that implements a method for the command function
+  // of an object's class, resolved on first invocation.
+  typedef std::unordered_map<vtkTypeUInt32, const CommandFunction*> ResolvedMethodsType;
+  std::unordered_map<const CommandFunction*, ResolvedMethodsType> ResolvedMethods;
+
+  const CommandFunction* Resolve(
+    const std::string& cname, const CommandFunction* function, vtkTypeUInt32 methodId)
+  {
+    ResolvedMethodsType& resolved = this->ResolvedMethods[function];
+    auto iter = resolved.find(methodId);
+    if (iter != resolved.end())
+    {
+      return iter->second;
+    }
+
+    // Walk up the superclasses until one implements the method. Classes that
+    // did not register their methods may implement anything, so the dispatch
+    // then starts from the object's class, as do methods that no class
+    // implements so that the error names the object's class.
+    const CommandFunction* target = function;
+    auto methods = this->ClassToMethodsMap.find(cname);
+    while (methods != this->ClassToMethodsMap.end())
+    {
+      if (methods->second.MethodIds.count(methodId))
+      {
+        auto f = this->ClassToFunctionMap.find(methods->first);
+        if (f != this->ClassToFunctionMap.end())
+        {
+          target = f->second;
+        }
+        break;
+      }
+      if (methods->second.Superclass.empty())
+      {
+        break;
+      }
+      methods = this->ClassToMethodsMap.find(methods->second.Superclass);
+    }
+    resolved[methodId] = target;
+    return target;
+  }
+
+  int Call(const CommandFunction* function, vtkClientServerInterpreter* self, vtkObjectBase* ptr,
+    const char* method, const vtkClientServerStream& msg, vtkClientServerStream& result)
+  {
+    void* ctx = function->Context ? function->Context->Context : nullptr;
+    return function->Function(self, ptr, method, msg, result, ctx);
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -148,17 +207,18 @@ vtkObjectBase* vtkClientServerInterpreter::GetObjectFromID(vtkClientServerID id,
 //----------------------------------------------------------------------------
 vtkClientServerID vtkClientServerInterpreter::GetIDFromObject(vtkObjectBase* key)
 {
-  // Search the hash table for the given object.
+  // Search the hash table for the given object. The table is not ordered, so
+  // keep looking for the smallest ID referring to the object.
   vtkClientServerID result;
   vtkClientServerInterpreterInternals::IDToMessageMapType::iterator hi;
   for (hi = this->Internal->IDToMessageMap.begin(); hi != this->Internal->IDToMessageMap.end();
        ++hi)
   {
     vtkObjectBase* obj;
-    if (hi->second->GetArgument(0, 0, &obj) && obj == key)
+    if ((result.ID == 0 || hi->first < result.ID) && hi->second->GetArgument(0, 0, &obj) &&
+      obj == key)
     {
       result.ID = hi->first;
-      break;
     }
   }
   return result;
@@ -407,10 +467,28 @@ int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream
     }
 
     // Find the command function for this object's type.
-    if (obj && this->HasCommandFunction(obj->GetClassName()))
+    vtkClientServerInterpreterInternals::ClassToFunctionMapType::const_iterator f =
+      this->Internal->ClassToFunctionMap.end();
+    if (obj && obj->GetClassName())
+    {
+      f = this->Internal->ClassToFunctionMap.find(obj->GetClassName());
+    }
+    if (f != this->Internal->ClassToFunctionMap.end())
     {
-      if (this->CallCommandFunction(
-            obj->GetClassName(), obj, method, msg, *this->LastResultMessage))
+      // Skip the superclasses known not to implement the method.
+      const vtkClientServerInterpreterInternals::CommandFunction* target =
+        this->Internal->Resolve(f->first, f->second, this->GetMethodId(method));
+      if (target != f->second)
+      {
+        if (this->Internal->Call(target, this, obj, method, msg, *this->LastResultMessage))
+        {
+          return 1;
+        }
+        // Arguments did not match, dispatch from the object's class so that
+        // the error is reported as usual.
+        this->LastResultMessage->Reset();
+      }
+      if (this->Internal->Call(f->second, this, obj, method, msg, *this->LastResultMessage))
       {
         return 1;
       }
@@ -766,6 +844,39 @@ void vtkClientServerInterpreter::AddCommandFunction(const char* cname,
 
   this->Internal->ClassToFunctionMap[cname] =
     new vtkClientServerInterpreterInternals::CommandFunction(func, context);
+  this->Internal->ResolvedMethods.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkClientServerInterpreter::AddCommandMethodIds(
+  const char* cname, const char* superclass, const vtkTypeUInt32* ids, int numberOfIds)
+{
+  if (!cname)
+  {
+    return;
+  }
+  vtkClientServerInterpreterInternals::ClassMethods& methods =
+    this->Internal->ClassToMethodsMap[cname];
+  methods.Superclass = superclass ? superclass : "";
+  methods.MethodIds.clear();
+  if (ids)
+  {
+    methods.MethodIds.insert(ids, ids + numberOfIds);
+  }
+  this->Internal->ResolvedMethods.clear();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt32 vtkClientServerInterpreter::GetMethodId(const char* method)
+{
+  // 32-bit FNV-1a, must match the hash computed by vtkWrapClientServer.
+  vtkTypeUInt32 hash = 2166136261u;
+  for (const unsigned char* c = reinterpret_cast<const unsigned char*>(method); c && *c; ++c)
+  {
+    hash ^= *c;
+    hash *= 16777619u;
+  }
+  return hash;
 }
 
 //----------------------------------------------------------------------------
@@ -791,11 +902,7 @@ int vtkClientServerInterpreter::CallCommandFunction(const char* cname, vtkObject
     return 1;
   }
 
-  const vtkClientServerInterpreterInternals::CommandFunction* n = f->second;
-
-  vtkClientServerCommandFunction function = n->Function;
-  void* ctx = n->Context ? n->Context->Context : nullptr;
-  return function(this, ptr, method, msg, result, ctx);
+  return this->Internal->Call(f->second, this, ptr, method, msg, result);
 }
 
 void vtkClientServerInterpreter::AddNewInstanceFunction(const char* name,
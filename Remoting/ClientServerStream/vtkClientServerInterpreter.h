@@ -129,6 +129,22 @@ public:
   void AddCommandFunction(const char* cname, vtkClientServerCommandFunction func,
     void* ctx = nullptr, vtkContextFreeFunction ctx_free = nullptr);
 
+  /**
+   * Called by generated code to register the ids of the methods implemented
+   * by the command function of a class, as returned by GetMethodId, and the
+   * superclass its command function falls back to. Invocations then skip the
+   * command functions of the classes that do not implement the method.
+   * Classes that do not register their methods are assumed to implement all
+   * of them.
+   */
+  void AddCommandMethodIds(
+    const char* cname, const char* superclass, const vtkTypeUInt32* ids, int numberOfIds);
+
+  /**
+   * Return the id of a method name used to dispatch invocations.
+   */
+  static vtkTypeUInt32 GetMethodId(const char* method);
+
   /**
    * Return true if the classname has a command function, false otherwise.
    */
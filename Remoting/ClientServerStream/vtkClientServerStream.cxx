@@ -13,6 +13,8 @@
 #include "vtkVariantExtract.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <typeinfo>
@@ -241,11 +243,93 @@ const vtkClientServerStreamInternals::ValueOffsetsType::size_type
   vtkClientServerStreamInternals::InvalidStartIndex =
     static_cast<vtkClientServerStreamInternals::ValueOffsetsType::size_type>(-1);
 
+//----------------------------------------------------------------------------
+// Pool of the internal representations of destroyed streams.  They are reused
+// with the storage they allocated by new streams, so that building the many
+// short-lived streams sent for each property or invocation does not allocate.
+namespace
+{
+// Streams with larger storage release it rather than keep it around.
+const size_t vtkClientServerStreamPoolMaximumCapacity = 64 * 1024;
+const size_t vtkClientServerStreamPoolMaximumSize = 64;
+
+std::atomic<bool> vtkClientServerStreamPoolEnabled(true);
+// Trivially destructible, so still valid for streams destroyed after the pool.
+bool vtkClientServerStreamPoolDestroyed = false;
+
+class vtkClientServerStreamPool
+{
+public:
+  ~vtkClientServerStreamPool()
+  {
+    this->Clear();
+    vtkClientServerStreamPoolDestroyed = true;
+  }
+
+  static vtkClientServerStreamPool& GetInstance()
+  {
+    static vtkClientServerStreamPool instance;
+    return instance;
+  }
+
+  vtkClientServerStreamInternals* Acquire(vtkObjectBase* owner)
+  {
+    if (vtkClientServerStreamPoolEnabled && !vtkClientServerStreamPoolDestroyed)
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      if (!this->Internals.empty())
+      {
+        vtkClientServerStreamInternals* internals = this->Internals.back();
+        this->Internals.pop_back();
+        internals->Objects.Owner = owner;
+        return internals;
+      }
+    }
+    return new vtkClientServerStreamInternals(owner);
+  }
+
+  void Release(vtkClientServerStreamInternals* internals)
+  {
+    if (vtkClientServerStreamPoolEnabled && !vtkClientServerStreamPoolDestroyed &&
+      internals->Data.capacity() <= vtkClientServerStreamPoolMaximumCapacity)
+    {
+      internals->Objects.Clear();
+      internals->Objects.Owner = nullptr;
+      internals->String.clear();
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      if (this->Internals.size() < vtkClientServerStreamPoolMaximumSize)
+      {
+        this->Internals.push_back(internals);
+        return;
+      }
+    }
+    delete internals;
+  }
+
+  void Clear()
+  {
+    std::vector<vtkClientServerStreamInternals*> internals;
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      std::swap(internals, this->Internals);
+    }
+    for (auto item : internals)
+    {
+      delete item;
+    }
+  }
+
+private:
+  std::mutex Mutex;
+  std::vector<vtkClientServerStreamInternals*> Internals;
+};
+}
+
 //----------------------------------------------------------------------------
 vtkClientServerStream::vtkClientServerStream(vtkObjectBase* owner)
 {
   // Initialize the internal representation of the stream.
-  this->Internal = new vtkClientServerStreamInternals(owner);
+  this->Internal = vtkClientServerStreamPool::GetInstance().Acquire(owner);
   this->Reserve(1024);
   this->Reset();
 }
@@ -253,14 +337,34 @@ vtkClientServerStream::vtkClientServerStream(vtkObjectBase* owner)
 //----------------------------------------------------------------------------
 vtkClientServerStream::~vtkClientServerStream()
 {
-  delete this->Internal;
+  vtkClientServerStreamPool::GetInstance().Release(this->Internal);
 }
 
 //----------------------------------------------------------------------------
 vtkClientServerStream::vtkClientServerStream(const vtkClientServerStream& r, vtkObjectBase* owner)
 {
   // Allocate and copy the internal representation of the stream.
-  this->Internal = new vtkClientServerStreamInternals(*r.Internal, owner);
+  this->Internal = vtkClientServerStreamPool::GetInstance().Acquire(owner);
+  *this->Internal = *r.Internal;
+}
+
+//----------------------------------------------------------------------------
+vtkClientServerStream::vtkClientServerStream(vtkClientServerStream&& r) noexcept
+{
+  if (r.Internal->Objects.Owner == nullptr)
+  {
+    // Take the internal representation, the objects are not referenced.
+    this->Internal = r.Internal;
+    r.Internal = vtkClientServerStreamPool::GetInstance().Acquire(nullptr);
+    r.Reset();
+  }
+  else
+  {
+    // The objects are referenced by the owner of the other stream.
+    this->Internal = vtkClientServerStreamPool::GetInstance().Acquire(nullptr);
+    *this->Internal = *r.Internal;
+    r.Reset();
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -270,6 +374,43 @@ vtkClientServerStream& vtkClientServerStream::operator=(const vtkClientServerStr
   return *this;
 }
 
+//----------------------------------------------------------------------------
+vtkClientServerStream& vtkClientServerStream::operator=(vtkClientServerStream&& that) noexcept
+{
+  if (this == &that)
+  {
+    return *this;
+  }
+  if (this->Internal->Objects.Owner == that.Internal->Objects.Owner)
+  {
+    std::swap(this->Internal, that.Internal);
+    that.Reset();
+  }
+  else
+  {
+    // The objects are referenced by the owner of the other stream.
+    *this->Internal = *that.Internal;
+    that.Reset();
+  }
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+void vtkClientServerStream::SetUseStoragePool(bool use)
+{
+  vtkClientServerStreamPoolEnabled = use;
+  if (!use && !vtkClientServerStreamPoolDestroyed)
+  {
+    vtkClientServerStreamPool::GetInstance().Clear();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkClientServerStream::GetUseStoragePool()
+{
+  return vtkClientServerStreamPoolEnabled;
+}
+
 //----------------------------------------------------------------------------
 void vtkClientServerStream::Copy(const vtkClientServerStream* source)
 {
@@ -305,8 +446,17 @@ void vtkClientServerStream::Reserve(size_t size)
 //----------------------------------------------------------------------------
 void vtkClientServerStream::Reset()
 {
-  // Empty the entire stream.
-  vtkClientServerStreamInternals::DataType().swap(this->Internal->Data);
+  // Empty the entire stream.  The storage is kept for the next messages
+  // unless it is too large or storage is not pooled.
+  if (vtkClientServerStreamPoolEnabled &&
+    this->Internal->Data.capacity() <= vtkClientServerStreamPoolMaximumCapacity)
+  {
+    this->Internal->Data.clear();
+  }
+  else
+  {
+    vtkClientServerStreamInternals::DataType().swap(this->Internal->Data);
+  }
 
   this->Internal->ValueOffsets.erase(
     this->Internal->ValueOffsets.begin(), this->Internal->ValueOffsets.end());
@@ -1481,16 +1631,27 @@ int vtkClientServerStream::GetData(const unsigned char** data, size_t* length) c
 //----------------------------------------------------------------------------
 int vtkClientServerStream::SetData(const unsigned char* data, size_t length)
 {
-  // Reset and remove the byte order entry from the stream.
-  this->Reset();
-  this->Internal->Data.erase(this->Internal->Data.begin(), this->Internal->Data.end());
-
   // Store the given data in the stream.
-  if (data)
+  unsigned char* buffer = this->BeginSetData(data ? length : 0);
+  if (data && length > 0)
   {
-    this->Internal->Data.insert(this->Internal->Data.begin(), data, data + length);
+    memcpy(buffer, data, length);
   }
+  return this->EndSetData();
+}
+
+//----------------------------------------------------------------------------
+unsigned char* vtkClientServerStream::BeginSetData(size_t length)
+{
+  // Reset and replace the byte order entry with room for the data.
+  this->Reset();
+  this->Internal->Data.resize(length);
+  return length > 0 ? this->Internal->Data.data() : nullptr;
+}
 
+//----------------------------------------------------------------------------
+int vtkClientServerStream::EndSetData()
+{
   // Parse the stream to fill in ValueOffsets and MessageIndexes and
   // to perform byte-swapping if necessary.
   if (this->ParseData())
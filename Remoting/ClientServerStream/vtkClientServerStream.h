@@ -40,6 +40,28 @@ public:
   vtkClientServerStream& operator=(const vtkClientServerStream&);
   ///@}
 
+  ///@{
+  /**
+   * Move constructor and assignment operator take the stream data without
+   * copying it, unless the objects stored in the stream are referenced by a
+   * different owner.  The moved-from stream is left empty.
+   */
+  vtkClientServerStream(vtkClientServerStream&&) noexcept;
+  vtkClientServerStream& operator=(vtkClientServerStream&&) noexcept;
+  ///@}
+
+  ///@{
+  /**
+   * Enable/disable the pooling of stream storage.  When enabled, the default,
+   * the storage of destroyed streams is kept in a pool and reused by new
+   * streams, and resetting a stream keeps its storage, so that building
+   * streams does not allocate memory once the pool is warm.  Only streams
+   * smaller than 64 KiB keep their storage.
+   */
+  static void SetUseStoragePool(bool use);
+  static bool GetUseStoragePool();
+  ///@}
+
   /**
    * Enumeration of message types that may be stored in a stream.
    * This must be kept in sync with the string table in this class's
@@ -307,6 +329,18 @@ public:
    */
   int SetData(const unsigned char* data, size_t length);
 
+  ///@{
+  /**
+   * Construct the entire stream from data written directly into its storage,
+   * e.g. when receiving it from a socket, rather than copied with SetData.
+   * BeginSetData destroys any data already in the stream and returns a
+   * buffer of the given length to fill with the data.  EndSetData then parses
+   * the data and returns whether the stream is deemed valid, as SetData does.
+   */
+  unsigned char* BeginSetData(size_t length);
+  int EndSetData();
+  ///@}
+
   //--------------------------------------------------------------------------
   // Utility methods:
 
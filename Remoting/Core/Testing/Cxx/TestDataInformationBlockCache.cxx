@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> GetPolyData(int index)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(index, 0, 0);
+  sphere->Update();
+
+  vtkSmartPointer<vtkPolyData> pd = sphere->GetOutput();
+  vtkNew<vtkDoubleArray> array;
+  array->SetName("values");
+  array->SetNumberOfTuples(pd->GetNumberOfPoints());
+  array->FillValue(index);
+  pd->GetPointData()->AddArray(array);
+  return pd;
+}
+
+bool CheckStatistics(const char* step, vtkTypeInt64 hits, vtkTypeInt64 misses)
+{
+  const bool valid = vtkPVDataInformation::GetBlockCacheHits() == hits &&
+    vtkPVDataInformation::GetBlockCacheMisses() == misses;
+  if (!valid)
+  {
+    cerr << "ERROR: " << step << ": expected " << hits << " hits and " << misses
+         << " misses, got " << vtkPVDataInformation::GetBlockCacheHits() << " hits and "
+         << vtkPVDataInformation::GetBlockCacheMisses() << " misses." << endl;
+  }
+  vtkPVDataInformation::ResetBlockCacheStatistics();
+  return valid;
+}
+}
+
+int TestDataInformationBlockCache(int, char*[])
+{
+  const int numBlocks = 10;
+  vtkNew<vtkMultiBlockDataSet> data;
+  for (int cc = 0; cc < numBlocks; ++cc)
+  {
+    data->SetBlock(cc, GetPolyData(cc));
+  }
+
+  // the cache is disabled by default.
+  vtkNew<vtkPVDataInformation> info;
+  info->CopyFromObject(data);
+  if (!CheckStatistics("gather with default settings", 0, 0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkPVDataInformation::SetUseBlockCache(true);
+  vtkPVDataInformation::ClearBlockCache();
+  vtkPVDataInformation::ResetBlockCacheStatistics();
+
+  info->CopyFromObject(data);
+  if (!CheckStatistics("first gather", 0, numBlocks))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // nothing changed, all blocks must be reused and the result must be identical.
+  vtkNew<vtkPVDataInformation> info2;
+  info2->CopyFromObject(data);
+  if (!CheckStatistics("second gather", numBlocks, 0))
+  {
+    return EXIT_FAILURE;
+  }
+  if (info2->GetNumberOfPoints() != info->GetNumberOfPoints() ||
+    info2->GetNumberOfDataSets() != numBlocks || info2->GetMemorySize() != info->GetMemorySize())
+  {
+    cerr << "ERROR: cached information does not match." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // modify a single array, only that block must be gathered again.
+  auto array = vtkDoubleArray::SafeDownCast(
+    vtkPolyData::SafeDownCast(data->GetBlock(3))->GetPointData()->GetArray("values"));
+  array->SetValue(0, 100.0);
+  array->Modified();
+  info2->CopyFromObject(data);
+  if (!CheckStatistics("gather after modification", numBlocks - 1, 1))
+  {
+    return EXIT_FAILURE;
+  }
+  double range[2];
+  info2->GetArrayInformation("values", vtkDataObject::POINT)->GetComponentRange(0, range);
+  if (range[0] != 0.0 || range[1] != 100.0)
+  {
+    cerr << "ERROR: invalid range after modification: " << range[0] << ", " << range[1] << endl;
+    return EXIT_FAILURE;
+  }
+
+  // disabling the cache must gather everything again.
+  vtkPVDataInformation::SetUseBlockCache(false);
+  info2->CopyFromObject(data);
+  if (!CheckStatistics("gather without cache", 0, 0) ||
+    info2->GetNumberOfPoints() != info->GetNumberOfPoints())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
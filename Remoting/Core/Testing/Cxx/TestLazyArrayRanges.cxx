@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkClientServerStream.h"
+#include "vtkDoubleArray.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+
+namespace
+{
+void AddArray(vtkPolyData* pd, const char* name, double value)
+{
+  vtkNew<vtkDoubleArray> array;
+  array->SetName(name);
+  array->SetNumberOfTuples(pd->GetNumberOfPoints());
+  array->FillValue(0.0);
+  array->SetValue(0, value);
+  pd->GetPointData()->AddArray(array);
+}
+
+bool CheckRange(vtkPVArrayInformation* ainfo, bool hasRanges, double max)
+{
+  if (ainfo == nullptr || ainfo->GetHasRanges() != hasRanges)
+  {
+    cerr << "ERROR: unexpected ranges state for " << (ainfo ? ainfo->GetName() : "(null)") << endl;
+    return false;
+  }
+  if (hasRanges && ainfo->GetComponentRange(0)[1] != max)
+  {
+    cerr << "ERROR: invalid range for " << ainfo->GetName() << ": "
+         << ainfo->GetComponentRange(0)[1] << " != " << max << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestLazyArrayRanges(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->Update();
+  vtkNew<vtkPolyData> pd;
+  pd->ShallowCopy(sphere->GetOutput());
+  AddArray(pd, "first", 10.0);
+  AddArray(pd, "second", 20.0);
+
+  vtkPVDataInformation::SetUseBlockCache(false);
+
+  // request the range for "second" only, and pass the request through a
+  // parameters stream as done when gathering information from the server.
+  vtkNew<vtkPVDataInformation> request;
+  request->ComputeArrayRangesOff();
+  request->AddRangeArray(vtkDataObject::FIELD_ASSOCIATION_POINTS, "second");
+  vtkMultiProcessStream parameters;
+  request->CopyParametersToStream(parameters);
+
+  vtkNew<vtkPVDataInformation> info;
+  info->CopyParametersFromStream(parameters);
+  info->CopyFromObject(pd);
+
+  vtkClientServerStream css;
+  info->CopyToStream(&css);
+  vtkNew<vtkPVDataInformation> result;
+  result->CopyFromStream(&css);
+
+  vtkPVDataInformation::SetUseBlockCache(true);
+
+  auto first = result->GetArrayInformation("first", vtkDataObject::FIELD_ASSOCIATION_POINTS);
+  auto second = result->GetArrayInformation("second", vtkDataObject::FIELD_ASSOCIATION_POINTS);
+  if (!CheckRange(first, false, 0) || !CheckRange(second, true, 20.0))
+  {
+    return EXIT_FAILURE;
+  }
+  if (first->GetNumberOfComponents() != 1 || first->GetNumberOfTuples() != pd->GetNumberOfPoints())
+  {
+    cerr << "ERROR: array information without ranges is incomplete." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // fill in the missing range as vtkSMOutputPort does.
+  vtkNew<vtkPVDataInformation> full;
+  full->CopyFromObject(pd);
+  first->CopyRangesFrom(
+    full->GetArrayInformation("first", vtkDataObject::FIELD_ASSOCIATION_POINTS));
+  if (!CheckRange(first, true, 10.0))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
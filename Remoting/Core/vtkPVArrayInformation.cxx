@@ -58,6 +58,7 @@ void vtkPVArrayInformation::Initialize()
   this->DataType = -1;
   this->NumberOfTuples = 0;
   this->IsPartial = false;
+  this->HasRanges = true;
   this->Components.clear();
   this->StringValues.clear();
   this->InformationKeys.clear();
@@ -74,6 +75,7 @@ void vtkPVArrayInformation::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "NumberOfComponents: " << this->Components.size() << endl;
   os << indent << "NumberOfTuples: " << this->NumberOfTuples << endl;
   os << indent << "IsPartial: " << this->IsPartial << endl;
+  os << indent << "HasRanges: " << this->HasRanges << endl;
   os << indent << "InformationKeys (count=" << this->InformationKeys.size() << "):" << endl;
   for (auto& pair : this->InformationKeys)
   {
@@ -245,6 +247,7 @@ void vtkPVArrayInformation::DeepCopy(vtkPVArrayInformation* other)
   this->DataType = other->DataType;
   this->NumberOfTuples = other->NumberOfTuples;
   this->IsPartial = other->IsPartial;
+  this->HasRanges = other->HasRanges;
   this->Components = other->Components;
   this->StringValues = other->StringValues;
   this->InformationKeys = other->InformationKeys;
@@ -280,6 +283,7 @@ struct vtkPVArrayInformation::GetRangeFunctor
   vtkAbstractArray* Array = nullptr;
   vtkFieldData* FieldData = nullptr;
   int ArrayIdx = -1;
+  bool ComputeRanges = true;
 };
 
 //----------------------------------------------------------------------------
@@ -315,7 +319,11 @@ void vtkPVArrayInformation::CopyFromArrayInternal(
   }
 
   auto dataArray = vtkDataArray::SafeDownCast(array);
-  if (dataArray && dataArray->IsNumeric())
+  if (dataArray && dataArray->IsNumeric() && !getRangeFn.ComputeRanges)
+  {
+    this->HasRanges = false;
+  }
+  else if (dataArray && dataArray->IsNumeric())
   {
     for (int comp = -1; comp < numComponents; ++comp)
     {
@@ -362,6 +370,13 @@ void vtkPVArrayInformation::CopyFromArray(vtkAbstractArray* array)
 
 //----------------------------------------------------------------------------
 void vtkPVArrayInformation::CopyFromArray(vtkFieldData* fieldData, int fdArrayIdx)
+{
+  this->CopyFromArray(fieldData, fdArrayIdx, true);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVArrayInformation::CopyFromArray(
+  vtkFieldData* fieldData, int fdArrayIdx, bool computeRanges)
 {
   assert(fieldData != nullptr);
   assert(fdArrayIdx >= 0 && fdArrayIdx < fieldData->GetNumberOfArrays());
@@ -372,6 +387,7 @@ void vtkPVArrayInformation::CopyFromArray(vtkFieldData* fieldData, int fdArrayId
   rangeFn.Array = array;
   rangeFn.ArrayIdx = fdArrayIdx;
   rangeFn.FieldData = fieldData;
+  rangeFn.ComputeRanges = computeRanges;
 
   this->CopyFromArrayInternal(array, rangeFn);
 }
@@ -446,6 +462,7 @@ void vtkPVArrayInformation::CopyToStream(vtkClientServerStream* css) const
   *css << this->DataType;
   *css << this->NumberOfTuples;
   *css << this->IsPartial;
+  *css << this->HasRanges;
   *css << static_cast<int>(this->Components.size());
 
   // components
@@ -483,7 +500,8 @@ bool vtkPVArrayInformation::CopyFromStream(const vtkClientServerStream* css)
   if (!css->GetArgument(0, argument++, &this->Name) ||
     !css->GetArgument(0, argument++, &this->DataType) ||
     !css->GetArgument(0, argument++, &this->NumberOfTuples) ||
-    !css->GetArgument(0, argument++, &this->IsPartial))
+    !css->GetArgument(0, argument++, &this->IsPartial) ||
+    !css->GetArgument(0, argument++, &this->HasRanges))
   {
     vtkErrorMacro("Error parsing message.");
     return false;
@@ -576,6 +594,7 @@ void vtkPVArrayInformation::AddInformation(vtkPVArrayInformation* other, int fie
   // different types often; so this check is not reasonable.
   // Fixes pv.ColorOpacityTableEditorHistogram test.
   // assert(this->DataType == other->DataType);
+  this->HasRanges = this->HasRanges && other->HasRanges;
   if (fieldAssociation == vtkDataObject::FIELD)
   {
     this->NumberOfTuples = std::max(this->NumberOfTuples, other->NumberOfTuples);
@@ -609,6 +628,43 @@ void vtkPVArrayInformation::AddInformation(vtkPVArrayInformation* other, int fie
   this->InformationKeys.insert(other->InformationKeys.begin(), other->InformationKeys.end());
 }
 
+//----------------------------------------------------------------------------
+void vtkPVArrayInformation::CopyRangesFrom(vtkPVArrayInformation* other)
+{
+  if (other == nullptr || !other->HasRanges)
+  {
+    return;
+  }
+  if (this->Components.size() != other->Components.size())
+  {
+    vtkErrorMacro("Cannot copy ranges from array '" << other->Name
+                                                    << "' with a different number of components.");
+    return;
+  }
+  for (size_t cc = 0; cc < this->Components.size(); ++cc)
+  {
+    this->Components[cc].Range = other->Components[cc].Range;
+    this->Components[cc].FiniteRange = other->Components[cc].FiniteRange;
+  }
+  this->HasRanges = true;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVArrayInformation::SetComponentRange(int comp, const double range[2])
+{
+  if (comp < -1 || comp + 1 >= static_cast<int>(this->Components.size()))
+  {
+    vtkErrorMacro("Invalid component number " << comp);
+    return;
+  }
+  auto& info = this->Components[comp + 1];
+  info.Range = vtkTuple<double, 2>(range);
+  info.FiniteRange = vtkTuple<double, 2>(range);
+  this->HasRanges = true;
+  this->Modified();
+}
+
 //----------------------------------------------------------------------------
 int vtkPVArrayInformation::GetNumberOfInformationKeys() const
 {
@@ -108,6 +108,28 @@ public:
    */
   void GetDataTypeRange(double range[2]) const;
 
+  /**
+   * Returns false if the component ranges were not computed, which happens
+   * when the information was gathered with
+   * `vtkPVDataInformation::ComputeArrayRanges` off and ranges were not
+   * requested for this array. Ranges are invalid in that case.
+   */
+  vtkGetMacro(HasRanges, bool);
+
+  /**
+   * Copies the component ranges from `other`, which must describe the same
+   * array with ranges computed. This is used to fill in ranges gathered on
+   * demand.
+   */
+  void CopyRangesFrom(vtkPVArrayInformation* other);
+
+  /**
+   * Overrides both the range and the finite range of a component, or of the
+   * magnitude if component is `-1`. This is used for ranges computed
+   * elsewhere, e.g. over several timesteps.
+   */
+  void SetComponentRange(int comp, const double range[2]);
+
   ///@{
   /**
    * If IsPartial is true, this array is in only some of the
@@ -166,6 +188,7 @@ protected:
   void DeepCopy(vtkPVArrayInformation* info);
   void AddInformation(vtkPVArrayInformation*, int fieldAssociation);
   vtkSetMacro(IsPartial, bool);
+  void CopyFromArray(vtkFieldData* fieldData, int fdArrayIdx, bool computeRanges);
   ///@}
 
   vtkSetMacro(Name, std::string);
@@ -175,6 +198,7 @@ private:
   int DataType = -1;
   vtkTypeInt64 NumberOfTuples = 0;
   bool IsPartial = false;
+  bool HasRanges = true;
 
   struct ComponentInfo
   {
@@ -21,6 +21,7 @@
 #include "vtkExecutive.h"
 #include "vtkExplicitStructuredGrid.h"
 #include "vtkExtractBlockUsingDataAssembly.h"
+#include "vtkFieldData.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
@@ -37,19 +38,113 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUniformGridAMR.h"
+#include "vtkWeakPointer.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <iterator>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+namespace
+{
+// Information gathered for leaf data objects, keyed on the data object. An
+// entry is only valid if the data object is still alive and has not been
+// modified since the entry was added.
+class vtkPVDataInformationBlockCache
+{
+  struct Entry
+  {
+    vtkWeakPointer<vtkDataObject> DataObject;
+    vtkMTimeType MTime;
+    vtkSmartPointer<vtkPVDataInformation> Information;
+  };
+  std::unordered_map<vtkDataObject*, Entry> Entries;
+  std::mutex Mutex;
+
+  // Entries for released data objects are only removed once the number of
+  // entries reaches this threshold, which then grows with the live entries.
+  static constexpr std::size_t MinimumPruneThreshold = 1024;
+  std::size_t PruneThreshold = MinimumPruneThreshold;
+
+  // Removes the entries for data objects that have been released. The mutex
+  // must be locked.
+  void Prune()
+  {
+    for (auto iter = this->Entries.begin(); iter != this->Entries.end();)
+    {
+      iter = iter->second.DataObject ? std::next(iter) : this->Entries.erase(iter);
+    }
+    this->PruneThreshold = std::max(MinimumPruneThreshold, 2 * this->Entries.size());
+  }
+
+public:
+  std::atomic<bool> Enabled{ false };
+  std::atomic<vtkTypeInt64> Hits{ 0 };
+  std::atomic<vtkTypeInt64> Misses{ 0 };
+
+  static vtkPVDataInformationBlockCache& GetInstance()
+  {
+    static vtkPVDataInformationBlockCache instance;
+    return instance;
+  }
+
+  static vtkMTimeType GetMTime(vtkDataObject* dobj)
+  {
+    // field data is not accounted for in vtkDataObject::GetMTime.
+    auto fd = dobj->GetFieldData();
+    return fd ? std::max(dobj->GetMTime(), fd->GetMTime()) : dobj->GetMTime();
+  }
+
+  vtkPVDataInformation* Find(vtkDataObject* dobj)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto iter = this->Entries.find(dobj);
+    if (iter != this->Entries.end() && iter->second.DataObject.GetPointer() == dobj &&
+      iter->second.MTime == GetMTime(dobj))
+    {
+      ++this->Hits;
+      return iter->second.Information;
+    }
+    ++this->Misses;
+    return nullptr;
+  }
+
+  void Insert(vtkDataObject* dobj, vtkPVDataInformation* info)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto& entry = this->Entries[dobj];
+    entry.DataObject = dobj;
+    entry.MTime = GetMTime(dobj);
+    entry.Information = info;
+    if (this->Entries.size() >= this->PruneThreshold)
+    {
+      this->Prune();
+    }
+  }
+
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Entries.clear();
+    this->PruneThreshold = MinimumPruneThreshold;
+  }
+};
+}
+
 class vtkPVDataInformationAccumulator
 {
   vtkNew<vtkPVDataInformation> Current;
 
 public:
   std::set<int> UniqueBlockTypes;
+  vtkTypeInt64 NumberOfReusedBlocks = 0;
+  vtkTypeInt64 NumberOfBlocks = 0;
+
   vtkPVDataInformation* operator()(vtkPVDataInformation* info, vtkDataObject* dobj)
   {
     if (!dobj)
@@ -58,17 +153,52 @@ public:
     }
     assert(vtkCompositeDataSet::SafeDownCast(dobj) == nullptr);
 
-    this->Current->Initialize();
-    this->Current->CopyFromDataObject(dobj);
-    if (this->Current->GetDataSetType() != -1)
+    ++this->NumberOfBlocks;
+    vtkPVDataInformation* current = this->Current;
+    auto& cache = vtkPVDataInformationBlockCache::GetInstance();
+    if (!cache.Enabled)
+    {
+      this->Current->Initialize();
+      this->CopyRangeParameters(info, this->Current);
+      this->Current->CopyFromDataObject(dobj);
+    }
+    else if (auto cached = cache.Find(dobj))
     {
-      assert(this->Current->GetCompositeDataSetType() == -1);
-      this->UniqueBlockTypes.insert(this->Current->GetDataSetType());
-      info->AddInformation(this->Current);
+      current = cached;
+      ++this->NumberOfReusedBlocks;
+    }
+    else
+    {
+      vtkNew<vtkPVDataInformation> blockInfo;
+      this->CopyRangeParameters(info, blockInfo);
+      blockInfo->CopyFromDataObject(dobj);
+      // only complete information is cached, so that it can be used for any request.
+      if (info->ComputeArrayRanges)
+      {
+        cache.Insert(dobj, blockInfo);
+      }
+      current = blockInfo;
+    }
+
+    if (current->GetDataSetType() != -1)
+    {
+      assert(current->GetCompositeDataSetType() == -1);
+      this->UniqueBlockTypes.insert(current->GetDataSetType());
+      info->AddInformation(current);
     }
     return info;
   }
 
+  void CopyRangeParameters(vtkPVDataInformation* source, vtkPVDataInformation* target)
+  {
+    target->ComputeArrayRanges = source->ComputeArrayRanges;
+    if (!source->ComputeArrayRanges)
+    {
+      std::copy(source->RangeArrays,
+        source->RangeArrays + vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES, target->RangeArrays);
+    }
+  }
+
   void AddFieldDataOnly(vtkPVDataInformation* info, vtkDataObject* dobj)
   {
     this->Current->Initialize();
@@ -149,7 +279,16 @@ vtkPVDataInformation::~vtkPVDataInformation()
 void vtkPVDataInformation::CopyParametersToStream(vtkMultiProcessStream& str)
 {
   str << 828792 << this->PortNumber << std::string(this->SubsetSelector ? SubsetSelector : "")
-      << std::string(this->SubsetAssemblyName ? this->SubsetAssemblyName : "") << this->Rank;
+      << std::string(this->SubsetAssemblyName ? this->SubsetAssemblyName : "") << this->Rank
+      << (this->ComputeArrayRanges ? 1 : 0);
+  for (const auto& names : this->RangeArrays)
+  {
+    str << static_cast<int>(names.size());
+    for (const auto& name : names)
+    {
+      str << name;
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -157,11 +296,25 @@ void vtkPVDataInformation::CopyParametersFromStream(vtkMultiProcessStream& str)
 {
   int magic_number;
   std::string path, name;
-  str >> magic_number >> this->PortNumber >> path >> name >> this->Rank;
+  int computeArrayRanges;
+  str >> magic_number >> this->PortNumber >> path >> name >> this->Rank >> computeArrayRanges;
   if (magic_number != 828792)
   {
     vtkErrorMacro("Magic number mismatch.");
   }
+  this->ComputeArrayRanges = computeArrayRanges != 0;
+  for (auto& names : this->RangeArrays)
+  {
+    int count;
+    str >> count;
+    names.clear();
+    for (int cc = 0; cc < count; ++cc)
+    {
+      std::string arrayName;
+      str >> arrayName;
+      names.insert(arrayName);
+    }
+  }
   this->SetSubsetSelector(path.empty() ? nullptr : path.c_str());
   this->SetSubsetAssemblyName(name.empty() ? nullptr : name.c_str());
 }
@@ -179,6 +332,7 @@ void vtkPVDataInformation::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "SubsetAssemblyName: "
      << (this->SubsetAssemblyName ? this->SubsetAssemblyName : "(nullptr)") << endl;
+  os << indent << "ComputeArrayRanges: " << this->ComputeArrayRanges << endl;
   os << indent << "DataSetType: " << this->DataSetType << endl;
   os << indent << "CompositeDataSetType: " << this->CompositeDataSetType << endl;
   os << indent << "FirstLeafCompositeIndex: " << this->FirstLeafCompositeIndex << endl;
@@ -462,6 +616,11 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
       accumulator.UniqueBlockTypes.begin(), accumulator.UniqueBlockTypes.end());
   }
 
+  vtkVLogF(PARAVIEW_LOG_PIPELINE_VERBOSITY(),
+    "data information: reused %lld of %lld blocks from cache",
+    static_cast<long long>(accumulator.NumberOfReusedBlocks),
+    static_cast<long long>(accumulator.NumberOfBlocks));
+
   // Copy information from `pipelineInfo`
   this->CopyFromPipelineInformation(pipelineInfo);
 
@@ -474,6 +633,75 @@ void vtkPVDataInformation::CopyFromObject(vtkObject* object)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::AddRangeArray(int fieldAssociation, const char* arrayName)
+{
+  if (fieldAssociation < 0 || fieldAssociation >= vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES ||
+    arrayName == nullptr)
+  {
+    vtkErrorMacro("Invalid array " << (arrayName ? arrayName : "(nullptr)")
+                                   << " or field association " << fieldAssociation);
+    return;
+  }
+  if (this->RangeArrays[fieldAssociation].insert(arrayName).second)
+  {
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ClearRangeArrays()
+{
+  for (auto& names : this->RangeArrays)
+  {
+    names.clear();
+  }
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::SetUseBlockCache(bool val)
+{
+  auto& cache = vtkPVDataInformationBlockCache::GetInstance();
+  cache.Enabled = val;
+  if (!val)
+  {
+    cache.Clear();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataInformation::GetUseBlockCache()
+{
+  return vtkPVDataInformationBlockCache::GetInstance().Enabled;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ClearBlockCache()
+{
+  vtkPVDataInformationBlockCache::GetInstance().Clear();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVDataInformation::GetBlockCacheHits()
+{
+  return vtkPVDataInformationBlockCache::GetInstance().Hits;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVDataInformation::GetBlockCacheMisses()
+{
+  return vtkPVDataInformationBlockCache::GetInstance().Misses;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ResetBlockCacheStatistics()
+{
+  auto& cache = vtkPVDataInformationBlockCache::GetInstance();
+  cache.Hits = 0;
+  cache.Misses = 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyFromPipelineInformation(vtkInformation* pinfo)
 {
@@ -522,7 +750,8 @@ void vtkPVDataInformation::CopyFromDataObject(vtkDataObject* dobj)
 
   for (int cc = 0; cc < vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES; ++cc)
   {
-    this->AttributeInformations[cc]->CopyFromDataObject(dobj);
+    this->AttributeInformations[cc]->CopyFromDataObject(
+      dobj, this->ComputeArrayRanges, this->RangeArrays[cc]);
     switch (cc)
     {
       case vtkDataObject::FIELD:
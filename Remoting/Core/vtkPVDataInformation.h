@@ -21,6 +21,7 @@
 #include "vtkSmartPointer.h"       // for vtkSmartPointer
 
 #include <set>    // for std::set
+#include <string> // for std::string
 #include <vector> // for std::vector
 
 class vtkCellGrid;
@@ -87,6 +88,22 @@ public:
   void SetSubsetAssemblyNameToHierarchy();
   ///@}
 
+  ///@{
+  /**
+   * When off, the component ranges of the arrays are not computed by
+   * `CopyFromObject`, except for the arrays added using `AddRangeArray`.
+   * Computing ranges is the most expensive part of gathering information for
+   * datasets with many arrays and can be skipped when only the names and
+   * types of the arrays are needed. `vtkPVArrayInformation::GetHasRanges`
+   * returns false for arrays without ranges. Default is on.
+   */
+  vtkSetMacro(ComputeArrayRanges, bool);
+  vtkGetMacro(ComputeArrayRanges, bool);
+  vtkBooleanMacro(ComputeArrayRanges, bool);
+  void AddRangeArray(int fieldAssociation, const char* arrayName);
+  void ClearRangeArrays();
+  ///@}
+
   /**
    * Populate vtkPVDataInformation using `object`. The object can be a
    * `vtkDataObject`, `vtkAlgorithm` or `vtkAlgorithmOutput`.
@@ -109,6 +126,31 @@ public:
    */
   void Initialize();
 
+  ///@{
+  /**
+   * Information gathered from each leaf data object is cached, keyed on the
+   * data object and its modification time. When gathering information for a
+   * composite dataset in which only a few blocks changed, the information for
+   * the unchanged blocks is reused and only the modified blocks are walked.
+   * The cache is shared by all instances and is disabled by default since it
+   * keeps the information of every block in memory until the block is released.
+   */
+  static void SetUseBlockCache(bool);
+  static bool GetUseBlockCache();
+  static void ClearBlockCache();
+  ///@}
+
+  ///@{
+  /**
+   * Returns the number of leaf data objects for which the cached information
+   * was reused (hits) or had to be gathered (misses) since the last call to
+   * `ResetBlockCacheStatistics`.
+   */
+  static vtkTypeInt64 GetBlockCacheHits();
+  static vtkTypeInt64 GetBlockCacheMisses();
+  static void ResetBlockCacheStatistics();
+  ///@}
+
   /**
    * Simply copies from another vtkPVDataInformation.
    */
@@ -493,6 +535,8 @@ private:
   int Rank = -1;
   char* SubsetSelector = nullptr;
   char* SubsetAssemblyName = nullptr;
+  bool ComputeArrayRanges = true;
+  std::set<std::string> RangeArrays[vtkDataObject::NUMBER_OF_ATTRIBUTE_TYPES];
 
   int DataSetType = -1;
   int CompositeDataSetType = -1;
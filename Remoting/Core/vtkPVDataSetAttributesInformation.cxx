@@ -148,7 +148,8 @@ void vtkPVDataSetAttributesInformation::DeepCopy(vtkPVDataSetAttributesInformati
 }
 
 //----------------------------------------------------------------------------
-void vtkPVDataSetAttributesInformation::CopyFromDataObject(vtkDataObject* dobj)
+void vtkPVDataSetAttributesInformation::CopyFromDataObject(
+  vtkDataObject* dobj, bool computeRanges, const std::set<std::string>& rangeArrays)
 {
   auto& internals = (*this->Internals);
 
@@ -196,7 +197,8 @@ void vtkPVDataSetAttributesInformation::CopyFromDataObject(vtkDataObject* dobj)
       if (array && !vtkSkipArray(array->GetName()))
       {
         vtkPVArrayInformation* ainfo = vtkPVArrayInformation::New();
-        ainfo->CopyFromArray(fd, cc);
+        ainfo->CopyFromArray(fd, cc,
+          computeRanges || rangeArrays.find(array->GetName()) != rangeArrays.end());
         internals.GetOrCreateArrayInformation(array->GetName()).TakeReference(ainfo);
       }
     }
@@ -18,6 +18,8 @@
 #include "vtkRemotingCoreModule.h" //needed for exports
 
 #include <memory> // For unique_ptr
+#include <set>    // For std::set
+#include <string> // For std::string
 
 class vtkClientServerStream;
 class vtkDataObject;
@@ -137,9 +139,12 @@ protected:
   void DeepCopy(vtkPVDataSetAttributesInformation*);
 
   /**
-   * Initializes this instance using the data object.
+   * Initializes this instance using the data object. When `computeRanges` is
+   * false, component ranges are only computed for arrays listed in
+   * `rangeArrays`.
    */
-  void CopyFromDataObject(vtkDataObject* dobj);
+  void CopyFromDataObject(vtkDataObject* dobj, bool computeRanges = true,
+    const std::set<std::string>& rangeArrays = std::set<std::string>());
 
 private:
   vtkPVDataSetAttributesInformation(const vtkPVDataSetAttributesInformation&) = delete;
@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVTemporalRangesInformation.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkClientServerStream.h"
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+
+vtkStandardNewMacro(vtkPVTemporalRangesInformation);
+//----------------------------------------------------------------------------
+vtkPVTemporalRangesInformation::vtkPVTemporalRangesInformation() = default;
+
+//----------------------------------------------------------------------------
+vtkPVTemporalRangesInformation::~vtkPVTemporalRangesInformation() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::AddTimeStep(double time)
+{
+  this->TimeSteps.push_back(time);
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::RemoveAllTimeSteps()
+{
+  this->TimeSteps.clear();
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::CopyParametersToStream(vtkMultiProcessStream& stream)
+{
+  this->Superclass::CopyParametersToStream(stream);
+  stream << this->PortNumber << this->FieldAssociation << this->ArrayName
+         << static_cast<unsigned int>(this->TimeSteps.size());
+  for (const double time : this->TimeSteps)
+  {
+    stream << time;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::CopyParametersFromStream(vtkMultiProcessStream& stream)
+{
+  this->Superclass::CopyParametersFromStream(stream);
+  unsigned int count;
+  stream >> this->PortNumber >> this->FieldAssociation >> this->ArrayName >> count;
+  this->TimeSteps.resize(count);
+  for (auto& time : this->TimeSteps)
+  {
+    stream >> time;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::CopyFromObject(vtkObject* object)
+{
+  this->Ranges.clear();
+
+  vtkAlgorithm* algo = vtkAlgorithm::SafeDownCast(object);
+  vtkAlgorithmOutput* port = vtkAlgorithmOutput::SafeDownCast(object);
+  if (algo)
+  {
+    port = algo->GetOutputPort(this->PortNumber);
+  }
+  if (!port)
+  {
+    vtkErrorMacro("vtkPVTemporalRangesInformation needs a vtkAlgorithm or "
+                  " a vtkAlgorithmOutput.");
+    return;
+  }
+
+  vtkStreamingDemandDrivenPipeline* sddp =
+    vtkStreamingDemandDrivenPipeline::SafeDownCast(port->GetProducer()->GetExecutive());
+  if (!sddp)
+  {
+    vtkErrorMacro("This class expects vtkStreamingDemandDrivenPipeline.");
+    return;
+  }
+
+  port->GetProducer()->UpdateInformation();
+  vtkInformation* pipelineInfo = port->GetProducer()->GetOutputInformation(port->GetIndex());
+  if (!pipelineInfo->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+  {
+    return;
+  }
+
+  const double* available = pipelineInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  const int length = pipelineInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  std::vector<double> timesteps(available, available + length);
+  if (!this->TimeSteps.empty())
+  {
+    timesteps.erase(std::remove_if(timesteps.begin(), timesteps.end(),
+                      [this](double time) {
+                        return std::find(this->TimeSteps.begin(), this->TimeSteps.end(), time) ==
+                          this->TimeSteps.end();
+                      }),
+      timesteps.end());
+  }
+
+  for (const double time : timesteps)
+  {
+    pipelineInfo->Set(sddp->UPDATE_TIME_STEP(), time);
+    sddp->Update(port->GetIndex());
+
+    // only the ranges of the requested array are computed.
+    vtkNew<vtkPVDataInformation> dinfo;
+    dinfo->SetComputeArrayRanges(false);
+    dinfo->AddRangeArray(this->FieldAssociation, this->ArrayName.c_str());
+    dinfo->CopyFromObject(port->GetProducer()->GetOutputDataObject(port->GetIndex()));
+
+    auto& ranges = this->Ranges[time];
+    vtkPVArrayInformation* ainfo =
+      dinfo->GetArrayInformation(this->ArrayName.c_str(), this->FieldAssociation);
+    if (ainfo && ainfo->GetHasRanges())
+    {
+      for (int comp = -1; comp < ainfo->GetNumberOfComponents(); ++comp)
+      {
+        const double* range = ainfo->GetComponentFiniteRange(comp);
+        ranges.push_back(range[0]);
+        ranges.push_back(range[1]);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::AddInformation(vtkPVInformation* other)
+{
+  auto otherInfo = vtkPVTemporalRangesInformation::SafeDownCast(other);
+  if (!otherInfo)
+  {
+    return;
+  }
+
+  for (const auto& item : otherInfo->Ranges)
+  {
+    auto& ranges = this->Ranges[item.first];
+    if (ranges.empty())
+    {
+      ranges = item.second;
+    }
+    else if (ranges.size() == item.second.size())
+    {
+      for (size_t cc = 0; cc < ranges.size(); cc += 2)
+      {
+        ranges[cc] = std::min(ranges[cc], item.second[cc]);
+        ranges[cc + 1] = std::max(ranges[cc + 1], item.second[cc + 1]);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::CopyToStream(vtkClientServerStream* css)
+{
+  css->Reset();
+  *css << vtkClientServerStream::Reply << static_cast<int>(this->Ranges.size());
+  for (const auto& item : this->Ranges)
+  {
+    *css << item.first << static_cast<int>(item.second.size());
+    if (!item.second.empty())
+    {
+      *css << vtkClientServerStream::InsertArray(
+        item.second.data(), static_cast<int>(item.second.size()));
+    }
+  }
+  *css << vtkClientServerStream::End;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::CopyFromStream(const vtkClientServerStream* css)
+{
+  this->Ranges.clear();
+
+  int argument = 0;
+  int count;
+  if (!css->GetArgument(0, argument++, &count))
+  {
+    vtkErrorMacro("Error parsing stream.");
+    return;
+  }
+  for (int cc = 0; cc < count; ++cc)
+  {
+    double time;
+    int length;
+    if (!css->GetArgument(0, argument++, &time) || !css->GetArgument(0, argument++, &length))
+    {
+      this->Ranges.clear();
+      vtkErrorMacro("Error parsing stream.");
+      return;
+    }
+    auto& ranges = this->Ranges[time];
+    ranges.resize(length);
+    if (length > 0 && !css->GetArgument(0, argument++, ranges.data(), length))
+    {
+      this->Ranges.clear();
+      vtkErrorMacro("Error parsing stream.");
+      return;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTemporalRangesInformation::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "PortNumber: " << this->PortNumber << endl;
+  os << indent << "FieldAssociation: " << this->FieldAssociation << endl;
+  os << indent << "ArrayName: " << this->ArrayName << endl;
+  os << indent << "Number of timesteps: " << this->Ranges.size() << endl;
+}
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkPVTemporalRangesInformation
+ * @brief gathers the range of an array at each timestep.
+ *
+ * vtkPVTemporalRangesInformation updates the pipeline at each of the requested
+ * timesteps, or at all the timesteps of the source when none are requested,
+ * and gathers the finite ranges of a single array. Unlike
+ * vtkPVTemporalDataInformation, which merges the information of all the
+ * timesteps, the ranges are kept per timestep so that they can be cached and
+ * only the missing timesteps are gathered later on.
+ *
+ * @sa vtkPVTemporalDataInformation
+ */
+
+#ifndef vtkPVTemporalRangesInformation_h
+#define vtkPVTemporalRangesInformation_h
+
+#include "vtkPVInformation.h"
+#include "vtkRemotingCoreModule.h" //needed for exports
+
+#include <map>    // for std::map
+#include <string> // for std::string
+#include <vector> // for std::vector
+
+class VTKREMOTINGCORE_EXPORT vtkPVTemporalRangesInformation : public vtkPVInformation
+{
+public:
+  static vtkPVTemporalRangesInformation* New();
+  vtkTypeMacro(vtkPVTemporalRangesInformation, vtkPVInformation);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Port number controls which output port the information is gathered from.
+   */
+  vtkSetMacro(PortNumber, int);
+  vtkGetMacro(PortNumber, int);
+  ///@}
+
+  ///@{
+  /**
+   * The array to gather the ranges of.
+   */
+  vtkSetMacro(FieldAssociation, int);
+  vtkGetMacro(FieldAssociation, int);
+  vtkSetStdStringFromCharMacro(ArrayName);
+  vtkGetCharFromStdStringMacro(ArrayName);
+  ///@}
+
+  ///@{
+  /**
+   * The timesteps to gather the ranges at. When empty, all the timesteps of
+   * the source are used. Requested timesteps that the source does not provide
+   * are ignored.
+   */
+  void AddTimeStep(double time);
+  void RemoveAllTimeSteps();
+  ///@}
+
+  /**
+   * Returns the ranges gathered for each timestep. Ranges are stored as
+   * (min, max) pairs for the magnitude followed by each component, the same
+   * order as vtkPVArrayInformation::GetComponentFiniteRange for components -1
+   * to N - 1. They are empty for timesteps where the array is missing.
+   */
+  const std::map<double, std::vector<double>>& GetRanges() const { return this->Ranges; }
+
+  ///@{
+  void CopyFromObject(vtkObject*) override;
+  void AddInformation(vtkPVInformation*) override;
+  void CopyToStream(vtkClientServerStream*) override;
+  void CopyFromStream(const vtkClientServerStream*) override;
+  void CopyParametersToStream(vtkMultiProcessStream&) override;
+  void CopyParametersFromStream(vtkMultiProcessStream&) override;
+  ///@}
+
+protected:
+  vtkPVTemporalRangesInformation();
+  ~vtkPVTemporalRangesInformation() override;
+
+  int PortNumber = 0;
+  int FieldAssociation = 0;
+  std::string ArrayName;
+
+private:
+  vtkPVTemporalRangesInformation(const vtkPVTemporalRangesInformation&) = delete;
+  void operator=(const vtkPVTemporalRangesInformation&) = delete;
+
+  std::vector<double> TimeSteps;
+  std::map<double, std::vector<double>> Ranges;
+};
+
+#endif
@@ -279,6 +279,11 @@ bool vtkRemotingCoreConfiguration::PopulatePluginOptions(
   CLI::deprecate_option(groupPlugins, "--test-plugin");
   CLI::deprecate_option(groupPlugins, "--test-plugin-path");
 
+  groupPlugins
+    ->add_option("--proxy-definition-cache", this->ProxyDefinitionCacheDirectory,
+      "Specify a directory where parsed proxy definitions are cached to speed up startup.")
+    ->envname("PV_PROXY_DEFINITION_CACHE");
+
   return true;
 }
 
@@ -560,6 +565,8 @@ void vtkRemotingCoreConfiguration::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "ConnectID: " << this->ConnectID << endl;
   os << indent << "ServerURL: " << this->ServerURL.c_str() << endl;
   os << indent << "ServerResourceName: " << this->ServerResourceName.c_str() << endl;
+  os << indent << "ProxyDefinitionCacheDirectory: " << this->ProxyDefinitionCacheDirectory
+     << endl;
   os << indent << "Timeout: " << this->Timeout << endl;
   os << indent << "TimeoutCommand: " << this->TimeoutCommand << endl;
   os << indent << "TimeoutCommandInterval: " << this->TimeoutCommandInterval << endl;
@@ -197,6 +197,12 @@ public:
    * Get a list of names for plugins to load.
    */
   const std::vector<std::string>& GetPlugins() const { return this->Plugins; }
+
+  /**
+   * Get the directory where parsed proxy definitions are cached, if any.
+   * @sa vtkPVProxyDefinitionCache
+   */
+  vtkGetMacro(ProxyDefinitionCacheDirectory, std::string);
   ///@}
 
   //---------------------------------------------------------------------------
@@ -344,6 +350,7 @@ private:
   int ConnectID = 0;
   std::string ServerURL;
   std::string ServerResourceName;
+  std::string ProxyDefinitionCacheDirectory;
   int Timeout = 0;
   std::string TimeoutCommand;
   int TimeoutCommandInterval = 60;
@@ -6,7 +6,6 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVArrayInformation.h"
-#include "vtkPVDataInformation.h"
 #include "vtkSMParaViewPipelineController.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMProxyProperty.h"
@@ -79,7 +78,6 @@ void vtkSMOMETIFFChannelCalculatorInitializationHelper::PostInitializeProxy(
   }
 
   const auto port = vtkSMPropertyHelper(proxy, "Input").GetOutputPort();
-  auto dinfo = inputProxy->GetDataInformation(port);
   vtkNew<vtkSMParaViewPipelineController> controller;
 
   auto pxm = proxy->GetSessionProxyManager();
@@ -96,8 +94,8 @@ void vtkSMOMETIFFChannelCalculatorInitializationHelper::PostInitializeProxy(
 
     std::ostringstream aname;
     aname << "Channel_" << cc;
-    auto ainfo =
-      dinfo->GetArrayInformation(aname.str().c_str(), vtkDataObject::FIELD_ASSOCIATION_POINTS);
+    auto ainfo = inputProxy->GetArrayInformationWithRanges(
+      port, aname.str().c_str(), vtkDataObject::FIELD_ASSOCIATION_POINTS);
     if (!ainfo)
     {
       continue;
@@ -106,8 +104,8 @@ void vtkSMOMETIFFChannelCalculatorInitializationHelper::PostInitializeProxy(
     vtkVector2d range(ainfo->GetComponentRange(0));
 
     const std::string aname_range = aname.str() + "_Range";
-    if (auto rinfo =
-          dinfo->GetArrayInformation(aname_range.c_str(), vtkDataObject::FIELD_ASSOCIATION_NONE))
+    if (auto rinfo = inputProxy->GetArrayInformationWithRanges(
+          port, aname_range.c_str(), vtkDataObject::FIELD_ASSOCIATION_NONE))
     {
       range[0] = rinfo->GetComponentRange(0)[0];
       range[1] = rinfo->GetComponentRange(1)[0];
@@ -0,0 +1,254 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVPlugin.h"
+#include "vtkPVPluginTracker.h"
+#include "vtkPVProxyDefinitionCache.h"
+#include "vtkPVServerManagerPluginInterface.h"
+#include "vtkPVTestUtilities.h"
+#include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
+#include "vtkSmartPointer.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// The configuration XML of ParaView, as loaded by vtkSIProxyDefinitionManager.
+std::vector<std::string> GetCoreXMLs()
+{
+  std::vector<std::string> xmls;
+  vtkPVPluginTracker* tracker = vtkPVPluginTracker::GetInstance();
+  for (unsigned int cc = 0; cc < tracker->GetNumberOfPlugins(); cc++)
+  {
+    vtkPVPlugin* plugin = tracker->GetPlugin(cc);
+    auto smplugin = dynamic_cast<vtkPVServerManagerPluginInterface*>(plugin);
+    if (smplugin && strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") == 0)
+    {
+      smplugin->GetXMLs(xmls);
+    }
+  }
+  return xmls;
+}
+
+// Parses all the XML, as a process starting up does.
+bool ParseAll(vtkPVProxyDefinitionCache* cache, const std::vector<std::string>& xmls,
+  std::vector<vtkSmartPointer<vtkPVXMLElement>>& roots)
+{
+  roots.clear();
+  for (const auto& xml : xmls)
+  {
+    roots.push_back(cache->Parse(xml.c_str()));
+  }
+  if (std::find(roots.begin(), roots.end(), nullptr) != roots.end())
+  {
+    vtkLogF(ERROR, "Failed to parse proxy definitions.");
+    return false;
+  }
+  return true;
+}
+
+// Parses all the XML count times, removing the cache files before each
+// startup when cold is true, and returns the number of startups per second.
+double Benchmark(vtkPVProxyDefinitionCache* cache, const std::vector<std::string>& xmls,
+  int count, bool cold)
+{
+  std::vector<vtkSmartPointer<vtkPVXMLElement>> roots;
+  std::chrono::duration<double> elapsed(0);
+  for (int cc = 0; cc < count; ++cc)
+  {
+    if (cold)
+    {
+      for (const auto& xml : xmls)
+      {
+        std::remove(cache->GetFileName(xml.c_str()).c_str());
+      }
+    }
+    const auto start = std::chrono::steady_clock::now();
+    if (!ParseAll(cache, xmls, roots))
+    {
+      return 0;
+    }
+    elapsed += std::chrono::steady_clock::now() - start;
+  }
+  return count / std::max(elapsed.count(), 1e-9);
+}
+
+void WriteFile(const std::string& fileName, const std::string& content)
+{
+  std::ofstream file(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+  file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+bool FileExists(const std::string& fileName)
+{
+  return std::ifstream(fileName).good();
+}
+
+bool Compare(const std::vector<vtkSmartPointer<vtkPVXMLElement>>& expected,
+  const std::vector<vtkSmartPointer<vtkPVXMLElement>>& roots)
+{
+  for (size_t cc = 0; cc < expected.size(); ++cc)
+  {
+    if (!roots[cc]->Equals(expected[cc]) ||
+      strcmp(roots[cc]->GetNestedElement(0)->GetId(), expected[cc]->GetNestedElement(0)->GetId()))
+    {
+      vtkLogF(ERROR, "Cached definitions differ from the XML.");
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+// Checks the cached definitions and the handling of invalid and stale cache
+// files. Use --benchmark to report the startups per second without cache,
+// with a cold cache and with a warm cache, and --count to set the number of
+// startups timed.
+int TestProxyDefinitionCache(int argc, char* argv[])
+{
+  vtkNew<vtkPVTestUtilities> testing;
+  testing->Initialize(argc, argv);
+
+  int count = 10;
+  bool benchmark = false;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument(
+    "--count", argT::EQUAL_ARGUMENT, &count, "Optionally specify the number of startups timed.");
+  arg.AddBooleanArgument("--benchmark", &benchmark, "Print the startups per second.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse() || count < 1)
+  {
+    vtkLogF(ERROR, "Problem parsing arguments.");
+    return EXIT_FAILURE;
+  }
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  const std::vector<std::string> xmls = GetCoreXMLs();
+  if (xmls.empty())
+  {
+    vtkLogF(ERROR, "No proxy definitions found.");
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkPVProxyDefinitionCache> cache;
+  std::vector<vtkSmartPointer<vtkPVXMLElement>> expected;
+  bool success = ParseAll(cache, xmls, expected);
+
+  auto cstr = testing->GetTempFilePath("ProxyDefinitionCache");
+  const std::string directory = cstr;
+  delete[] cstr;
+  cache->SetDirectory(directory);
+  for (const auto& xml : xmls)
+  {
+    std::remove(cache->GetFileName(xml.c_str()).c_str());
+  }
+
+  // cold cache, then warm cache.
+  std::vector<vtkSmartPointer<vtkPVXMLElement>> roots;
+  success = success && ParseAll(cache, xmls, roots) && ParseAll(cache, xmls, roots) &&
+    Compare(expected, roots);
+  if (success &&
+    (cache->GetNumberOfMisses() != static_cast<vtkIdType>(xmls.size()) ||
+      cache->GetNumberOfHits() != static_cast<vtkIdType>(xmls.size())))
+  {
+    vtkLogF(ERROR, "Expected %d misses then %d hits, got %d and %d.",
+      static_cast<int>(xmls.size()), static_cast<int>(xmls.size()),
+      static_cast<int>(cache->GetNumberOfMisses()), static_cast<int>(cache->GetNumberOfHits()));
+    success = false;
+  }
+
+  // invalid files are ignored, then replaced.
+  const std::string fileName = cache->GetFileName(xmls[0].c_str());
+  WriteFile(fileName, "PVPD");
+  if (success &&
+    (!cache->Parse(xmls[0].c_str()) ||
+      cache->GetNumberOfMisses() != static_cast<vtkIdType>(xmls.size()) + 1 ||
+      !cache->Parse(xmls[0].c_str()) ||
+      cache->GetNumberOfHits() != static_cast<vtkIdType>(xmls.size()) + 1))
+  {
+    vtkLogF(ERROR, "Invalid cache file was not replaced.");
+    success = false;
+  }
+
+  // a file whose header matches the XML but whose content differs, as for a
+  // hash collision, is not used. The content follows the 40 bytes header.
+  if (success)
+  {
+    std::string content;
+    {
+      std::ifstream file(fileName, std::ios::in | std::ios::binary);
+      content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    const size_t headerSize = 40;
+    success = content.size() > headerSize;
+    if (success)
+    {
+      content[headerSize] = content[headerSize] == ' ' ? '\t' : ' ';
+      WriteFile(fileName, content);
+      const vtkIdType misses = cache->GetNumberOfMisses();
+      vtkSmartPointer<vtkPVXMLElement> root = cache->Parse(xmls[0].c_str());
+      success = root && root->Equals(expected[0]) && cache->GetNumberOfMisses() == misses + 1;
+    }
+    if (!success)
+    {
+      vtkLogF(ERROR, "Cache file for other content was used.");
+    }
+  }
+
+  // files that were not used for MaximumAge days are removed when files are
+  // written. Temporary files are only removed after a day, other files are
+  // kept.
+  const std::string staleFile = directory + "/0123456789abcdef.pvpd";
+  const std::string staleTemporaryFile = directory + "/0123456789abcdef.pvpd.1.tmp";
+  const std::string otherFile = directory + "/other.txt";
+  WriteFile(staleFile, "PVPD");
+  WriteFile(staleTemporaryFile, "PVPD");
+  WriteFile(otherFile, "other");
+  std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+  vtkNew<vtkPVProxyDefinitionCache> pruningCache;
+  pruningCache->SetDirectory(directory);
+  pruningCache->SetMaximumAge(0);
+  std::remove(fileName.c_str());
+  if (success &&
+    (!pruningCache->Parse(xmls[0].c_str()) || FileExists(staleFile) ||
+      !FileExists(staleTemporaryFile) || !FileExists(otherFile) || !FileExists(fileName)))
+  {
+    vtkLogF(ERROR, "Stale cache files were not removed.");
+    success = false;
+  }
+  std::remove(staleTemporaryFile.c_str());
+  std::remove(otherFile.c_str());
+
+  // the timings are only reported, they never fail the test.
+  if (success && benchmark)
+  {
+    vtkNew<vtkPVProxyDefinitionCache> benchmarkCache;
+    const double uncached = Benchmark(benchmarkCache, xmls, count, false);
+    benchmarkCache->SetDirectory(directory + "/benchmark");
+    const double cold = Benchmark(benchmarkCache, xmls, count, true);
+    const double warm = Benchmark(benchmarkCache, xmls, count, false);
+    vtkLogF(INFO, "no cache: %g startups/s", uncached);
+    vtkLogF(INFO, "cold cache: %g startups/s", cold);
+    vtkLogF(INFO, "warm cache: %g startups/s", warm);
+  }
+
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
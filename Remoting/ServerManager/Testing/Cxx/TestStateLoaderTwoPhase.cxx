@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineController.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMStateLoader.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+bool ValidateState(vtkSMSessionProxyManager* pxm, vtkSMStateLoader* loader)
+{
+  vtkSMProxy* source = pxm->GetProxy("sources", "time");
+  vtkSMProxy* shrink = pxm->GetProxy("sources", "shrink");
+  if (!source || !shrink)
+  {
+    vtkLogF(ERROR, "Proxies were not registered.");
+    return false;
+  }
+  if (vtkSMPropertyHelper(shrink, "Input").GetAsProxy() != source)
+  {
+    vtkLogF(ERROR, "Input of the filter was not restored.");
+    return false;
+  }
+  // information properties are updated before the proxies are registered.
+  if (vtkSMPropertyHelper(source, "TimestepValues").GetNumberOfElements() < 2)
+  {
+    vtkLogF(ERROR, "Pipeline information was not updated.");
+    return false;
+  }
+
+  double total = 0;
+  for (int step = 0; step < vtkSMStateLoader::NUMBER_OF_LOADING_STEPS; ++step)
+  {
+    const double time = loader->GetLoadingTime(step);
+    if (time < 0)
+    {
+      vtkLogF(ERROR, "Invalid time for step %d.", step);
+      return false;
+    }
+    total += time;
+  }
+  vtkLogF(INFO, "two-phase: %d, create: %gs, properties: %gs, update: %gs, total: %gs",
+    loader->GetTwoPhaseLoading() ? 1 : 0, loader->GetLoadingTime(vtkSMStateLoader::CREATE),
+    loader->GetLoadingTime(vtkSMStateLoader::PROPERTIES),
+    loader->GetLoadingTime(vtkSMStateLoader::UPDATE), total);
+  return true;
+}
+}
+
+int TestStateLoaderTwoPhase(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineController> controller;
+  vtkNew<vtkSMSession> session;
+  controller->InitializeSession(session);
+
+  auto pxm = session->GetSessionProxyManager();
+  auto source = vtkSmartPointer<vtkSMSourceProxy>::Take(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "TimeSource")));
+  controller->InitializeProxy(source);
+  controller->RegisterPipelineProxy(source, "time");
+
+  auto shrink = vtkSmartPointer<vtkSMSourceProxy>::Take(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "ShrinkFilter")));
+  controller->PreInitializeProxy(shrink);
+  vtkSMPropertyHelper(shrink, "Input").Set(source);
+  controller->PostInitializeProxy(shrink);
+  controller->RegisterPipelineProxy(shrink, "shrink");
+
+  auto state = vtkSmartPointer<vtkPVXMLElement>::Take(pxm->SaveXMLState());
+  source = nullptr;
+  shrink = nullptr;
+
+  {
+    vtkNew<vtkSMStateLoader> loader;
+    if (loader->GetTwoPhaseLoading())
+    {
+      vtkLogF(ERROR, "Two-phase loading should be disabled by default.");
+      vtkInitializationHelper::Finalize();
+      return EXIT_FAILURE;
+    }
+  }
+
+  for (bool twoPhase : { false, true })
+  {
+    pxm->UnRegisterProxies();
+    vtkNew<vtkSMStateLoader> loader;
+    loader->SetSession(session);
+    loader->SetTwoPhaseLoading(twoPhase);
+    pxm->LoadXMLState(state, loader);
+    if (!ValidateState(pxm, loader))
+    {
+      vtkInitializationHelper::Finalize();
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkInitializationHelper::Finalize();
+  return EXIT_SUCCESS;
+}
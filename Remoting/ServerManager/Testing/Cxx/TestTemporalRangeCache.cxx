@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataObject.h"
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVDataSetAttributesInformation.h"
+#include "vtkPVTestUtilities.h"
+#include "vtkProcessModule.h"
+#include "vtkSMOutputPort.h"
+#include "vtkSMParaViewPipelineController.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMTemporalRangeCache.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+bool ValidateRanges(vtkSMSourceProxy* source, const std::string& arrayName)
+{
+  std::map<double, std::vector<double>> ranges;
+  if (!source->GetOutputPort(0u)->GetTemporalArrayRanges(
+        arrayName.c_str(), vtkDataObject::FIELD_ASSOCIATION_POINTS, ranges))
+  {
+    vtkLogF(ERROR, "Failed to get the ranges over time.");
+    return false;
+  }
+
+  vtkPVDataInformation* tinfo = source->GetOutputPort(0u)->GetTemporalDataInformation();
+  if (ranges.size() != tinfo->GetTimeSteps().size())
+  {
+    vtkLogF(ERROR, "Expected ranges for %d timesteps, got %d.",
+      static_cast<int>(tinfo->GetTimeSteps().size()), static_cast<int>(ranges.size()));
+    return false;
+  }
+
+  double range[2] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+  for (const auto& item : ranges)
+  {
+    range[0] = std::min(range[0], item.second[0]);
+    range[1] = std::max(range[1], item.second[1]);
+  }
+  const double* expected = tinfo->GetPointDataInformation()
+                             ->GetArrayInformation(arrayName.c_str())
+                             ->GetComponentFiniteRange(-1);
+  if (range[0] != expected[0] || range[1] != expected[1])
+  {
+    vtkLogF(ERROR, "Expected range [%g, %g], got [%g, %g].", expected[0], expected[1], range[0],
+      range[1]);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestTemporalRangeCache(int argc, char* argv[])
+{
+  vtkNew<vtkPVTestUtilities> testing;
+  testing->Initialize(argc, argv);
+
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineController> controller;
+
+  // Create a new session.
+  vtkNew<vtkSMSession> session;
+  controller->InitializeSession(session);
+
+  auto pxm = session->GetSessionProxyManager();
+  auto source = vtkSmartPointer<vtkSMSourceProxy>::Take(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "TimeSource")));
+  controller->InitializeProxy(source);
+  controller->RegisterPipelineProxy(source);
+  source->UpdatePipeline();
+
+  auto pdinfo = source->GetDataInformation()->GetPointDataInformation();
+  if (pdinfo->GetNumberOfArrays() == 0 ||
+    source->GetOutputPort(0u)->GetTemporalDataInformation()->GetTimeSteps().size() < 2)
+  {
+    vtkLogF(ERROR, "Expected point arrays and several timesteps.");
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+  const std::string arrayName = pdinfo->GetArrayInformation(0)->GetName();
+
+  // ranges gathered over time, then reused from memory.
+  auto cache = vtkSMTemporalRangeCache::GetInstance();
+  cache->SetEnabled(true);
+  if (!ValidateRanges(source, arrayName) || !ValidateRanges(source, arrayName))
+  {
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+
+  // ranges persisted to the directory, then loaded back once forgotten.
+  auto cstr = testing->GetTempFilePath("TemporalRanges");
+  cache->SetDirectory(cstr);
+  delete[] cstr;
+  cache->Clear();
+  if (!ValidateRanges(source, arrayName))
+  {
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+  cache->Clear();
+
+  const std::string key = cache->GetKey(source, 0);
+  const double time =
+    *std::next(source->GetOutputPort(0u)->GetTemporalDataInformation()->GetTimeSteps().begin());
+  std::vector<double> ranges;
+  if (!cache->Find(key, vtkDataObject::FIELD_ASSOCIATION_POINTS, arrayName.c_str(), time, ranges))
+  {
+    vtkLogF(ERROR, "Ranges were not loaded from the directory.");
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+  if (!ValidateRanges(source, arrayName))
+  {
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+
+  // ranges recorded as the data information is gathered.
+  cache->SetDirectory(std::string());
+  cache->Clear();
+  source->UpdatePipeline(time);
+  source->GetDataInformation();
+  if (!cache->Find(key, vtkDataObject::FIELD_ASSOCIATION_POINTS, arrayName.c_str(), time, ranges))
+  {
+    vtkLogF(ERROR, "Ranges were not recorded on update.");
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+
+  // changing a property changes the dataset.
+  vtkSMPropertyHelper(source, "X Amplitude").Set(20.0);
+  source->UpdateVTKObjects();
+  if (cache->GetKey(source, 0) == key)
+  {
+    vtkLogF(ERROR, "Key is not affected by property changes.");
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+
+  cache->SetEnabled(false);
+  vtkInitializationHelper::Finalize();
+  return EXIT_SUCCESS;
+}
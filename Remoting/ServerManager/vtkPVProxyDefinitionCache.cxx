@@ -0,0 +1,348 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVProxyDefinitionCache.h"
+
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+#include "vtkProcessModule.h"
+#include "vtkRemotingCoreConfiguration.h"
+
+#include "vtksys/Directory.hxx"
+#include "vtksys/Encoding.hxx"
+#include "vtksys/FStream.hxx"
+#include "vtksys/SystemTools.hxx"
+
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+#include <process.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+// Header of the cache files, followed by the XML content and by the elements
+// as written by vtkPVXMLElement::WriteBinary(). The byte order mark and the
+// version reject files written by other architectures or by other versions of
+// the format. The content is compared in full, the hash only names the file.
+struct vtkHeader
+{
+  char Magic[4];
+  vtkTypeUInt32 ByteOrder;
+  vtkTypeUInt32 Version;
+  vtkTypeUInt32 Reserved;
+  vtkTypeUInt64 ContentHash;
+  vtkTypeUInt64 ContentLength;
+  vtkTypeUInt64 DataLength;
+};
+
+constexpr char FILE_MAGIC[4] = { 'P', 'V', 'P', 'D' };
+constexpr vtkTypeUInt32 FILE_BYTE_ORDER = 0x01020304;
+constexpr vtkTypeUInt32 FILE_VERSION = 2;
+constexpr const char* FILE_EXTENSION = ".pvpd";
+
+// Hits refresh the modification time of the files at most once a day, so
+// that only the files no longer used age.
+constexpr long SECONDS_PER_DAY = 24 * 60 * 60;
+
+// FNV-1a hash of the XML content.
+vtkTypeUInt64 Hash(const char* data, size_t length)
+{
+  vtkTypeUInt64 hash = 14695981039346656037ull;
+  for (size_t cc = 0; cc < length; ++cc)
+  {
+    hash ^= static_cast<unsigned char>(data[cc]);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+std::string MakeFileName(const std::string& directory, vtkTypeUInt64 hash)
+{
+  std::ostringstream fileName;
+  fileName << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << hash
+           << FILE_EXTENSION;
+  return fileName.str();
+}
+
+//============================================================================
+// Read-only memory mapping of a whole file.
+class vtkMappedFile
+{
+public:
+  explicit vtkMappedFile(const std::string& filename)
+  {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(filename).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return;
+    }
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+      HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping != nullptr)
+      {
+        this->Data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        this->Size = this->Data ? static_cast<size_t>(size.QuadPart) : 0;
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+      return;
+    }
+    struct stat fs;
+    if (fstat(fd, &fs) == 0 && fs.st_size > 0)
+    {
+      void* data = mmap(nullptr, static_cast<size_t>(fs.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED)
+      {
+        this->Data = static_cast<const char*>(data);
+        this->Size = static_cast<size_t>(fs.st_size);
+      }
+    }
+    close(fd);
+#endif
+  }
+
+  ~vtkMappedFile()
+  {
+    if (this->Data)
+    {
+#ifdef _WIN32
+      UnmapViewOfFile(this->Data);
+#else
+      munmap(const_cast<char*>(this->Data), this->Size);
+#endif
+    }
+  }
+
+  const char* GetData() const { return this->Data; }
+  size_t GetSize() const { return this->Size; }
+
+private:
+  vtkMappedFile(const vtkMappedFile&) = delete;
+  void operator=(const vtkMappedFile&) = delete;
+
+  const char* Data = nullptr;
+  size_t Size = 0;
+};
+
+vtkSmartPointer<vtkPVXMLElement> Load(const std::string& fileName, const char* content,
+  vtkTypeUInt64 hash, vtkTypeUInt64 length)
+{
+  vtkMappedFile file(fileName);
+  vtkHeader header;
+  if (file.GetSize() < sizeof(header))
+  {
+    return nullptr;
+  }
+  memcpy(&header, file.GetData(), sizeof(header));
+  const vtkTypeUInt64 available = file.GetSize() - sizeof(header);
+  if (memcmp(header.Magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+    header.ByteOrder != FILE_BYTE_ORDER || header.Version != FILE_VERSION ||
+    header.ContentHash != hash || header.ContentLength != length ||
+    header.ContentLength > available || header.DataLength != available - header.ContentLength)
+  {
+    return nullptr;
+  }
+  const char* data = file.GetData() + sizeof(header);
+  if (memcmp(data, content, static_cast<size_t>(length)) != 0)
+  {
+    return nullptr;
+  }
+  return vtkSmartPointer<vtkPVXMLElement>::Take(vtkPVXMLElement::NewFromBinary(
+    data + header.ContentLength, static_cast<size_t>(header.DataLength)));
+}
+
+// Writes to a temporary file first, so that processes sharing the directory
+// never read a partially written file.
+bool Save(const std::string& fileName, const char* content, vtkTypeUInt64 hash,
+  vtkTypeUInt64 length, vtkPVXMLElement* root)
+{
+  std::string data;
+  root->WriteBinary(data);
+
+  vtkHeader header;
+  memcpy(header.Magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+  header.ByteOrder = FILE_BYTE_ORDER;
+  header.Version = FILE_VERSION;
+  header.Reserved = 0;
+  header.ContentHash = hash;
+  header.ContentLength = length;
+  header.DataLength = data.size();
+
+#ifdef _WIN32
+  const std::string tmpName = fileName + "." + std::to_string(_getpid()) + ".tmp";
+#else
+  const std::string tmpName = fileName + "." + std::to_string(getpid()) + ".tmp";
+#endif
+  vtksys::ofstream file(tmpName.c_str(), ios::out | ios::binary);
+  if (!file)
+  {
+    return false;
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(content, static_cast<std::streamsize>(length));
+  file.write(data.c_str(), static_cast<std::streamsize>(data.size()));
+  file.close();
+  if (!file || !vtksys::SystemTools::RenameFile(tmpName, fileName))
+  {
+    vtksys::SystemTools::RemoveFile(tmpName);
+    return false;
+  }
+  return true;
+}
+
+// Removes the cache files that were not used for `maximumAge` days, and the
+// temporary files left by processes that did not complete a write.
+void RemoveStaleFiles(const std::string& directory, int maximumAge)
+{
+  vtksys::Directory dir;
+  if (!dir.Load(directory))
+  {
+    return;
+  }
+  const long now = static_cast<long>(std::time(nullptr));
+  for (unsigned long cc = 0; cc < dir.GetNumberOfFiles(); ++cc)
+  {
+    const std::string name = dir.GetFile(cc);
+    const bool isTemporary = vtksys::SystemTools::StringEndsWith(name, ".tmp") &&
+      name.find(FILE_EXTENSION) != std::string::npos;
+    if (!isTemporary && !vtksys::SystemTools::StringEndsWith(name, FILE_EXTENSION))
+    {
+      continue;
+    }
+    const std::string path = directory + "/" + name;
+    const long age = now - vtksys::SystemTools::ModifiedTime(path);
+    if (age > (isTemporary ? SECONDS_PER_DAY : maximumAge * SECONDS_PER_DAY) &&
+      vtksys::SystemTools::RemoveFile(path).IsSuccess())
+    {
+      vtkVLogF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), "removed stale proxy definitions '%s'",
+        path.c_str());
+    }
+  }
+}
+}
+
+vtkStandardNewMacro(vtkPVProxyDefinitionCache);
+//----------------------------------------------------------------------------
+vtkPVProxyDefinitionCache::vtkPVProxyDefinitionCache() = default;
+
+//----------------------------------------------------------------------------
+vtkPVProxyDefinitionCache::~vtkPVProxyDefinitionCache() = default;
+
+//----------------------------------------------------------------------------
+vtkPVProxyDefinitionCache* vtkPVProxyDefinitionCache::GetInstance()
+{
+  static vtkSmartPointer<vtkPVProxyDefinitionCache> Instance;
+  if (Instance.GetPointer() == nullptr)
+  {
+    vtkPVProxyDefinitionCache* cache = vtkPVProxyDefinitionCache::New();
+    if (auto config = vtkRemotingCoreConfiguration::GetInstance())
+    {
+      cache->SetDirectory(config->GetProxyDefinitionCacheDirectory());
+    }
+    Instance = cache;
+    cache->FastDelete();
+  }
+  return Instance;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPVProxyDefinitionCache::GetFileName(const char* xmlContent)
+{
+  return MakeFileName(this->Directory, Hash(xmlContent, xmlContent ? strlen(xmlContent) : 0));
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPVXMLElement> vtkPVProxyDefinitionCache::Parse(const char* xmlContent)
+{
+  if (!xmlContent)
+  {
+    return nullptr;
+  }
+
+  auto pm = vtkProcessModule::GetProcessModule();
+  const bool enabled = !this->Directory.empty();
+  const bool writer = enabled && (!pm || pm->GetPartitionId() == 0);
+  const vtkTypeUInt64 length = strlen(xmlContent);
+  const vtkTypeUInt64 hash = enabled ? Hash(xmlContent, length) : 0;
+  std::string fileName;
+  if (enabled)
+  {
+    fileName = MakeFileName(this->Directory, hash);
+    if (auto root = Load(fileName, xmlContent, hash, length))
+    {
+      ++this->NumberOfHits;
+      vtkVLogF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), "read proxy definitions from '%s'",
+        fileName.c_str());
+      const long now = static_cast<long>(std::time(nullptr));
+      if (writer && now - vtksys::SystemTools::ModifiedTime(fileName) > SECONDS_PER_DAY)
+      {
+        vtksys::SystemTools::Touch(fileName, false);
+      }
+      return root;
+    }
+    ++this->NumberOfMisses;
+  }
+
+  vtkNew<vtkPVXMLParser> parser;
+  if (!parser->Parse(xmlContent))
+  {
+    return nullptr;
+  }
+  vtkSmartPointer<vtkPVXMLElement> root = parser->GetRootElement();
+
+  if (writer)
+  {
+    if (!vtksys::SystemTools::MakeDirectory(this->Directory).IsSuccess())
+    {
+      vtkWarningMacro("Directory '" << this->Directory << "' could not be created.");
+      return root;
+    }
+    // a miss is when files may have become stale, check for them once.
+    if (this->StaleFilesDirectory != this->Directory)
+    {
+      RemoveStaleFiles(this->Directory, this->MaximumAge);
+      this->StaleFilesDirectory = this->Directory;
+    }
+    if (Save(fileName, xmlContent, hash, length, root))
+    {
+      vtkVLogF(
+        PARAVIEW_LOG_PLUGIN_VERBOSITY(), "saved proxy definitions to '%s'", fileName.c_str());
+    }
+    else
+    {
+      vtkWarningMacro("Could not save proxy definitions to '" << fileName << "'.");
+    }
+  }
+  return root;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVProxyDefinitionCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Directory: " << this->Directory << endl;
+  os << indent << "MaximumAge: " << this->MaximumAge << endl;
+  os << indent << "NumberOfHits: " << this->NumberOfHits << endl;
+  os << indent << "NumberOfMisses: " << this->NumberOfMisses << endl;
+}
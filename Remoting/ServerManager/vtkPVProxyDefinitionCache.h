@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPVProxyDefinitionCache
+ * @brief   on-disk cache of parsed server manager configuration XML.
+ *
+ * vtkPVProxyDefinitionCache is used by vtkSIProxyDefinitionManager to parse
+ * the server manager configuration XML of ParaView and of plugins. When a
+ * directory is set, each parsed XML is saved to it in the binary form written
+ * by vtkPVXMLElement::WriteBinary(), in a file named after a hash of the XML
+ * content. Later processes parsing the same XML memory-map that file and read
+ * the elements from it instead of parsing the XML, which is several times
+ * faster. Files store the XML content they were built from and are only used
+ * if it matches, so modified XML is parsed again. Files that were not used for
+ * `MaximumAge` days are removed when new files are written.
+ *
+ * In parallel, only the first rank writes files, so the other ranks parse the
+ * XML until the cache is warm. The directory is given by the
+ * `--proxy-definition-cache` command line option or the
+ * `PV_PROXY_DEFINITION_CACHE` environment variable.
+ *
+ * @sa vtkSIProxyDefinitionManager, vtkRemotingCoreConfiguration
+ */
+
+#ifndef vtkPVProxyDefinitionCache_h
+#define vtkPVProxyDefinitionCache_h
+
+#include "vtkObject.h"
+#include "vtkRemotingServerManagerModule.h" //needed for exports
+#include "vtkSmartPointer.h"                // for vtkSmartPointer
+
+#include <string> // for std::string
+
+class vtkPVXMLElement;
+
+class VTKREMOTINGSERVERMANAGER_EXPORT vtkPVProxyDefinitionCache : public vtkObject
+{
+public:
+  static vtkPVProxyDefinitionCache* New();
+  vtkTypeMacro(vtkPVProxyDefinitionCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns the singleton used by vtkSIProxyDefinitionManager. Its directory
+   * is initialized from vtkRemotingCoreConfiguration.
+   */
+  static vtkPVProxyDefinitionCache* GetInstance();
+
+  ///@{
+  /**
+   * Directory where the parsed XML is cached. When empty, the default, XML is
+   * always parsed.
+   */
+  vtkSetMacro(Directory, std::string);
+  vtkGetMacro(Directory, std::string);
+  ///@}
+
+  ///@{
+  /**
+   * Number of days after which files that were not used are removed from the
+   * directory. Default is 30.
+   */
+  vtkSetClampMacro(MaximumAge, int, 0, VTK_INT_MAX);
+  vtkGetMacro(MaximumAge, int);
+  ///@}
+
+  /**
+   * Returns the root element of the given XML, read from the cache if
+   * possible. Returns nullptr if the XML cannot be parsed.
+   */
+  vtkSmartPointer<vtkPVXMLElement> Parse(const char* xmlContent);
+
+  /**
+   * Returns the name of the file caching the given XML in the directory.
+   */
+  std::string GetFileName(const char* xmlContent);
+
+  ///@{
+  /**
+   * Number of calls to Parse() that read the elements from the cache, and
+   * that parsed the XML.
+   */
+  vtkGetMacro(NumberOfHits, vtkIdType);
+  vtkGetMacro(NumberOfMisses, vtkIdType);
+  ///@}
+
+protected:
+  vtkPVProxyDefinitionCache();
+  ~vtkPVProxyDefinitionCache() override;
+
+  std::string Directory;
+  int MaximumAge = 30;
+  vtkIdType NumberOfHits = 0;
+  vtkIdType NumberOfMisses = 0;
+
+private:
+  // Directory last checked for stale files.
+  std::string StaleFilesDirectory;
+
+  vtkPVProxyDefinitionCache(const vtkPVProxyDefinitionCache&) = delete;
+  void operator=(const vtkPVProxyDefinitionCache&) = delete;
+};
+
+#endif
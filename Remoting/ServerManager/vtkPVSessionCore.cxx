@@ -583,13 +583,13 @@ void vtkPVSessionCore::ExecuteStreamSatelliteCallback()
 {
   int byte_size[2] = { 0, 0 };
   this->ParallelController->Broadcast(byte_size, 2, 0);
-  unsigned char* raw_data = new unsigned char[byte_size[0] + 1];
-  this->ParallelController->Broadcast(raw_data, byte_size[0], 0);
 
+  // receive the data directly in the stream.
   vtkClientServerStream stream;
-  stream.SetData(raw_data, byte_size[0]);
+  unsigned char* raw_data = stream.BeginSetData(byte_size[0]);
+  this->ParallelController->Broadcast(raw_data, byte_size[0], 0);
+  stream.EndSetData();
   this->ExecuteStreamInternal(stream, byte_size[1] != 0);
-  delete[] raw_data;
 }
 
 //----------------------------------------------------------------------------
@@ -505,6 +505,12 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
 {
   vtkMultiProcessStream stream;
   stream.SetRawData(reinterpret_cast<const unsigned char*>(message), message_length);
+  this->ProcessClientServerMessage(stream, false);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSessionServer::ProcessClientServerMessage(vtkMultiProcessStream& stream, bool batched)
+{
   int type;
   stream >> type;
   switch (type)
@@ -574,13 +580,41 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
     {
       int ignore_errors, size;
       stream >> ignore_errors >> size;
-      unsigned char* css_data = new unsigned char[size + 1];
-      this->Internal->GetActiveController()->Receive(
-        css_data, size, 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
       vtkClientServerStream cssStream;
-      cssStream.SetData(css_data, size);
+      if (batched)
+      {
+        unsigned char* css_data = nullptr;
+        unsigned int css_size = 0;
+        stream.Pop(css_data, css_size);
+        cssStream.SetData(css_data, size);
+        delete[] css_data;
+      }
+      else
+      {
+        // receive the data directly in the stream.
+        unsigned char* css_data = cssStream.BeginSetData(size);
+        this->Internal->GetActiveController()->Receive(
+          css_data, size, 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
+        cssStream.EndSetData();
+      }
       this->ExecuteStream(vtkPVSession::CLIENT_AND_SERVERS, cssStream, ignore_errors != 0);
-      delete[] css_data;
+    }
+    break;
+
+    case vtkPVSessionServer::BATCH:
+    {
+      int count;
+      stream >> count;
+      for (int cc = 0; cc < count; ++cc)
+      {
+        unsigned char* data = nullptr;
+        unsigned int size = 0;
+        stream.Pop(data, size);
+        vtkMultiProcessStream message;
+        message.SetRawData(data, size);
+        delete[] data;
+        this->ProcessClientServerMessage(message, true);
+      }
     }
     break;
 
@@ -71,6 +71,7 @@ public:
     REGISTER_SI = 16,
     UNREGISTER_SI = 17,
     LAST_RESULT = 18,
+    BATCH = 19,
     SERVER_NOTIFICATION_MESSAGE_RMI = 55624,
     CLIENT_SERVER_MESSAGE_RMI = 55625,
     CLOSE_SESSION = 55626,
@@ -139,6 +140,13 @@ protected:
    */
   void SendLastResultToClient();
 
+  /**
+   * Processes a message sent by the client. Batched messages carry the
+   * vtkClientServerStream of EXECUTE_STREAM messages inline instead of sending
+   * it separately.
+   */
+  void ProcessClientServerMessage(vtkMultiProcessStream& stream, bool batched);
+
   vtkMPIMToNSocketConnection* MPIMToNSocketConnection;
 
   bool MultipleConnection;
@@ -7,8 +7,10 @@
 #include "vtkCommand.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkPVPlugin.h"
 #include "vtkPVPluginTracker.h"
+#include "vtkPVProxyDefinitionCache.h"
 #include "vtkPVProxyDefinitionIterator.h"
 #include "vtkPVServerManagerPluginInterface.h"
 #include "vtkPVSession.h"
@@ -415,6 +417,7 @@ vtkSIProxyDefinitionManager::vtkSIProxyDefinitionManager()
   this->InternalsFlatten = new vtkInternals;
 
   vtkPVPluginTracker* tracker = vtkPVPluginTracker::GetInstance();
+  vtkVLogScopeF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), "load proxy definitions");
 
   // Load the core xmls.
   // These are loaded from the vtkPVInitializerPlugin plugin.
@@ -801,9 +804,10 @@ bool vtkSIProxyDefinitionManager::LoadConfigurationXMLFromString(const char* xml
 bool vtkSIProxyDefinitionManager::LoadConfigurationXMLFromString(
   const char* xmlContent, bool attachHints, bool invoke, const std::string& ensurePluginLoaded)
 {
-  vtkNew<vtkPVXMLParser> parser;
-  return (parser->Parse(xmlContent) != 0) &&
-    this->LoadConfigurationXML(parser->GetRootElement(), attachHints, invoke, ensurePluginLoaded);
+  // the parsed XML is read from the cache when possible.
+  vtkSmartPointer<vtkPVXMLElement> root =
+    vtkPVProxyDefinitionCache::GetInstance()->Parse(xmlContent);
+  return root && this->LoadConfigurationXML(root, attachHints, invoke, ensurePluginLoaded);
 }
 
 //---------------------------------------------------------------------------
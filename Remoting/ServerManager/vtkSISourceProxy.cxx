@@ -15,6 +15,7 @@
 #include "vtkPVCompositeDataPipeline.h"
 #include "vtkPVLogger.h"
 #include "vtkPVPostFilter.h"
+#include "vtkPVTimeStepPrefetcher.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPolyData.h"
 #include "vtkProcessModule.h"
@@ -27,12 +28,50 @@
 #include <sstream>
 #include <vector>
 
+namespace
+{
+int NumberOfTimeStepsToPrefetch = 0;
+unsigned long TimeStepPrefetchMemoryLimit = 1048576;
+}
+
 //*****************************************************************************
 class vtkSISourceProxy::vtkInternals
 {
 public:
   std::vector<vtkSmartPointer<vtkAlgorithmOutput>> OutputPorts;
   std::vector<vtkSmartPointer<vtkPVPostFilter>> PostFilters;
+
+  // Properties pushed so far, replayed on the shadow source of the
+  // prefetcher when it is created.
+  vtkSMMessage PushedState;
+  vtkSmartPointer<vtkPVTimeStepPrefetcher> Prefetcher;
+
+  // Set when the proxy definition has the PrefetchTimeSteps hint.
+  bool PrefetchTimeStepsHint = false;
+
+  void RecordPushedState(vtkSMMessage* message)
+  {
+    const int size = message->ExtensionSize(ProxyState::property);
+    for (int cc = 0; cc < size; ++cc)
+    {
+      const ProxyState_Property& propMsg = message->GetExtension(ProxyState::property, cc);
+      bool found = false;
+      const int numberOfRecorded = this->PushedState.ExtensionSize(ProxyState::property);
+      for (int kk = 0; kk < numberOfRecorded && !found; ++kk)
+      {
+        auto recorded = this->PushedState.MutableExtension(ProxyState::property, kk);
+        if (recorded->name() == propMsg.name())
+        {
+          recorded->CopyFrom(propMsg);
+          found = true;
+        }
+      }
+      if (!found)
+      {
+        this->PushedState.AddExtension(ProxyState::property)->CopyFrom(propMsg);
+      }
+    }
+  }
 };
 
 //*****************************************************************************
@@ -138,6 +177,20 @@ bool vtkSISourceProxy::CreateOutputPorts()
   for (int cc = 0; cc < ports; cc++)
   {
     internals.OutputPorts[cc] = algo->GetOutputPort(cc);
+    if (cc == 0 && ::NumberOfTimeStepsToPrefetch > 0 && this->CanPrefetchTimeSteps())
+    {
+      // insert the prefetcher between the reader and the post filter, its
+      // shadow source is only created on the first prefetch request.
+      if (internals.Prefetcher == nullptr)
+      {
+        internals.Prefetcher = vtkSmartPointer<vtkPVTimeStepPrefetcher>::New();
+        internals.Prefetcher->SetCallbackQueue(
+          vtkProcessModule::GetProcessModule()->GetCallbackQueue());
+      }
+      internals.Prefetcher->SetMemoryLimit(::TimeStepPrefetchMemoryLimit);
+      internals.Prefetcher->SetInputConnection(internals.OutputPorts[cc]);
+      internals.OutputPorts[cc] = internals.Prefetcher->GetOutputPort(0);
+    }
     if (vtkPVCompositeDataPipeline::SafeDownCast(algo->GetExecutive()) != nullptr)
     {
       // add the post filters to the source proxy
@@ -170,6 +223,12 @@ void vtkSISourceProxy::RecreateVTKObjects()
     return;
   }
 
+  if (this->Internals->Prefetcher)
+  {
+    // the shadow source is recreated along with the algorithm.
+    this->Internals->Prefetcher->SetShadowSource(nullptr);
+  }
+
   this->Superclass::RecreateVTKObjects();
   if (this->PortsCreated)
   {
@@ -179,6 +238,109 @@ void vtkSISourceProxy::RecreateVTKObjects()
   }
 }
 
+//----------------------------------------------------------------------------
+bool vtkSISourceProxy::CanPrefetchTimeSteps()
+{
+  // The shadow source is updated concurrently with the algorithm, which is
+  // only safe for readers that do not share state between instances, e.g.
+  // readers using the HDF5 or NetCDF libraries are not. Hence prefetching is
+  // only done for readers whose definition opts in with the PrefetchTimeSteps
+  // hint. It is not safe either for readers communicating with other ranks.
+  // Readers with subproxies cannot be duplicated by replaying their own
+  // properties.
+  vtkAlgorithm* algo = vtkAlgorithm::SafeDownCast(this->GetVTKObject());
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  return this->Internals->PrefetchTimeStepsHint && algo && algo->GetNumberOfInputPorts() == 0 && algo->GetNumberOfOutputPorts() == 1 &&
+    this->GetNumberOfSubSIProxys() == 0 && this->GetSIProperty("TimestepValues") != nullptr &&
+    (controller == nullptr || controller->GetNumberOfProcesses() == 1);
+}
+
+//----------------------------------------------------------------------------
+void vtkSISourceProxy::Push(vtkSMMessage* message)
+{
+  vtkInternals& internals = (*this->Internals);
+  vtkAlgorithm* shadow = internals.Prefetcher ? internals.Prefetcher->GetShadowSource() : nullptr;
+  if (shadow)
+  {
+    // prefetched timesteps are obsolete and the shadow source must not be
+    // modified while being updated.
+    internals.Prefetcher->ClearPrefetchedTimeSteps();
+  }
+
+  this->Superclass::Push(message);
+
+  if (::NumberOfTimeStepsToPrefetch > 0 || internals.Prefetcher)
+  {
+    internals.RecordPushedState(message);
+  }
+  if (shadow)
+  {
+    vtkSmartPointer<vtkObjectBase> object = this->GetVTKObject();
+    this->SetVTKObject(shadow);
+    this->vtkSIProxy::Push(message);
+    this->SetVTKObject(object);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSISourceProxy::PrefetchTimeStep(double time)
+{
+  vtkInternals& internals = (*this->Internals);
+  if (!internals.Prefetcher || this->DisablePipelineExecution)
+  {
+    return;
+  }
+
+  if (internals.Prefetcher->GetShadowSource() == nullptr)
+  {
+    vtkSmartPointer<vtkObjectBase> object = this->GetVTKObject();
+    vtkSmartPointer<vtkAlgorithm> shadow;
+    shadow.TakeReference(vtkAlgorithm::SafeDownCast(object->NewInstance()));
+    if (!shadow)
+    {
+      return;
+    }
+
+    vtkVLogF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "%s: create shadow source for prefetching",
+      this->GetLogNameOrDefault());
+
+    // configure the shadow source by replaying the properties pushed so far,
+    // the last pushed message is preserved since it is used by Pull().
+    vtkSMMessage lastPushedMessage;
+    lastPushedMessage.CopyFrom(*this->LastPushedMessage);
+    this->SetVTKObject(shadow);
+    this->vtkSIProxy::Push(&internals.PushedState);
+    this->SetVTKObject(object);
+    this->LastPushedMessage->CopyFrom(lastPushedMessage);
+    internals.Prefetcher->SetShadowSource(shadow);
+  }
+  internals.Prefetcher->PrefetchTimeStep(time);
+}
+
+//----------------------------------------------------------------------------
+void vtkSISourceProxy::SetNumberOfTimeStepsToPrefetch(int count)
+{
+  ::NumberOfTimeStepsToPrefetch = count;
+}
+
+//----------------------------------------------------------------------------
+int vtkSISourceProxy::GetNumberOfTimeStepsToPrefetch()
+{
+  return ::NumberOfTimeStepsToPrefetch;
+}
+
+//----------------------------------------------------------------------------
+void vtkSISourceProxy::SetTimeStepPrefetchMemoryLimit(unsigned long limit)
+{
+  ::TimeStepPrefetchMemoryLimit = limit;
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkSISourceProxy::GetTimeStepPrefetchMemoryLimit()
+{
+  return ::TimeStepPrefetchMemoryLimit;
+}
+
 //----------------------------------------------------------------------------
 bool vtkSISourceProxy::ReadXMLAttributes(vtkPVXMLElement* element)
 {
@@ -192,6 +354,10 @@ bool vtkSISourceProxy::ReadXMLAttributes(vtkPVXMLElement* element)
   {
     this->SetExecutiveName(executiveName);
   }
+
+  vtkPVXMLElement* hints = element->FindNestedElementByName("Hints");
+  this->Internals->PrefetchTimeStepsHint =
+    hints && hints->FindNestedElementByName("PrefetchTimeSteps") != nullptr;
   return true;
 }
 
@@ -59,6 +59,47 @@ public:
    */
   void RecreateVTKObjects() override;
 
+  /**
+   * Overridden to keep the shadow source used to prefetch timesteps, if any,
+   * in sync with the algorithm.
+   */
+  void Push(vtkSMMessage* msg) override;
+
+  /**
+   * Requests that the timestep matching \c time is read in the background so
+   * that a later UpdatePipeline() for that time does not have to execute the
+   * reader. Ignored unless timestep prefetching was enabled when the output
+   * ports were created and the algorithm supports it.
+   * Called from client.
+   * @sa vtkPVTimeStepPrefetcher
+   */
+  virtual void PrefetchTimeStep(double time);
+
+  ///@{
+  /**
+   * Set the number of timesteps to prefetch ahead of the current time when
+   * playing an animation. 0 (default) disables prefetching. Only affects
+   * output ports created after the call.
+   *
+   * Prefetching uses a second instance of the reader, updated on the process
+   * module's callback queue. Since both instances are updated concurrently,
+   * it is only done for readers that opt in with the `PrefetchTimeSteps` hint
+   * in their proxy definition, i.e. `<Hints><PrefetchTimeSteps/></Hints>`,
+   * without subproxies, in serial or on single-process servers.
+   */
+  static void SetNumberOfTimeStepsToPrefetch(int count);
+  static int GetNumberOfTimeStepsToPrefetch();
+  ///@}
+
+  ///@{
+  /**
+   * Set the maximum size, in KiB, of the prefetched timesteps of each reader.
+   * @sa vtkPVTimeStepPrefetcher::SetMemoryLimit
+   */
+  static void SetTimeStepPrefetchMemoryLimit(unsigned long limit);
+  static unsigned long GetTimeStepPrefetchMemoryLimit();
+  ///@}
+
 protected:
   vtkSISourceProxy();
   ~vtkSISourceProxy() override;
@@ -88,6 +129,12 @@ protected:
    */
   virtual bool CreateOutputPorts();
 
+  /**
+   * Returns true if the timesteps of the algorithm can be prefetched. The
+   * default implementation requires the `PrefetchTimeSteps` hint.
+   */
+  virtual bool CanPrefetchTimeSteps();
+
   ///@{
   /**
    * Callbacks to add start/end events to the timer log.
@@ -75,6 +75,7 @@ void vtkSMArrayRangeDomain::Update(const char* arrayName, int fieldAssociation,
   }
 
   vtkPVArrayInformation* arrayInfo = info->GetArrayInformation(arrayName, fieldAssociation);
+  int arrayAssociation = fieldAssociation;
 
   if (arrayInfo == nullptr &&
     (fieldAssociation == vtkDataObject::POINT || fieldAssociation == vtkDataObject::CELL))
@@ -94,6 +95,7 @@ void vtkSMArrayRangeDomain::Update(const char* arrayName, int fieldAssociation,
 
       arrayInfo = info->GetArrayInformation(arrayName, otherField);
       arrayInfo = arrayInfo ? arrayInfo : info->GetArrayInformation(name.c_str(), otherField);
+      arrayAssociation = otherField;
     }
 
     // Now, extract static component information if no dynamic component have been specified.
@@ -113,6 +115,13 @@ void vtkSMArrayRangeDomain::Update(const char* arrayName, int fieldAssociation,
     }
   }
 
+  if (arrayInfo && !arrayInfo->GetHasRanges())
+  {
+    // data information was gathered without ranges, request them for this array only.
+    arrayInfo = producer->GetArrayInformationWithRanges(
+      static_cast<unsigned int>(producerPort), arrayInfo->GetName(), arrayAssociation);
+  }
+
   if (!arrayInfo)
   {
     std::vector<vtkEntry> values;
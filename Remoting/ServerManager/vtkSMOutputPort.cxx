@@ -9,22 +9,45 @@
 #include "vtkDataAssembly.h"
 #include "vtkDataAssemblyUtilities.h"
 #include "vtkDataObject.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVArrayInformation.h"
 #include "vtkPVClassNameInformation.h"
 #include "vtkPVDataInformation.h"
+#include "vtkPVLogger.h"
 #include "vtkPVTemporalDataInformation.h"
+#include "vtkPVTemporalRangesInformation.h"
 #include "vtkPVXMLElement.h"
 #include "vtkProcessModule.h"
 #include "vtkSMCompoundSourceProxy.h"
 #include "vtkSMMessage.h"
 #include "vtkSMSession.h"
+#include "vtkSMTemporalRangeCache.h"
 #include "vtkTimerLog.h"
 
+#include <iterator>
 #include <sstream>
 
+namespace
+{
+bool vtkSMOutputPortLazyArrayRanges = false;
+}
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkSMOutputPort);
 
+//----------------------------------------------------------------------------
+void vtkSMOutputPort::SetLazyArrayRanges(bool lazy)
+{
+  vtkSMOutputPortLazyArrayRanges = lazy;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMOutputPort::GetLazyArrayRanges()
+{
+  return vtkSMOutputPortLazyArrayRanges;
+}
+
 //----------------------------------------------------------------------------
 vtkSMOutputPort::vtkSMOutputPort()
 {
@@ -227,6 +250,94 @@ vtkPVDataInformation* vtkSMOutputPort::GetRankDataInformation(int rank)
   return rankInfo;
 }
 
+//----------------------------------------------------------------------------
+vtkPVArrayInformation* vtkSMOutputPort::GetArrayInformationWithRanges(
+  const char* arrayName, int fieldAssociation)
+{
+  auto dinfo = this->GetDataInformation();
+  auto ainfo = dinfo->GetArrayInformation(arrayName, fieldAssociation);
+  if (ainfo == nullptr || ainfo->GetHasRanges() || !this->SourceProxy)
+  {
+    return ainfo;
+  }
+
+  this->SourceProxy->GetSession()->PrepareProgress();
+
+  vtkNew<vtkPVDataInformation> rangesInfo;
+  rangesInfo->Initialize();
+  rangesInfo->SetPortNumber(this->PortIndex);
+  rangesInfo->SetComputeArrayRanges(false);
+  rangesInfo->AddRangeArray(fieldAssociation, arrayName);
+  this->SourceProxy->GatherInformation(rangesInfo);
+
+  if (auto rangesAInfo = rangesInfo->GetArrayInformation(arrayName, fieldAssociation))
+  {
+    ainfo->CopyRangesFrom(rangesAInfo);
+    if (this->RecordTemporalRanges)
+    {
+      vtkSMTemporalRangeCache::GetInstance()->Record(this->SourceProxy, this->PortIndex, dinfo);
+    }
+  }
+  this->SourceProxy->GetSession()->CleanupPendingProgress();
+  return ainfo;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMOutputPort::GetTemporalArrayRanges(
+  const char* arrayName, int fieldAssociation, std::map<double, std::vector<double>>& ranges)
+{
+  ranges.clear();
+  if (!arrayName || !this->SourceProxy)
+  {
+    return false;
+  }
+
+  const auto& timesteps = this->GetDataInformation()->GetTimeSteps();
+  if (timesteps.empty())
+  {
+    return false;
+  }
+
+  auto cache = vtkSMTemporalRangeCache::GetInstance();
+  this->RecordTemporalRanges = cache->GetEnabled();
+  const std::string key = cache->GetKey(this->SourceProxy, this->PortIndex);
+  vtkNew<vtkPVTemporalRangesInformation> info;
+  info->SetPortNumber(this->PortIndex);
+  info->SetFieldAssociation(fieldAssociation);
+  info->SetArrayName(arrayName);
+  size_t missing = 0;
+  for (const double time : timesteps)
+  {
+    if (!cache->Find(key, fieldAssociation, arrayName, time, ranges[time]))
+    {
+      info->AddTimeStep(time);
+      ++missing;
+    }
+  }
+  vtkVLogF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "%s: ranges of '%s' cached for %d of %d timesteps",
+    this->SourceProxy->GetLogNameOrDefault(), arrayName,
+    static_cast<int>(timesteps.size() - missing), static_cast<int>(timesteps.size()));
+
+  if (missing > 0)
+  {
+    this->SourceProxy->GetSession()->PrepareProgress();
+    this->SourceProxy->GatherInformation(info);
+    this->SourceProxy->GetSession()->CleanupPendingProgress();
+    for (const auto& item : info->GetRanges())
+    {
+      ranges[item.first] = item.second;
+      cache->Insert(key, fieldAssociation, arrayName, item.first, item.second);
+    }
+    cache->Flush();
+  }
+
+  for (auto iter = ranges.begin(); iter != ranges.end();)
+  {
+    iter = iter->second.empty() ? ranges.erase(iter) : std::next(iter);
+  }
+  return !ranges.empty();
+}
+
 //----------------------------------------------------------------------------
 vtkPVClassNameInformation* vtkSMOutputPort::GetClassNameInformation()
 {
@@ -266,8 +377,14 @@ void vtkSMOutputPort::GatherDataInformation()
   this->SourceProxy->GetSession()->PrepareProgress();
   this->DataInformation->Initialize();
   this->DataInformation->SetPortNumber(this->PortIndex);
+  this->DataInformation->SetComputeArrayRanges(!vtkSMOutputPortLazyArrayRanges);
   this->SourceProxy->GatherInformation(this->DataInformation);
   this->DataInformation->Modified();
+  if (this->RecordTemporalRanges)
+  {
+    vtkSMTemporalRangeCache::GetInstance()->Record(
+      this->SourceProxy, this->PortIndex, this->DataInformation);
+  }
 
   this->DataInformationValid = true;
   this->SourceProxy->GetSession()->CleanupPendingProgress();
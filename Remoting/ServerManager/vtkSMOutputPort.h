@@ -23,9 +23,11 @@
 #include "vtkSmartPointer.h" // needed for vtkSmartPointer
 #include "vtkWeakPointer.h"  // needed for vtkWeakPointer
 
-#include <map> // needed for std::map
+#include <map>    // needed for std::map
+#include <vector> // needed for std::vector
 
 class vtkCollection;
+class vtkPVArrayInformation;
 class vtkPVClassNameInformation;
 class vtkPVDataAssemblyInformation;
 class vtkPVDataInformation;
@@ -94,6 +96,41 @@ public:
     const char* selector, const char* assemblyName = nullptr);
   ///@}
 
+  /**
+   * Returns the array information for the array named \c arrayName with the given
+   * field association, ensuring its component ranges are available. When
+   * the data information was gathered without array ranges (see
+   * `SetLazyArrayRanges`), this requests the ranges for that single array from
+   * the server and updates the array information returned by
+   * `GetDataInformation`. Returns nullptr if no such array exists.
+   */
+  vtkPVArrayInformation* GetArrayInformationWithRanges(
+    const char* arrayName, int fieldAssociation);
+
+  /**
+   * Fills `ranges` with the finite ranges of the array named \c arrayName at
+   * each timestep of the data, laid out as described in
+   * vtkPVTemporalRangesInformation. When vtkSMTemporalRangeCache is enabled,
+   * ranges recorded in an earlier call, or in an earlier session, are reused:
+   * only the missing timesteps are gathered, which updates the pipeline at each
+   * of them. From then on, the ranges gathered with the data information of
+   * this port, e.g. as an animation plays, are recorded too. Returns false if
+   * the data has no timesteps or the array was not found at any of them.
+   */
+  bool GetTemporalArrayRanges(
+    const char* arrayName, int fieldAssociation, std::map<double, std::vector<double>>& ranges);
+
+  ///@{
+  /**
+   * When enabled, data information is gathered without computing array ranges,
+   * which requires a full pass over every array on every rank. Ranges are then
+   * requested per array, when needed, using `GetArrayInformationWithRanges`.
+   * Default is false.
+   */
+  static void SetLazyArrayRanges(bool lazy);
+  static bool GetLazyArrayRanges();
+  ///@}
+
   /**
    * Returns the classname of the data object on this output port.
    */
@@ -176,6 +213,10 @@ protected:
   vtkPVTemporalDataInformation* TemporalDataInformation;
   bool TemporalDataInformationValid;
 
+  // Set once ranges over time were requested. Only then are the ranges
+  // gathered with the data information recorded in vtkSMTemporalRangeCache.
+  bool RecordTemporalRanges = false;
+
   std::map<std::string, std::map<int, vtkSmartPointer<vtkPVDataInformation>>>
     SubsetDataInformations;
   std::map<std::string, std::map<int, vtkSmartPointer<vtkPVTemporalDataInformation>>>
@@ -13,7 +13,6 @@
 #include "vtkObjectFactory.h"
 #include "vtkPVInformation.h"
 #include "vtkPVLogger.h"
-#include "vtkPVPluginLoader.h"
 #include "vtkPVXMLElement.h"
 #include "vtkProcessModule.h"
 #include "vtkSIProxy.h"
@@ -21,7 +20,6 @@
 #include "vtkSMDocumentation.h"
 #include "vtkSMInputProperty.h"
 #include "vtkSMMessage.h"
-#include "vtkSMPluginLoaderProxy.h"
 #include "vtkSMPropertyGroup.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMPropertyIterator.h"
@@ -900,18 +898,10 @@ bool vtkSMProxy::LoadPluginIfEnsured()
 {
   if (this->EnsurePluginLoaded)
   {
-    // Ensure local plugin is loaded
+    // Ensure the plugin is loaded locally and on the servers, the first time
+    // one of its proxies is created in the session.
     const char* pluginName = this->EnsurePluginLoaded->GetAttributeOrEmpty("name");
-    vtkNew<vtkPVPluginLoader> loader;
-    bool ret = loader->LoadPluginByName(pluginName, false);
-
-    // Ensure remote plugin is loaded
-    vtkSMSessionProxyManager* pxm = this->GetSessionProxyManager();
-    auto proxy = vtkSmartPointer<vtkSMPluginLoaderProxy>::Take(
-      vtkSMPluginLoaderProxy::SafeDownCast(pxm->NewProxy("misc", "PluginLoader")));
-    proxy->UpdateVTKObjects();
-    ret &= proxy->LoadPluginByName(pluginName, false);
-    return ret;
+    return this->GetSessionProxyManager()->EnsurePluginLoaded(pluginName);
   }
   return false;
 }
@@ -12,6 +12,7 @@
 #include "vtkSMSessionProxyManager.h"
 #include "vtkSMSourceProxy.h"
 #include "vtkSMStringVectorProperty.h"
+#include "vtkSMTemporalRangeCache.h"
 #include "vtkSMTrace.h"
 #include "vtkSmartPointer.h"
 
@@ -161,6 +162,8 @@ bool vtkSMReaderReloadHelper::ReloadFiles(vtkSMSourceProxy* proxy)
   {
     proxy->RecreateVTKObjects();
   }
+  // files may have changed without the properties of the proxy changing.
+  vtkSMTemporalRangeCache::GetInstance()->MarkModified(proxy);
   proxy->UpdatePipelineInformation();
   return true;
 }
@@ -114,6 +114,46 @@ void vtkSMSession::PushState(vtkSMMessage* msg)
   this->Superclass::PushState(msg);
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSession::BeginBatch()
+{
+  ++this->BatchDepth;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSession::EndBatch()
+{
+  if (this->BatchDepth <= 0)
+  {
+    vtkErrorMacro("BeginBatch and EndBatch mismatch!");
+    this->BatchDepth = 0;
+    return;
+  }
+  if (--this->BatchDepth == 0)
+  {
+    this->FlushBatch();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSMSession::vtkScopedBatch::vtkScopedBatch(vtkSMSession* session)
+  : Session(session)
+{
+  if (this->Session)
+  {
+    this->Session->BeginBatch();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSMSession::vtkScopedBatch::~vtkScopedBatch()
+{
+  if (this->Session)
+  {
+    this->Session->EndBatch();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSession::UpdateStateHistory(vtkSMMessage* msg)
 {
@@ -203,6 +243,7 @@ bool vtkSMSession::IsMPIInitialized(vtkTypeUInt32)
 void vtkSMSession::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "BatchDepth: " << this->BatchDepth << endl;
 }
 
 //----------------------------------------------------------------------------
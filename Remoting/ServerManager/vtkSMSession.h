@@ -94,6 +94,49 @@ public:
    */
   virtual unsigned int GetRenderClientMode();
 
+  //---------------------------------------------------------------------------
+  // API for batching messages.
+  //---------------------------------------------------------------------------
+
+  ///@{
+  /**
+   * Begins or ends a batch. Between the outermost BeginBatch() and EndBatch()
+   * calls, the messages that don't need a reply from the servers, such as
+   * property pushes, proxy creations and registrations, are queued and sent
+   * together when the batch ends or as soon as a reply is needed. This saves
+   * round trips when many proxies are updated at once, e.g. when loading a
+   * state. Batches can be nested. Messages are never queued in builtin
+   * sessions.
+   */
+  void BeginBatch();
+  void EndBatch();
+  bool GetInBatch() const { return this->BatchDepth > 0; }
+  ///@}
+
+  /**
+   * Sends the queued messages right away. Does nothing in builtin sessions.
+   */
+  virtual void FlushBatch() {}
+
+  /**
+   * Helper class calling BeginBatch() in its constructor and EndBatch() in its
+   * destructor.
+   * @code
+   * {
+   *    vtkSMSession::vtkScopedBatch batch(session);
+   *    ...
+   * }
+   * @endcode
+   */
+  class VTKREMOTINGSERVERMANAGER_EXPORT vtkScopedBatch
+  {
+    vtkSMSession* Session;
+
+  public:
+    vtkScopedBatch(vtkSMSession* session);
+    ~vtkScopedBatch();
+  };
+
   //---------------------------------------------------------------------------
   // Undo/Redo related API.
   //---------------------------------------------------------------------------
@@ -304,6 +347,9 @@ protected:
   vtkSMStateLocator* StateLocator;
   vtkSMProxyLocator* ProxyLocator;
 
+  // Depth of nested BeginBatch() calls.
+  int BatchDepth = 0;
+
 private:
   vtkSMSession(const vtkSMSession&) = delete;
   void operator=(const vtkSMSession&) = delete;
@@ -10,6 +10,7 @@
 #include "vtkNetworkAccessManager.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkPVMultiClientsInformation.h"
 #include "vtkPVProgressHandler.h"
 #include "vtkPVServerInformation.h"
@@ -34,9 +35,13 @@
 #include <sstream>
 #include <string>
 #include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <set>
+#include <utility>
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -50,6 +55,16 @@ void RMICallback(
   self->OnServerNotificationMessageRMI(remoteArg, remoteArgLength);
 }
 };
+
+//****************************************************************************/
+class vtkSMSessionClient::vtkBatchInternals
+{
+public:
+  // Messages queued since the last flush, in order, with the controller of the
+  // server they are sent to.
+  std::vector<std::pair<vtkMultiProcessController*, std::vector<unsigned char>>> Messages;
+};
+
 //****************************************************************************/
 vtkStandardNewMacro(vtkSMSessionClient);
 vtkCxxSetObjectMacro(vtkSMSessionClient, RenderServerController, vtkMultiProcessController);
@@ -81,6 +96,8 @@ vtkSMSessionClient::vtkSMSessionClient()
   // Default value
   this->NoMoreDelete = false;
   this->NotBusy = 0;
+
+  this->BatchInternals = new vtkBatchInternals();
 }
 
 //----------------------------------------------------------------------------
@@ -109,11 +126,18 @@ vtkSMSessionClient::~vtkSMSessionClient()
 
   delete this->ServerLastInvokeResult;
   this->ServerLastInvokeResult = nullptr;
+
+  delete this->BatchInternals;
+  this->BatchInternals = nullptr;
 }
 
 //----------------------------------------------------------------------------
 vtkMultiProcessController* vtkSMSessionClient::GetController(ServerFlags processType)
 {
+  // the controller may be used to communicate with the servers directly, so
+  // queued messages must be sent first.
+  this->FlushBatch();
+
   switch (processType)
   {
     case CLIENT:
@@ -522,6 +546,7 @@ bool vtkSMSessionClient::IsMPIInitialized(vtkTypeUInt32 servers)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::CloseSession()
 {
+  this->FlushBatch();
   if (this->DataServerController)
   {
     this->DataServerController->TriggerRMIOnAllChildren(vtkPVSessionServer::CLOSE_SESSION);
@@ -540,6 +565,7 @@ void vtkSMSessionClient::CloseSession()
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PreDisconnection()
 {
+  this->FlushBatch();
   this->NoMoreDelete = true;
 }
 
@@ -592,11 +618,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    for (int cc = 0; cc < num_controllers; cc++)
-    {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-    }
+    this->PostClientServerMessage(controllers, num_controllers, std::move(raw_message));
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -632,8 +654,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         stream << msg.SerializeAsString();
         std::vector<unsigned char> raw_message;
         stream.GetRawData(raw_message);
-        this->DataServerController->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        this->PostClientServerMessage(&this->DataServerController, 1, std::move(raw_message));
       }
       else if (!remoteObject)
       {
@@ -658,6 +679,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PullState(vtkSMMessage* message)
 {
+  this->FlushBatch();
   this->StartBusyWork();
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
@@ -686,8 +708,7 @@ void vtkSMSessionClient::PullState(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->TriggerClientServerMessage(controller, raw_message);
 
     // Get the reply
     vtkMultiProcessStream replyStream;
@@ -736,15 +757,27 @@ void vtkSMSessionClient::ExecuteStream(
     vtkMultiProcessStream stream;
     stream << static_cast<int>(vtkPVSessionServer::EXECUTE_STREAM)
            << static_cast<int>(ignore_errors) << static_cast<int>(size);
+    if (this->GetInBatch())
+    {
+      // the stream cannot be sent separately, so it goes in the message.
+      stream.Push(const_cast<unsigned char*>(data), static_cast<unsigned int>(size));
+    }
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
 
-    for (int cc = 0; cc < num_controllers; cc++)
+    if (this->GetInBatch())
+    {
+      this->PostClientServerMessage(controllers, num_controllers, std::move(raw_message));
+    }
+    else
     {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-      controllers[cc]->Send(
-        data, static_cast<int>(size), 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
+      // the stream is sent straight from its own storage.
+      for (int cc = 0; cc < num_controllers; cc++)
+      {
+        this->TriggerClientServerMessage(controllers[cc], raw_message);
+        controllers[cc]->Send(
+          data, static_cast<int>(size), 1, vtkPVSessionServer::EXECUTE_STREAM_TAG);
+      }
     }
   }
 
@@ -757,6 +790,7 @@ void vtkSMSessionClient::ExecuteStream(
 //----------------------------------------------------------------------------
 const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 location)
 {
+  this->FlushBatch();
   this->StartBusyWork();
   location = this->GetRealLocation(location);
 
@@ -783,8 +817,7 @@ const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 loc
     stream << static_cast<int>(vtkPVSessionServer::LAST_RESULT);
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->TriggerClientServerMessage(controller, raw_message);
 
     // Get the reply
     int size = 0;
@@ -805,6 +838,7 @@ const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 loc
 bool vtkSMSessionClient::GatherInformation(
   vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
 {
+  this->FlushBatch();
   this->StartBusyWork();
   if (this->RenderServerController == nullptr)
   {
@@ -857,8 +891,7 @@ bool vtkSMSessionClient::GatherInformation(
 
   if (controller)
   {
-    controller->TriggerRMIOnAllChildren(&raw_message[0], static_cast<int>(raw_message.size()),
-      vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    this->TriggerClientServerMessage(controller, raw_message);
 
     int length2 = 0;
     controller->Receive(&length2, 1, 1, vtkPVSessionServer::REPLY_GATHER_INFORMATION_TAG);
@@ -925,11 +958,7 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    for (int cc = 0; cc < num_controllers; cc++)
-    {
-      controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-        static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-    }
+    this->PostClientServerMessage(controllers, num_controllers, std::move(raw_message));
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -966,14 +995,7 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
     stream << message->SerializeAsString();
     std::vector<unsigned char> raw_message;
     stream.GetRawData(raw_message);
-    for (int cc = 0; cc < num_controllers; cc++)
-    {
-      if (controllers[cc] != nullptr)
-      {
-        controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
-          static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
-      }
-    }
+    this->PostClientServerMessage(controllers, num_controllers, std::move(raw_message));
   }
 
   if ((location & vtkPVSession::CLIENT) != 0)
@@ -982,10 +1004,97 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::PostClientServerMessage(vtkMultiProcessController* const* controllers,
+  int numberOfControllers, std::vector<unsigned char>&& raw_message)
+{
+  for (int cc = 0; cc < numberOfControllers; cc++)
+  {
+    if (controllers[cc] == nullptr)
+    {
+      continue;
+    }
+    if (!this->GetInBatch())
+    {
+      this->TriggerClientServerMessage(controllers[cc], raw_message);
+    }
+    else if (cc + 1 < numberOfControllers)
+    {
+      this->BatchInternals->Messages.emplace_back(controllers[cc], raw_message);
+    }
+    else
+    {
+      // the last server takes the message rather than a copy.
+      this->BatchInternals->Messages.emplace_back(controllers[cc], std::move(raw_message));
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::TriggerClientServerMessage(
+  vtkMultiProcessController* controller, const std::vector<unsigned char>& raw_message)
+{
+  if (this->SimulatedLatency > 0)
+  {
+    vtksys::SystemTools::Delay(this->SimulatedLatency);
+  }
+  this->NumberOfMessagesSent++;
+  controller->TriggerRMIOnAllChildren(const_cast<unsigned char*>(raw_message.data()),
+    static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::FlushBatch()
+{
+  if (this->BatchInternals->Messages.empty())
+  {
+    return;
+  }
+
+  // messages queued while flushing, if any, are sent by the next flush.
+  std::vector<std::pair<vtkMultiProcessController*, std::vector<unsigned char>>> messages;
+  std::swap(messages, this->BatchInternals->Messages);
+
+  // consecutive messages for the same server are sent together, so that the
+  // servers execute the messages in the order they were queued.
+  int numberOfMessages = 0;
+  vtkTypeUInt64 size = 0;
+  for (auto begin = messages.begin(); begin != messages.end();)
+  {
+    vtkMultiProcessController* controller = begin->first;
+    auto end = std::find_if(begin, messages.end(),
+      [controller](const auto& message) { return message.first != controller; });
+    const int count = static_cast<int>(std::distance(begin, end));
+
+    vtkMultiProcessStream stream;
+    stream << static_cast<int>(vtkPVSessionServer::BATCH) << count;
+    for (auto iter = begin; iter != end; ++iter)
+    {
+      stream.Push(iter->second.data(), static_cast<unsigned int>(iter->second.size()));
+    }
+    std::vector<unsigned char> raw_message;
+    stream.GetRawData(raw_message);
+    this->TriggerClientServerMessage(controller, raw_message);
+
+    numberOfMessages += count;
+    size += raw_message.size();
+    begin = end;
+  }
+
+  this->LastBatchNumberOfMessages = numberOfMessages;
+  this->LastBatchSize = size;
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "sent %d batched messages (%llu bytes)",
+    numberOfMessages, static_cast<unsigned long long>(size));
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "SimulatedLatency: " << this->SimulatedLatency << endl;
+  os << indent << "LastBatchNumberOfMessages: " << this->LastBatchNumberOfMessages << endl;
+  os << indent << "LastBatchSize: " << this->LastBatchSize << endl;
+  os << indent << "NumberOfMessagesSent: " << this->NumberOfMessagesSent << endl;
 }
 //----------------------------------------------------------------------------
 vtkTypeUInt32 vtkSMSessionClient::GetNextGlobalUniqueIdentifier()
@@ -14,6 +14,8 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSMSession.h"
 
+#include <vector> // for std::vector
+
 class vtkMultiProcessController;
 class vtkPVServerInformation;
 class vtkSMCollaborationManager;
@@ -214,6 +216,41 @@ public:
 
   void OnServerNotificationMessageRMI(void* message, int message_length);
 
+  //---------------------------------------------------------------------------
+  // API for batching messages
+  //---------------------------------------------------------------------------
+
+  /**
+   * Sends the queued messages. Consecutive messages for the same server are
+   * sent as a single message, so that the servers execute the messages in the
+   * order they were queued.
+   */
+  void FlushBatch() override;
+
+  ///@{
+  /**
+   * Returns the number of messages and the number of bytes sent by the last
+   * FlushBatch() that had messages to send.
+   */
+  vtkGetMacro(LastBatchNumberOfMessages, int);
+  vtkGetMacro(LastBatchSize, vtkTypeUInt64);
+  ///@}
+
+  /**
+   * Returns the number of messages sent to the servers since the session was
+   * created. Each message sent by FlushBatch() counts as one.
+   */
+  vtkGetMacro(NumberOfMessagesSent, vtkTypeUInt64);
+
+  ///@{
+  /**
+   * Delay, in milliseconds, added before each message sent to the servers.
+   * This simulates a high-latency connection, for testing. Default is 0.
+   */
+  vtkSetClampMacro(SimulatedLatency, int, 0, VTK_INT_MAX);
+  vtkGetMacro(SimulatedLatency, int);
+  ///@}
+
 protected:
   vtkSMSessionClient();
   ~vtkSMSessionClient() override;
@@ -277,9 +314,30 @@ private:
   vtkSMSessionClient(const vtkSMSessionClient&) = delete;
   void operator=(const vtkSMSessionClient&) = delete;
 
+  /**
+   * Queues the message for each of the controllers when in a batch, otherwise
+   * sends it right away. Null controllers are skipped.
+   */
+  void PostClientServerMessage(vtkMultiProcessController* const* controllers,
+    int numberOfControllers, std::vector<unsigned char>&& raw_message);
+
+  /**
+   * Sends the message right away.
+   */
+  void TriggerClientServerMessage(
+    vtkMultiProcessController* controller, const std::vector<unsigned char>& raw_message);
+
   int NotBusy;
   vtkTypeUInt32 LastGlobalID;
   vtkTypeUInt32 LastGlobalIDAvailable;
+
+  int SimulatedLatency = 0;
+  int LastBatchNumberOfMessages = 0;
+  vtkTypeUInt64 LastBatchSize = 0;
+  vtkTypeUInt64 NumberOfMessagesSent = 0;
+
+  class vtkBatchInternals;
+  vtkBatchInternals* BatchInternals;
 };
 
 #endif
@@ -8,6 +8,8 @@
 #include "vtkEventForwarderCommand.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
+#include "vtkPVPluginLoader.h"
 #include "vtkPVProxyDefinitionIterator.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
@@ -18,6 +20,7 @@
 #include "vtkSMDeserializerProtobuf.h"
 #include "vtkSMDocumentation.h"
 #include "vtkSMPipelineState.h"
+#include "vtkSMPluginLoaderProxy.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMPropertyIterator.h"
 #include "vtkSMProxy.h"
@@ -1220,6 +1223,11 @@ void vtkSMSessionProxyManager::LoadXMLState(vtkPVXMLElement* rootElement,
 
   bool prev = this->InLoadXMLState;
   this->InLoadXMLState = true;
+
+  // coalesce the proxy creations, registrations and property pushes until a
+  // reply from the servers is needed.
+  vtkSMSession::vtkScopedBatch batch(this->GetSession());
+
   vtkSmartPointer<vtkSMStateLoader> spLoader;
   if (!loader)
   {
@@ -1801,6 +1809,43 @@ bool vtkSMSessionProxyManager::HasDefinition(const char* groupName, const char*
     this->ProxyDefinitionManager->HasDefinition(groupName, proxyName);
 }
 
+//---------------------------------------------------------------------------
+bool vtkSMSessionProxyManager::EnsurePluginLoaded(const char* pluginName)
+{
+  if (!pluginName || !pluginName[0])
+  {
+    return false;
+  }
+  auto& ensuredPlugins = this->Internals->EnsuredPlugins;
+  if (ensuredPlugins.find(pluginName) != ensuredPlugins.end())
+  {
+    return true;
+  }
+
+  vtkVLogF(PARAVIEW_LOG_PLUGIN_VERBOSITY(), "load plugin `%s` on first use", pluginName);
+  vtkNew<vtkPVPluginLoader> loader;
+  bool ret = loader->LoadPluginByName(pluginName, false);
+
+  // builtin sessions share the plugins loaded locally.
+  if (vtkSMSessionClient::SafeDownCast(this->GetSession()))
+  {
+    auto proxy = vtkSmartPointer<vtkSMPluginLoaderProxy>::Take(
+      vtkSMPluginLoaderProxy::SafeDownCast(this->NewProxy("misc", "PluginLoader")));
+    if (!proxy)
+    {
+      return false;
+    }
+    proxy->UpdateVTKObjects();
+    ret &= proxy->LoadPluginByName(pluginName, false);
+  }
+
+  if (ret)
+  {
+    ensuredPlugins.insert(pluginName);
+  }
+  return ret;
+}
+
 //---------------------------------------------------------------------------
 void vtkSMSessionProxyManager::RegisterSelectionModel(
   const char* name, vtkSMProxySelectionModel* model)
@@ -485,6 +485,15 @@ public:
    */
   bool HasDefinition(const char* groupName, const char* proxyName);
 
+  /**
+   * Loads the plugin with the given name locally and on the servers, unless it
+   * was already loaded this way in this session. This is used to load the
+   * shared library of delayed load plugins when one of their proxies is first
+   * created, their definitions being registered from the XML listed in the
+   * plugin configuration file. Returns true if the plugin is loaded.
+   */
+  bool EnsurePluginLoaded(const char* pluginName);
+
   /**
    * Get if there are any registered proxies that have their properties in
    * a modified state.
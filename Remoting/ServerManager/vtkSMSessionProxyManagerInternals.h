@@ -13,6 +13,7 @@
 
 #include <map>                          // for std::map
 #include <set>                          // for std::set
+#include <string>                       // for std::string
 #include <vector>                       // for std::vector
 #include <vtksys/RegularExpression.hxx> // for regexes
 
@@ -199,6 +200,9 @@ struct vtkSMSessionProxyManagerInternals
   // Data structure for storing the fullState
   vtkSMMessage State;
 
+  // Names of the plugins loaded by EnsurePluginLoaded.
+  std::set<std::string> EnsuredPlugins;
+
   // Keep ref to the proxyManager to access the session
   vtkSMSessionProxyManager* ProxyManager;
 
@@ -362,6 +362,23 @@ void vtkSMSourceProxy::UpdatePipeline(double time)
   // this->InvalidateDataInformation();
 }
 
+//---------------------------------------------------------------------------
+void vtkSMSourceProxy::PrefetchTimeSteps(const std::vector<double>& times)
+{
+  if (!this->ObjectsCreated || times.empty())
+  {
+    return;
+  }
+
+  vtkClientServerStream stream;
+  for (double time : times)
+  {
+    stream << vtkClientServerStream::Invoke << SIPROXY(this) << "PrefetchTimeStep" << time
+           << vtkClientServerStream::End;
+  }
+  this->ExecuteStream(stream);
+}
+
 //---------------------------------------------------------------------------
 void vtkSMSourceProxy::CreateVTKObjects()
 {
@@ -537,6 +554,19 @@ vtkPVDataInformation* vtkSMSourceProxy::GetDataInformation(unsigned int idx)
   return this->GetOutputPort(idx)->GetDataInformation();
 }
 
+//----------------------------------------------------------------------------
+vtkPVArrayInformation* vtkSMSourceProxy::GetArrayInformationWithRanges(
+  unsigned int idx, const char* arrayName, int fieldAssociation)
+{
+  this->CreateOutputPorts();
+  if (idx >= this->GetNumberOfOutputPorts())
+  {
+    return nullptr;
+  }
+
+  return this->GetOutputPort(idx)->GetArrayInformationWithRanges(arrayName, fieldAssociation);
+}
+
 //----------------------------------------------------------------------------
 vtkPVDataInformation* vtkSMSourceProxy::GetRankDataInformation(unsigned int idx, int rank)
 {
@@ -24,6 +24,8 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSMProxy.h"
 
+#include <vector> // for std::vector
+
 class vtkPVArrayInformation;
 class vtkPVDataInformation;
 class vtkPVDataSetAttributesInformation;
@@ -58,6 +60,14 @@ public:
    */
   virtual void UpdatePipeline(double time);
 
+  /**
+   * Requests that the data for the given times is read in the background, so
+   * that later calls to UpdatePipeline(time) are faster. This is only a hint,
+   * ignored unless timestep prefetching is enabled on the server.
+   * @sa vtkSISourceProxy::SetNumberOfTimeStepsToPrefetch
+   */
+  virtual void PrefetchTimeSteps(const std::vector<double>& times);
+
   ///@{
   /**
    * Returns if the output port proxies have been created.
@@ -155,6 +165,15 @@ public:
   vtkPVDataInformation* GetSubsetDataInformation(
     unsigned int outputIdx, unsigned int compositeIndex);
 
+  /**
+   * Returns the array information for an array on the given output port with
+   * its component ranges available, requesting them from the server if the
+   * data information was gathered without ranges.
+   * @sa vtkSMOutputPort::GetArrayInformationWithRanges
+   */
+  vtkPVArrayInformation* GetArrayInformationWithRanges(
+    unsigned int outputIdx, const char* arrayName, int fieldAssociation);
+
   ///@{
   /**
    * Get rank-specific data information.
@@ -4,6 +4,7 @@
 
 #include "vtkClientServerStreamInstantiator.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkPVXMLElement.h"
 #include "vtkSMProperty.h"
 #include "vtkSMPropertyLink.h"
@@ -17,7 +18,9 @@
 #include "vtkSMSourceProxy.h"
 #include "vtkSMStateVersionController.h"
 #include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <vector>
@@ -47,11 +50,60 @@ struct vtkSMStateLoaderInternals
   ProxyCreationOrderType ProxyCreationOrder;
   bool DeferProxyRegistration;
 
+  /// Proxies whose pipeline information is updated once all proxies are
+  /// created, in the order they were created.
+  std::vector<vtkWeakPointer<vtkSMProxy>> PipelineInformationOrder;
+  bool DeferPipelineInformation;
+
+  /// Time spent in each loading step. Time spent in a step nested in another,
+  /// e.g. creating an input while loading the properties of a filter, is only
+  /// counted for the nested step.
+  double LoadingTimes[vtkSMStateLoader::NUMBER_OF_LOADING_STEPS];
+  std::vector<int> LoadingSteps;
+  double LastTime;
+
   vtkSMStateLoaderInternals()
     : KeepOriginalId(false)
     , DeferProxyRegistration(false)
+    , DeferPipelineInformation(false)
+    , LastTime(0)
+  {
+    std::fill_n(this->LoadingTimes, vtkSMStateLoader::NUMBER_OF_LOADING_STEPS, 0.0);
+  }
+
+  void StartStep(int step)
+  {
+    const double now = vtkTimerLog::GetUniversalTime();
+    if (!this->LoadingSteps.empty())
+    {
+      this->LoadingTimes[this->LoadingSteps.back()] += now - this->LastTime;
+    }
+    this->LoadingSteps.push_back(step);
+    this->LastTime = now;
+  }
+
+  void EndStep()
   {
+    const double now = vtkTimerLog::GetUniversalTime();
+    this->LoadingTimes[this->LoadingSteps.back()] += now - this->LastTime;
+    this->LoadingSteps.pop_back();
+    this->LastTime = now;
   }
+
+  /// Times the step for the lifetime of the object.
+  class ScopedStep
+  {
+  public:
+    ScopedStep(vtkSMStateLoaderInternals* internals, int step)
+      : Internals(internals)
+    {
+      this->Internals->StartStep(step);
+    }
+    ~ScopedStep() { this->Internals->EndStep(); }
+
+  private:
+    vtkSMStateLoaderInternals* Internals;
+  };
 };
 
 //---------------------------------------------------------------------------
@@ -60,6 +112,7 @@ vtkSMStateLoader::vtkSMStateLoader()
   this->Internal = new vtkSMStateLoaderInternals;
   this->ServerManagerStateElement = nullptr;
   this->KeepIdMapping = 0;
+  this->TwoPhaseLoading = false;
   this->ProxyLocator = vtkSMProxyLocator::New();
 }
 
@@ -180,9 +233,18 @@ vtkSMProxy* vtkSMStateLoader::CreateProxy(
   //**************************************************************************
 
   // If all else fails, let the superclass handle it:
+  vtkSMStateLoaderInternals::ScopedStep step(this->Internal, vtkSMStateLoader::CREATE);
   return this->Superclass::CreateProxy(xml_group, xml_name, subProxyName);
 }
 
+//---------------------------------------------------------------------------
+int vtkSMStateLoader::LoadProxyState(
+  vtkPVXMLElement* element, vtkSMProxy* proxy, vtkSMProxyLocator* locator)
+{
+  vtkSMStateLoaderInternals::ScopedStep step(this->Internal, vtkSMStateLoader::PROPERTIES);
+  return this->Superclass::LoadProxyState(element, proxy, locator);
+}
+
 //---------------------------------------------------------------------------
 void vtkSMStateLoader::CreatedNewProxy(vtkTypeUInt32 id, vtkSMProxy* proxy)
 {
@@ -209,14 +271,21 @@ void vtkSMStateLoader::CreatedNewProxy(vtkTypeUInt32 id, vtkSMProxy* proxy)
   }
 
   // Calling UpdateVTKObjects() will assign the proxy a GlobalId, if needed.
-  proxy->UpdateVTKObjects();
-  if (proxy->IsA("vtkSMSourceProxy"))
   {
-    vtkSMSourceProxy::SafeDownCast(proxy)->UpdatePipelineInformation();
+    vtkSMStateLoaderInternals::ScopedStep step(this->Internal, vtkSMStateLoader::CREATE);
+    proxy->UpdateVTKObjects();
   }
-  else if (proxy->IsA("vtkSMImporterProxy"))
+  if (proxy->IsA("vtkSMSourceProxy") || proxy->IsA("vtkSMImporterProxy"))
   {
-    proxy->UpdatePipelineInformation();
+    if (this->Internal->DeferPipelineInformation)
+    {
+      this->Internal->PipelineInformationOrder.push_back(proxy);
+    }
+    else
+    {
+      vtkSMStateLoaderInternals::ScopedStep step(this->Internal, vtkSMStateLoader::UPDATE);
+      proxy->UpdatePipelineInformation();
+    }
   }
   if (this->Internal->DeferProxyRegistration)
   {
@@ -238,6 +307,7 @@ void vtkSMStateLoader::RegisterProxy(vtkTypeUInt32 id, vtkSMProxy* proxy)
   {
     return;
   }
+  vtkSMStateLoaderInternals::ScopedStep step(this->Internal, vtkSMStateLoader::REGISTER);
   for (const auto& regInfo : iter->second)
   {
     this->RegisterProxyInternal(regInfo.GroupName.c_str(), regInfo.ProxyName.c_str(), proxy);
@@ -531,9 +601,22 @@ int vtkSMStateLoader::LoadState(vtkPVXMLElement* elem, bool keepOriginalId)
     return 0;
   }
 
+  std::fill_n(this->Internal->LoadingTimes, vtkSMStateLoader::NUMBER_OF_LOADING_STEPS, 0.0);
   this->ProxyLocator->SetDeserializer(this);
-  int ret = this->LoadStateInternal(elem);
+  int ret;
+  {
+    // messages to the server are sent together, until a reply is needed.
+    vtkSMSession::vtkScopedBatch batch(this->GetSession());
+    ret = this->LoadStateInternal(elem);
+  }
   this->ProxyLocator->SetDeserializer(nullptr);
+  this->Internal->LoadingSteps.clear();
+
+  vtkVLogF(PARAVIEW_LOG_APPLICATION_VERBOSITY(),
+    "state loaded (parse: %.3fs, create: %.3fs, properties: %.3fs, update: %.3fs, "
+    "register: %.3fs)",
+    this->GetLoadingTime(PARSE), this->GetLoadingTime(CREATE), this->GetLoadingTime(PROPERTIES),
+    this->GetLoadingTime(UPDATE), this->GetLoadingTime(REGISTER));
 
   // BUG #10650. When animation scene time ranges are read from the state, they
   // often override those that the timekeeper painstakingly computed. Here we
@@ -564,6 +647,7 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
     }
   }
 
+  this->Internal->StartStep(PARSE);
   vtkSMStateVersionController* converter = vtkSMStateVersionController::New();
   if (!converter->Process(parent, this->GetSession()))
   {
@@ -596,6 +680,7 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
       }
     }
   }
+  this->Internal->EndStep();
 
   // Load all compound proxy definitions.
   for (i = 0; i < numElems; i++)
@@ -620,8 +705,14 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   // registered. That way, when properties on TimeKeeper or AnimationScene
   // start getting modified, the proxies they may refer to are already
   // present and registered.
+  //
+  // With TwoPhaseLoading, updating the pipeline information of sources is
+  // also deferred until all proxies are created, so that creating proxies and
+  // pushing their properties is not interleaved with requests to the server.
+  // Each update still needs a round trip to the server.
   std::vector<vtkSmartPointer<vtkPVXMLElement>> deferredCollections;
   this->Internal->DeferProxyRegistration = true;
+  this->Internal->DeferPipelineInformation = this->TwoPhaseLoading;
   for (i = 0; i < numElems; i++)
   {
     vtkPVXMLElement* currentElement = rootElement->GetNestedElement(i);
@@ -635,11 +726,29 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
       }
       else if (!this->HandleProxyCollection(currentElement))
       {
+        this->Internal->DeferPipelineInformation = false;
+        this->Internal->PipelineInformationOrder.clear();
         return 0;
       }
     }
   }
 
+  // Update the pipeline information of sources in the order they were
+  // created, before they are registered.
+  this->Internal->DeferPipelineInformation = false;
+  if (!this->Internal->PipelineInformationOrder.empty())
+  {
+    vtkSMStateLoaderInternals::ScopedStep step(this->Internal, UPDATE);
+    for (const auto& proxy : this->Internal->PipelineInformationOrder)
+    {
+      if (proxy)
+      {
+        proxy->UpdatePipelineInformation();
+      }
+    }
+    this->Internal->PipelineInformationOrder.clear();
+  }
+
   // Register proxies in order they were created (as that's a good dependency
   // order).
   for (vtkSMStateLoaderInternals::ProxyCreationOrderType::const_iterator iter =
@@ -663,6 +772,7 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   assert(this->Internal->ProxyCreationOrder.size() == 0);
 
   // Process link elements.
+  vtkSMStateLoaderInternals::ScopedStep linksStep(this->Internal, PROPERTIES);
   for (i = 0; i < numElems; i++)
   {
     vtkPVXMLElement* currentElement = rootElement->GetNestedElement(i);
@@ -723,10 +833,22 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   return 1;
 }
 
+//---------------------------------------------------------------------------
+double vtkSMStateLoader::GetLoadingTime(int step) const
+{
+  if (step < 0 || step >= NUMBER_OF_LOADING_STEPS)
+  {
+    vtkErrorMacro("Invalid loading step " << step);
+    return 0.0;
+  }
+  return this->Internal->LoadingTimes[step];
+}
+
 //---------------------------------------------------------------------------
 void vtkSMStateLoader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "TwoPhaseLoading: " << this->TwoPhaseLoading << endl;
 }
 
 //---------------------------------------------------------------------------
@@ -6,6 +6,13 @@
  *
  * vtkSMStateLoader can load server manager state from a given
  * vtkPVXMLElement. This element is usually populated by a vtkPVXMLParser.
+ *
+ * By default, the state is loaded in two phases: all proxies are created and
+ * their properties loaded first, then the pipeline information of the sources
+ * is updated and the proxies are registered. Messages to the server are
+ * batched while loading, so the first phase does not wait on the server. The
+ * time spent in each step of the loading is logged with the application
+ * verbosity and can be queried with GetLoadingTime().
  * @sa
  * vtkPVXMLParser vtkPVXMLElement
  */
@@ -37,6 +44,37 @@ public:
    */
   int LoadState(vtkPVXMLElement* rootElement, bool keepOriginalId = false);
 
+  ///@{
+  /**
+   * When true, updating the pipeline information of sources is deferred until
+   * all proxies are created, instead of happening as each source is created.
+   * This changes the order in which the state is loaded, hence it is false by
+   * default.
+   */
+  vtkSetMacro(TwoPhaseLoading, bool);
+  vtkGetMacro(TwoPhaseLoading, bool);
+  vtkBooleanMacro(TwoPhaseLoading, bool);
+  ///@}
+
+  /**
+   * Steps of the loading that are timed.
+   */
+  enum LoadingSteps
+  {
+    PARSE,      ///< converting the state and reading the proxy collections
+    CREATE,     ///< creating proxies and their VTK objects
+    PROPERTIES, ///< loading the properties of proxies, and links
+    UPDATE,     ///< updating the pipeline information of sources
+    REGISTER,   ///< registering proxies
+    NUMBER_OF_LOADING_STEPS
+  };
+
+  /**
+   * Returns the time, in seconds, spent in the given step by the last call to
+   * LoadState().
+   */
+  double GetLoadingTime(int step) const;
+
   ///@{
   /**
    * Get/Set the proxy locator to use. Default is
@@ -85,12 +123,19 @@ protected:
    * true). It also called vtkSMProxy::UpdateVTKObjects() and
    * vtkSMProxy::UpdatePipelineInformation() (if applicable) to ensure that the
    * state loaded on the proxy is "pushed" and any info properties updated.
+   * With TwoPhaseLoading, the pipeline information is updated by
+   * LoadStateInternal() once all proxies are created instead.
    * We also create a list to track the order in which proxies are created.
    * This order is a dependency order too and hence helps us register proxies in
    * order of dependencies.
    */
   void CreatedNewProxy(vtkTypeUInt32 id, vtkSMProxy* proxy) override;
 
+  /**
+   * Overridden to time the loading of properties.
+   */
+  int LoadProxyState(vtkPVXMLElement* element, vtkSMProxy*, vtkSMProxyLocator* locator) override;
+
   /**
    * Overridden so that when new views are to be created, we create views
    * suitable for the connection.
@@ -153,6 +198,7 @@ protected:
   vtkPVXMLElement* ServerManagerStateElement;
   vtkSMProxyLocator* ProxyLocator;
   int KeepIdMapping;
+  bool TwoPhaseLoading;
 
 private:
   vtkSMStateLoader(const vtkSMStateLoader&) = delete;
@@ -0,0 +1,504 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSMTemporalRangeCache.h"
+
+#include "vtkDataObject.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVDataSetAttributesInformation.h"
+#include "vtkPVLogger.h"
+#include "vtkSMCoreUtilities.h"
+#include "vtkSMDoubleVectorProperty.h"
+#include "vtkSMIdTypeVectorProperty.h"
+#include "vtkSMInputProperty.h"
+#include "vtkSMIntVectorProperty.h"
+#include "vtkSMPropertyIterator.h"
+#include "vtkSMProxy.h"
+#include "vtkSMProxyProperty.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionClient.h"
+#include "vtkSMStringVectorProperty.h"
+#include "vtkSmartPointer.h"
+
+#include "vtksys/FStream.hxx"
+#include "vtksys/SystemTools.hxx"
+
+#include "vtk_jsoncpp.h"
+
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <utility>
+
+namespace
+{
+// Keeps the number of datasets in memory small: when exceeded, the recorded
+// ranges are flushed and forgotten.
+constexpr size_t MAX_NUMBER_OF_DATASETS = 64;
+
+// Keys of datasets not in memory are forgotten past this number.
+constexpr size_t MAX_NUMBER_OF_KEYS = 256;
+
+const int FIELD_ASSOCIATIONS[] = { vtkDataObject::FIELD_ASSOCIATION_POINTS,
+  vtkDataObject::FIELD_ASSOCIATION_CELLS, vtkDataObject::FIELD_ASSOCIATION_NONE,
+  vtkDataObject::FIELD_ASSOCIATION_VERTICES, vtkDataObject::FIELD_ASSOCIATION_EDGES,
+  vtkDataObject::FIELD_ASSOCIATION_ROWS };
+}
+
+class vtkSMTemporalRangeCache::vtkInternals
+{
+public:
+  using ArrayKey = std::pair<int, std::string>;
+  using TimeRanges = std::map<double, std::vector<double>>;
+
+  struct Dataset
+  {
+    std::map<ArrayKey, TimeRanges> Arrays;
+    bool Persistent = false;
+    bool Modified = false;
+  };
+  std::map<std::string, Dataset> Datasets;
+
+  // Keys that can be persisted, i.e. for which all the files could be
+  // examined.
+  std::map<std::string, bool> PersistentKeys;
+
+  void SetPersistent(const std::string& key, bool persistent)
+  {
+    this->PersistentKeys[key] = persistent;
+    if (this->PersistentKeys.size() <= MAX_NUMBER_OF_KEYS)
+    {
+      return;
+    }
+    // every change of a property upstream makes a new key. Only the keys of
+    // the datasets in memory are still needed, the others are computed again
+    // by GetKey() when used.
+    for (auto iter = this->PersistentKeys.begin(); iter != this->PersistentKeys.end();)
+    {
+      if (iter->first != key && this->Datasets.find(iter->first) == this->Datasets.end())
+      {
+        iter = this->PersistentKeys.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+  }
+
+  // Incremented by MarkModified, for proxies whose files cannot be examined.
+  std::map<vtkTypeUInt32, int> Generations;
+
+  bool AppendKey(vtkSMProxy* proxy, std::ostream& key, bool local, bool& persistent, int depth)
+  {
+    if (!proxy)
+    {
+      key << "null;";
+      return true;
+    }
+    if (depth > 100)
+    {
+      return false;
+    }
+
+    key << proxy->GetXMLGroup() << "," << proxy->GetXMLName() << "{";
+    const char* fileProperty = vtkSMCoreUtilities::GetFileNameProperty(proxy);
+    bool filesExamined = true;
+
+    vtkSmartPointer<vtkSMPropertyIterator> iter;
+    iter.TakeReference(proxy->NewPropertyIterator());
+    for (iter->Begin(); !iter->IsAtEnd(); iter->Next())
+    {
+      vtkSMProperty* property = iter->GetProperty();
+      if (!property || property->GetInformationOnly())
+      {
+        continue;
+      }
+      key << iter->GetKey() << "=";
+      if (auto dvp = vtkSMDoubleVectorProperty::SafeDownCast(property))
+      {
+        for (unsigned int cc = 0; cc < dvp->GetNumberOfElements(); ++cc)
+        {
+          key << std::setprecision(17) << dvp->GetElement(cc) << ",";
+        }
+      }
+      else if (auto ivp = vtkSMIntVectorProperty::SafeDownCast(property))
+      {
+        for (unsigned int cc = 0; cc < ivp->GetNumberOfElements(); ++cc)
+        {
+          key << ivp->GetElement(cc) << ",";
+        }
+      }
+      else if (auto idvp = vtkSMIdTypeVectorProperty::SafeDownCast(property))
+      {
+        for (unsigned int cc = 0; cc < idvp->GetNumberOfElements(); ++cc)
+        {
+          key << idvp->GetElement(cc) << ",";
+        }
+      }
+      else if (auto svp = vtkSMStringVectorProperty::SafeDownCast(property))
+      {
+        const bool isFile = fileProperty && strcmp(fileProperty, iter->GetKey()) == 0;
+        for (unsigned int cc = 0; cc < svp->GetNumberOfElements(); ++cc)
+        {
+          const char* element = svp->GetElement(cc);
+          key << std::quoted(element ? element : "") << ",";
+          if (isFile && element)
+          {
+            if (local && vtksys::SystemTools::FileExists(element))
+            {
+              key << vtksys::SystemTools::ModifiedTime(element) << ","
+                  << vtksys::SystemTools::FileLength(element) << ",";
+            }
+            else
+            {
+              filesExamined = false;
+            }
+          }
+        }
+      }
+      else if (auto pp = vtkSMProxyProperty::SafeDownCast(property))
+      {
+        auto ip = vtkSMInputProperty::SafeDownCast(pp);
+        for (unsigned int cc = 0; cc < pp->GetNumberOfProxies(); ++cc)
+        {
+          if (!this->AppendKey(pp->GetProxy(cc), key, local, persistent, depth + 1))
+          {
+            return false;
+          }
+          if (ip)
+          {
+            key << ":" << ip->GetOutputPortForConnection(cc) << ",";
+          }
+        }
+      }
+      key << ";";
+    }
+
+    if (!filesExamined)
+    {
+      persistent = false;
+      auto generation = this->Generations.find(proxy->GetGlobalID());
+      key << "generation=" << (generation != this->Generations.end() ? generation->second : 0);
+    }
+    key << "}";
+    return true;
+  }
+
+  std::string GetFileName(const std::string& directory, const std::string& key) const
+  {
+    std::ostringstream name;
+    name << directory << "/" << std::hex << std::setw(16) << std::setfill('0')
+         << static_cast<unsigned long long>(std::hash<std::string>()(key)) << ".json";
+    return name.str();
+  }
+
+  Dataset& GetDataset(const std::string& key, const std::string& directory)
+  {
+    auto iter = this->Datasets.find(key);
+    if (iter != this->Datasets.end())
+    {
+      return iter->second;
+    }
+
+    auto& dataset = this->Datasets[key];
+    auto persistent = this->PersistentKeys.find(key);
+    dataset.Persistent = persistent != this->PersistentKeys.end() && persistent->second;
+    if (dataset.Persistent && !directory.empty())
+    {
+      this->Load(this->GetFileName(directory, key), key, dataset);
+    }
+    return dataset;
+  }
+
+  void Load(const std::string& fileName, const std::string& key, Dataset& dataset)
+  {
+    vtksys::ifstream file(fileName.c_str(), ios::in | ios::binary);
+    if (!file.is_open())
+    {
+      return;
+    }
+    Json::CharReaderBuilder builder;
+    Json::Value root;
+    if (!Json::parseFromStream(builder, file, &root, nullptr) || !root.isObject() ||
+      root["key"].asString() != key)
+    {
+      // a different dataset with the same hash, or an invalid file.
+      return;
+    }
+
+    for (const auto& array : root["arrays"])
+    {
+      auto& ranges =
+        dataset.Arrays[ArrayKey(array["association"].asInt(), array["name"].asString())];
+      for (const auto& timestep : array["timesteps"])
+      {
+        if (timestep.size() < 1)
+        {
+          continue;
+        }
+        auto& values = ranges[timestep[0].asDouble()];
+        values.clear();
+        for (Json::ArrayIndex cc = 1; cc < timestep.size(); ++cc)
+        {
+          values.push_back(timestep[cc].asDouble());
+        }
+      }
+    }
+    vtkVLogF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "loaded temporal ranges from '%s'",
+      fileName.c_str());
+  }
+
+  bool Save(const std::string& fileName, const std::string& key, const Dataset& dataset) const
+  {
+    Json::Value root(Json::objectValue);
+    root["key"] = key;
+    Json::Value arrays(Json::arrayValue);
+    for (const auto& array : dataset.Arrays)
+    {
+      Json::Value value(Json::objectValue);
+      value["association"] = array.first.first;
+      value["name"] = array.first.second;
+      Json::Value timesteps(Json::arrayValue);
+      for (const auto& timestep : array.second)
+      {
+        Json::Value ranges(Json::arrayValue);
+        ranges.append(timestep.first);
+        for (const double range : timestep.second)
+        {
+          ranges.append(range);
+        }
+        timesteps.append(ranges);
+      }
+      value["timesteps"] = timesteps;
+      arrays.append(value);
+    }
+    root["arrays"] = arrays;
+
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "";
+    vtksys::ofstream file(fileName.c_str(), ios::out | ios::binary);
+    if (!file.is_open())
+    {
+      return false;
+    }
+    file << Json::writeString(builder, root);
+    return static_cast<bool>(file);
+  }
+};
+
+vtkStandardNewMacro(vtkSMTemporalRangeCache);
+//----------------------------------------------------------------------------
+vtkSMTemporalRangeCache::vtkSMTemporalRangeCache()
+  : Internals(new vtkSMTemporalRangeCache::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkSMTemporalRangeCache::~vtkSMTemporalRangeCache()
+{
+  this->Flush();
+  delete this->Internals;
+  this->Internals = nullptr;
+}
+
+//----------------------------------------------------------------------------
+vtkSMTemporalRangeCache* vtkSMTemporalRangeCache::GetInstance()
+{
+  static vtkSmartPointer<vtkSMTemporalRangeCache> Instance;
+  if (Instance.GetPointer() == nullptr)
+  {
+    vtkSMTemporalRangeCache* cache = vtkSMTemporalRangeCache::New();
+    Instance = cache;
+    cache->FastDelete();
+  }
+  return Instance;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkSMTemporalRangeCache::GetKey(vtkSMProxy* source, int port)
+{
+  if (!this->Enabled || !source)
+  {
+    return std::string();
+  }
+
+  // files can be examined only if they are on this process.
+  vtkSMSession* session = source->GetSession();
+  const bool local = vtkSMSessionClient::SafeDownCast(session) == nullptr;
+
+  std::ostringstream key;
+  bool persistent = true;
+  if (!local)
+  {
+    key << (session ? session->GetURI() : "") << "|";
+  }
+  if (!this->Internals->AppendKey(source, key, local, persistent, 0))
+  {
+    return std::string();
+  }
+  key << "#" << port;
+
+  const std::string result = key.str();
+  this->Internals->SetPersistent(result, persistent);
+  return result;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTemporalRangeCache::Record(vtkSMProxy* source, int port, vtkPVDataInformation* info)
+{
+  if (!this->Enabled || !info || !info->GetHasTime() ||
+    info->GetTimeSteps().count(info->GetTime()) == 0)
+  {
+    return;
+  }
+
+  const std::string key = this->GetKey(source, port);
+  if (key.empty())
+  {
+    return;
+  }
+
+  std::vector<double> ranges;
+  for (const int association : FIELD_ASSOCIATIONS)
+  {
+    vtkPVDataSetAttributesInformation* attributes = info->GetAttributeInformation(association);
+    for (int idx = 0; attributes && idx < attributes->GetNumberOfArrays(); ++idx)
+    {
+      vtkPVArrayInformation* ainfo = attributes->GetArrayInformation(idx);
+      if (!ainfo || !ainfo->GetName() || !ainfo->GetHasRanges() ||
+        ainfo->GetNumberOfComponents() < 1)
+      {
+        continue;
+      }
+      ranges.clear();
+      for (int comp = -1; comp < ainfo->GetNumberOfComponents(); ++comp)
+      {
+        const double* range = ainfo->GetComponentFiniteRange(comp);
+        ranges.push_back(range[0]);
+        ranges.push_back(range[1]);
+      }
+      this->Insert(key, association, ainfo->GetName(), info->GetTime(), ranges);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMTemporalRangeCache::Find(const std::string& key, int fieldAssociation,
+  const char* arrayName, double time, std::vector<double>& ranges)
+{
+  if (!this->Enabled || key.empty() || !arrayName)
+  {
+    return false;
+  }
+  const auto& dataset = this->Internals->GetDataset(key, this->Directory);
+  auto array = dataset.Arrays.find(vtkInternals::ArrayKey(fieldAssociation, arrayName));
+  if (array == dataset.Arrays.end())
+  {
+    return false;
+  }
+  auto timestep = array->second.find(time);
+  if (timestep == array->second.end())
+  {
+    return false;
+  }
+  ranges = timestep->second;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTemporalRangeCache::Insert(const std::string& key, int fieldAssociation,
+  const char* arrayName, double time, const std::vector<double>& ranges)
+{
+  if (!this->Enabled || key.empty() || !arrayName)
+  {
+    return;
+  }
+
+  auto& internals = *this->Internals;
+  if (internals.Datasets.size() >= MAX_NUMBER_OF_DATASETS &&
+    internals.Datasets.find(key) == internals.Datasets.end())
+  {
+    const bool persistent = internals.PersistentKeys[key];
+    this->Flush();
+    this->Clear();
+    internals.PersistentKeys[key] = persistent;
+  }
+
+  auto& dataset = internals.GetDataset(key, this->Directory);
+  auto& values = dataset.Arrays[vtkInternals::ArrayKey(fieldAssociation, arrayName)][time];
+  if (values != ranges)
+  {
+    values = ranges;
+    dataset.Modified = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTemporalRangeCache::MarkModified(vtkSMProxy* proxy)
+{
+  if (proxy)
+  {
+    this->Internals->Generations[proxy->GetGlobalID()]++;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTemporalRangeCache::Flush()
+{
+  auto& internals = *this->Internals;
+  if (this->Directory.empty())
+  {
+    return;
+  }
+
+  bool directoryExists = false;
+  for (auto& item : internals.Datasets)
+  {
+    auto& dataset = item.second;
+    if (!dataset.Persistent || !dataset.Modified)
+    {
+      continue;
+    }
+    if (!directoryExists)
+    {
+      if (!vtksys::SystemTools::MakeDirectory(this->Directory).IsSuccess())
+      {
+        vtkWarningMacro("Directory '" << this->Directory << "' could not be created.");
+        return;
+      }
+      directoryExists = true;
+    }
+
+    const std::string fileName = internals.GetFileName(this->Directory, item.first);
+    if (internals.Save(fileName, item.first, dataset))
+    {
+      dataset.Modified = false;
+      vtkVLogF(
+        PARAVIEW_LOG_PIPELINE_VERBOSITY(), "saved temporal ranges to '%s'", fileName.c_str());
+    }
+    else
+    {
+      vtkWarningMacro("Could not save temporal ranges to '" << fileName << "'.");
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTemporalRangeCache::Clear()
+{
+  this->Internals->Datasets.clear();
+  this->Internals->PersistentKeys.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTemporalRangeCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << this->Enabled << endl;
+  os << indent << "Directory: " << this->Directory << endl;
+  os << indent << "Number of datasets: " << this->Internals->Datasets.size() << endl;
+}
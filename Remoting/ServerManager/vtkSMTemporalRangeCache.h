@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSMTemporalRangeCache
+ * @brief   cache of the array ranges at each timestep of a dataset.
+ *
+ * vtkSMTemporalRangeCache keeps the finite ranges of arrays at each timestep
+ * of the data produced by an output port, so that rescaling a transfer
+ * function over time does not have to update the pipeline at every timestep.
+ * Ranges are recorded when ranges over time are gathered by vtkSMOutputPort
+ * and, for the ports that gathered them, as a side effect of gathering data
+ * information afterwards. The cache is disabled by default.
+ *
+ * Datasets are identified by a key built from the pipeline upstream of the
+ * port: the XML names and property values of the proxies and, for readers,
+ * the names, modification times and sizes of their files. When a directory is
+ * set, the ranges of each dataset are persisted to a small JSON file in it, so
+ * they are reused in later sessions as long as the files are unchanged. Files
+ * can only be examined in builtin sessions: in client-server sessions, ranges
+ * are kept in memory only and are forgotten when the files are reloaded.
+ *
+ * @sa vtkSMOutputPort, vtkPVTemporalRangesInformation
+ */
+
+#ifndef vtkSMTemporalRangeCache_h
+#define vtkSMTemporalRangeCache_h
+
+#include "vtkObject.h"
+#include "vtkRemotingServerManagerModule.h" //needed for exports
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+
+class vtkPVDataInformation;
+class vtkSMProxy;
+
+class VTKREMOTINGSERVERMANAGER_EXPORT vtkSMTemporalRangeCache : public vtkObject
+{
+public:
+  static vtkSMTemporalRangeCache* New();
+  vtkTypeMacro(vtkSMTemporalRangeCache, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns the singleton used by vtkSMOutputPort.
+   */
+  static vtkSMTemporalRangeCache* GetInstance();
+
+  ///@{
+  /**
+   * Enables the cache. When disabled, nothing is recorded and ranges over time
+   * are always gathered. Default is false.
+   */
+  vtkSetMacro(Enabled, bool);
+  vtkGetMacro(Enabled, bool);
+  vtkBooleanMacro(Enabled, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Directory where the ranges are persisted. When empty, the default, ranges
+   * are only kept in memory.
+   */
+  vtkSetMacro(Directory, std::string);
+  vtkGetMacro(Directory, std::string);
+  ///@}
+
+  /**
+   * Returns the key of the data produced by the given output port of `source`,
+   * or an empty string if the cache is disabled.
+   */
+  std::string GetKey(vtkSMProxy* source, int port);
+
+  /**
+   * Records the ranges of all the arrays of `info` that have ranges, if the
+   * data is at one of its timesteps.
+   */
+  void Record(vtkSMProxy* source, int port, vtkPVDataInformation* info);
+
+  ///@{
+  /**
+   * Finds or inserts the ranges of an array at a timestep of the dataset with
+   * the given key. Ranges are stored as in vtkPVTemporalRangesInformation, and
+   * are empty when the array is missing at that timestep.
+   */
+  bool Find(const std::string& key, int fieldAssociation, const char* arrayName, double time,
+    std::vector<double>& ranges);
+  void Insert(const std::string& key, int fieldAssociation, const char* arrayName, double time,
+    const std::vector<double>& ranges);
+  ///@}
+
+  /**
+   * Marks the data produced by `proxy` as modified even though its properties
+   * are not, e.g. when its files are reloaded.
+   */
+  void MarkModified(vtkSMProxy* proxy);
+
+  /**
+   * Writes the ranges recorded since the last call to the directory.
+   */
+  void Flush();
+
+  /**
+   * Forgets the ranges kept in memory. Persisted ranges are not removed.
+   */
+  void Clear();
+
+protected:
+  vtkSMTemporalRangeCache();
+  ~vtkSMTemporalRangeCache() override;
+
+  bool Enabled = false;
+  std::string Directory;
+
+private:
+  vtkSMTemporalRangeCache(const vtkSMTemporalRangeCache&) = delete;
+  void operator=(const vtkSMTemporalRangeCache&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
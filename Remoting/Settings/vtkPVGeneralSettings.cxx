@@ -6,12 +6,15 @@
 #include "vtkAlgorithm.h"
 #include "vtkLegacy.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVDataInformation.h"
 #include "vtkPVSession.h"
 #include "vtkProcessModule.h"
 #include "vtkSISourceProxy.h"
 #include "vtkSMArraySelectionDomain.h"
 #include "vtkSMInputArrayDomain.h"
+#include "vtkSMOutputPort.h"
 #include "vtkSMPTools.h"
+#include "vtkSMTemporalRangeCache.h"
 #include "vtkSMTrace.h"
 #include "vtkThreadedCallbackQueue.h"
 #include "vtkThreads.h"
@@ -21,6 +24,7 @@
 #endif
 
 #if VTK_MODULE_ENABLE_ParaView_RemotingViews
+#include "vtkPVDataDeliveryManager.h"
 #include "vtkPVView.h"
 #include "vtkPVXYChartView.h"
 #include "vtkSMChartSeriesSelectionDomain.h"
@@ -73,6 +77,54 @@ bool vtkPVGeneralSettings::GetAutoConvertProperties()
   return vtkSMInputArrayDomain::GetAutomaticPropertyConversion();
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetLazyArrayRanges(bool val)
+{
+  if (this->GetLazyArrayRanges() != val)
+  {
+    vtkSMOutputPort::SetLazyArrayRanges(val);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVGeneralSettings::GetLazyArrayRanges()
+{
+  return vtkSMOutputPort::GetLazyArrayRanges();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetCacheTemporalRanges(bool val)
+{
+  if (this->GetCacheTemporalRanges() != val)
+  {
+    vtkSMTemporalRangeCache::GetInstance()->SetEnabled(val);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVGeneralSettings::GetCacheTemporalRanges()
+{
+  return vtkSMTemporalRangeCache::GetInstance()->GetEnabled();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetCacheDataInformation(bool val)
+{
+  if (this->GetCacheDataInformation() != val)
+  {
+    vtkPVDataInformation::SetUseBlockCache(val);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVGeneralSettings::GetCacheDataInformation()
+{
+  return vtkPVDataInformation::GetUseBlockCache();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeneralSettings::SetCacheGeometryForAnimation(bool val)
 {
@@ -101,10 +153,48 @@ void vtkPVGeneralSettings::SetAnimationGeometryCacheLimit(unsigned long val)
   if (this->AnimationGeometryCacheLimit != val)
   {
     this->AnimationGeometryCacheLimit = val;
+#if VTK_MODULE_ENABLE_ParaView_RemotingViews
+    vtkPVDataDeliveryManager::SetCacheSizeLimit(val);
+#endif
     this->Modified();
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetNumberOfTimeStepsToPrefetch(int val)
+{
+  if (this->GetNumberOfTimeStepsToPrefetch() != val)
+  {
+    vtkSISourceProxy::SetNumberOfTimeStepsToPrefetch(val);
+#if VTK_MODULE_ENABLE_ParaView_RemotingAnimation
+    vtkSMAnimationScene::SetGlobalNumberOfTimeStepsToPrefetch(val);
+#endif
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkPVGeneralSettings::GetNumberOfTimeStepsToPrefetch()
+{
+  return vtkSISourceProxy::GetNumberOfTimeStepsToPrefetch();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetTimeStepPrefetchMemoryLimit(unsigned long val)
+{
+  if (this->GetTimeStepPrefetchMemoryLimit() != val)
+  {
+    vtkSISourceProxy::SetTimeStepPrefetchMemoryLimit(val);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkPVGeneralSettings::GetTimeStepPrefetchMemoryLimit()
+{
+  return vtkSISourceProxy::GetTimeStepPrefetchMemoryLimit();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeneralSettings::SetIgnoreNegativeLogAxisWarning(bool val)
 {
@@ -43,6 +43,39 @@ public:
   bool GetAutoConvertProperties();
   ///@}
 
+  ///@{
+  /**
+   * When enabled, data information is gathered without array ranges and the
+   * range of an array is only requested from the server when needed, e.g. to
+   * rescale a color map.
+   * Forwards the call to vtkSMOutputPort::SetLazyArrayRanges.
+   */
+  void SetLazyArrayRanges(bool val);
+  bool GetLazyArrayRanges();
+  ///@}
+
+  ///@{
+  /**
+   * When enabled, the ranges of arrays at each timestep are kept in memory
+   * once a color map was rescaled over time, so that later rescales over time
+   * only update the pipeline at the missing timesteps.
+   * Forwards the call to vtkSMTemporalRangeCache::SetEnabled.
+   */
+  void SetCacheTemporalRanges(bool val);
+  bool GetCacheTemporalRanges();
+  ///@}
+
+  ///@{
+  /**
+   * When enabled, the data information gathered for each block of a dataset
+   * is kept in memory, so that gathering the data information again only
+   * walks the blocks that were modified.
+   * Forwards the call to vtkPVDataInformation::SetUseBlockCache.
+   */
+  void SetCacheDataInformation(bool val);
+  bool GetCacheDataInformation();
+  ///@}
+
   ///@{
   /**
    * Determines the number of distinct values in
@@ -133,12 +166,35 @@ public:
 
   ///@{
   /**
-   * Set the animation cache limit in KBs.
+   * Set the animation cache limit in KBs. 0 means no limit.
+   * Forwards the call to vtkPVDataDeliveryManager::SetCacheSizeLimit.
    */
   void SetAnimationGeometryCacheLimit(unsigned long val);
   vtkGetMacro(AnimationGeometryCacheLimit, unsigned long);
   ///@}
 
+  ///@{
+  /**
+   * Set the number of timesteps readers prefetch ahead of the current time
+   * when playing an animation. 0 disables prefetching.
+   * Forwards the call to vtkSISourceProxy::SetNumberOfTimeStepsToPrefetch,
+   * which enables prefetching on readers, and to
+   * vtkSMAnimationScene::SetGlobalNumberOfTimeStepsToPrefetch, which requests
+   * the timesteps during playback.
+   */
+  void SetNumberOfTimeStepsToPrefetch(int val);
+  int GetNumberOfTimeStepsToPrefetch();
+  ///@}
+
+  ///@{
+  /**
+   * Set the maximum size of the prefetched timesteps of a reader in KBs.
+   * Forwards the call to vtkSISourceProxy::SetTimeStepPrefetchMemoryLimit.
+   */
+  void SetTimeStepPrefetchMemoryLimit(unsigned long val);
+  unsigned long GetTimeStepPrefetchMemoryLimit();
+  ///@}
+
   enum RealNumberNotation
   {
     MIXED = 0,
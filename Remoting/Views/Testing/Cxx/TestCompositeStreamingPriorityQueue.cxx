@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCamera.h"
+#include "vtkCompositeStreamingPriorityQueue.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+
+#define TEST_ASSERT(condition, message)                                                            \
+  if (!(condition))                                                                                \
+  {                                                                                                \
+    cerr << "ERROR: " << message << endl;                                                          \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+// Looks at the piece centered at (x, 0, 0) from a distance of 10.
+void GetViewPlanes(double x, double planes[24])
+{
+  vtkNew<vtkCamera> camera;
+  camera->SetPosition(x, 0, 10);
+  camera->SetFocalPoint(x, 0, 0);
+  camera->SetClippingRange(1, 100);
+  camera->GetFrustumPlanes(1.0, planes);
+}
+}
+
+// Checks that the pieces are popped in order of screen coverage and that the
+// least important pieces are released when the memory limit is reached.
+int TestCompositeStreamingPriorityQueue(int, char*[])
+{
+  // 10 unit pieces along the x axis, 3 units apart. The leaves of the
+  // meta-data have flat indices 1 to 10.
+  vtkNew<vtkMultiBlockDataSet> metadata;
+  metadata->SetNumberOfBlocks(10);
+  for (unsigned int cc = 0; cc < 10; ++cc)
+  {
+    const double bounds[6] = { 3.0 * cc - 0.5, 3.0 * cc + 0.5, -0.5, 0.5, -0.5, 0.5 };
+    metadata->GetMetaData(cc)->Set(vtkStreamingDemandDrivenPipeline::BOUNDS(), bounds, 6);
+  }
+
+  vtkNew<vtkCompositeStreamingPriorityQueue> queue;
+  queue->SetController(nullptr);
+  queue->Initialize(metadata);
+  TEST_ASSERT(queue->GetNumberOfPieces() == 10, "Expected 10 pieces.");
+  TEST_ASSERT(queue->HasPieceBounds(), "Expected pieces with bounds.");
+
+  double planes[24];
+  GetViewPlanes(0, planes);
+  queue->Update(planes);
+  TEST_ASSERT(queue->Pop() == 1, "Expected the piece in the center of the view first.");
+  queue->SetLoadedMemorySize(100);
+  TEST_ASSERT(queue->Pop() == 2, "Expected the neighbouring piece next.");
+  queue->SetLoadedMemorySize(100);
+
+  // the next piece does not fit anymore.
+  queue->SetMemoryLimit(250);
+  queue->Update(planes);
+  TEST_ASSERT(queue->GetEvictedPieces().empty(), "Expected no piece to be released.");
+  TEST_ASSERT(queue->IsEmpty(), "Expected the memory limit to stop the streaming.");
+  TEST_ASSERT(queue->GetResidentMemorySize() == 200, "Unexpected resident memory size.");
+
+  // looking at the last piece makes it more important than the loaded ones.
+  GetViewPlanes(27, planes);
+  queue->Update(planes);
+  const auto& evicted = queue->GetEvictedPieces();
+  TEST_ASSERT(evicted.size() == 1, "Expected a piece to be released.");
+  TEST_ASSERT(!queue->IsEmpty(), "Expected room for the piece in view.");
+  TEST_ASSERT(queue->Pop() == 10, "Expected the piece in view.");
+  queue->SetLoadedMemorySize(100);
+  TEST_ASSERT(queue->GetResidentMemorySize() == 200, "Unexpected resident memory size.");
+
+  // without limit, all the pieces are eventually popped, including the
+  // released one.
+  queue->SetMemoryLimit(0);
+  queue->Update(planes);
+  int count = 0;
+  while (!queue->IsEmpty())
+  {
+    const unsigned int cid = queue->Pop();
+    TEST_ASSERT(cid >= 1 && cid <= 10 && cid != 10, "Unexpected piece " << cid);
+    queue->SetLoadedMemorySize(100);
+    ++count;
+  }
+  TEST_ASSERT(count == 8, "Expected 8 more pieces and got " << count);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVDataDeliveryManager.h"
+#include "vtkPVRenderView.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMViewProxy.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+// Updates the view for the given cache key, showing a sphere whose geometry
+// has the same size for every key.
+void UpdateView(vtkSMViewProxy* view, vtkSMProxy* sphere, int key)
+{
+  vtkSMPropertyHelper(view, "CacheKey").Set(static_cast<double>(key));
+  view->UpdateVTKObjects();
+  const double center[3] = { static_cast<double>(key), 0, 0 };
+  vtkSMPropertyHelper(sphere, "Center").Set(center, 3);
+  sphere->UpdateVTKObjects();
+  view->Update();
+}
+
+bool CheckStatistics(vtkPVDataDeliveryManager* dmgr, const char* step, vtkTypeUInt64 hits,
+  vtkTypeUInt64 misses, vtkTypeUInt64 evictions)
+{
+  if (dmgr->GetCacheHits() != hits || dmgr->GetCacheMisses() != misses ||
+    dmgr->GetCacheEvictions() != evictions)
+  {
+    vtkLogF(ERROR, "%s: expected %d hits, %d misses, %d evictions, got %d, %d, %d.", step,
+      static_cast<int>(hits), static_cast<int>(misses), static_cast<int>(evictions),
+      static_cast<int>(dmgr->GetCacheHits()), static_cast<int>(dmgr->GetCacheMisses()),
+      static_cast<int>(dmgr->GetCacheEvictions()));
+    return false;
+  }
+  if (dmgr->GetCacheSize() > vtkPVDataDeliveryManager::GetCacheSizeLimit())
+  {
+    vtkLogF(ERROR, "%s: cache size %lu exceeds the limit %lu.", step, dmgr->GetCacheSize(),
+      vtkPVDataDeliveryManager::GetCacheSizeLimit());
+    return false;
+  }
+  return true;
+}
+}
+
+int TestGeometryCacheLimit(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session);
+  controller->InitializeSession(session);
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSmartPointer<vtkSMViewProxy> view;
+  view.TakeReference(vtkSMViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+  controller->InitializeProxy(view);
+  vtkSMPropertyHelper(view, "UseCache").Set(1);
+  view->UpdateVTKObjects();
+  controller->RegisterViewProxy(view);
+
+  vtkSmartPointer<vtkSMSourceProxy> sphere;
+  sphere.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "SphereSource")));
+  controller->InitializeProxy(sphere);
+  vtkSMPropertyHelper(sphere, "ThetaResolution").Set(64);
+  vtkSMPropertyHelper(sphere, "PhiResolution").Set(64);
+  sphere->UpdateVTKObjects();
+  controller->RegisterPipelineProxy(sphere);
+  controller->Show(sphere, 0, view);
+
+  vtkPVDataDeliveryManager::SetCacheSizeLimit(0);
+  UpdateView(view, sphere, 0);
+  auto dmgr = vtkPVRenderView::SafeDownCast(view->GetClientSideObject())->GetDeliveryManager();
+  const unsigned long entrySize = dmgr->GetCacheSize();
+  bool success = entrySize > 0;
+  if (!success)
+  {
+    vtkLogF(ERROR, "No geometry was cached.");
+  }
+  else
+  {
+    // room for 3 geometries.
+    vtkPVDataDeliveryManager::SetCacheSizeLimit(3 * entrySize + entrySize / 2);
+    dmgr->ResetCacheStatistics();
+
+    for (int key = 1; key <= 5; ++key)
+    {
+      UpdateView(view, sphere, key);
+    }
+    // 0, 1 and 2 were evicted.
+    success = CheckStatistics(dmgr, "first pass", 0, 5, 3);
+
+    UpdateView(view, sphere, 4);
+    success = success && CheckStatistics(dmgr, "reuse 4", 1, 5, 3);
+
+    // 3 is now the least recently used.
+    UpdateView(view, sphere, 6);
+    success = success && CheckStatistics(dmgr, "add 6", 1, 6, 4);
+    UpdateView(view, sphere, 5);
+    success = success && CheckStatistics(dmgr, "reuse 5", 2, 6, 4);
+    UpdateView(view, sphere, 3);
+    success = success && CheckStatistics(dmgr, "reload 3", 2, 7, 5);
+  }
+
+  vtkPVDataDeliveryManager::SetCacheSizeLimit(0);
+  controller->UnRegisterProxy(sphere);
+  controller->UnRegisterProxy(view);
+  view = nullptr;
+  sphere = nullptr;
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
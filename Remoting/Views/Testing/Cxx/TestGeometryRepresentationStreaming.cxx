@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompositeDataPipeline.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkDataSet.h"
+#include "vtkGeometryRepresentationWithFaces.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkMapper.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiBlockDataSetAlgorithm.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVRenderView.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMRenderViewProxy.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+
+namespace
+{
+constexpr int NumberOfPieces = 4;
+
+// Produces spheres along the x axis, one per block, and advertises their
+// bounds in the composite meta-data so that they can be streamed. Only the
+// requested blocks are generated.
+class vtkStreamedSpheresSource : public vtkMultiBlockDataSetAlgorithm
+{
+public:
+  static vtkStreamedSpheresSource* New();
+  vtkTypeMacro(vtkStreamedSpheresSource, vtkMultiBlockDataSetAlgorithm);
+
+protected:
+  vtkStreamedSpheresSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkNew<vtkMultiBlockDataSet> metadata;
+    metadata->SetNumberOfBlocks(NumberOfPieces);
+    for (unsigned int cc = 0; cc < NumberOfPieces; ++cc)
+    {
+      const double bounds[6] = { 3.0 * cc - 0.5, 3.0 * cc + 0.5, -0.5, 0.5, -0.5, 0.5 };
+      metadata->GetMetaData(cc)->Set(vtkStreamingDemandDrivenPipeline::BOUNDS(), bounds, 6);
+    }
+    outputVector->GetInformationObject(0)->Set(
+      vtkCompositeDataPipeline::COMPOSITE_DATA_META_DATA(), metadata);
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkMultiBlockDataSet* output = vtkMultiBlockDataSet::GetData(outInfo);
+    output->SetNumberOfBlocks(NumberOfPieces);
+    const bool requested = outInfo->Has(vtkCompositeDataPipeline::LOAD_REQUESTED_BLOCKS()) != 0;
+    const int size =
+      requested ? outInfo->Length(vtkCompositeDataPipeline::UPDATE_COMPOSITE_INDICES()) : 0;
+    const int* ids =
+      requested ? outInfo->Get(vtkCompositeDataPipeline::UPDATE_COMPOSITE_INDICES()) : nullptr;
+    for (unsigned int cc = 0; cc < NumberOfPieces; ++cc)
+    {
+      // the flat index of block cc is cc + 1.
+      if (requested && std::find(ids, ids + size, static_cast<int>(cc + 1)) == ids + size)
+      {
+        continue;
+      }
+      vtkNew<vtkSphereSource> sphere;
+      sphere->SetCenter(3.0 * cc, 0, 0);
+      sphere->Update();
+      output->SetBlock(cc, sphere->GetOutput());
+    }
+    return 1;
+  }
+
+private:
+  vtkStreamedSpheresSource(const vtkStreamedSpheresSource&) = delete;
+  void operator=(const vtkStreamedSpheresSource&) = delete;
+};
+vtkStandardNewMacro(vtkStreamedSpheresSource);
+
+// Gives access to the mappers of the front and back faces.
+class vtkTestGeometryRepresentation : public vtkGeometryRepresentationWithFaces
+{
+public:
+  static vtkTestGeometryRepresentation* New();
+  vtkTypeMacro(vtkTestGeometryRepresentation, vtkGeometryRepresentationWithFaces);
+
+  vtkDataObject* GetRenderedData() { return this->Mapper->GetInputDataObject(0, 0); }
+  vtkDataObject* GetRenderedBackfaceData()
+  {
+    return this->BackfaceMapper->GetInputDataObject(0, 0);
+  }
+
+protected:
+  vtkTestGeometryRepresentation() = default;
+
+private:
+  vtkTestGeometryRepresentation(const vtkTestGeometryRepresentation&) = delete;
+  void operator=(const vtkTestGeometryRepresentation&) = delete;
+};
+vtkStandardNewMacro(vtkTestGeometryRepresentation);
+
+int GetNumberOfRenderedPieces(vtkDataObject* data)
+{
+  auto tree = vtkDataObjectTree::SafeDownCast(data);
+  if (!tree)
+  {
+    return 0;
+  }
+  int count = 0;
+  vtkSmartPointer<vtkDataObjectTreeIterator> iter;
+  iter.TakeReference(tree->NewTreeIterator());
+  iter->VisitOnlyLeavesOn();
+  iter->SkipEmptyNodesOn();
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    auto ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
+    count += (ds && ds->GetNumberOfPoints() > 0) ? 1 : 0;
+  }
+  return count;
+}
+}
+
+// Checks that the pieces streamed by vtkGeometryRepresentation are rendered,
+// for the front faces as well as for the back faces.
+int TestGeometryRepresentationStreaming(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  vtkPVView::SetEnableStreaming(true);
+
+  vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session);
+  controller->InitializeSession(session);
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSmartPointer<vtkSMRenderViewProxy> view;
+  view.TakeReference(vtkSMRenderViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+  controller->InitializeProxy(view);
+  controller->RegisterViewProxy(view);
+  auto rview = vtkPVRenderView::SafeDownCast(view->GetClientSideObject());
+
+  vtkNew<vtkStreamedSpheresSource> source;
+  vtkNew<vtkTestGeometryRepresentation> repr;
+  repr->SetInputConnection(source->GetOutputPort());
+  repr->SetBackfaceRepresentation(vtkGeometryRepresentationWithFaces::SURFACE);
+  rview->AddRepresentation(repr);
+
+  view->Update();
+  view->ResetCamera();
+  view->StillRender();
+  bool success = true;
+  if (GetNumberOfRenderedPieces(repr->GetRenderedData()) != 1)
+  {
+    vtkLogF(ERROR, "Expected a single piece for the first frame, got %d.",
+      GetNumberOfRenderedPieces(repr->GetRenderedData()));
+    success = false;
+  }
+
+  // stream the other pieces.
+  int updates = 0;
+  while (updates < 2 * NumberOfPieces && view->StreamingUpdate(true))
+  {
+    ++updates;
+  }
+
+  const int rendered = GetNumberOfRenderedPieces(repr->GetRenderedData());
+  const int renderedBackfaces = GetNumberOfRenderedPieces(repr->GetRenderedBackfaceData());
+  if (rendered != NumberOfPieces || renderedBackfaces != NumberOfPieces)
+  {
+    vtkLogF(ERROR, "Expected %d pieces after streaming, got %d front faces and %d back faces.",
+      NumberOfPieces, rendered, renderedBackfaces);
+    success = false;
+  }
+
+  rview->RemoveRepresentation(repr);
+  vtkPVView::SetEnableStreaming(false);
+  controller->UnRegisterProxy(view);
+  view = nullptr;
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataObject.h"
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkMathUtilities.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVDataSetAttributesInformation.h"
+#include "vtkProcessModule.h"
+#include "vtkSMColorMapEditorHelper.h"
+#include "vtkSMOutputPort.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMTemporalRangeCache.h"
+#include "vtkSMTransferFunctionProxy.h"
+#include "vtkSMViewProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+double GetPercentile(std::vector<double> values, double percentile)
+{
+  std::sort(values.begin(), values.end());
+  const double position = percentile / 100.0 * (values.size() - 1);
+  const size_t index = static_cast<size_t>(position);
+  if (index + 1 >= values.size())
+  {
+    return values.back();
+  }
+  return values[index] + (position - index) * (values[index + 1] - values[index]);
+}
+
+bool CheckRescale(vtkSMProxy* repr, const char* arrayName, double lower, double upper,
+  const double expected[2])
+{
+  if (!vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataPercentilesOverTime(
+        repr, arrayName, vtkDataObject::POINT, lower, upper))
+  {
+    vtkLogF(ERROR, "Rescale to percentiles %g and %g failed.", lower, upper);
+    return false;
+  }
+  double range[2];
+  vtkSMProxy* lut = vtkSMPropertyHelper(repr, "LookupTable").GetAsProxy();
+  if (!vtkSMTransferFunctionProxy::GetRange(lut, range))
+  {
+    vtkLogF(ERROR, "No color map range.");
+    return false;
+  }
+  if (!vtkMathUtilities::FuzzyCompare(range[0], expected[0], 1e-6) ||
+    !vtkMathUtilities::FuzzyCompare(range[1], expected[1], 1e-6))
+  {
+    vtkLogF(ERROR, "Percentiles %g and %g: expected [%g, %g], got [%g, %g].", lower, upper,
+      expected[0], expected[1], range[0], range[1]);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestRescaleOverTimePercentiles(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session);
+  controller->InitializeSession(session);
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSmartPointer<vtkSMViewProxy> view;
+  view.TakeReference(vtkSMViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+  controller->InitializeProxy(view);
+  controller->RegisterViewProxy(view);
+
+  vtkSmartPointer<vtkSMSourceProxy> source;
+  source.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "TimeSource")));
+  controller->InitializeProxy(source);
+  controller->RegisterPipelineProxy(source);
+  source->UpdatePipeline();
+
+  // a scalar point array, whose range at each timestep is the expected input
+  // of the percentiles.
+  std::string arrayName;
+  auto pdinfo = source->GetDataInformation()->GetPointDataInformation();
+  for (int cc = 0; cc < pdinfo->GetNumberOfArrays() && arrayName.empty(); ++cc)
+  {
+    if (pdinfo->GetArrayInformation(cc)->GetNumberOfComponents() == 1)
+    {
+      arrayName = pdinfo->GetArrayInformation(cc)->GetName();
+    }
+  }
+  const auto timesteps = source->GetOutputPort(0u)->GetTemporalDataInformation()->GetTimeSteps();
+  if (arrayName.empty() || timesteps.size() < 3)
+  {
+    vtkLogF(ERROR, "Expected a scalar point array and several timesteps.");
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+
+  std::vector<double> minima;
+  std::vector<double> maxima;
+  for (const double time : timesteps)
+  {
+    source->UpdatePipeline(time);
+    const double* range = source->GetDataInformation()
+                            ->GetPointDataInformation()
+                            ->GetArrayInformation(arrayName.c_str())
+                            ->GetComponentFiniteRange(0);
+    minima.push_back(range[0]);
+    maxima.push_back(range[1]);
+  }
+  const double fullRange[2] = { *std::min_element(minima.begin(), minima.end()),
+    *std::max_element(maxima.begin(), maxima.end()) };
+  const double percentileRange[2] = { GetPercentile(minima, 25), GetPercentile(maxima, 75) };
+
+  vtkSMProxy* repr = controller->Show(source, 0, view);
+  vtkSMColorMapEditorHelper::SetScalarColoring(repr, arrayName.c_str(), vtkDataObject::POINT);
+
+  // 0 and 100 give the range over time, the same with or without the cache.
+  bool success = CheckRescale(repr, arrayName.c_str(), 0, 100, fullRange) &&
+    CheckRescale(repr, arrayName.c_str(), 25, 75, percentileRange);
+  vtkSMTemporalRangeCache::GetInstance()->SetEnabled(true);
+  success = success && CheckRescale(repr, arrayName.c_str(), 25, 75, percentileRange) &&
+    CheckRescale(repr, arrayName.c_str(), 25, 75, percentileRange) &&
+    CheckRescale(repr, arrayName.c_str(), 0, 100, fullRange);
+  vtkSMTemporalRangeCache::GetInstance()->SetEnabled(false);
+  vtkSMTemporalRangeCache::GetInstance()->Clear();
+
+  if (success &&
+    vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataPercentilesOverTime(
+      repr, arrayName.c_str(), vtkDataObject::POINT, 75, 25))
+  {
+    vtkLogF(ERROR, "Invalid percentiles were accepted.");
+    success = false;
+  }
+
+  controller->UnRegisterProxy(source);
+  controller->UnRegisterProxy(view);
+  source = nullptr;
+  view = nullptr;
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
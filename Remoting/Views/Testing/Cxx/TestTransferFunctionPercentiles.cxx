@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAlgorithm.h"
+#include "vtkDataArray.h"
+#include "vtkDataObject.h"
+#include "vtkDataSet.h"
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkProcessModule.h"
+#include "vtkSMColorMapEditorHelper.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMTransferFunctionProxy.h"
+#include "vtkSMViewProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+// Checks that `value` is a valid `percentile` of the sorted `values`: the
+// fraction of the values below it must be within `tolerance` of the
+// percentile, up to the gap between consecutive values.
+bool CheckPercentile(
+  const std::vector<double>& values, double percentile, double value, double tolerance)
+{
+  const double count = static_cast<double>(values.size());
+  const double below = std::lower_bound(values.begin(), values.end(), value) - values.begin();
+  const double notAbove = std::upper_bound(values.begin(), values.end(), value) - values.begin();
+  const double target = percentile / 100.0 * count;
+  if (notAbove < target - tolerance * count - 1 || below > target + tolerance * count + 1)
+  {
+    vtkLogF(ERROR, "Percentile %g: %g has %g of %g values below it.", percentile, value, below,
+      count);
+    return false;
+  }
+  return true;
+}
+
+bool CheckPercentiles(vtkSMProxy* lut, const std::vector<double>& values, double lower,
+  double upper, bool exact)
+{
+  double range[2];
+  if (!vtkSMTransferFunctionProxy::ComputeDataPercentiles(lut, lower, upper, range, exact))
+  {
+    vtkLogF(ERROR, "Failed to compute percentiles %g and %g.", lower, upper);
+    return false;
+  }
+  // the refined histogram locates the exact percentiles up to the values
+  // counted in its border bins, the sketch within a few percents in rank.
+  const double tolerance = exact ? 0.001 : 0.03;
+  return CheckPercentile(values, lower, range[0], tolerance) &&
+    CheckPercentile(values, upper, range[1], tolerance);
+}
+}
+
+// Checks the percentiles computed by vtkSMTransferFunctionProxy, exact and
+// approximate, against the sorted values, and the rescale to percentiles.
+int TestTransferFunctionPercentiles(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session);
+  controller->InitializeSession(session);
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSmartPointer<vtkSMViewProxy> view;
+  view.TakeReference(vtkSMViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+  controller->InitializeProxy(view);
+  controller->RegisterViewProxy(view);
+
+  vtkSmartPointer<vtkSMSourceProxy> source;
+  source.TakeReference(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "RTAnalyticSource")));
+  controller->InitializeProxy(source);
+  controller->RegisterPipelineProxy(source);
+  source->UpdatePipeline();
+
+  vtkSMProxy* repr = controller->Show(source, 0, view);
+  vtkSMColorMapEditorHelper::SetScalarColoring(repr, "RTData", vtkDataObject::POINT);
+  vtkSMProxy* lut = vtkSMPropertyHelper(repr, "LookupTable").GetAsProxy();
+
+  // in a builtin session, the data produced by the source is available here.
+  auto data = vtkDataSet::SafeDownCast(
+    vtkAlgorithm::SafeDownCast(source->GetClientSideObject())->GetOutputDataObject(0));
+  vtkDataArray* array = data ? data->GetPointData()->GetArray("RTData") : nullptr;
+  bool success = lut != nullptr && array != nullptr;
+  if (!success)
+  {
+    vtkLogF(ERROR, "Expected a color map and the 'RTData' array.");
+  }
+
+  std::vector<double> values;
+  for (vtkIdType cc = 0; success && cc < array->GetNumberOfTuples(); ++cc)
+  {
+    values.push_back(array->GetTuple1(cc));
+  }
+  std::sort(values.begin(), values.end());
+
+  success = success && CheckPercentiles(lut, values, 0, 100, true) &&
+    CheckPercentiles(lut, values, 1, 99, true) && CheckPercentiles(lut, values, 25, 50, true) &&
+    CheckPercentiles(lut, values, 1, 99, false) && CheckPercentiles(lut, values, 25, 50, false);
+
+  // the percentiles are ordered, whatever the order of the arguments.
+  if (success &&
+    vtkSMTransferFunctionProxy::RescaleTransferFunctionToDataPercentiles(lut, 75, 25, true))
+  {
+    double range[2];
+    vtkSMTransferFunctionProxy::GetRange(lut, range);
+    success = CheckPercentile(values, 25, range[0], 0.001) &&
+      CheckPercentile(values, 75, range[1], 0.001);
+  }
+  else if (success)
+  {
+    vtkLogF(ERROR, "Rescale to percentiles failed.");
+    success = false;
+  }
+
+  controller->UnRegisterProxy(source);
+  controller->UnRegisterProxy(view);
+  source = nullptr;
+  view = nullptr;
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,323 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompositeStreamingPriorityQueue.h"
+
+#include "vtkBoundingBox.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkInformation.h"
+#include "vtkMath.h"
+#include "vtkMultiProcessController.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStreamingPriorityQueue.h"
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace
+{
+// Used for the loaded pieces: the top of the queue is the piece to release
+// first.
+class vtkLowestPriorityFirstComparator
+{
+public:
+  bool operator()(
+    const vtkStreamingPriorityQueueItem& me, const vtkStreamingPriorityQueueItem& other) const
+  {
+    return me.Priority > other.Priority;
+  }
+};
+}
+
+class vtkCompositeStreamingPriorityQueue::vtkInternals
+{
+public:
+  vtkSmartPointer<vtkDataObject> Metadata;
+  vtkStreamingPriorityQueue<> PriorityQueue;
+  vtkStreamingPriorityQueue<vtkLowestPriorityFirstComparator> LoadedPieces;
+  std::deque<unsigned int> PiecesWithoutBounds;
+  vtkBoundingBox Bounds;
+  unsigned int NumberOfPieces = 0;
+
+  // Memory used by the loaded pieces that can be released, keyed by composite
+  // id. Pieces without bounds are accounted for in ResidentMemory only.
+  std::map<unsigned int, unsigned long> LoadedSizes;
+  unsigned long ResidentMemory = 0;
+  unsigned int NumberOfLoadedPieces = 0;
+
+  // The pieces returned by the most recent Pop(), one per process.
+  std::vector<unsigned int> PoppedPieces;
+  std::vector<unsigned int> EvictedPieces;
+
+  unsigned long GetEstimatedPieceSize() const
+  {
+    return this->NumberOfLoadedPieces > 0 ? this->ResidentMemory / this->NumberOfLoadedPieces : 0;
+  }
+};
+
+vtkStandardNewMacro(vtkCompositeStreamingPriorityQueue);
+vtkCxxSetObjectMacro(vtkCompositeStreamingPriorityQueue, Controller, vtkMultiProcessController);
+//----------------------------------------------------------------------------
+vtkCompositeStreamingPriorityQueue::vtkCompositeStreamingPriorityQueue()
+{
+  this->Internals = new vtkInternals();
+  this->Controller = nullptr;
+  this->MemoryLimit = 0;
+  this->SetController(vtkMultiProcessController::GetGlobalController());
+}
+
+//----------------------------------------------------------------------------
+vtkCompositeStreamingPriorityQueue::~vtkCompositeStreamingPriorityQueue()
+{
+  delete this->Internals;
+  this->Internals = nullptr;
+  this->SetController(nullptr);
+}
+
+//----------------------------------------------------------------------------
+void vtkCompositeStreamingPriorityQueue::Initialize(vtkDataObject* metadata)
+{
+  delete this->Internals;
+  this->Internals = new vtkInternals();
+  this->Internals->Metadata = metadata;
+
+  auto tree = vtkDataObjectTree::SafeDownCast(metadata);
+  if (!tree)
+  {
+    return;
+  }
+
+  vtkSmartPointer<vtkDataObjectTreeIterator> iter;
+  iter.TakeReference(tree->NewTreeIterator());
+  iter->SkipEmptyNodesOff();
+  iter->VisitOnlyLeavesOn();
+
+  std::vector<vtkStreamingPriorityQueueItem> items;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    const unsigned int cid = iter->GetCurrentFlatIndex();
+    this->Internals->NumberOfPieces++;
+
+    double bounds[6];
+    vtkMath::UninitializeBounds(bounds);
+    if (iter->HasCurrentMetaData())
+    {
+      vtkInformation* info = iter->GetCurrentMetaData();
+      if (info->Has(vtkStreamingDemandDrivenPipeline::BOUNDS()))
+      {
+        info->Get(vtkStreamingDemandDrivenPipeline::BOUNDS(), bounds);
+      }
+      else if (info->Has(vtkDataObject::BOUNDING_BOX()))
+      {
+        info->Get(vtkDataObject::BOUNDING_BOX(), bounds);
+      }
+    }
+
+    if (!vtkBoundingBox::IsValid(bounds))
+    {
+      this->Internals->PiecesWithoutBounds.push_back(cid);
+      continue;
+    }
+
+    vtkStreamingPriorityQueueItem item;
+    item.Identifier = cid;
+    item.Bounds.SetBounds(bounds);
+    this->Internals->Bounds.AddBounds(bounds);
+    items.push_back(item);
+  }
+
+  // default priority is to prefer the pieces in order. Thus even without
+  // view-planes we have a deterministic order.
+  for (size_t cc = 0; cc < items.size(); ++cc)
+  {
+    items[cc].Priority = static_cast<double>(items.size() - cc);
+    this->Internals->PriorityQueue.push(items[cc]);
+  }
+}
+
+//----------------------------------------------------------------------------
+unsigned int vtkCompositeStreamingPriorityQueue::GetNumberOfPieces()
+{
+  return this->Internals->NumberOfPieces;
+}
+
+//----------------------------------------------------------------------------
+bool vtkCompositeStreamingPriorityQueue::HasPieceBounds()
+{
+  return this->Internals->Bounds.IsValid();
+}
+
+//----------------------------------------------------------------------------
+void vtkCompositeStreamingPriorityQueue::GetBounds(double bounds[6])
+{
+  if (this->Internals->Bounds.IsValid())
+  {
+    this->Internals->Bounds.GetBounds(bounds);
+  }
+  else
+  {
+    vtkMath::UninitializeBounds(bounds);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkCompositeStreamingPriorityQueue::IsEmpty()
+{
+  auto& internals = *this->Internals;
+  if (!internals.PiecesWithoutBounds.empty())
+  {
+    return false;
+  }
+  if (internals.PriorityQueue.empty())
+  {
+    return true;
+  }
+  return this->MemoryLimit > 0 &&
+    internals.ResidentMemory + internals.GetEstimatedPieceSize() > this->MemoryLimit;
+}
+
+//----------------------------------------------------------------------------
+unsigned int vtkCompositeStreamingPriorityQueue::Pop()
+{
+  auto& internals = *this->Internals;
+  internals.PoppedPieces.clear();
+  if (this->IsEmpty())
+  {
+    return VTK_UNSIGNED_INT_MAX;
+  }
+
+  const int num_procs = this->Controller ? this->Controller->GetNumberOfProcesses() : 1;
+  const int myid = this->Controller ? this->Controller->GetLocalProcessId() : 0;
+
+  // pieces without bounds go first since their priority does not depend on the
+  // view. Processes left without a piece when the queue empties out in the
+  // middle of a pop simply don't load anything.
+  internals.PoppedPieces.resize(num_procs, VTK_UNSIGNED_INT_MAX);
+  for (int cc = 0; cc < num_procs; cc++)
+  {
+    if (!internals.PiecesWithoutBounds.empty())
+    {
+      internals.PoppedPieces[cc] = internals.PiecesWithoutBounds.front();
+      internals.PiecesWithoutBounds.pop_front();
+    }
+    else if (!internals.PriorityQueue.empty())
+    {
+      const vtkStreamingPriorityQueueItem item = internals.PriorityQueue.top();
+      internals.PriorityQueue.pop();
+      internals.PoppedPieces[cc] = item.Identifier;
+      internals.LoadedPieces.push(item);
+      internals.LoadedSizes[item.Identifier] = 0;
+    }
+    else
+    {
+      break;
+    }
+  }
+  return internals.PoppedPieces[myid];
+}
+
+//----------------------------------------------------------------------------
+void vtkCompositeStreamingPriorityQueue::SetLoadedMemorySize(unsigned long size)
+{
+  auto& internals = *this->Internals;
+  const int num_procs = this->Controller ? this->Controller->GetNumberOfProcesses() : 1;
+
+  // the sizes of all pieces are needed on all processes to keep the queues
+  // identical.
+  std::vector<unsigned long> sizes(num_procs, size);
+  if (num_procs > 1)
+  {
+    this->Controller->AllGather(&size, sizes.data(), 1);
+  }
+
+  const int count = std::min(num_procs, static_cast<int>(internals.PoppedPieces.size()));
+  for (int cc = 0; cc < count; cc++)
+  {
+    const unsigned int cid = internals.PoppedPieces[cc];
+    if (cid == VTK_UNSIGNED_INT_MAX)
+    {
+      continue;
+    }
+    internals.ResidentMemory += sizes[cc];
+    internals.NumberOfLoadedPieces++;
+    auto iter = internals.LoadedSizes.find(cid);
+    if (iter != internals.LoadedSizes.end())
+    {
+      iter->second += sizes[cc];
+    }
+  }
+  internals.PoppedPieces.clear();
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkCompositeStreamingPriorityQueue::GetResidentMemorySize()
+{
+  return this->Internals->ResidentMemory;
+}
+
+//----------------------------------------------------------------------------
+const std::vector<unsigned int>& vtkCompositeStreamingPriorityQueue::GetEvictedPieces() const
+{
+  return this->Internals->EvictedPieces;
+}
+
+//----------------------------------------------------------------------------
+void vtkCompositeStreamingPriorityQueue::Update(const double view_planes[24])
+{
+  auto& internals = *this->Internals;
+  internals.EvictedPieces.clear();
+  if (!internals.Metadata)
+  {
+    return;
+  }
+
+  double clamp_bounds[6];
+  vtkMath::UninitializeBounds(clamp_bounds);
+  internals.PriorityQueue.UpdatePriorities(view_planes, clamp_bounds);
+  internals.LoadedPieces.UpdatePriorities(view_planes, clamp_bounds);
+  if (this->MemoryLimit == 0)
+  {
+    return;
+  }
+
+  // release the least important pieces while over the limit, or while a queued
+  // piece is more important than a loaded one and there's no room left for it.
+  while (!internals.LoadedPieces.empty())
+  {
+    const vtkStreamingPriorityQueueItem lowest = internals.LoadedPieces.top();
+    const bool overLimit = internals.ResidentMemory > this->MemoryLimit;
+    const bool makeRoom = !internals.PriorityQueue.empty() &&
+      internals.PriorityQueue.top().Priority > lowest.Priority &&
+      internals.ResidentMemory + internals.GetEstimatedPieceSize() > this->MemoryLimit;
+    if (!overLimit && !makeRoom)
+    {
+      break;
+    }
+
+    internals.LoadedPieces.pop();
+    auto iter = internals.LoadedSizes.find(lowest.Identifier);
+    if (iter != internals.LoadedSizes.end())
+    {
+      internals.ResidentMemory -= std::min(internals.ResidentMemory, iter->second);
+      internals.LoadedSizes.erase(iter);
+    }
+    if (internals.NumberOfLoadedPieces > 0)
+    {
+      internals.NumberOfLoadedPieces--;
+    }
+    internals.EvictedPieces.push_back(lowest.Identifier);
+    internals.PriorityQueue.push(lowest);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkCompositeStreamingPriorityQueue::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "MemoryLimit: " << this->MemoryLimit << endl;
+}
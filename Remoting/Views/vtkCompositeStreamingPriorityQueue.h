@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCompositeStreamingPriorityQueue
+ * @brief   implements a coverage based priority
+ * queue for the pieces of composite datasets.
+ *
+ * vtkCompositeStreamingPriorityQueue is used by representations supporting
+ * streaming of partitioned datasets, such as vtkGeometryRepresentation, to
+ * determine the order in which the pieces of the dataset are requested. Unlike
+ * vtkAMRStreamingPriorityQueue, it does not assume any particular structure:
+ * it relies on the bounds the reader provides for each leaf of the composite
+ * meta-data (vtkCompositeDataPipeline::COMPOSITE_DATA_META_DATA()), using
+ * either vtkStreamingDemandDrivenPipeline::BOUNDS() or
+ * vtkDataObject::BOUNDING_BOX(). Leaves without bounds cannot be prioritized
+ * and are popped first.
+ *
+ * The queue also keeps track of the pieces that were loaded and of the memory
+ * they use, as reported by SetLoadedMemorySize(). When MemoryLimit is set,
+ * Update() releases the loaded pieces with the lowest priorities to stay
+ * within the limit, or to make room for more important pieces, and puts them
+ * back in the queue. GetEvictedPieces() returns the pieces released by the
+ * most recent Update().
+ * @sa
+ * vtkAMRStreamingPriorityQueue, vtkGeometryRepresentation.
+ */
+
+#ifndef vtkCompositeStreamingPriorityQueue_h
+#define vtkCompositeStreamingPriorityQueue_h
+
+#include "vtkObject.h"
+#include "vtkRemotingViewsModule.h" // for export macros
+
+#include <vector> // for std::vector
+
+class vtkDataObject;
+class vtkMultiProcessController;
+
+class VTKREMOTINGVIEWS_EXPORT vtkCompositeStreamingPriorityQueue : public vtkObject
+{
+public:
+  static vtkCompositeStreamingPriorityQueue* New();
+  vtkTypeMacro(vtkCompositeStreamingPriorityQueue, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * If the controller is specified, the queue can be used in parallel. So long
+   * as Initialize(), Update(), Pop() and SetLoadedMemorySize() are called on
+   * all processes and all process get the same meta-data and view_planes
+   * (which is generally true with ParaView), the pieces are distributed among
+   * the processes. SetLoadedMemorySize() is collective.
+   * By default, this is set to the
+   * vtkMultiProcessController::GetGlobalController();
+   */
+  void SetController(vtkMultiProcessController*);
+  vtkGetObjectMacro(Controller, vtkMultiProcessController);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum memory, in KiB, used by the loaded pieces across all processes.
+   * 0 (default) means no limit.
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  /**
+   * Initializes the queue using the meta-data of a composite dataset. All
+   * information about items in the queue, and about the pieces loaded, is
+   * lost. Only the meta-data of the leaves is looked at.
+   */
+  void Initialize(vtkDataObject* metadata);
+
+  /**
+   * Returns the number of pieces in the meta-data given to Initialize().
+   */
+  unsigned int GetNumberOfPieces();
+
+  /**
+   * Returns true if at least one of the pieces had bounds in the meta-data
+   * given to Initialize() i.e. if the priorities depend on the view.
+   */
+  bool HasPieceBounds();
+
+  /**
+   * Returns the union of the bounds of the pieces.
+   */
+  void GetBounds(double bounds[6]);
+
+  /**
+   * Updates the priorities of the pieces, either queued or loaded, based on
+   * the new view frustum planes and releases pieces if the memory limit is
+   * exceeded.
+   */
+  void Update(const double view_planes[24]);
+
+  /**
+   * Returns if the queue is empty. The queue is also considered empty when
+   * loading another piece would exceed the memory limit.
+   */
+  bool IsEmpty();
+
+  /**
+   * Pops and returns the composite id of the piece this process should load
+   * next. Returns VTK_UNSIGNED_INT_MAX if there's none, which can happen on
+   * some processes when the queue empties out.
+   */
+  unsigned int Pop();
+
+  /**
+   * Records the memory, in KiB, used by the piece returned by the most recent
+   * call to Pop() on this process. This must be called on all processes.
+   */
+  void SetLoadedMemorySize(unsigned long size);
+
+  /**
+   * Returns the memory, in KiB, used by the loaded pieces across all
+   * processes.
+   */
+  unsigned long GetResidentMemorySize();
+
+  /**
+   * Returns the composite ids of the pieces released by the most recent call to
+   * Update().
+   */
+  const std::vector<unsigned int>& GetEvictedPieces() const;
+
+protected:
+  vtkCompositeStreamingPriorityQueue();
+  ~vtkCompositeStreamingPriorityQueue() override;
+
+  vtkMultiProcessController* Controller;
+  unsigned long MemoryLimit;
+
+private:
+  vtkCompositeStreamingPriorityQueue(const vtkCompositeStreamingPriorityQueue&) = delete;
+  void operator=(const vtkCompositeStreamingPriorityQueue&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
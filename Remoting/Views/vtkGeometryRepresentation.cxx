@@ -4,16 +4,22 @@
 #include "vtkGeometryRepresentationInternal.h"
 
 #include "vtkAlgorithmOutput.h"
+#include "vtkAppendCompositeDataLeaves.h"
 #include "vtkBoundingBox.h"
 #include "vtkCallbackCommand.h"
 #include "vtkCommand.h"
 #include "vtkCompositeCellGridMapper.h"
 #include "vtkCompositeDataDisplayAttributes.h"
+#include "vtkCompositeDataPipeline.h"
 #include "vtkCompositePolyDataMapper.h"
+#include "vtkCompositeStreamingPriorityQueue.h"
 #include "vtkDataAssembly.h"
 #include "vtkDataAssemblyUtilities.h"
+#include "vtkDataObjectTree.h"
+#include "vtkDataObjectTreeIterator.h"
 #include "vtkDataObjectTreeRange.h"
 #include "vtkDataObjectTypes.h"
+#include "vtkFieldData.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -27,6 +33,7 @@
 #include "vtkPVLODActor.h"
 #include "vtkPVLogger.h"
 #include "vtkPVRenderView.h"
+#include "vtkPVStreamingMacros.h"
 #include "vtkPVTrivialProducer.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPointData.h"
@@ -42,6 +49,7 @@
 #include "vtkStringToken.h"
 #include "vtkTexture.h"
 #include "vtkTransform.h"
+#include "vtkUnsignedIntArray.h"
 
 #if VTK_MODULE_ENABLE_VTK_RenderingRayTracing
 #include "vtkOSPRayActorNode.h"
@@ -51,8 +59,10 @@
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <cassert>
 #include <memory>
 #include <numeric>
+#include <set>
 #include <tuple>
 #include <vector>
 
@@ -61,6 +71,13 @@ namespace vtkGeometryRepresentation_detail
 vtkStandardNewMacro(DecimationFilterType);
 }
 
+namespace
+{
+// Name of the field data array used to send the composite ids of the pieces
+// released by the data-server processes along with a streamed piece.
+const char* const EVICTED_PIECES_ARRAY_NAME = "__vtkGeometryRepresentationEvictedPieces";
+}
+
 //*****************************************************************************
 // This is used to convert a vtkPolyData to a vtkPartitionedDataSetCollection.
 // If the input is a vtkPartitionedDataSetCollection/vtkMultiBlockDataSet,
@@ -255,6 +272,7 @@ vtkGeometryRepresentation::vtkGeometryRepresentation()
   this->LODMapper = vtkCompositePolyDataMapper::New();
   this->Actor = vtkPVLODActor::New();
   this->Property = vtkProperty::New();
+  this->PriorityQueue = vtkCompositeStreamingPriorityQueue::New();
 
   this->RequestGhostCellsIfNeeded = true;
   this->RepeatTextures = true;
@@ -298,6 +316,7 @@ vtkGeometryRepresentation::~vtkGeometryRepresentation()
   this->LODMapper->Delete();
   this->Actor->Delete();
   this->Property->Delete();
+  this->PriorityQueue->Delete();
   if (this->TextureTransform)
   {
     this->TextureTransform->Delete();
@@ -430,10 +449,19 @@ int vtkGeometryRepresentation::ProcessViewRequest(
     // representation allows users to transform the geometry, we need to ensure
     // that the bounds we report include the transformation as well.
     this->ComputeVisibleDataBounds();
+    if (this->StreamingCapablePipeline)
+    {
+      // only a few pieces are loaded at this point, report the bounds of all of
+      // them instead.
+      this->PriorityQueue->GetBounds(this->VisibleDataBounds);
+    }
 
     vtkNew<vtkMatrix4x4> matrix;
     this->Actor->GetMatrix(matrix);
     vtkPVRenderView::SetGeometryBounds(inInfo, this, this->VisibleDataBounds, matrix);
+
+    // let the view know if this representation is streaming capable.
+    vtkPVRenderView::SetStreamable(inInfo, this, this->StreamingCapablePipeline);
   }
   else if (request_type == vtkPVView::REQUEST_UPDATE_LOD())
   {
@@ -472,7 +500,19 @@ int vtkGeometryRepresentation::ProcessViewRequest(
   }
   else if (request_type == vtkPVView::REQUEST_RENDER())
   {
-    auto outputData = vtkPVView::GetDeliveredPiece(inInfo, this);
+    vtkDataObject* outputData = vtkPVView::GetDeliveredPiece(inInfo, this);
+    if (this->StreamedData &&
+      (outputData != this->StreamedDataSource.GetPointer() ||
+        (outputData && outputData->GetMTime() > this->StreamedDataTime)))
+    {
+      // the data was delivered again, the pieces streamed so far are obsolete.
+      vtkStreamingStatusMacro(<< this << ": discarding streamed pieces.");
+      this->StreamedData = nullptr;
+    }
+    if (this->StreamedData)
+    {
+      outputData = this->StreamedData;
+    }
     // vtkLogF(INFO, "%p: %s", (void*)data, this->GetLogName().c_str());
     auto dataLOD = vtkPVView::GetDeliveredPieceLOD(inInfo, this);
     this->Mapper->SetInputDataObject(outputData);
@@ -507,6 +547,28 @@ int vtkGeometryRepresentation::ProcessViewRequest(
       this->UpdateBlockAttrLOD = false;
     }
   }
+  else if (request_type == vtkPVRenderView::REQUEST_STREAMING_UPDATE())
+  {
+    if (this->StreamingCapablePipeline)
+    {
+      // This is a streaming update request, request next piece.
+      double view_planes[24];
+      inInfo->Get(vtkPVRenderView::VIEW_PLANES(), view_planes);
+      if (this->StreamingUpdate(view_planes))
+      {
+        // since we indeed "had" a next piece to produce, give it to the view
+        // so it can deliver it to the rendering nodes.
+        vtkPVRenderView::SetNextStreamedPiece(inInfo, this, this->StreamedPiece);
+      }
+    }
+  }
+  else if (request_type == vtkPVRenderView::REQUEST_PROCESS_STREAMED_PIECE())
+  {
+    if (vtkDataObject* piece = vtkPVRenderView::GetCurrentStreamedPiece(inInfo, this))
+    {
+      this->MergeStreamedPiece(piece, vtkPVView::GetDeliveredPiece(inInfo, this));
+    }
+  }
 
   return 1;
 }
@@ -534,13 +596,76 @@ int vtkGeometryRepresentation::RequestUpdateExtent(
     }
   }
 
+  if (inputVector[0]->GetNumberOfInformationObjects() == 1)
+  {
+    vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+    if (this->StreamingCapablePipeline)
+    {
+      // Request the next piece to stream or, when not streaming, the first one.
+      // The other pieces are delivered by the following streaming updates.
+      const unsigned int cid = this->PriorityQueue->Pop();
+      const int request = static_cast<int>(cid);
+      vtkStreamingStatusMacro(<< this << ": requesting piece: "
+                              << (cid == VTK_UNSIGNED_INT_MAX ? -1 : request));
+      inInfo->Set(vtkCompositeDataPipeline::LOAD_REQUESTED_BLOCKS(), 1);
+      inInfo->Set(vtkCompositeDataPipeline::UPDATE_COMPOSITE_INDICES(), &request,
+        cid == VTK_UNSIGNED_INT_MAX ? 0 : 1);
+    }
+    else
+    {
+      inInfo->Remove(vtkCompositeDataPipeline::LOAD_REQUESTED_BLOCKS());
+      inInfo->Remove(vtkCompositeDataPipeline::UPDATE_COMPOSITE_INDICES());
+    }
+  }
+
   return 1;
 }
 
+//----------------------------------------------------------------------------
+int vtkGeometryRepresentation::RequestInformation(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // Determine if the input is streaming capable. A pipeline is streaming
+  // capable if it provides us with COMPOSITE_DATA_META_DATA() in the
+  // RequestInformation() pass, with bounds for the pieces. It implies that we
+  // can request arbitrary pieces from the input pipeline and prioritize them.
+  if (!this->InStreamingUpdate)
+  {
+    this->StreamingCapablePipeline = false;
+    if (inputVector[0]->GetNumberOfInformationObjects() == 1 && vtkPVView::GetEnableStreaming() &&
+      this->SupportsStreaming())
+    {
+      vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+      if (inInfo->Has(vtkCompositeDataPipeline::COMPOSITE_DATA_META_DATA()))
+      {
+        // Since the representation reexecuted, it means that the input changed
+        // and we should initialize our streaming.
+        this->PriorityQueue->Initialize(
+          inInfo->Get(vtkCompositeDataPipeline::COMPOSITE_DATA_META_DATA()));
+        this->StreamingCapablePipeline = this->PriorityQueue->HasPieceBounds();
+      }
+    }
+    vtkStreamingStatusMacro(<< this << ": streaming capable input pipeline? "
+                            << (this->StreamingCapablePipeline ? "yes" : "no"));
+  }
+  return this->Superclass::RequestInformation(request, inputVector, outputVector);
+}
+
 //----------------------------------------------------------------------------
 int vtkGeometryRepresentation::RequestData(
   vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
+  if (this->InStreamingUpdate)
+  {
+    // Only process the pieces requested during this streaming update, the data
+    // generated by the last full update is left untouched.
+    this->ProcessStreamedPiece(inputVector[0]->GetNumberOfInformationObjects() == 1
+        ? vtkDataObject::GetData(inputVector[0], 0)
+        : nullptr);
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  this->StreamedPiece = nullptr;
   if (inputVector[0]->GetNumberOfInformationObjects() == 1)
   {
     vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
@@ -570,9 +695,145 @@ int vtkGeometryRepresentation::RequestData(
     this->GeometryFilter->Modified();
   }
   this->MultiBlockMaker->Update();
+  if (this->StreamingCapablePipeline)
+  {
+    // account for the pieces loaded for the first frame.
+    this->PriorityQueue->SetLoadedMemorySize(
+      this->MultiBlockMaker->GetOutputDataObject(0)->GetActualMemorySize());
+  }
   return this->Superclass::RequestData(request, inputVector, outputVector);
 }
 
+//----------------------------------------------------------------------------
+bool vtkGeometryRepresentation::SupportsStreaming()
+{
+  return vtkPVGeometryFilter::SafeDownCast(this->GeometryFilter) != nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool vtkGeometryRepresentation::StreamingUpdate(const double view_planes[24])
+{
+  assert(this->InStreamingUpdate == false);
+
+  // update the priority queue. This also releases the least important pieces
+  // when the memory limit is exceeded, and we still need to tell the rendering
+  // nodes about those even if there's nothing left to load.
+  this->PriorityQueue->Update(view_planes);
+  if (this->PriorityQueue->IsEmpty() && this->PriorityQueue->GetEvictedPieces().empty())
+  {
+    return false;
+  }
+
+  this->InStreamingUpdate = true;
+  vtkStreamingStatusMacro(<< this << ": doing streaming-update.");
+
+  // This ensure that the representation re-executes.
+  this->MarkModified();
+
+  // Execute the pipeline.
+  this->Update();
+
+  this->InStreamingUpdate = false;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkGeometryRepresentation::ProcessStreamedPiece(vtkDataObject* input)
+{
+  this->StreamedPiece = nullptr;
+  unsigned long size = 0;
+  auto geometryFilter = vtkPVGeometryFilter::SafeDownCast(this->GeometryFilter);
+  if (input && geometryFilter)
+  {
+    // Streaming and "flip-book" caching don't make much sense together. Hence
+    // a separate filter, configured like the one used for the full data, is
+    // used for the pieces. The pieces are loaded by different processes over
+    // time so the surface is extracted on each process independently.
+    vtkNew<vtkPVGeometryFilter> pieceFilter;
+    pieceFilter->SetController(nullptr);
+    pieceFilter->SetUseOutline(geometryFilter->GetUseOutline());
+    pieceFilter->SetTriangulate(geometryFilter->GetTriangulate());
+    pieceFilter->SetNonlinearSubdivisionLevel(geometryFilter->GetNonlinearSubdivisionLevel());
+    pieceFilter->SetMatchBoundariesIgnoringCellOrder(
+      geometryFilter->GetMatchBoundariesIgnoringCellOrder());
+    pieceFilter->SetGenerateFeatureEdges(geometryFilter->GetGenerateFeatureEdges());
+    pieceFilter->SetGeneratePointNormals(geometryFilter->GetGeneratePointNormals());
+    pieceFilter->SetFeatureAngle(geometryFilter->GetFeatureAngle());
+    pieceFilter->SetBlockColorsDistinctValues(geometryFilter->GetBlockColorsDistinctValues());
+    pieceFilter->SetPassThroughCellIds(geometryFilter->GetPassThroughCellIds());
+    pieceFilter->SetPassThroughPointIds(geometryFilter->GetPassThroughPointIds());
+    pieceFilter->SetGenerateProcessIds(geometryFilter->GetGenerateProcessIds());
+    pieceFilter->SetInputData(input);
+    pieceFilter->Update();
+    this->StreamedPiece = pieceFilter->GetOutputDataObject(0);
+    size = this->StreamedPiece->GetActualMemorySize();
+  }
+
+  // this is collective, all processes have to record the sizes of the pieces.
+  this->PriorityQueue->SetLoadedMemorySize(size);
+
+  const auto& evicted = this->PriorityQueue->GetEvictedPieces();
+  if (this->StreamedPiece && !evicted.empty())
+  {
+    vtkNew<vtkUnsignedIntArray> array;
+    array->SetName(EVICTED_PIECES_ARRAY_NAME);
+    array->SetNumberOfTuples(static_cast<vtkIdType>(evicted.size()));
+    std::copy(evicted.begin(), evicted.end(), array->GetPointer(0));
+    this->StreamedPiece->GetFieldData()->AddArray(array);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkGeometryRepresentation::MergeStreamedPiece(
+  vtkDataObject* piece, vtkDataObject* deliveredData)
+{
+  vtkDataObject* current = this->StreamedData ? this->StreamedData.GetPointer() : deliveredData;
+  if (!vtkDataObjectTree::SafeDownCast(piece) || !vtkDataObjectTree::SafeDownCast(current))
+  {
+    return;
+  }
+  vtkStreamingStatusMacro(<< this << ": received new piece.");
+  if (!this->StreamedData)
+  {
+    this->StreamedDataSource = deliveredData;
+  }
+
+  vtkSmartPointer<vtkDataObject> base = current;
+  auto evicted =
+    vtkUnsignedIntArray::SafeDownCast(piece->GetFieldData()->GetArray(EVICTED_PIECES_ARRAY_NAME));
+  if (evicted && evicted->GetNumberOfTuples() > 0)
+  {
+    // release the pieces evicted by the data-server processes. We work on a
+    // shallow copy since the current data may be the delivered data.
+    const unsigned int* ids = evicted->GetPointer(0);
+    const std::set<unsigned int> toRelease(ids, ids + evicted->GetNumberOfTuples());
+
+    auto tree = vtk::TakeSmartPointer(vtkDataObjectTree::SafeDownCast(current->NewInstance()));
+    tree->ShallowCopy(current);
+    vtkSmartPointer<vtkDataObjectTreeIterator> iter;
+    iter.TakeReference(tree->NewTreeIterator());
+    iter->VisitOnlyLeavesOn();
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      if (toRelease.find(iter->GetCurrentFlatIndex()) != toRelease.end())
+      {
+        tree->SetDataSetFrom(iter, nullptr);
+      }
+    }
+    base = tree;
+  }
+
+  // merge with what we are already rendering.
+  vtkNew<vtkAppendCompositeDataLeaves> appender;
+  appender->AddInputDataObject(piece);
+  appender->AddInputDataObject(base);
+  appender->Update();
+
+  this->StreamedData = appender->GetOutputDataObject(0);
+  this->StreamedData->GetFieldData()->RemoveArray(EVICTED_PIECES_ARRAY_NAME);
+  this->StreamedDataTime.Modified();
+}
+
 //----------------------------------------------------------------------------
 bool vtkGeometryRepresentation::GetBounds(
   vtkDataObject* dataObject, double bounds[6], vtkCompositeDataDisplayAttributes* cdAttributes)
@@ -897,6 +1158,8 @@ bool vtkGeometryRepresentation::NeedsOrderedCompositing()
 void vtkGeometryRepresentation::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "StreamingMemoryLimit: " << this->StreamingMemoryLimit << endl;
+  os << indent << "StreamingCapablePipeline: " << this->StreamingCapablePipeline << endl;
 }
 
 //****************************************************************************
@@ -1494,6 +1757,17 @@ void vtkGeometryRepresentation::SetPlaceHolderDataType(int datatype)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkGeometryRepresentation::SetStreamingMemoryLimit(int limit)
+{
+  if (this->StreamingMemoryLimit != limit)
+  {
+    this->StreamingMemoryLimit = limit;
+    this->PriorityQueue->SetMemoryLimit(static_cast<unsigned long>(std::max(limit, 0)) * 1024);
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkGeometryRepresentation::AddBlockSelector(const char* selector)
 {
@@ -11,6 +11,12 @@
  * @par Thanks:
  * The addition of a transformation matrix was supported by CEA/DIF
  * Commissariat a l'Energie Atomique, Centre DAM Ile-De-France, Arpajon, France.
+ *
+ * When streaming is enabled (vtkPVView::GetEnableStreaming()) and the input
+ * pipeline provides bounds for the pieces of a composite dataset in its
+ * meta-data, the representation loads and renders the pieces progressively, in
+ * order of screen coverage, using vtkCompositeStreamingPriorityQueue. See
+ * SetStreamingMemoryLimit() to bound the memory used by the streamed pieces.
  */
 
 #ifndef vtkGeometryRepresentation_h
@@ -20,7 +26,9 @@
 #include "vtkParaViewDeprecation.h" // for PV_DEPRECATED
 #include "vtkProperty.h"            // needed for VTK_POINTS etc.
 #include "vtkRemotingViewsModule.h" // needed for exports
+#include "vtkSmartPointer.h"        // for vtkSmartPointer
 #include "vtkVector.h"              // for vtkVector.
+#include "vtkWeakPointer.h"         // for vtkWeakPointer
 
 #include <set>           // needed for std::set
 #include <string>        // needed for std::string
@@ -28,6 +36,7 @@
 #include <vector>        // needed for std::vector
 
 class vtkCompositeDataDisplayAttributes;
+class vtkCompositeStreamingPriorityQueue;
 class vtkMapper;
 class vtkPiecewiseFunction;
 class vtkPVGeometryFilter;
@@ -427,6 +436,18 @@ public:
   vtkGetMacro(PlaceHolderDataType, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the maximum memory, in MiB, used by the geometry of the streamed
+   * pieces across all data-server processes. When it is reached, the pieces
+   * with the lowest priority for the current view are released to make room
+   * for more important ones. 0 (default) means no limit. Only used when
+   * streaming.
+   */
+  void SetStreamingMemoryLimit(int limit);
+  vtkGetMacro(StreamingMemoryLimit, int);
+  ///@}
+
 protected:
   vtkGeometryRepresentation();
   ~vtkGeometryRepresentation() override;
@@ -462,6 +483,42 @@ protected:
   int RequestUpdateExtent(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector) override;
 
+  /**
+   * Overridden to check if the input pipeline is streaming capable i.e. if
+   * streaming is enabled and the input provides bounds for its pieces in the
+   * composite meta-data.
+   */
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+  /**
+   * Returns true if the representation can stream the pieces of its input.
+   * The default implementation returns true when the geometry filter is a
+   * vtkPVGeometryFilter. Subclasses that process the data further, and hence
+   * cannot render the pieces as they come, should return false.
+   */
+  virtual bool SupportsStreaming();
+
+  /**
+   * Returns true if this representation has a "next piece" that it streamed.
+   * This updates the PriorityQueue using the view planes specified and then
+   * calls Update() on the representation, making it request and process the
+   * next pieces.
+   */
+  bool StreamingUpdate(const double view_planes[24]);
+
+  /**
+   * Generates the geometry for the pieces loaded during StreamingUpdate() in
+   * StreamedPiece.
+   */
+  void ProcessStreamedPiece(vtkDataObject* input);
+
+  /**
+   * Merges a piece delivered during streaming with StreamedData, after releasing
+   * the pieces evicted by the data-server processes.
+   */
+  void MergeStreamedPiece(vtkDataObject* piece, vtkDataObject* deliveredData);
+
   /**
    * Adds the representation to the view.  This is called from
    * vtkView::AddRepresentation().  Subclasses should override this method.
@@ -589,6 +646,23 @@ protected:
   std::vector<std::pair<std::string, bool>> BlockUseLookupTableScalarRanges;
   std::vector<std::pair<vtkDataObject*, vtkIdType>> BlockFieldDataTupleIds;
   ///@}
+
+  ///@{
+  /**
+   * Streaming state. PriorityQueue and StreamedPiece are only used on the
+   * data-server processes, StreamedData, which combines the delivered data
+   * with the pieces streamed since, on the rendering processes.
+   */
+  vtkCompositeStreamingPriorityQueue* PriorityQueue;
+  vtkSmartPointer<vtkDataObject> StreamedPiece;
+  vtkSmartPointer<vtkDataObject> StreamedData;
+  vtkWeakPointer<vtkDataObject> StreamedDataSource;
+  vtkTimeStamp StreamedDataTime;
+  int StreamingMemoryLimit = 0;
+  bool StreamingCapablePipeline = false;
+  bool InStreamingUpdate = false;
+  ///@}
+
 private:
   bool DisableLighting = false;
   vtkGeometryRepresentation(const vtkGeometryRepresentation&) = delete;
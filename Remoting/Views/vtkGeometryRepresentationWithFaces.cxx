@@ -54,14 +54,15 @@ int vtkGeometryRepresentationWithFaces::ProcessViewRequest(
 
   if (request_type == vtkPVView::REQUEST_RENDER())
   {
-    vtkAlgorithmOutput* producerPort = vtkPVRenderView::GetPieceProducer(inInfo, this);
+    // render the same data as the front faces, which includes the pieces
+    // streamed so far when streaming.
     if (inInfo->Has(vtkPVRenderView::USE_LOD()))
     {
-      this->LODBackfaceMapper->SetInputConnection(0, producerPort);
+      this->LODBackfaceMapper->SetInputDataObject(0, this->LODMapper->GetInputDataObject(0, 0));
     }
     else
     {
-      this->BackfaceMapper->SetInputConnection(0, producerPort);
+      this->BackfaceMapper->SetInputDataObject(0, this->Mapper->GetInputDataObject(0, 0));
     }
   }
 
@@ -54,6 +54,12 @@ protected:
   bool AddToView(vtkView* view) override;
   bool RemoveFromView(vtkView* view) override;
 
+  /**
+   * Streamed pieces cannot be rendered without the processing done by this
+   * representation, hence streaming is not supported.
+   */
+  bool SupportsStreaming() override { return false; }
+
 private:
   vtkGeometrySliceRepresentation(const vtkGeometrySliceRepresentation&) = delete;
   void operator=(const vtkGeometrySliceRepresentation&) = delete;
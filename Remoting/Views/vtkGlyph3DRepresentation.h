@@ -127,6 +127,12 @@ protected:
    */
   void UpdateColoringParameters() override;
 
+  /**
+   * Streamed pieces cannot be rendered without the processing done by this
+   * representation, hence streaming is not supported.
+   */
+  bool SupportsStreaming() override { return false; }
+
   /**
    * Determines bounds using the vtkGlyph3DMapper.
    */
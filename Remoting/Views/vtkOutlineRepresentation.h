@@ -32,6 +32,12 @@ protected:
 
   void SetRepresentation(int) override { this->Superclass::SetRepresentation(WIREFRAME); }
 
+  /**
+   * The outline is computed from the bounds of the whole dataset, hence
+   * streaming its pieces is not supported.
+   */
+  bool SupportsStreaming() override { return false; }
+
 private:
   vtkOutlineRepresentation(const vtkOutlineRepresentation&) = delete;
   void operator=(const vtkOutlineRepresentation&) = delete;
@@ -8,6 +8,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderer.h"
 #include "vtkSquirtCompressor.h"
+#include "vtkTimerLog.h"
+#include "vtkTiledImageCompressor.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
@@ -24,6 +26,8 @@ vtkPVClientServerSynchronizedRenderers::vtkPVClientServerSynchronizedRenderers()
   : Compressor(nullptr)
   , LossLessCompression(true)
   , NVPipeSupport(false)
+  , ImageDeltaCompression(false)
+  , ImageKeyFrameInterval(30)
 {
   this->ConfigureCompressor("vtkLZ4Compressor 0 3");
 }
@@ -53,7 +57,7 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
       vtkUnsignedCharArray* data = vtkUnsignedCharArray::New();
       this->ParallelController->Receive(data, 1, 0x023430);
       this->Compressor->SetImageResolution(header[1], header[2]);
-      this->Decompress(data, rawImage.GetRawPtr());
+      this->Decompress(data, rawImage.GetRawPtr(), header[1], header[2]);
       data->Delete();
     }
     else
@@ -86,7 +90,8 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
     if (this->Compressor)
     {
       this->Compressor->SetImageResolution(header[1], header[2]);
-      this->ParallelController->Send(this->Compress(rawImage.GetRawPtr()), 1, 0x023430);
+      this->ParallelController->Send(
+        this->Compress(rawImage.GetRawPtr(), header[1], header[2]), 1, 0x023430);
     }
     else
     {
@@ -96,17 +101,19 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
 }
 
 //----------------------------------------------------------------------------
-vtkUnsignedCharArray* vtkPVClientServerSynchronizedRenderers::Compress(vtkUnsignedCharArray* data)
+vtkUnsignedCharArray* vtkPVClientServerSynchronizedRenderers::Compress(
+  vtkUnsignedCharArray* data, int width, int height)
 {
   if (this->Compressor)
   {
     this->Compressor->SetLossLessMode(this->LossLessCompression);
     this->Compressor->SetInput(data);
-    if (this->Compressor->Compress() == 0)
+    if (this->Compressor->CompressFrame(width, height) == 0)
     {
       vtkErrorMacro("Image compression failed!");
       return data;
     }
+    this->LogCompressionStatistics();
     return this->Compressor->GetOutput();
   }
 
@@ -115,17 +122,18 @@ vtkUnsignedCharArray* vtkPVClientServerSynchronizedRenderers::Compress(vtkUnsign
 
 //----------------------------------------------------------------------------
 void vtkPVClientServerSynchronizedRenderers::Decompress(
-  vtkUnsignedCharArray* data, vtkUnsignedCharArray* outputBuffer)
+  vtkUnsignedCharArray* data, vtkUnsignedCharArray* outputBuffer, int width, int height)
 {
   if (this->Compressor)
   {
     this->Compressor->SetLossLessMode(this->LossLessCompression);
     this->Compressor->SetInput(data);
     this->Compressor->SetOutput(outputBuffer);
-    if (this->Compressor->Decompress() == 0)
+    if (this->Compressor->DecompressFrame(width, height) == 0)
     {
       vtkErrorMacro("Image de-compression failed!");
     }
+    this->LogCompressionStatistics();
   }
   else
   {
@@ -159,6 +167,10 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
     {
       comp = vtkLZ4Compressor::New();
     }
+    else if (className == "vtkTiledImageCompressor")
+    {
+      comp = vtkTiledImageCompressor::New();
+    }
     else if (className == "vtkNvPipeCompressor" && this->NVPipeSupport)
     {
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
@@ -187,6 +199,8 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
       vtkWarningMacro("Could not create the compressor by name " << className << ".");
       return;
     }
+    comp->SetDeltaMode(this->ImageDeltaCompression);
+    comp->SetKeyFrameInterval(this->ImageKeyFrameInterval);
     this->SetCompressor(comp);
     comp->Delete();
   }
@@ -200,8 +214,58 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::SetImageDeltaCompression(bool val)
+{
+  if (this->ImageDeltaCompression != val)
+  {
+    this->ImageDeltaCompression = val;
+    if (this->Compressor)
+    {
+      this->Compressor->SetDeltaMode(val);
+    }
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::SetImageKeyFrameInterval(int val)
+{
+  if (this->ImageKeyFrameInterval != val)
+  {
+    this->ImageKeyFrameInterval = val;
+    if (this->Compressor)
+    {
+      this->Compressor->SetKeyFrameInterval(val);
+    }
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkPVClientServerSynchronizedRenderers::GetImageDeltaBytesSaved() const
+{
+  return this->Compressor ? this->Compressor->GetLastFrameBytesSaved() : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::LogCompressionStatistics()
+{
+  vtkImageCompressor* comp = this->Compressor;
+  if (comp && comp->GetDeltaMode())
+  {
+    vtkTimerLog::FormatAndMarkEvent(
+      "Image delta: key-frame %d, rectangles %d, bytes saved %lld, compressed size %lld",
+      comp->GetLastFrameIsKeyFrame() ? 1 : 0, comp->GetLastFrameNumberOfRectangles(),
+      static_cast<long long>(comp->GetLastFrameBytesSaved()),
+      static_cast<long long>(comp->GetLastFrameCompressedSize()));
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkPVClientServerSynchronizedRenderers::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ImageDeltaCompression: " << this->ImageDeltaCompression << endl;
+  os << indent << "ImageKeyFrameInterval: " << this->ImageKeyFrameInterval << endl;
 }
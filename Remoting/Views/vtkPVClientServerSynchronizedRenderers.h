@@ -47,6 +47,24 @@ public:
    */
   virtual void ConfigureCompressor(const char* stream);
 
+  ///@{
+  /**
+   * When set, only the parts of the image that changed since the previous
+   * frame are transmitted, with a complete key frame every
+   * ImageKeyFrameInterval frames. See vtkImageCompressor::SetDeltaMode.
+   */
+  void SetImageDeltaCompression(bool);
+  vtkGetMacro(ImageDeltaCompression, bool);
+  void SetImageKeyFrameInterval(int);
+  vtkGetMacro(ImageKeyFrameInterval, int);
+  ///@}
+
+  /**
+   * Returns the number of uncompressed image bytes that were not transmitted
+   * for the last frame thanks to delta compression.
+   */
+  vtkIdType GetImageDeltaBytesSaved() const;
+
 protected:
   vtkPVClientServerSynchronizedRenderers();
   ~vtkPVClientServerSynchronizedRenderers() override;
@@ -59,8 +77,14 @@ protected:
   vtkGetObjectMacro(Compressor, vtkImageCompressor);
   ///@}
 
-  vtkUnsignedCharArray* Compress(vtkUnsignedCharArray*);
-  void Decompress(vtkUnsignedCharArray* input, vtkUnsignedCharArray* outputBuffer);
+  vtkUnsignedCharArray* Compress(vtkUnsignedCharArray*, int width, int height);
+  void Decompress(
+    vtkUnsignedCharArray* input, vtkUnsignedCharArray* outputBuffer, int width, int height);
+
+  /**
+   * Adds the delta compression statistics for the last frame to the timer log.
+   */
+  void LogCompressionStatistics();
 
   void MasterEndRender() override;
   void SlaveEndRender() override;
@@ -68,6 +92,8 @@ protected:
   vtkImageCompressor* Compressor;
   bool LossLessCompression;
   bool NVPipeSupport;
+  bool ImageDeltaCompression;
+  int ImageKeyFrameInterval;
 
 private:
   vtkPVClientServerSynchronizedRenderers(const vtkPVClientServerSynchronizedRenderers&) = delete;
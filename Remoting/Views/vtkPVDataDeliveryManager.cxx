@@ -13,6 +13,14 @@
 #include "vtkSmartPointer.h"
 #include "vtkWeakPointer.h"
 
+#include <algorithm>
+#include <map>
+
+namespace
+{
+unsigned long vtkPVDataDeliveryManagerCacheSizeLimit = 0;
+}
+
 //*****************************************************************************
 //----------------------------------------------------------------------------
 vtkPVDataDeliveryManager::vtkPVDataDeliveryManager()
@@ -57,6 +65,7 @@ void vtkPVDataDeliveryManager::UnRegisterRepresentation(vtkPVDataRepresentation*
 {
   unsigned int rid = repr->GetUniqueIdentifier();
   this->Internals->RepresentationsMap.erase(rid);
+  this->Internals->ClearCacheUsage(rid);
 
   vtkInternals::ItemsMapType::iterator iter = this->Internals->ItemsMap.begin();
   while (iter != this->Internals->ItemsMap.end())
@@ -140,6 +149,17 @@ bool vtkPVDataDeliveryManager::HasPiece(vtkPVDataRepresentation* repr, bool low_
     this->Internals->GetItem(repr, low_res, port, /*create_if_needed=*/false);
   const auto cacheKey = this->GetCacheKey(repr);
   const bool val = item ? (item->GetDataObject(cacheKey) != nullptr) : false;
+  if (this->View && this->View->GetUseCache())
+  {
+    // representations may query the cache several times in the same update.
+    auto& internals = *this->Internals;
+    auto result = internals.CacheLookups.emplace(repr->GetUniqueIdentifier(), 0);
+    if (result.second || result.first->second != internals.CacheGeneration)
+    {
+      result.first->second = internals.CacheGeneration;
+      ++(val ? internals.CacheHits : internals.CacheMisses);
+    }
+  }
 
   vtkLogF(TRACE, "HasPiece %s (key=%g) : %d", repr->GetLogName().c_str(), cacheKey, val);
   return val;
@@ -285,8 +305,149 @@ void vtkPVDataDeliveryManager::ClearCache(vtkPVDataRepresentation* repr)
   this->Internals->ClearCache(repr);
 }
 
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::SetCacheSizeLimit(unsigned long kb)
+{
+  vtkPVDataDeliveryManagerCacheSizeLimit = kb;
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkPVDataDeliveryManager::GetCacheSizeLimit()
+{
+  return vtkPVDataDeliveryManagerCacheSizeLimit;
+}
+
+//----------------------------------------------------------------------------
+unsigned long vtkPVDataDeliveryManager::GetCacheSize()
+{
+  std::map<double, vtkTypeUInt64> sizes;
+  for (const auto& ipair : this->Internals->ItemsMap)
+  {
+    ipair.second.first.AccumulateCacheSizes(sizes);
+    ipair.second.second.AccumulateCacheSizes(sizes);
+  }
+  vtkTypeUInt64 total = 0;
+  for (const auto& spair : sizes)
+  {
+    total += spair.second;
+  }
+  return static_cast<unsigned long>(total);
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVDataDeliveryManager::GetCacheHits() const
+{
+  return this->Internals->CacheHits;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVDataDeliveryManager::GetCacheMisses() const
+{
+  return this->Internals->CacheMisses;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVDataDeliveryManager::GetCacheEvictions() const
+{
+  return this->Internals->CacheEvictions;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::ResetCacheStatistics()
+{
+  this->Internals->CacheHits = 0;
+  this->Internals->CacheMisses = 0;
+  this->Internals->CacheEvictions = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVDataDeliveryManager::UpdateCacheUsage()
+{
+  auto& internals = *this->Internals;
+  using CacheEntryType = vtkInternals::CacheEntryType;
+
+  // mark the geometries in use as the most recently used ones. Since all
+  // processes update the same representations, the generation is consistent.
+  const auto generation = ++internals.CacheGeneration;
+  std::map<unsigned int, double> currentKeys;
+  for (const auto& rpair : internals.RepresentationsMap)
+  {
+    if (auto repr = rpair.second.GetPointer())
+    {
+      const double cacheKey = this->GetCacheKey(repr);
+      currentKeys[rpair.first] = cacheKey;
+      internals.CacheEntriesLastUsed[CacheEntryType(rpair.first, cacheKey)] = generation;
+    }
+  }
+
+  // the candidates are all the entries used so far except the geometries
+  // currently shown, from the least to the most recently used. They do not
+  // depend on the data held by this process, so they are the same on all
+  // processes even if some of them hold no data for an entry.
+  auto& candidates = internals.EvictionCandidates;
+  candidates.clear();
+  for (const auto& upair : internals.CacheEntriesLastUsed)
+  {
+    if (upair.second != generation)
+    {
+      candidates.push_back(upair.first);
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+    [&internals](const CacheEntryType& a, const CacheEntryType& b) {
+      return internals.CacheEntriesLastUsed[a] < internals.CacheEntriesLastUsed[b];
+    });
+
+  // local size of each entry.
+  auto& sizes = internals.EvictionCandidateSizes;
+  sizes.clear();
+  for (const auto& ipair : internals.ItemsMap)
+  {
+    std::map<double, vtkTypeUInt64> itemSizes;
+    ipair.second.first.AccumulateCacheSizes(itemSizes);
+    ipair.second.second.AccumulateCacheSizes(itemSizes);
+    for (const auto& spair : itemSizes)
+    {
+      sizes[CacheEntryType(ipair.first.first, spair.first)] += spair.second;
+    }
+  }
+  return candidates.size();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVDataDeliveryManager::GetEvictionCandidateSize(vtkTypeUInt64 index)
+{
+  auto& internals = *this->Internals;
+  if (index >= internals.EvictionCandidates.size())
+  {
+    return 0;
+  }
+  auto iter = internals.EvictionCandidateSizes.find(internals.EvictionCandidates[index]);
+  return iter != internals.EvictionCandidateSizes.end() ? iter->second : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataDeliveryManager::EvictCacheEntries(vtkTypeUInt64 count)
+{
+  auto& internals = *this->Internals;
+  count = std::min<vtkTypeUInt64>(count, internals.EvictionCandidates.size());
+  for (vtkTypeUInt64 cc = 0; cc < count; ++cc)
+  {
+    const auto& entry = internals.EvictionCandidates[cc];
+    vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "evict cached geometry (id=%u, key=%g)",
+      entry.first, entry.second);
+    internals.ClearCache(entry.first, entry.second);
+  }
+  internals.CacheEvictions += count;
+  internals.EvictionCandidates.clear();
+  internals.EvictionCandidateSizes.clear();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVDataDeliveryManager::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheHits: " << this->Internals->CacheHits << endl;
+  os << indent << "CacheMisses: " << this->Internals->CacheMisses << endl;
+  os << indent << "CacheEvictions: " << this->Internals->CacheEvictions << endl;
 }
@@ -142,6 +142,54 @@ public:
    */
   void Deliver(int use_low_res, unsigned int size, unsigned int* keys);
 
+  ///@{
+  /**
+   * Set the maximum size, in KiB, of the geometry cached by all processes
+   * together when the view caches geometries (see vtkPVView::SetUseCache), e.g.
+   * when playing an animation with geometry caching enabled. When the limit is
+   * exceeded, cached geometries are evicted in least recently used order,
+   * across all representations of the view. The geometry currently shown is
+   * never evicted. 0 (default) means no limit.
+   */
+  static void SetCacheSizeLimit(unsigned long kb);
+  static unsigned long GetCacheSizeLimit();
+  ///@}
+
+  /**
+   * Returns the size, in KiB, of all geometries held by this manager, including
+   * cached geometries for other cache keys.
+   */
+  unsigned long GetCacheSize();
+
+  ///@{
+  /**
+   * Statistics about the geometry cache. A hit is counted once per
+   * representation update when the representation skips it because the
+   * geometry for the current cache key is available, a miss when it is not.
+   * Evictions count the cache entries evicted to honor the cache size limit.
+   */
+  vtkTypeUInt64 GetCacheHits() const;
+  vtkTypeUInt64 GetCacheMisses() const;
+  vtkTypeUInt64 GetCacheEvictions() const;
+  void ResetCacheStatistics();
+  ///@}
+
+  ///@{
+  /**
+   * Internal methods used by views to enforce the cache size limit.
+   * `UpdateCacheUsage` marks the geometries currently shown as the most
+   * recently used ones and returns the number of other cache entries, the
+   * eviction candidates, sorted from the least to the most recently used.
+   * Candidates are identified by representation and cache key, so they are
+   * the same on all processes. `GetEvictionCandidateSize` returns the size,
+   * in KiB, of a candidate on this process; views sum it over all processes
+   * to decide how many candidates `EvictCacheEntries` evicts.
+   */
+  vtkTypeUInt64 UpdateCacheUsage();
+  vtkTypeUInt64 GetEvictionCandidateSize(vtkTypeUInt64 index);
+  void EvictCacheEntries(vtkTypeUInt64 count);
+  ///@}
+
   /**
    * Views that support changing of which ranks do the rendering at runtime
    * based on things like data sizes, etc. may override this method to provide a
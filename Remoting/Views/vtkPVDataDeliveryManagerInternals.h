@@ -14,9 +14,11 @@
 #include "vtkWeakPointer.h"          // for vtkWeakPointer
 
 #include <cassert> // for assert
+#include <limits>  // for std::numeric_limits
 #include <map>     // for std::map
 #include <numeric> // for std::accumulate
 #include <utility> // for std::pair
+#include <vector>  // for std::vector
 
 class vtkPVDataDeliveryManager::vtkInternals
 {
@@ -77,6 +79,19 @@ public:
     vtkItem() = default;
 
     void ClearCache() { this->Data.clear(); }
+    void ClearCache(double cacheKey) { this->Data.erase(cacheKey); }
+
+    // Accumulates the memory size (in KiB) of the data cached for each cache key.
+    void AccumulateCacheSizes(std::map<double, vtkTypeUInt64>& sizes) const
+    {
+      for (const auto& pair : this->Data)
+      {
+        if (pair.second.DataObject)
+        {
+          sizes[pair.first] += pair.second.ActualMemorySize;
+        }
+      }
+    }
 
     void SetDataObject(vtkDataObject* data, vtkInternals* helper, double cacheKey)
     {
@@ -274,10 +289,50 @@ public:
         ipair.second.second.ClearCache();
       }
     }
+    this->ClearCacheUsage(id);
+  }
+
+  void ClearCacheUsage(unsigned int id)
+  {
+    auto iter = this->CacheEntriesLastUsed.lower_bound(
+      CacheEntryType(id, std::numeric_limits<double>::lowest()));
+    while (iter != this->CacheEntriesLastUsed.end() && iter->first.first == id)
+    {
+      iter = this->CacheEntriesLastUsed.erase(iter);
+    }
+    this->CacheLookups.erase(id);
+  }
+
+  void ClearCache(unsigned int id, double cacheKey)
+  {
+    for (auto& ipair : this->ItemsMap)
+    {
+      if (ipair.first.first == id)
+      {
+        ipair.second.first.ClearCache(cacheKey);
+        ipair.second.second.ClearCache(cacheKey);
+      }
+    }
+    this->CacheEntriesLastUsed.erase(CacheEntryType(id, cacheKey));
   }
 
   ItemsMapType ItemsMap;
   RepresentationsMapType RepresentationsMap;
+
+  // Geometry cache bookkeeping. Entries are identified by the representation
+  // id and the cache key and are ordered by the generation in which they were
+  // last used, which is identical on all processes. `CacheLookups` holds the
+  // generation in which a hit or a miss was last counted for a representation
+  // so that each representation update counts once.
+  typedef std::pair<unsigned int, double> CacheEntryType;
+  std::map<CacheEntryType, vtkTypeUInt64> CacheEntriesLastUsed;
+  std::vector<CacheEntryType> EvictionCandidates;
+  std::map<CacheEntryType, vtkTypeUInt64> EvictionCandidateSizes;
+  std::map<unsigned int, vtkTypeUInt64> CacheLookups;
+  vtkTypeUInt64 CacheGeneration{ 0 };
+  vtkTypeUInt64 CacheHits{ 0 };
+  vtkTypeUInt64 CacheMisses{ 0 };
+  vtkTypeUInt64 CacheEvictions{ 0 };
 };
 
 #endif // __WRAP__
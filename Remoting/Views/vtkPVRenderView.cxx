@@ -102,6 +102,7 @@
 #include "vtkOSPRayRendererNode.h"
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <set>
@@ -1432,6 +1433,38 @@ void vtkPVRenderView::Update()
 
   this->Superclass::Update();
 
+  // When caching geometries, evict least recently used geometries while the
+  // cache held by all ranks together exceeds the limit. Eviction must be
+  // identical on all ranks, otherwise ranks would disagree on which
+  // representations need to update, hence the sizes are summed over all ranks,
+  // with a single reduction for all the candidates.
+  if (this->GetUseCache())
+  {
+    auto dmgr = this->GetDeliveryManager();
+    const vtkTypeUInt64 numberOfCandidates = dmgr->UpdateCacheUsage();
+    const unsigned long cacheSizeLimit = vtkPVDataDeliveryManager::GetCacheSizeLimit();
+    if (cacheSizeLimit > 0 && numberOfCandidates > 0)
+    {
+      // the total cache size comes first, then the size of each candidate.
+      std::vector<vtkTypeUInt64> sizes(numberOfCandidates + 1);
+      sizes[0] = dmgr->GetCacheSize();
+      for (vtkTypeUInt64 cc = 0; cc < numberOfCandidates; ++cc)
+      {
+        sizes[cc + 1] = dmgr->GetEvictionCandidateSize(cc);
+      }
+      std::vector<vtkTypeUInt64> totals;
+      this->AllReduce(sizes, totals, vtkCommunicator::SUM_OP);
+      vtkTypeUInt64 total = totals[0];
+      vtkTypeUInt64 count = 0;
+      while (total > cacheSizeLimit && count < numberOfCandidates)
+      {
+        total -= std::min(total, totals[count + 1]);
+        ++count;
+      }
+      dmgr->EvictCacheEntries(count);
+    }
+  }
+
   // Update camera zoom manipulators based on whether we have discrete position.
   vtkUpdateTrackballZoomManipulators(this->TwoDInteractorStyle, this->DiscreteCameras == nullptr);
   vtkUpdateTrackballZoomManipulators(this->ThreeDInteractorStyle, this->DiscreteCameras == nullptr);
@@ -2417,6 +2450,24 @@ void vtkPVRenderView::ConfigureCompressor(const char* configuration)
   this->SynchronizedRenderers->ConfigureCompressor(configuration);
 }
 
+//----------------------------------------------------------------------------
+void vtkPVRenderView::SetImageDeltaCompression(bool val)
+{
+  this->SynchronizedRenderers->SetImageDeltaCompression(val);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVRenderView::SetImageKeyFrameInterval(int val)
+{
+  this->SynchronizedRenderers->SetImageKeyFrameInterval(val);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkPVRenderView::GetImageDeltaBytesSaved()
+{
+  return this->SynchronizedRenderers->GetImageDeltaBytesSaved();
+}
+
 //----------------------------------------------------------------------------
 void vtkPVRenderView::InvalidateCachedSelection()
 {
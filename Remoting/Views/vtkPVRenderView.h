@@ -287,6 +287,25 @@ public:
    */
   void ConfigureCompressor(const char* configuration);
 
+  ///@{
+  /**
+   * When enabled, only the parts of the rendered image that changed since the
+   * previous frame are transferred from the server to the client, with a
+   * complete key frame every ImageKeyFrameInterval frames.
+   * See vtkImageCompressor::SetDeltaMode for details.
+   * \note CallOnAllProcesses
+   */
+  void SetImageDeltaCompression(bool);
+  void SetImageKeyFrameInterval(int);
+  ///@}
+
+  /**
+   * Returns the number of uncompressed image bytes that delta compression
+   * avoided transferring for the last rendered frame. The statistic is also
+   * added to the timer log for every frame.
+   */
+  vtkIdType GetImageDeltaBytesSaved();
+
   /**
    * Resets the clipping range. One does not need to call this directly ever. It
    * is called periodically by the vtkRenderer to reset the camera range.
@@ -243,6 +243,44 @@ void vtkPVSynchronizedRenderer::ConfigureCompressor(const char* configuration)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPVSynchronizedRenderer::SetImageDeltaCompression(bool val)
+{
+  vtkPVClientServerSynchronizedRenderers* cssync =
+    vtkPVClientServerSynchronizedRenderers::SafeDownCast(this->CSSynchronizer);
+  if (cssync)
+  {
+    cssync->SetImageDeltaCompression(val);
+  }
+  else
+  {
+    vtkDebugMacro("Not in client-server mode.");
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSynchronizedRenderer::SetImageKeyFrameInterval(int val)
+{
+  vtkPVClientServerSynchronizedRenderers* cssync =
+    vtkPVClientServerSynchronizedRenderers::SafeDownCast(this->CSSynchronizer);
+  if (cssync)
+  {
+    cssync->SetImageKeyFrameInterval(val);
+  }
+  else
+  {
+    vtkDebugMacro("Not in client-server mode.");
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkPVSynchronizedRenderer::GetImageDeltaBytesSaved()
+{
+  vtkPVClientServerSynchronizedRenderers* cssync =
+    vtkPVClientServerSynchronizedRenderers::SafeDownCast(this->CSSynchronizer);
+  return cssync ? cssync->GetImageDeltaBytesSaved() : 0;
+}
+
 //----------------------------------------------------------------------------
 void vtkPVSynchronizedRenderer::SetImageProcessingPass(vtkImageProcessingPass* pass)
 {
@@ -127,6 +127,22 @@ public:
   void SetLossLessCompression(bool);
   ///@}
 
+  ///@{
+  /**
+   * Passes the delta compression settings to the client-server synchronizer,
+   * if any. See vtkPVClientServerSynchronizedRenderers::SetImageDeltaCompression.
+   */
+  void SetImageDeltaCompression(bool);
+  void SetImageKeyFrameInterval(int);
+  ///@}
+
+  /**
+   * Returns the number of uncompressed image bytes that delta compression
+   * avoided transmitting for the last frame, or 0 when not in client-server
+   * mode.
+   */
+  vtkIdType GetImageDeltaBytesSaved();
+
   /**
    * Activates or de-activated the use of Depth Buffer in an ImageProcessingPass
    */
@@ -30,6 +30,7 @@
 #include "vtkTimerLog.h"
 #include "vtkViewLayout.h"
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <sstream>
@@ -759,9 +760,19 @@ void vtkPVView::AllReduce(const vtkBoundingBox& arg_source, vtkBoundingBox& dest
 //-----------------------------------------------------------------------------
 void vtkPVView::AllReduce(
   const vtkTypeUInt64 arg_source, vtkTypeUInt64& dest, int operation, bool skip_data_server)
+{
+  std::vector<vtkTypeUInt64> result;
+  this->AllReduce(std::vector<vtkTypeUInt64>{ arg_source }, result, operation, skip_data_server);
+  dest = result[0];
+}
+
+//-----------------------------------------------------------------------------
+void vtkPVView::AllReduce(const std::vector<vtkTypeUInt64>& arg_source,
+  std::vector<vtkTypeUInt64>& dest, int operation, bool skip_data_server)
 {
   assert(this->Session);
-  vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "all-reduce (op=%d)", operation);
+  vtkVLogScopeF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "all-reduce (op=%d, count=%d)", operation,
+    static_cast<int>(arg_source.size()));
 
   auto evaluator = [operation](vtkTypeUInt64 a, vtkTypeUInt64 b) {
     switch (operation)
@@ -777,11 +788,18 @@ void vtkPVView::AllReduce(
     }
   };
 
-  vtkTypeUInt64 source = arg_source;
+  std::vector<vtkTypeUInt64> source = arg_source;
+  dest.resize(source.size());
+  const vtkIdType count = static_cast<vtkIdType>(source.size());
+  if (count == 0)
+  {
+    return;
+  }
+
   auto pController = vtkMultiProcessController::GetGlobalController();
   if (pController)
   {
-    pController->Reduce(&source, &dest, 1, operation, 0);
+    pController->Reduce(source.data(), dest.data(), count, operation, 0);
     source = dest;
   }
 
@@ -789,8 +807,8 @@ void vtkPVView::AllReduce(
   if (cController)
   {
     assert(pController == nullptr || pController->GetLocalProcessId() == 0);
-    cController->Send(&source, 1, 1, 41234);
-    cController->Receive(&source, 1, 1, 41235);
+    cController->Send(source.data(), count, 1, 41234);
+    cController->Receive(source.data(), count, 1, 41235);
   }
 
   auto crController = this->Session->GetController(vtkPVSession::RENDER_SERVER_ROOT);
@@ -800,37 +818,40 @@ void vtkPVView::AllReduce(
     cdController = nullptr;
   }
 
+  std::vector<vtkTypeUInt64> values(source.size());
   if (crController)
   {
-    vtkTypeUInt64 val;
-    crController->Receive(&val, 1, 1, 41234);
-    source = evaluator(source, val);
+    crController->Receive(values.data(), count, 1, 41234);
+    std::transform(source.begin(), source.end(), values.begin(), source.begin(), evaluator);
   }
 
   if (cdController)
   {
-    vtkTypeUInt64 val;
-    cdController->Receive(&val, 1, 1, 41234);
-    source = evaluator(source, val);
+    cdController->Receive(values.data(), count, 1, 41234);
+    std::transform(source.begin(), source.end(), values.begin(), source.begin(), evaluator);
   }
 
   if (crController)
   {
-    crController->Send(&source, 1, 1, 41235);
+    crController->Send(source.data(), count, 1, 41235);
   }
 
   if (cdController)
   {
-    cdController->Send(&source, 1, 1, 41235);
+    cdController->Send(source.data(), count, 1, 41235);
   }
 
   if (pController)
   {
-    pController->Broadcast(&source, 1, 0);
+    pController->Broadcast(source.data(), count, 0);
   }
 
   dest = source;
-  vtkVLogF(PARAVIEW_LOG_RENDERING_VERBOSITY(), "source=%llu, result=%llu", arg_source, dest);
+  if (count == 1)
+  {
+    vtkVLogF(
+      PARAVIEW_LOG_RENDERING_VERBOSITY(), "source=%llu, result=%llu", arg_source[0], dest[0]);
+  }
 }
 
 //-----------------------------------------------------------------------------
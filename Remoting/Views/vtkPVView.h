@@ -18,6 +18,8 @@
 #include "vtkView.h"
 #include "vtkWeakPointer.h" // for vtkWeakPointer
 
+#include <vector> // for std::vector
+
 class vtkBoundingBox;
 class vtkInformation;
 class vtkInformationObjectBaseKey;
@@ -311,6 +313,14 @@ protected:
   void AllReduce(
     vtkTypeUInt64 source, vtkTypeUInt64& dest, int operation, bool skip_data_server = false);
 
+  /**
+   * Same as above, for several values reduced element-wise in a single
+   * collective. `source` must have the same size on all participating
+   * processes.
+   */
+  void AllReduce(const std::vector<vtkTypeUInt64>& source, std::vector<vtkTypeUInt64>& dest,
+    int operation, bool skip_data_server = false);
+
   ///@{
   /**
    * Overridden to assign IDs to each representation. This assumes that
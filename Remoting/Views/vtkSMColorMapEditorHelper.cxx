@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkSMColorMapEditorHelper.h"
 
+#include "vtkClientServerStream.h"
 #include "vtkDataObject.h"
 #include "vtkDoubleArray.h"
 #include "vtkNew.h"
@@ -27,6 +28,7 @@
 #include "vtkSMTransferFunctionManager.h"
 #include "vtkSMTransferFunctionProxy.h"
 #include "vtkStringList.h"
+#include "vtkSmartPointer.h"
 #include "vtkVariant.h"
 
 #include "vtksys/SystemTools.hxx"
@@ -439,8 +441,8 @@ bool vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRange(
     return false;
   }
 
-  vtkPVDataInformation* dataInfo = inputProxy->GetDataInformation(port);
-  vtkPVArrayInformation* info = dataInfo->GetArrayInformation(arrayName, attributeType);
+  vtkPVArrayInformation* info =
+    inputProxy->GetArrayInformationWithRanges(port, arrayName, attributeType);
   if (!info)
   {
     vtkPVDataInformation* representedDataInfo = repr->GetRepresentedDataInformation();
@@ -543,6 +545,79 @@ std::vector<vtkTypeBool> vtkSMColorMapEditorHelper::RescaleSelectedTransferFunct
   }
 }
 
+namespace
+{
+// Returns the value at the given percentile, interpolating linearly between
+// the closest ranks.
+double GetPercentile(std::vector<double>& values, double percentile)
+{
+  std::sort(values.begin(), values.end());
+  const double position =
+    std::min(std::max(percentile, 0.0), 100.0) / 100.0 * (values.size() - 1);
+  const size_t index = static_cast<size_t>(position);
+  if (index + 1 >= values.size())
+  {
+    return values.back();
+  }
+  return values[index] + (position - index) * (values[index + 1] - values[index]);
+}
+
+// Returns an array information whose component ranges go from the
+// `lowerPercentile` of the minima of the timesteps to the `upperPercentile` of
+// their maxima, or nullptr if the ranges at each timestep are not available.
+vtkSmartPointer<vtkPVArrayInformation> GetArrayInformationOverTime(vtkSMOutputPort* port,
+  const char* arrayName, int attributeType, double lowerPercentile, double upperPercentile)
+{
+  std::map<double, std::vector<double>> ranges;
+  if (!port->GetTemporalArrayRanges(arrayName, attributeType, ranges))
+  {
+    return nullptr;
+  }
+
+  // the other properties of the array are taken from the current timestep if
+  // it has the array.
+  vtkPVArrayInformation* current =
+    port->GetDataInformation()->GetArrayInformation(arrayName, attributeType);
+  if (!current)
+  {
+    current = port->GetTemporalDataInformation()->GetArrayInformation(arrayName, attributeType);
+  }
+  if (!current)
+  {
+    return nullptr;
+  }
+  vtkClientServerStream stream;
+  current->CopyToStream(&stream);
+  auto info = vtkSmartPointer<vtkPVArrayInformation>::New();
+  info->CopyFromStream(&stream);
+
+  const size_t size = 2 * (static_cast<size_t>(info->GetNumberOfComponents()) + 1);
+  for (size_t cc = 0; cc < size; cc += 2)
+  {
+    std::vector<double> minima;
+    std::vector<double> maxima;
+    for (const auto& item : ranges)
+    {
+      // skip timesteps where the array has a different number of components.
+      if (item.second.size() == size && item.second[cc] <= item.second[cc + 1])
+      {
+        minima.push_back(item.second[cc]);
+        maxima.push_back(item.second[cc + 1]);
+      }
+    }
+    if (minima.empty())
+    {
+      continue;
+    }
+    double range[2] = { ::GetPercentile(minima, lowerPercentile),
+      ::GetPercentile(maxima, upperPercentile) };
+    range[1] = std::max(range[0], range[1]);
+    info->SetComponentRange(static_cast<int>(cc / 2) - 1, range);
+  }
+  return info;
+}
+}
+
 //----------------------------------------------------------------------------
 bool vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRangeOverTime(vtkSMProxy* proxy)
 {
@@ -566,12 +641,60 @@ bool vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRangeOverTime(
     return false;
   }
 
-  vtkPVTemporalDataInformation* dataInfo =
-    inputProxy->GetOutputPort(port)->GetTemporalDataInformation();
+  // use the cached ranges at each timestep when possible.
+  vtkSMOutputPort* outputPort = inputProxy->GetOutputPort(port);
+  if (auto info = ::GetArrayInformationOverTime(outputPort, arrayName, attributeType, 0, 100))
+  {
+    return vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRange(proxy, info);
+  }
+
+  vtkPVTemporalDataInformation* dataInfo = outputPort->GetTemporalDataInformation();
   vtkPVArrayInformation* info = dataInfo->GetArrayInformation(arrayName, attributeType);
   return info ? vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRange(proxy, info) : false;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataPercentilesOverTime(
+  vtkSMProxy* proxy, double lowerPercentile, double upperPercentile)
+{
+  const vtkSMPropertyHelper helper(proxy->GetProperty("ColorArrayName"));
+
+  return vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataPercentilesOverTime(
+    proxy, helper.GetAsString(4), helper.GetAsInt(3), lowerPercentile, upperPercentile);
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataPercentilesOverTime(vtkSMProxy* proxy,
+  const char* arrayName, int attributeType, double lowerPercentile, double upperPercentile)
+{
+  if (lowerPercentile < 0 || upperPercentile > 100 || lowerPercentile > upperPercentile)
+  {
+    vtkGenericWarningMacro(
+      "Invalid percentiles " << lowerPercentile << " and " << upperPercentile << ".");
+    return false;
+  }
+
+  const vtkSMPropertyHelper inputHelper(proxy->GetProperty("Input"));
+  vtkSMSourceProxy* inputProxy = vtkSMSourceProxy::SafeDownCast(inputHelper.GetAsProxy());
+  const int port = inputHelper.GetOutputPort();
+  if (!inputProxy || !inputProxy->GetOutputPort(port))
+  {
+    // no input.
+    vtkGenericWarningMacro("No input present. Cannot determine data ranges.");
+    return false;
+  }
+
+  auto info = ::GetArrayInformationOverTime(
+    inputProxy->GetOutputPort(port), arrayName, attributeType, lowerPercentile, upperPercentile);
+  if (!info)
+  {
+    // without timesteps, this is the same as the data range over time.
+    return vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRangeOverTime(
+      proxy, arrayName, attributeType);
+  }
+  return vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRange(proxy, info);
+}
+
 //----------------------------------------------------------------------------
 std::vector<vtkTypeBool>
 vtkSMColorMapEditorHelper::RescaleBlocksTransferFunctionToDataRangeOverTime(
@@ -799,14 +922,13 @@ bool vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataRange(
           return false;
         }
 
-        vtkPVDataInformation* dataInfo = inputProxy->GetDataInformation(port);
         const vtkSMPropertyHelper opacityArrayNameHelper(proxy, "OpacityArrayName");
         const int opacityArrayFieldAssociation = opacityArrayNameHelper.GetAsInt(3);
         const char* opacityArrayName = opacityArrayNameHelper.GetAsString(4);
         int opacityArrayComponent = vtkSMPropertyHelper(proxy, "OpacityComponent").GetAsInt();
 
-        vtkPVArrayInformation* opacityArrayInfo =
-          dataInfo->GetArrayInformation(opacityArrayName, opacityArrayFieldAssociation);
+        vtkPVArrayInformation* opacityArrayInfo = inputProxy->GetArrayInformationWithRanges(
+          port, opacityArrayName, opacityArrayFieldAssociation);
         if (opacityArrayComponent >= opacityArrayInfo->GetNumberOfComponents())
         {
           opacityArrayComponent = -1;
@@ -1033,8 +1155,8 @@ bool vtkSMColorMapEditorHelper::RescaleTransferFunctionToVisibleRange(
     return false;
   }
 
-  vtkPVDataInformation* dataInfo = inputProxy->GetOutputPort(port)->GetDataInformation();
-  vtkPVArrayInformation* info = dataInfo->GetArrayInformation(arrayName, attributeType);
+  vtkPVArrayInformation* info =
+    inputProxy->GetOutputPort(port)->GetArrayInformationWithRanges(arrayName, attributeType);
   if (!info)
   {
     return false;
@@ -3574,7 +3696,7 @@ vtkPVArrayInformation* vtkSMColorMapEditorHelper::GetArrayInformationForColorArr
   if (input)
   {
     vtkPVArrayInformation* arrayInfoFromData = nullptr;
-    arrayInfoFromData = input->GetDataInformation(port)->GetArrayInformation(
+    arrayInfoFromData = input->GetArrayInformationWithRanges(port,
       colorArrayHelper.GetInputArrayNameToProcess(), colorArrayHelper.GetInputArrayAssociation());
     if (arrayInfoFromData)
     {
@@ -3584,7 +3706,7 @@ vtkPVArrayInformation* vtkSMColorMapEditorHelper::GetArrayInformationForColorArr
     if (colorArrayHelper.GetInputArrayAssociation() == vtkDataObject::POINT_THEN_CELL)
     {
       // Try points...
-      arrayInfoFromData = input->GetDataInformation(port)->GetArrayInformation(
+      arrayInfoFromData = input->GetArrayInformationWithRanges(port,
         colorArrayHelper.GetInputArrayNameToProcess(), vtkDataObject::POINT);
       if (arrayInfoFromData)
       {
@@ -3592,7 +3714,7 @@ vtkPVArrayInformation* vtkSMColorMapEditorHelper::GetArrayInformationForColorArr
       }
 
       // ... then cells
-      arrayInfoFromData = input->GetDataInformation(port)->GetArrayInformation(
+      arrayInfoFromData = input->GetArrayInformationWithRanges(port,
         colorArrayHelper.GetInputArrayNameToProcess(), vtkDataObject::CELL);
       if (arrayInfoFromData)
       {
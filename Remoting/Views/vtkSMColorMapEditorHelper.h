@@ -338,6 +338,21 @@ public:
     vtkSMProxy* proxy, const char* arrayName, int attributeType);
   ///@}
 
+  ///@{
+  /**
+   * Rescales the color transfer function and opacity transfer function to
+   * percentiles of the data range over time, ignoring the timesteps with
+   * outlying values. The new range goes from the \c lowerPercentile of the
+   * minima of the timesteps to the \c upperPercentile of their maxima, so 0 and
+   * 100 give the data range over time. The ranges of each timestep are cached,
+   * see vtkSMTemporalRangeCache. Returns true if rescale was successful.
+   */
+  static bool RescaleTransferFunctionToDataPercentilesOverTime(
+    vtkSMProxy* proxy, double lowerPercentile, double upperPercentile);
+  static bool RescaleTransferFunctionToDataPercentilesOverTime(vtkSMProxy* proxy,
+    const char* arrayName, int attributeType, double lowerPercentile, double upperPercentile);
+  ///@}
+
   ///@{
   /**
    * Rescales the color transfer function and the opacity transfer function
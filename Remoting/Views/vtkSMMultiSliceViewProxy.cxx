@@ -4,11 +4,11 @@
 
 #include "vtkBoundingBox.h"
 #include "vtkClientServerStream.h"
+#include "vtkDataObject.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVArrayInformation.h"
 #include "vtkPVDataInformation.h"
-#include "vtkPVDataSetAttributesInformation.h"
 #include "vtkPVMultiSliceView.h"
 #include "vtkPVSession.h"
 #include "vtkPVXMLElement.h"
@@ -106,8 +106,8 @@ bool vtkSMMultiSliceViewProxy::GetDataBounds(vtkSMSourceProxy* source, int oppor
   vtkPVDataInformation* info = source ? source->GetDataInformation(opport) : nullptr;
   if (info)
   {
-    if (vtkPVArrayInformation* ainfo =
-          info->GetFieldDataInformation()->GetArrayInformation("BoundingBoxInModelCoordinates"))
+    if (vtkPVArrayInformation* ainfo = source->GetArrayInformationWithRanges(
+          opport, "BoundingBoxInModelCoordinates", vtkDataObject::FIELD))
     {
       // use "original basis" bounds,  if present.
       if (ainfo->GetNumberOfTuples() == 1 && ainfo->GetNumberOfComponents() == 6)
@@ -267,6 +267,22 @@ vtkSMPVRepresentationProxy::RescaleBlocksTransferFunctionToDataRangeOverTime(
     this, blockSelectors, arrayName, attributeType);
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMPVRepresentationProxy::RescaleTransferFunctionToDataPercentilesOverTime(
+  double lowerPercentile, double upperPercentile)
+{
+  return vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataPercentilesOverTime(
+    this, lowerPercentile, upperPercentile);
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMPVRepresentationProxy::RescaleTransferFunctionToDataPercentilesOverTime(
+  const char* arrayName, int attributeType, double lowerPercentile, double upperPercentile)
+{
+  return vtkSMColorMapEditorHelper::RescaleTransferFunctionToDataPercentilesOverTime(
+    this, arrayName, attributeType, lowerPercentile, upperPercentile);
+}
+
 //----------------------------------------------------------------------------
 bool vtkSMPVRepresentationProxy::RescaleTransferFunctionToVisibleRange(vtkSMProxy* view)
 {
@@ -236,6 +236,19 @@ public:
     const std::vector<std::string>& blockSelectors, const char* arrayName, int attributeType);
   ///@}
 
+  ///@{
+  /**
+   * Rescales the color transfer function and opacity transfer function to the
+   * \c lowerPercentile of the minima and the \c upperPercentile of the maxima
+   * of the data ranges at each timestep. Returns true if rescale was
+   * successful. \c attributeType must be one of vtkDataObject::AttributeTypes.
+   */
+  virtual bool RescaleTransferFunctionToDataPercentilesOverTime(
+    double lowerPercentile, double upperPercentile);
+  virtual bool RescaleTransferFunctionToDataPercentilesOverTime(
+    const char* arrayName, int attributeType, double lowerPercentile, double upperPercentile);
+  ///@}
+
   ///@{
   /**
    * Rescales the color transfer function and the opacity transfer function
@@ -3,6 +3,7 @@
 #include "vtkSMTransferFunctionProxy.h"
 
 #include "vtkAlgorithm.h"
+#include "vtkDataArray.h"
 #include "vtkDoubleArray.h"
 #include "vtkIntArray.h"
 #include "vtkNew.h"
@@ -194,6 +195,53 @@ bool vtkRescaleNormalizedControlPoints(
   }
   return true;
 }
+
+//----------------------------------------------------------------------------
+// Locates the value with `target` values below it in a histogram table, as
+// produced by the "ExtractHistogram" filter, assuming the values are evenly
+// spread in each bin. Also returns the bounds of the bin holding it and the
+// number of values of that bin below it.
+bool vtkLocateHistogramValue(
+  vtkTable* histogram, double target, double& value, double bin[2], double& countInBin)
+{
+  vtkDataArray* extents = histogram ? vtkDataArray::SafeDownCast(histogram->GetColumn(0)) : nullptr;
+  vtkDataArray* counts = histogram ? vtkDataArray::SafeDownCast(histogram->GetColumn(1)) : nullptr;
+  if (!extents || !counts || counts->GetNumberOfTuples() < 2)
+  {
+    return false;
+  }
+
+  const vtkIdType numberOfBins = counts->GetNumberOfTuples();
+  const double width = extents->GetTuple1(1) - extents->GetTuple1(0);
+  double cumulative = 0;
+  for (vtkIdType cc = 0; cc < numberOfBins; ++cc)
+  {
+    const double count = counts->GetTuple1(cc);
+    if (count > 0 && (cumulative + count >= target || cc == numberOfBins - 1))
+    {
+      bin[0] = extents->GetTuple1(cc) - width / 2;
+      bin[1] = bin[0] + width;
+      countInBin = std::max(0.0, std::min(target - cumulative, count));
+      value = bin[0] + width * countInBin / count;
+      return true;
+    }
+    cumulative += count;
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// Returns the number of values counted in a histogram table.
+double vtkGetHistogramTotal(vtkTable* histogram)
+{
+  vtkDataArray* counts = histogram ? vtkDataArray::SafeDownCast(histogram->GetColumn(1)) : nullptr;
+  double total = 0;
+  for (vtkIdType cc = 0; counts && cc < counts->GetNumberOfTuples(); ++cc)
+  {
+    total += counts->GetTuple1(cc);
+  }
+  return total;
+}
 }
 
 vtkStandardNewMacro(vtkSMTransferFunctionProxy);
@@ -468,14 +516,9 @@ bool vtkSMTransferFunctionProxy::ComputeAvailableAnnotations(bool extend)
 }
 
 //----------------------------------------------------------------------------
-vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins)
+vtkSmartPointer<vtkTable> vtkSMTransferFunctionProxy::ComputeHistogram(
+  int numberOfBins, const double* customRange, bool approximate)
 {
-  if (!this->HistogramTableCache)
-  {
-    this->HistogramTableCache = vtkSmartPointer<vtkTable>::New();
-  }
-  this->HistogramTableCache->Initialize();
-
   // Recover component property
   int component = -1;
   if (vtkSMPropertyHelper(this, "VectorMode").GetAsInt() == vtkScalarsToColors::COMPONENT)
@@ -535,8 +578,7 @@ vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins
         if (component > arrayInfo->GetNumberOfComponents())
         {
           vtkErrorMacro("Invalid component requested by the transfer function");
-          this->HistogramTableCache = nullptr;
-          return this->HistogramTableCache;
+          return nullptr;
         }
 
         vtkSMPropertyHelper colorArrayHelper(consumer, "ColorArrayName");
@@ -581,8 +623,7 @@ vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins
   // No valid consumer
   if (!hasData)
   {
-    this->HistogramTableCache = nullptr;
-    return this->HistogramTableCache;
+    return nullptr;
   }
 
   // Compute the histogram
@@ -593,8 +634,12 @@ vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins
     .SetInputArrayToProcess(arrayAsso, arrayName.c_str());
   vtkSMPropertyHelper(histo, "Component").Set(component);
   vtkSMPropertyHelper(histo, "BinCount").Set(numberOfBins);
-  vtkSMPropertyHelper(histo, "UseCustomBinRanges").Set(true);
-  vtkSMPropertyHelper(histo, "CustomBinRanges").Set(this->LastRange, 2);
+  vtkSMPropertyHelper(histo, "UseCustomBinRanges").Set(customRange != nullptr);
+  if (customRange)
+  {
+    vtkSMPropertyHelper(histo, "CustomBinRanges").Set(customRange, 2);
+  }
+  vtkSMPropertyHelper(histo, "Approximate").Set(approximate ? 1 : 0);
   histo->UpdateVTKObjects();
 
   // Reduce it
@@ -615,7 +660,28 @@ vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins
   mover->UpdatePipeline();
   vtkTable* histoTable = vtkTable::SafeDownCast(
     vtkAlgorithm::SafeDownCast(mover->GetClientSideObject())->GetOutputDataObject(0));
-  this->HistogramTableCache->ShallowCopy(histoTable);
+  vtkNew<vtkTable> histogram;
+  histogram->ShallowCopy(histoTable);
+  return histogram;
+}
+
+//----------------------------------------------------------------------------
+vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins)
+{
+  const bool approximate =
+    vtkSMPropertyHelper(this, "ApproximateDataHistogram", true).GetAsInt() != 0;
+  vtkSmartPointer<vtkTable> histogram =
+    this->ComputeHistogram(numberOfBins, this->LastRange, approximate);
+  if (!histogram)
+  {
+    this->HistogramTableCache = nullptr;
+    return this->HistogramTableCache;
+  }
+  if (!this->HistogramTableCache)
+  {
+    this->HistogramTableCache = vtkSmartPointer<vtkTable>::New();
+  }
+  this->HistogramTableCache->ShallowCopy(histogram);
 
   // Sanity check of the histogram table
   if (this->HistogramTableCache->GetNumberOfColumns() < 2)
@@ -646,6 +712,62 @@ vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins
   return this->HistogramTableCache;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMTransferFunctionProxy::ComputeDataPercentiles(
+  double lowerPercentile, double upperPercentile, double range[2], bool exact)
+{
+  // Number of bins of the histograms used to locate the percentiles. When
+  // refining, the percentiles are located within 1/1024^2 of the data range.
+  const int numberOfBins = 1024;
+
+  vtkSmartPointer<vtkTable> histogram = this->ComputeHistogram(numberOfBins, nullptr, !exact);
+  const double total = vtkGetHistogramTotal(histogram);
+  if (total <= 0)
+  {
+    return false;
+  }
+
+  const double percentiles[2] = { std::min(lowerPercentile, upperPercentile),
+    std::max(lowerPercentile, upperPercentile) };
+  for (int cc = 0; cc < 2; ++cc)
+  {
+    const double target = std::max(0.0, std::min(percentiles[cc], 100.0)) / 100.0 * total;
+    double bin[2];
+    double countInBin;
+    if (!vtkLocateHistogramValue(histogram, target, range[cc], bin, countInBin))
+    {
+      return false;
+    }
+    if (exact && bin[1] > bin[0])
+    {
+      // bin the values of the bin holding the percentile again, and locate the
+      // percentile among them.
+      vtkSmartPointer<vtkTable> refined = this->ComputeHistogram(numberOfBins, bin, false);
+      double refinedValue;
+      double refinedBin[2];
+      double refinedCount;
+      if (!vtkLocateHistogramValue(refined, countInBin, refinedValue, refinedBin, refinedCount))
+      {
+        return false;
+      }
+      range[cc] = std::max(bin[0], std::min(refinedValue, bin[1]));
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMTransferFunctionProxy::RescaleTransferFunctionToDataPercentiles(
+  double lowerPercentile, double upperPercentile, bool exact)
+{
+  double range[2];
+  if (this->ComputeDataPercentiles(lowerPercentile, upperPercentile, range, exact))
+  {
+    return this->RescaleTransferFunction(range[0], range[1], false);
+  }
+  return false;
+}
+
 //----------------------------------------------------------------------------
 bool vtkSMTransferFunctionProxy::RescaleTransferFunctionToDataRange(bool extend)
 {
@@ -68,6 +68,24 @@ public:
   }
   ///@}
 
+  ///@{
+  /**
+   * Rescales the transfer function to the range between two percentiles of the
+   * values from all the representations using it, e.g. 1 and 99 to leave out
+   * outliers. See ComputeDataPercentiles().
+   */
+  virtual bool RescaleTransferFunctionToDataPercentiles(
+    double lowerPercentile, double upperPercentile, bool exact = false);
+  static bool RescaleTransferFunctionToDataPercentiles(
+    vtkSMProxy* proxy, double lowerPercentile, double upperPercentile, bool exact = false)
+  {
+    vtkSMTransferFunctionProxy* self = vtkSMTransferFunctionProxy::SafeDownCast(proxy);
+    return self
+      ? self->RescaleTransferFunctionToDataPercentiles(lowerPercentile, upperPercentile, exact)
+      : false;
+  }
+  ///@}
+
   /**
    * Invert the transfer function. Returns true if successful.
    */
@@ -261,6 +279,29 @@ public:
   }
   ///@}
 
+  ///@{
+  /**
+   * Computes the values below which the given percentages, in [0, 100], of the
+   * values from all the visible representations using the transfer function
+   * lie. By default, the percentiles are estimated from an approximate
+   * histogram, computed in a single pass over the data from sketches merged
+   * across ranks (see vtkPExtractHistogram::SetApproximate()), which is fast
+   * but only accurate to about 2% in rank. When \c exact is true, an exact
+   * histogram is computed and the bins holding the percentiles are binned
+   * again, which locates the percentiles within a millionth of the data range.
+   * Returns true if a valid range was determined.
+   */
+  virtual bool ComputeDataPercentiles(
+    double lowerPercentile, double upperPercentile, double range[2], bool exact = false);
+  static bool ComputeDataPercentiles(vtkSMProxy* proxy, double lowerPercentile,
+    double upperPercentile, double range[2], bool exact = false)
+  {
+    vtkSMTransferFunctionProxy* self = vtkSMTransferFunctionProxy::SafeDownCast(proxy);
+    return self ? self->ComputeDataPercentiles(lowerPercentile, upperPercentile, range, exact)
+                : false;
+  }
+  ///@}
+
   ///@{
   /**
    * Helper method used to compute a histogram with provided number of bins based on the data
@@ -268,6 +309,8 @@ public:
    * If successful, returns the histogram as a vtkTable containing two columns of double,
    * the first one being the indexes, the second one the number of values.
    * If not, returns nullptr.
+   * When the "ApproximateDataHistogram" property is on, the histogram is
+   * estimated in a single pass (see vtkPExtractHistogram::SetApproximate()).
    */
   virtual vtkTable* ComputeDataHistogramTable(int numberOfBins);
   static vtkTable* ComputeDataHistogramTable(vtkSMProxy* proxy, int numberOfBins)
@@ -382,6 +425,15 @@ protected:
    */
   void RestoreFromSiteSettingsOrXML(const char* arrayName);
 
+  /**
+   * Computes a histogram of the data from all the visible representations
+   * using the transfer function, over customRange, or over the data range if
+   * nullptr. The histogram is computed with the "ExtractHistogram" filter and
+   * delivered to the client. Returns nullptr on failure.
+   */
+  vtkSmartPointer<vtkTable> ComputeHistogram(
+    int numberOfBins, const double* customRange, bool approximate);
+
   /*
    * Stores the last range used to rescale to transfer function
    * Used by ComputeDataHistogram
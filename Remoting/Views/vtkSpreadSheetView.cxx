@@ -759,6 +759,7 @@ void vtkSpreadSheetView::ClearOrderedColumnList()
 void vtkSpreadSheetView::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfBlocksToPrefetch: " << this->NumberOfBlocksToPrefetch << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -1054,6 +1055,46 @@ bool vtkSpreadSheetView::IsAvailable(vtkIdType row)
   return this->Internals->GetDataObject(blockIndex) != nullptr;
 }
 
+//----------------------------------------------------------------------------
+void vtkSpreadSheetView::FetchRows(vtkIdType firstRow, vtkIdType lastRow)
+{
+  const vtkIdType numRows = this->GetNumberOfRows();
+  if (!this->Internals->ActiveRepresentation || numRows <= 0)
+  {
+    return;
+  }
+
+  firstRow = std::min(std::max(firstRow, static_cast<vtkIdType>(0)), numRows - 1);
+  lastRow = std::min(std::max(lastRow, firstRow), numRows - 1);
+
+  const vtkIdType blockSize = this->TableStreamer->GetBlockSize();
+  const vtkIdType firstBlock = firstRow / blockSize;
+  const vtkIdType lastBlock = lastRow / blockSize;
+  const vtkIdType maxBlock = (numRows - 1) / blockSize;
+  for (vtkIdType cc = firstBlock; cc <= lastBlock; ++cc)
+  {
+    this->FetchBlock(cc);
+  }
+
+  // Neighbouring blocks are requested from the closest to the farthest. The
+  // server keeps the sorted index and the block boundaries, so these are
+  // cheaper than the first block.
+  for (vtkIdType cc = 1; cc <= this->NumberOfBlocksToPrefetch; ++cc)
+  {
+    if (lastBlock + cc <= maxBlock)
+    {
+      this->FetchBlock(lastBlock + cc);
+    }
+    if (firstBlock - cc >= 0)
+    {
+      this->FetchBlock(firstBlock - cc);
+    }
+  }
+
+  // Keep the visible block as the most recently accessed one.
+  this->Internals->GetDataObject(firstBlock);
+}
+
 //----------------------------------------------------------------------------
 bool vtkSpreadSheetView::IsDataValid(vtkIdType row, vtkIdType col)
 {
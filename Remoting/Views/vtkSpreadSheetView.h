@@ -201,6 +201,24 @@ public:
    */
   virtual bool IsAvailable(vtkIdType row);
 
+  /**
+   * Fetches the blocks holding the rows from \c firstRow to \c lastRow, if
+   * they are not locally available, followed by NumberOfBlocksToPrefetch blocks
+   * on each side so that scrolling to the neighbouring rows does not have to
+   * wait for the server. This may result in collective operations.
+   * \note CallOnClient
+   */
+  virtual void FetchRows(vtkIdType firstRow, vtkIdType lastRow);
+
+  ///@{
+  /**
+   * Set the number of blocks to prefetch before and after the rows requested
+   * with FetchRows(). Default is 1.
+   */
+  vtkSetClampMacro(NumberOfBlocksToPrefetch, int, 0, 4);
+  vtkGetMacro(NumberOfBlocksToPrefetch, int);
+  ///@}
+
   /**
    * Returns true of the data at the given row and column is valid.
    */
@@ -260,6 +278,7 @@ protected:
   bool ShowExtractedSelection = false;
   bool GenerateCellConnectivity = false;
   bool ShowFieldData = false;
+  int NumberOfBlocksToPrefetch = 1;
   vtkSortedTableStreamer* TableStreamer;
   vtkMarkSelectedRows* TableSelectionMarker;
   vtkReductionFilter* ReductionFilter;
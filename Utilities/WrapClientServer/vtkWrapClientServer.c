@@ -13,6 +13,49 @@ static int numberOfWrappedFunctions = 0;
 static FunctionInfo* wrappedFunctions[1000];
 static FunctionInfo* currentFunction;
 static HierarchyInfo* hierarchyInfo = NULL;
+static int numberOfMethodIds = 0;
+static int maximumNumberOfMethodIds = 0;
+static unsigned int* methodIds = NULL;
+
+/* the id of a method, must match vtkClientServerInterpreter::GetMethodId */
+static unsigned int method_id(const char* method)
+{
+  unsigned int hash = 2166136261u;
+  const unsigned char* c;
+  for (c = (const unsigned char*)method; *c; ++c)
+  {
+    hash ^= *c;
+    hash = (hash * 16777619u) & 0xffffffffu;
+  }
+  return hash;
+}
+
+/* add a method id to the ones registered with the interpreter */
+static void add_method_id(unsigned int id)
+{
+  int i;
+  for (i = 0; i < numberOfMethodIds; i++)
+  {
+    if (methodIds[i] == id)
+    {
+      return;
+    }
+  }
+  if (numberOfMethodIds == maximumNumberOfMethodIds)
+  {
+    unsigned int* ids;
+    maximumNumberOfMethodIds = maximumNumberOfMethodIds > 0 ? 2 * maximumNumberOfMethodIds : 64;
+    ids = (unsigned int*)realloc(methodIds, maximumNumberOfMethodIds * sizeof(unsigned int));
+    if (!ids)
+    {
+      fprintf(stderr, "vtkWrapClientServer: cannot allocate %d method ids\n",
+        maximumNumberOfMethodIds);
+      exit(1);
+    }
+    methodIds = ids;
+  }
+  methodIds[numberOfMethodIds++] = id;
+}
 
 /* make a guess about whether a class is wrapped */
 static int class_is_wrapped(const char* classname)
@@ -408,18 +451,19 @@ void get_args(FILE* fp, int i)
 int managableArguments(FunctionInfo* curFunction);
 int notWrappable(FunctionInfo* curFunction);
 
+/* check whether outputFunction generates code for the function */
+int isWrappedFunction(ClassInfo* data, FunctionInfo* curFunction)
+{
+  /* if the args are OK and it is not a constructor or destructor */
+  return !notWrappable(curFunction) && managableArguments(curFunction) &&
+    strcmp(data->Name, curFunction->Name) != 0 && strcmp(data->Name, curFunction->Name + 1) != 0;
+}
+
 void outputFunction(FILE* fp, ClassInfo* data)
 {
   int i;
 
-  if (notWrappable(currentFunction))
-  {
-    return;
-  }
-
-  /* if the args are OK and it is not a constructor or destructor */
-  if (managableArguments(currentFunction) && strcmp(data->Name, currentFunction->Name) != 0 &&
-    strcmp(data->Name, currentFunction->Name + 1) != 0)
+  if (isWrappedFunction(data, currentFunction))
   {
     if (currentFunction->IsLegacy)
     {
@@ -1142,6 +1186,24 @@ void output_InitFunction(FILE* fp, NewClassInfo* data)
       data->ClassName, data->ClassName);
   fprintf(
     fp, "    csi->AddCommandFunction(\"%s\", %sCommand);\n", data->ClassName, data->ClassName);
+  /* with several superclasses, the fallback is not a single chain */
+  if (data->NumberOfSuperClasses <= 1)
+  {
+    if (numberOfMethodIds > 0)
+    {
+      fprintf(fp, "    csi->AddCommandMethodIds(\"%s\", %s%s%s, %sMethodIds, %d);\n",
+        data->ClassName, data->NumberOfSuperClasses ? "\"" : "",
+        data->NumberOfSuperClasses ? data->SuperClasses[0] : "nullptr",
+        data->NumberOfSuperClasses ? "\"" : "", data->ClassName, numberOfMethodIds);
+    }
+    else
+    {
+      fprintf(fp, "    csi->AddCommandMethodIds(\"%s\", %s%s%s, nullptr, 0);\n",
+        data->ClassName, data->NumberOfSuperClasses ? "\"" : "",
+        data->NumberOfSuperClasses ? data->SuperClasses[0] : "nullptr",
+        data->NumberOfSuperClasses ? "\"" : "");
+    }
+  }
   fprintf(fp, "    }\n}\n");
 }
 
@@ -1391,11 +1453,33 @@ int main(int argc, char* argv[])
 
   fprintf(fp, "  (void)arlu;\n");
 
-  /* insert function handling code here */
+  /* insert function handling code here, overloads share the case of their id */
+  numberOfMethodIds = 0;
   for (i = 0; i < data->NumberOfFunctions; i++)
   {
-    currentFunction = data->Functions[i];
-    outputFunction(fp, data);
+    if (isWrappedFunction(data, data->Functions[i]))
+    {
+      add_method_id(method_id(data->Functions[i]->Name));
+    }
+  }
+  if (numberOfMethodIds > 0)
+  {
+    fprintf(fp, "  switch (vtkClientServerInterpreter::GetMethodId(method))\n  {\n");
+    for (j = 0; j < numberOfMethodIds; j++)
+    {
+      fprintf(fp, "  case 0x%08xu:\n", methodIds[j]);
+      for (i = 0; i < data->NumberOfFunctions; i++)
+      {
+        currentFunction = data->Functions[i];
+        if (isWrappedFunction(data, currentFunction) &&
+          method_id(currentFunction->Name) == methodIds[j])
+        {
+          outputFunction(fp, data);
+        }
+      }
+      fprintf(fp, "    break;\n");
+    }
+    fprintf(fp, "  default:\n    break;\n  }\n");
   }
 
   /* try superclasses */
@@ -1460,11 +1544,35 @@ int main(int argc, char* argv[])
     "  return 0;\n"
     "}\n");
 
+  /* the special methods above are implemented by the class too */
+  if (!strcmp("vtkObjectBase", data->Name))
+  {
+    add_method_id(method_id("Print"));
+  }
+  if (!strcmp("vtkObject", data->Name))
+  {
+    add_method_id(method_id("AddObserver"));
+  }
+  if (numberOfMethodIds > 0)
+  {
+    fprintf(fp, "\nstatic const vtkTypeUInt32 %sMethodIds[] = {", data->Name);
+    for (i = 0; i < numberOfMethodIds; i++)
+    {
+      fprintf(fp, "%s0x%08xu", (i % 6) ? ", " : "\n  ", methodIds[i]);
+    }
+    fprintf(fp, "\n};\n");
+  }
+
   classData = (NewClassInfo*)malloc(sizeof(NewClassInfo));
   getClassInfo(fileInfo, data, classData);
   output_InitFunction(fp, classData);
   free(classData);
 
+  free(methodIds);
+  methodIds = NULL;
+  numberOfMethodIds = 0;
+  maximumNumberOfMethodIds = 0;
+
   vtkParse_Free(fileInfo);
   fclose(fp);
 
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVTimeStepPrefetcher.h"
+
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkThreadedCallbackQueue.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+// Source with 10 timesteps producing the requested timestep as field data.
+class vtkTestTimeSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTestTimeSource* New();
+  vtkTypeMacro(vtkTestTimeSource, vtkPolyDataAlgorithm);
+
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+protected:
+  vtkTestTimeSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
+    override
+  {
+    double timeSteps[10];
+    for (int cc = 0; cc < 10; ++cc)
+    {
+      timeSteps[cc] = cc;
+    }
+    const double timeRange[2] = { 0, 9 };
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), timeSteps, 10);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), timeRange, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    vtkNew<vtkDoubleArray> array;
+    array->SetName("time");
+    array->InsertNextValue(time);
+    auto output = vtkPolyData::GetData(outInfo);
+    output->GetFieldData()->AddArray(array);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    ++this->NumberOfExecutions;
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestTimeSource);
+
+bool CheckTime(vtkPVTimeStepPrefetcher* prefetcher, double expected)
+{
+  auto output = vtkPolyData::SafeDownCast(prefetcher->GetOutputDataObject(0));
+  auto array = output ? output->GetFieldData()->GetArray("time") : nullptr;
+  if (!array || array->GetTuple1(0) != expected)
+  {
+    vtkLogF(ERROR, "Unexpected output for timestep %g", expected);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestTimeStepPrefetcher(int, char*[])
+{
+  vtkNew<vtkTestTimeSource> reader;
+  vtkNew<vtkTestTimeSource> shadow;
+  vtkNew<vtkThreadedCallbackQueue> queue;
+
+  vtkNew<vtkPVTimeStepPrefetcher> prefetcher;
+  prefetcher->SetInputConnection(reader->GetOutputPort());
+  prefetcher->SetShadowSource(shadow);
+  prefetcher->SetCallbackQueue(queue);
+
+  prefetcher->UpdateTimeStep(0);
+  if (!CheckTime(prefetcher, 0) || reader->NumberOfExecutions != 1)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // prefetch the next two timesteps, the reader must not execute for them.
+  prefetcher->PrefetchTimeStep(1);
+  prefetcher->PrefetchTimeStep(2.5);
+  for (double time : { 1.0, 2.5 })
+  {
+    prefetcher->UpdateTimeStep(time);
+    if (!CheckTime(prefetcher, std::floor(time)))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  prefetcher->Wait();
+  if (reader->NumberOfExecutions != 1 || shadow->NumberOfExecutions != 2 ||
+    prefetcher->GetNumberOfHits() != 2)
+  {
+    vtkLogF(ERROR, "Prefetched timesteps were not used (%d reader executions, %d hits).",
+      reader->NumberOfExecutions.load(), static_cast<int>(prefetcher->GetNumberOfHits()));
+    return EXIT_FAILURE;
+  }
+
+  // timesteps that were not prefetched are read by the reader.
+  prefetcher->UpdateTimeStep(5);
+  if (!CheckTime(prefetcher, 5) || reader->NumberOfExecutions != 2)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // modifying the reader discards prefetched timesteps.
+  prefetcher->PrefetchTimeStep(6);
+  prefetcher->Wait();
+  reader->Modified();
+  prefetcher->UpdateTimeStep(6);
+  if (!CheckTime(prefetcher, 6) || reader->NumberOfExecutions != 3)
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,334 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVTimeStepPrefetcher.h"
+
+#include "vtkDataObject.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkThreadedCallbackQueue.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+//*****************************************************************************
+class vtkPVTimeStepPrefetcher::vtkInternals
+{
+public:
+  // Only accessed on the main thread, or when no read is in progress.
+  vtkSmartPointer<vtkAlgorithm> ShadowSource;
+  vtkSmartPointer<vtkThreadedCallbackQueue> CallbackQueue;
+  vtkThreadedCallbackQueue::SharedFutureBasePointer Future;
+  std::vector<double> InputTimeSteps;
+  vtkMTimeType SourceMTime = 0;
+  vtkSmartPointer<vtkDataObject> HitData;
+  double HitTime = 0.0;
+
+  // Shared with the background read, protected by Mutex.
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::map<double, std::pair<vtkSmartPointer<vtkDataObject>, unsigned long>> TimeSteps;
+  std::deque<double> Pending;
+  unsigned long Size = 0;
+  bool IsReading = false;
+  bool IsReadingTime = false;
+  double ReadingTime = 0.0;
+  int Piece = 0;
+  int NumberOfPieces = 1;
+  int GhostLevels = 0;
+
+  // Returns the timestep the reader produces for the given time: the largest
+  // timestep not greater than time.
+  double SnapToTimeStep(double time) const
+  {
+    if (this->InputTimeSteps.empty())
+    {
+      return time;
+    }
+    auto iter = std::upper_bound(this->InputTimeSteps.begin(), this->InputTimeSteps.end(), time);
+    return iter == this->InputTimeSteps.begin() ? *iter : *(iter - 1);
+  }
+};
+
+vtkStandardNewMacro(vtkPVTimeStepPrefetcher);
+//----------------------------------------------------------------------------
+vtkPVTimeStepPrefetcher::vtkPVTimeStepPrefetcher()
+  : MemoryLimit(1048576)
+  , NumberOfHits(0)
+  , NumberOfMisses(0)
+  , Internals(new vtkPVTimeStepPrefetcher::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVTimeStepPrefetcher::~vtkPVTimeStepPrefetcher()
+{
+  this->ClearPrefetchedTimeSteps();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTimeStepPrefetcher::SetShadowSource(vtkAlgorithm* source)
+{
+  auto& internals = *this->Internals;
+  if (internals.ShadowSource != source)
+  {
+    this->ClearPrefetchedTimeSteps();
+    internals.ShadowSource = source;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkAlgorithm* vtkPVTimeStepPrefetcher::GetShadowSource()
+{
+  return this->Internals->ShadowSource;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTimeStepPrefetcher::SetCallbackQueue(vtkThreadedCallbackQueue* queue)
+{
+  auto& internals = *this->Internals;
+  if (internals.CallbackQueue != queue)
+  {
+    this->Wait();
+    internals.CallbackQueue = queue;
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkThreadedCallbackQueue* vtkPVTimeStepPrefetcher::GetCallbackQueue()
+{
+  return this->Internals->CallbackQueue;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTimeStepPrefetcher::PrefetchTimeStep(double time)
+{
+  auto& internals = *this->Internals;
+  if (!internals.ShadowSource || !internals.CallbackQueue)
+  {
+    return;
+  }
+
+  const double timeStep = internals.SnapToTimeStep(time);
+  {
+    std::lock_guard<std::mutex> lock(internals.Mutex);
+    if (internals.TimeSteps.find(timeStep) != internals.TimeSteps.end() ||
+      (internals.IsReadingTime && internals.ReadingTime == timeStep) ||
+      std::find(internals.Pending.begin(), internals.Pending.end(), timeStep) !=
+        internals.Pending.end())
+    {
+      return;
+    }
+    internals.Pending.push_back(timeStep);
+    if (internals.IsReading)
+    {
+      // the read in progress will pick up this request.
+      return;
+    }
+    internals.IsReading = true;
+  }
+
+  vtkLogF(TRACE, "prefetch timestep %g", timeStep);
+  internals.Future = internals.CallbackQueue->Push([this]() { this->ReadPendingTimeSteps(); });
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTimeStepPrefetcher::ReadPendingTimeSteps()
+{
+  auto& internals = *this->Internals;
+  while (true)
+  {
+    double timeStep;
+    int piece, numberOfPieces, ghostLevels;
+    {
+      std::lock_guard<std::mutex> lock(internals.Mutex);
+      if (internals.Pending.empty() ||
+        (this->MemoryLimit > 0 && internals.Size >= this->MemoryLimit))
+      {
+        internals.IsReading = false;
+        return;
+      }
+      timeStep = internals.Pending.front();
+      internals.Pending.pop_front();
+      internals.IsReadingTime = true;
+      internals.ReadingTime = timeStep;
+      piece = internals.Piece;
+      numberOfPieces = internals.NumberOfPieces;
+      ghostLevels = internals.GhostLevels;
+    }
+
+    vtkSmartPointer<vtkDataObject> data;
+    auto shadow = internals.ShadowSource;
+    if (shadow->UpdateTimeStep(timeStep, piece, numberOfPieces, ghostLevels))
+    {
+      if (auto output = shadow->GetOutputDataObject(0))
+      {
+        data.TakeReference(output->NewInstance());
+        data->ShallowCopy(output);
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(internals.Mutex);
+      if (data)
+      {
+        const unsigned long size = data->GetActualMemorySize();
+        internals.TimeSteps[timeStep] = std::make_pair(data, size);
+        internals.Size += size;
+      }
+      internals.IsReadingTime = false;
+    }
+    internals.Condition.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTimeStepPrefetcher::Wait()
+{
+  auto& internals = *this->Internals;
+  if (internals.Future)
+  {
+    internals.Future->Wait();
+    internals.Future = nullptr;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTimeStepPrefetcher::ClearPrefetchedTimeSteps()
+{
+  auto& internals = *this->Internals;
+  {
+    std::lock_guard<std::mutex> lock(internals.Mutex);
+    internals.Pending.clear();
+  }
+  this->Wait();
+
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  internals.TimeSteps.clear();
+  internals.Size = 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVTimeStepPrefetcher::RequestUpdateExtent(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  auto& internals = *this->Internals;
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  using vtkSDDP = vtkStreamingDemandDrivenPipeline;
+
+  internals.HitData = nullptr;
+  internals.InputTimeSteps.clear();
+  if (inInfo->Has(vtkSDDP::TIME_STEPS()))
+  {
+    const double* timeSteps = inInfo->Get(vtkSDDP::TIME_STEPS());
+    internals.InputTimeSteps.assign(timeSteps, timeSteps + inInfo->Length(vtkSDDP::TIME_STEPS()));
+  }
+
+  // prefetched timesteps are obsolete as soon as the reader is modified.
+  vtkAlgorithm* source = this->GetInputAlgorithm(0, 0);
+  const vtkMTimeType sourceMTime = source ? source->GetMTime() : 0;
+  if (sourceMTime != internals.SourceMTime)
+  {
+    this->ClearPrefetchedTimeSteps();
+    internals.SourceMTime = sourceMTime;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(internals.Mutex);
+    internals.Piece =
+      outInfo->Has(vtkSDDP::UPDATE_PIECE_NUMBER()) ? outInfo->Get(vtkSDDP::UPDATE_PIECE_NUMBER()) : 0;
+    internals.NumberOfPieces = outInfo->Has(vtkSDDP::UPDATE_NUMBER_OF_PIECES())
+      ? outInfo->Get(vtkSDDP::UPDATE_NUMBER_OF_PIECES())
+      : 1;
+    internals.GhostLevels = outInfo->Has(vtkSDDP::UPDATE_NUMBER_OF_GHOST_LEVELS())
+      ? outInfo->Get(vtkSDDP::UPDATE_NUMBER_OF_GHOST_LEVELS())
+      : 0;
+  }
+
+  if (!outInfo->Has(vtkSDDP::UPDATE_TIME_STEP()))
+  {
+    return 1;
+  }
+
+  const double timeStep = internals.SnapToTimeStep(outInfo->Get(vtkSDDP::UPDATE_TIME_STEP()));
+  vtkDataObject* input = vtkDataObject::GetData(inInfo);
+  {
+    std::unique_lock<std::mutex> lock(internals.Mutex);
+    // a pending request for this timestep is now useless, the reader will
+    // either execute or the data is being read.
+    internals.Pending.erase(
+      std::remove(internals.Pending.begin(), internals.Pending.end(), timeStep),
+      internals.Pending.end());
+    internals.Condition.wait(lock,
+      [&internals, timeStep]()
+      { return !(internals.IsReadingTime && internals.ReadingTime == timeStep); });
+
+    auto iter = internals.TimeSteps.find(timeStep);
+    if (iter != internals.TimeSteps.end())
+    {
+      if (input && iter->second.first->IsA(input->GetClassName()))
+      {
+        internals.HitData = iter->second.first;
+        internals.HitTime = timeStep;
+      }
+      internals.Size -= iter->second.second;
+      internals.TimeSteps.erase(iter);
+    }
+  }
+
+  if (internals.HitData)
+  {
+    ++this->NumberOfHits;
+    // request the timestep the reader already has, so that it does not execute.
+    vtkInformation* inputDataInfo = input->GetInformation();
+    if (inputDataInfo->Has(vtkDataObject::DATA_TIME_STEP()))
+    {
+      inInfo->Set(vtkSDDP::UPDATE_TIME_STEP(), inputDataInfo->Get(vtkDataObject::DATA_TIME_STEP()));
+    }
+  }
+  else
+  {
+    ++this->NumberOfMisses;
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVTimeStepPrefetcher::RequestData(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  auto& internals = *this->Internals;
+  vtkDataObject* output = vtkDataObject::GetData(outputVector, 0);
+  if (internals.HitData)
+  {
+    output->ShallowCopy(internals.HitData);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), internals.HitTime);
+    internals.HitData = nullptr;
+  }
+  else
+  {
+    output->ShallowCopy(vtkDataObject::GetData(inputVector[0], 0));
+  }
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVTimeStepPrefetcher::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "ShadowSource: " << this->Internals->ShadowSource << endl;
+  os << indent << "MemoryLimit: " << this->MemoryLimit << endl;
+  os << indent << "NumberOfHits: " << this->NumberOfHits << endl;
+  os << indent << "NumberOfMisses: " << this->NumberOfMisses << endl;
+}
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPVTimeStepPrefetcher
+ * @brief   pass-through filter that reads upcoming timesteps in the background.
+ *
+ * vtkPVTimeStepPrefetcher is inserted after a reader. It passes the reader's
+ * output through, unless the requested timestep was prefetched, in which case
+ * the prefetched data is produced instead and the reader does not execute.
+ *
+ * Timesteps are prefetched using `PrefetchTimeStep` by a shadow source, which
+ * must be a distinct instance of the reader configured identically, updated
+ * on a vtkThreadedCallbackQueue. Only one timestep is read at a time and no
+ * timestep is prefetched once the prefetched data exceeds `MemoryLimit`.
+ * Prefetched timesteps are discarded when the reader is modified, and once
+ * they have been handed to the pipeline.
+ *
+ * The shadow source is updated concurrently with the main thread, hence it
+ * must not share any state with the reader, e.g. a multi-process controller
+ * or a non thread-safe I/O library.
+ */
+
+#ifndef vtkPVTimeStepPrefetcher_h
+#define vtkPVTimeStepPrefetcher_h
+
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+#include "vtkPassInputTypeAlgorithm.h"
+
+#include <memory> // for std::unique_ptr
+
+class vtkThreadedCallbackQueue;
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVTimeStepPrefetcher : public vtkPassInputTypeAlgorithm
+{
+public:
+  static vtkPVTimeStepPrefetcher* New();
+  vtkTypeMacro(vtkPVTimeStepPrefetcher, vtkPassInputTypeAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set the shadow source used to read timesteps in the background. Changing
+   * the shadow source discards all prefetched timesteps.
+   */
+  void SetShadowSource(vtkAlgorithm* source);
+  vtkAlgorithm* GetShadowSource();
+  ///@}
+
+  ///@{
+  /**
+   * Set the queue used to run the background reads.
+   */
+  void SetCallbackQueue(vtkThreadedCallbackQueue* queue);
+  vtkThreadedCallbackQueue* GetCallbackQueue();
+  ///@}
+
+  ///@{
+  /**
+   * Set the maximum size, in KiB, of the prefetched data. Default is 1 GiB.
+   */
+  vtkSetMacro(MemoryLimit, unsigned long);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  /**
+   * Requests that the timestep matching \c time is read in the background.
+   * Ignored if no shadow source or callback queue is set, or if the timestep is
+   * already prefetched or being prefetched.
+   */
+  void PrefetchTimeStep(double time);
+
+  /**
+   * Discards all prefetched timesteps as well as pending requests. Waits for
+   * the timestep being read, if any.
+   */
+  void ClearPrefetchedTimeSteps();
+
+  /**
+   * Waits until the timestep being read in the background, if any, is done.
+   * This must be called before modifying the shadow source.
+   */
+  void Wait();
+
+  ///@{
+  /**
+   * Returns the number of updates served from prefetched data and the number
+   * of updates that executed the reader.
+   */
+  vtkGetMacro(NumberOfHits, vtkIdType);
+  vtkGetMacro(NumberOfMisses, vtkIdType);
+  ///@}
+
+protected:
+  vtkPVTimeStepPrefetcher();
+  ~vtkPVTimeStepPrefetcher() override;
+
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  unsigned long MemoryLimit;
+  vtkIdType NumberOfHits;
+  vtkIdType NumberOfMisses;
+
+private:
+  vtkPVTimeStepPrefetcher(const vtkPVTimeStepPrefetcher&) = delete;
+  void operator=(const vtkPVTimeStepPrefetcher&) = delete;
+
+  void ReadPendingTimeSteps();
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
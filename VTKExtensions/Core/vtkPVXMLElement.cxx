@@ -3,12 +3,14 @@
 #include "vtkPVXMLElement.h"
 
 #include "vtkCollection.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
 vtkStandardNewMacro(vtkPVXMLElement);
 
 #include <cctype>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -774,3 +776,160 @@ void vtkPVXMLElement::RemoveAttribute(const char* name)
 }
 
 //----------------------------------------------------------------------------
+// Strings are written as their length followed by their characters, with a
+// length of VTK_UNSIGNED_INT_MAX for null strings.
+static void vtkPVXMLWriteBinary(std::string& buffer, const char* data, size_t length)
+{
+  const unsigned int size = data ? static_cast<unsigned int>(length) : VTK_UNSIGNED_INT_MAX;
+  buffer.append(reinterpret_cast<const char*>(&size), sizeof(size));
+  if (data)
+  {
+    buffer.append(data, length);
+  }
+}
+
+static void vtkPVXMLWriteBinary(std::string& buffer, unsigned int value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static bool vtkPVXMLReadBinary(const char*& data, const char* end, unsigned int& value)
+{
+  if (static_cast<size_t>(end - data) < sizeof(value))
+  {
+    return false;
+  }
+  memcpy(&value, data, sizeof(value));
+  data += sizeof(value);
+  return true;
+}
+
+static bool vtkPVXMLReadBinary(
+  const char*& data, const char* end, const char*& str, unsigned int& length)
+{
+  if (!vtkPVXMLReadBinary(data, end, length))
+  {
+    return false;
+  }
+  if (length == VTK_UNSIGNED_INT_MAX)
+  {
+    str = nullptr;
+    length = 0;
+    return true;
+  }
+  if (static_cast<size_t>(end - data) < length)
+  {
+    return false;
+  }
+  str = data;
+  data += length;
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVXMLElement::WriteBinary(std::string& buffer)
+{
+  vtkPVXMLWriteBinary(buffer, this->Name, this->Name ? strlen(this->Name) : 0);
+  vtkPVXMLWriteBinary(buffer, this->Id, this->Id ? strlen(this->Id) : 0);
+  vtkPVXMLWriteBinary(
+    buffer, this->Internal->CharacterData.c_str(), this->Internal->CharacterData.size());
+
+  vtkPVXMLWriteBinary(buffer, static_cast<unsigned int>(this->Internal->AttributeNames.size()));
+  for (size_t cc = 0; cc < this->Internal->AttributeNames.size(); ++cc)
+  {
+    const std::string& name = this->Internal->AttributeNames[cc];
+    const std::string& value = this->Internal->AttributeValues[cc];
+    vtkPVXMLWriteBinary(buffer, name.c_str(), name.size());
+    vtkPVXMLWriteBinary(buffer, value.c_str(), value.size());
+  }
+
+  vtkPVXMLWriteBinary(buffer, static_cast<unsigned int>(this->Internal->NestedElements.size()));
+  for (const auto& nested : this->Internal->NestedElements)
+  {
+    nested->WriteBinary(buffer);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkPVXMLElement* vtkPVXMLElement::NewFromBinary(const char* data, size_t length)
+{
+  if (!data)
+  {
+    return nullptr;
+  }
+  vtkPVXMLElement* element = vtkPVXMLElement::New();
+  if (!element->ReadBinary(data, data + length))
+  {
+    element->Delete();
+    return nullptr;
+  }
+  return element;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVXMLElement::ReadBinary(const char*& data, const char* end)
+{
+  const char* str;
+  unsigned int length;
+  if (!vtkPVXMLReadBinary(data, end, str, length))
+  {
+    return false;
+  }
+  this->SetName(str ? std::string(str, length).c_str() : nullptr);
+  if (!vtkPVXMLReadBinary(data, end, str, length))
+  {
+    return false;
+  }
+  this->SetId(str ? std::string(str, length).c_str() : nullptr);
+  if (!vtkPVXMLReadBinary(data, end, str, length))
+  {
+    return false;
+  }
+  this->Internal->CharacterData.assign(str ? str : "", length);
+
+  // each attribute takes at least two lengths, and each nested element three
+  // lengths and two counts, so counts that do not fit in the remaining bytes
+  // are rejected before reserving memory for them.
+  const size_t attributeSize = 2 * sizeof(unsigned int);
+  const size_t elementSize = 5 * sizeof(unsigned int);
+
+  unsigned int count;
+  if (!vtkPVXMLReadBinary(data, end, count) ||
+    count > static_cast<size_t>(end - data) / attributeSize)
+  {
+    return false;
+  }
+  this->Internal->AttributeNames.reserve(count);
+  this->Internal->AttributeValues.reserve(count);
+  for (unsigned int cc = 0; cc < count; ++cc)
+  {
+    const char* value;
+    unsigned int valueLength;
+    if (!vtkPVXMLReadBinary(data, end, str, length) || !str ||
+      !vtkPVXMLReadBinary(data, end, value, valueLength) || !value)
+    {
+      return false;
+    }
+    this->Internal->AttributeNames.emplace_back(str, length);
+    this->Internal->AttributeValues.emplace_back(value, valueLength);
+  }
+
+  if (!vtkPVXMLReadBinary(data, end, count) ||
+    count > static_cast<size_t>(end - data) / elementSize)
+  {
+    return false;
+  }
+  this->Internal->NestedElements.reserve(count);
+  for (unsigned int cc = 0; cc < count; ++cc)
+  {
+    vtkNew<vtkPVXMLElement> nested;
+    if (!nested->ReadBinary(data, end))
+    {
+      return false;
+    }
+    this->AddNestedElement(nested);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
@@ -207,6 +207,19 @@ public:
   void PrintXML();
   ///@}
 
+  ///@{
+  /**
+   * Serialize the element, with its ids and nested elements, in a compact
+   * binary form appended to `buffer`, and create an element back from it.
+   * Reading the binary form is much faster than parsing XML, which makes it
+   * suitable to cache parsed XML. NewFromBinary returns nullptr if the data is
+   * truncated or invalid.
+   */
+  void WriteBinary(std::string& buffer);
+  VTK_NEWINSTANCE
+  static vtkPVXMLElement* NewFromBinary(const char* data, size_t length);
+  ///@}
+
   /**
    * Merges another element with this one, both having the same name.
    * If any attribute, character data or nested element exists in both,
@@ -268,6 +281,9 @@ protected:
   void ReadXMLAttributes(const char** atts);
   void AddCharacterData(const char* data, int length);
 
+  // Method used by NewFromBinary to read an element and its nested elements.
+  bool ReadBinary(const char*& data, const char* end);
+
   // Internal utility methods.
   vtkPVXMLElement* LookupElementInScope(const char* id);
   vtkPVXMLElement* LookupElementUpScope(const char* id);
@@ -10,10 +10,12 @@
 #include "vtkSmartPointer.h"
 #include "vtkSquirtCompressor.h"
 #include "vtkTesting.h"
+#include "vtkTiledImageCompressor.h"
 #include "vtkTimerLog.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
 
+#include <cstring>
 #include <map>
 #include <string>
 #include <vtksys/CommandLineArguments.hxx>
@@ -69,6 +71,106 @@ bool DoTest(Data& data, vtkImageCompressor* compressor, vtkUnsignedCharArray* in
   return true;
 }
 
+// Sends the same frame twice through a pair of tiled compressors and checks
+// that the second frame only contains the tile headers and is still decoded.
+bool TestUnchangedTiles(vtkUnsignedCharArray* input, int width, int height)
+{
+  vtkNew<vtkTiledImageCompressor> sender;
+  vtkNew<vtkTiledImageCompressor> receiver;
+  sender->SetImageResolution(width, height);
+  receiver->SetImageResolution(width, height);
+
+  vtkNew<vtkUnsignedCharArray> compressed;
+  vtkNew<vtkUnsignedCharArray> decompressed;
+  decompressed->SetNumberOfComponents(input->GetNumberOfComponents());
+  decompressed->SetNumberOfTuples(input->GetNumberOfTuples());
+  sender->SetInput(input);
+  sender->SetOutput(compressed);
+  receiver->SetInput(compressed);
+  receiver->SetOutput(decompressed);
+
+  for (int frame = 0; frame < 2; ++frame)
+  {
+    decompressed->FillValue(0);
+    if (!sender->Compress() || !receiver->Decompress())
+    {
+      return false;
+    }
+    if (memcmp(input->GetPointer(0), decompressed->GetPointer(0),
+          input->GetNumberOfValues()) != 0)
+    {
+      cerr << "Tiled compressor round trip failed for frame " << frame << endl;
+      return false;
+    }
+  }
+  if (sender->GetNumberOfChangedTiles() != 0 || receiver->GetNumberOfChangedTiles() != 0)
+  {
+    cerr << "Unchanged tiles were transmitted." << endl;
+    return false;
+  }
+  return true;
+}
+
+// Checks that only the modified part of the image is transmitted when using
+// DeltaMode and that the decompressed frames are identical to the input.
+bool TestDeltaMode(vtkUnsignedCharArray* input, int width, int height)
+{
+  vtkNew<vtkLZ4Compressor> sender;
+  vtkNew<vtkLZ4Compressor> receiver;
+  sender->SetLossLessMode(1);
+  receiver->SetLossLessMode(1);
+  sender->DeltaModeOn();
+  receiver->DeltaModeOn();
+
+  vtkNew<vtkUnsignedCharArray> frame;
+  frame->DeepCopy(input);
+  vtkNew<vtkUnsignedCharArray> compressed;
+  vtkNew<vtkUnsignedCharArray> decompressed;
+  decompressed->SetNumberOfComponents(input->GetNumberOfComponents());
+  decompressed->SetNumberOfTuples(input->GetNumberOfTuples());
+  sender->SetInput(frame);
+  sender->SetOutput(compressed);
+  receiver->SetInput(compressed);
+  receiver->SetOutput(decompressed);
+
+  const int numComps = frame->GetNumberOfComponents();
+  for (int cc = 0; cc < 3; ++cc)
+  {
+    if (cc > 0)
+    {
+      // modify a small square in the middle of the image.
+      for (int y = height / 2; y < height / 2 + 10; ++y)
+      {
+        const vtkIdType offset = (static_cast<vtkIdType>(y) * width + width / 2) * numComps;
+        memset(frame->GetPointer(offset), 17 * cc, 10 * numComps);
+      }
+    }
+    decompressed->FillValue(0);
+    if (!sender->CompressFrame(width, height) || !receiver->DecompressFrame(width, height))
+    {
+      return false;
+    }
+    if (memcmp(frame->GetPointer(0), decompressed->GetPointer(0), frame->GetNumberOfValues()) != 0)
+    {
+      cerr << "Delta round trip failed for frame " << cc << endl;
+      return false;
+    }
+    if (sender->GetLastFrameIsKeyFrame() != (cc == 0) ||
+      receiver->GetLastFrameIsKeyFrame() != (cc == 0))
+    {
+      cerr << "Unexpected key frame for frame " << cc << endl;
+      return false;
+    }
+  }
+  if (sender->GetLastFrameBytesSaved() <= 0 ||
+    sender->GetLastFrameBytesSaved() != receiver->GetLastFrameBytesSaved())
+  {
+    cerr << "Delta compression did not reduce the transmitted image size." << endl;
+    return false;
+  }
+  return true;
+}
+
 int TestImageCompressors(int argc, char* argv[])
 {
   int max_count = 10;
@@ -181,6 +283,30 @@ int TestImageCompressors(int argc, char* argv[])
         return TEST_FAILED;
       }
     }
+
+    vtkNew<vtkTiledImageCompressor> tiled;
+    tiled->SetImageResolution(image->GetDimensions()[0], image->GetDimensions()[1]);
+    tiled->SetSkipUnchangedTiles(false);
+    if (!DoTest(datas["TILED (codec: LZ4, level: 5)"], tiled.Get(), input))
+    {
+      return TEST_FAILED;
+    }
+
+    tiled->SetCodec(vtkTiledImageCompressor::ZLIB);
+    tiled->SetCompressionLevel(1);
+    if (!DoTest(datas["TILED (codec: ZLIB, level: 1)"], tiled.Get(), input))
+    {
+      return TEST_FAILED;
+    }
+  }
+
+  if (!TestUnchangedTiles(input, image->GetDimensions()[0], image->GetDimensions()[1]))
+  {
+    return TEST_FAILED;
+  }
+  if (!TestDeltaMode(input, image->GetDimensions()[0], image->GetDimensions()[1]))
+  {
+    return TEST_FAILED;
   }
 
   cout << "Input: " << image->GetDimensions()[0] << "x" << image->GetDimensions()[1] << "x"
@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkBitArray.h"
+#include "vtkCellTypeSource.h"
+#include "vtkCharArray.h"
+#include "vtkCommunicator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVDataObjectMarshaller.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTimerLog.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <vtksys/CommandLineArguments.hxx>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+class Data
+{
+public:
+  double LegacyTime = 0;
+  double BinaryTime = 0;
+  vtkIdType LegacySize = 0;
+  vtkIdType BinarySize = 0;
+};
+typedef std::map<std::string, Data> MapType;
+
+bool CompareDataSets(vtkDataSet* expected, vtkDataSet* actual)
+{
+  if (!expected || !actual || expected->GetDataObjectType() != actual->GetDataObjectType() ||
+    expected->GetNumberOfPoints() != actual->GetNumberOfPoints() ||
+    expected->GetNumberOfCells() != actual->GetNumberOfCells())
+  {
+    return false;
+  }
+
+  double b1[6], b2[6];
+  expected->GetBounds(b1);
+  actual->GetBounds(b2);
+  if (memcmp(b1, b2, sizeof(b1)) != 0)
+  {
+    return false;
+  }
+
+  vtkPointData* pd1 = expected->GetPointData();
+  vtkPointData* pd2 = actual->GetPointData();
+  if (pd1->GetNumberOfArrays() != pd2->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int cc = 0; cc < pd1->GetNumberOfArrays(); ++cc)
+  {
+    vtkDataArray* a1 = pd1->GetArray(cc);
+    vtkDataArray* a2 = pd2->GetArray(a1->GetName());
+    if (!a2 || a1->GetDataType() != a2->GetDataType() ||
+      a1->GetNumberOfValues() != a2->GetNumberOfValues() ||
+      memcmp(a1->GetVoidPointer(0), a2->GetVoidPointer(0),
+        a1->GetNumberOfValues() * a1->GetDataTypeSize()) != 0)
+    {
+      return false;
+    }
+    // bits are packed, GetDataTypeSize() is 0 for them.
+    auto bits1 = vtkBitArray::SafeDownCast(a1);
+    auto bits2 = vtkBitArray::SafeDownCast(a2);
+    for (vtkIdType idx = 0; bits1 && bits2 && idx < bits1->GetNumberOfValues(); ++idx)
+    {
+      if (bits1->GetValue(idx) != bits2->GetValue(idx))
+      {
+        return false;
+      }
+    }
+  }
+  return pd1->IsArrayAnAttribute(0) == pd2->IsArrayAnAttribute(0);
+}
+
+bool Compare(vtkDataObject* expected, vtkDataObject* actual)
+{
+  if (auto ds = vtkDataSet::SafeDownCast(expected))
+  {
+    return CompareDataSets(ds, vtkDataSet::SafeDownCast(actual));
+  }
+
+  auto leaves1 = vtkCompositeDataSet::GetDataSets<vtkDataSet>(expected);
+  auto leaves2 = vtkCompositeDataSet::GetDataSets<vtkDataSet>(actual);
+  if (!actual || expected->GetDataObjectType() != actual->GetDataObjectType() ||
+    leaves1.size() != leaves2.size())
+  {
+    return false;
+  }
+  for (size_t cc = 0; cc < leaves1.size(); ++cc)
+  {
+    if (!CompareDataSets(leaves1[cc], leaves2[cc]))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool DoTest(Data& data, vtkDataObject* input)
+{
+  vtkNew<vtkTimerLog> timer;
+
+  // legacy writer based marshalling, as used by vtkCommunicator.
+  timer->StartTimer();
+  vtkNew<vtkCharArray> legacyBuffer;
+  if (!vtkCommunicator::MarshalDataObject(input, legacyBuffer))
+  {
+    return false;
+  }
+  auto legacyOutput = vtkCommunicator::UnMarshalDataObject(legacyBuffer);
+  timer->StopTimer();
+  data.LegacyTime += timer->GetElapsedTime();
+  data.LegacySize = legacyBuffer->GetNumberOfValues();
+
+  // binary marshalling.
+  timer->StartTimer();
+  vtkNew<vtkPVDataObjectMarshaller> marshaller;
+  if (!marshaller->Marshal(input))
+  {
+    cerr << "Failed to marshal " << input->GetClassName() << endl;
+    return false;
+  }
+  std::vector<char> buffer(marshaller->GetMarshalledSize());
+  marshaller->CopyToBuffer(buffer.data());
+  if (!vtkPVDataObjectMarshaller::IsMarshalledBuffer(
+        buffer.data(), static_cast<vtkIdType>(buffer.size())))
+  {
+    cerr << "Marshalled buffer not recognized." << endl;
+    return false;
+  }
+  auto output =
+    vtkPVDataObjectMarshaller::Unmarshal(buffer.data(), static_cast<vtkIdType>(buffer.size()));
+  timer->StopTimer();
+  data.BinaryTime += timer->GetElapsedTime();
+  data.BinarySize = static_cast<vtkIdType>(buffer.size());
+
+  if (!Compare(input, output))
+  {
+    cerr << "Round trip failed for " << input->GetClassName() << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestPVDataObjectMarshaller(int argc, char* argv[])
+{
+  int max_count = 1;
+  int size = 20;
+
+  // Use --size and --count arguments to use this for benchmarking.
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument("--size", argT::EQUAL_ARGUMENT, &size,
+    "Optionally specify the resolution of the generated datasets.");
+  arg.AddArgument("--count", argT::EQUAL_ARGUMENT, &max_count,
+    "Optionally specify the number of iterations.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return TEST_FAILED;
+  }
+
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(-size, size, -size, size, -size, size);
+  wavelet->Update();
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(size * 10);
+  sphere->SetPhiResolution(size * 10);
+  sphere->Update();
+
+  vtkNew<vtkCellTypeSource> cells;
+  cells->SetBlocksDimensions(size, size, size);
+  cells->SetCellType(VTK_HEXAHEDRON);
+  cells->Update();
+
+  // bit arrays are packed. With the default size, the number of points is not
+  // a multiple of 8 so the last byte is partially used.
+  vtkNew<vtkPolyData> bits;
+  bits->ShallowCopy(sphere->GetOutputDataObject(0));
+  vtkNew<vtkBitArray> mask;
+  mask->SetName("mask");
+  mask->SetNumberOfTuples(bits->GetNumberOfPoints());
+  for (vtkIdType cc = 0; cc < mask->GetNumberOfTuples(); ++cc)
+  {
+    mask->SetValue(cc, cc % 3 == 0 ? 1 : 0);
+  }
+  bits->GetPointData()->AddArray(mask);
+
+  vtkNew<vtkMultiBlockDataSet> mb;
+  mb->SetBlock(0, wavelet->GetOutputDataObject(0));
+  mb->SetBlock(1, sphere->GetOutputDataObject(0));
+  mb->SetBlock(2, cells->GetOutputDataObject(0));
+  mb->GetMetaData(1u)->Set(vtkCompositeDataSet::NAME(), "sphere");
+
+  vtkNew<vtkPartitionedDataSetCollection> pdc;
+  vtkNew<vtkPartitionedDataSet> pd;
+  pd->SetPartition(0, sphere->GetOutputDataObject(0));
+  pd->SetPartition(1, cells->GetOutputDataObject(0));
+  pdc->SetPartitionedDataSet(0, pd);
+
+  std::map<std::string, vtkDataObject*> inputs;
+  inputs["Image"] = wavelet->GetOutputDataObject(0);
+  inputs["Polygonal Mesh"] = sphere->GetOutputDataObject(0);
+  inputs["Polygonal Mesh With Bit Array"] = bits;
+  inputs["Unstructured Grid"] = cells->GetOutputDataObject(0);
+  inputs["Multi-block Dataset"] = mb;
+  inputs["Partitioned Dataset Collection"] = pdc;
+
+  MapType datas;
+  for (int cc = 0; cc < max_count; cc++)
+  {
+    for (const auto& input : inputs)
+    {
+      if (!DoTest(datas[input.first], input.second))
+      {
+        return TEST_FAILED;
+      }
+    }
+  }
+
+  for (const auto& iter : datas)
+  {
+    cout << iter.first << " :"
+         << " legacy: " << (iter.second.LegacyTime / max_count) << "s ("
+         << iter.second.LegacySize << " bytes)"
+         << " binary: " << (iter.second.BinaryTime / max_count) << "s ("
+         << iter.second.BinarySize << " bytes)" << endl;
+  }
+  return TEST_SUCCESS;
+}
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkCellTypeSource.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkTimerLog.h"
+#include "vtkTransform.h"
+#include "vtkTransformFilter.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstring>
+#include <vtksys/CommandLineArguments.hxx>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+bool CompareArrays(vtkDataArray* a1, vtkDataArray* a2)
+{
+  if (!a1 || !a2)
+  {
+    return a1 == a2;
+  }
+  if (a1->GetNumberOfValues() != a2->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType cc = 0; cc < a1->GetNumberOfValues(); ++cc)
+  {
+    if (a1->GetVariantValue(cc) != a2->GetVariantValue(cc))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Checks that both outputs have the same leaves, in the same order, with the
+// same composite index and block color.
+bool Compare(vtkDataObject* serial, vtkDataObject* parallel)
+{
+  auto leaves1 = vtkCompositeDataSet::GetDataSets<vtkPolyData>(serial);
+  auto leaves2 = vtkCompositeDataSet::GetDataSets<vtkPolyData>(parallel);
+  if (leaves1.empty() || leaves1.size() != leaves2.size())
+  {
+    cerr << "Mismatched number of leaves: " << leaves1.size() << " != " << leaves2.size() << endl;
+    return false;
+  }
+  for (size_t cc = 0; cc < leaves1.size(); ++cc)
+  {
+    vtkPolyData* pd1 = leaves1[cc];
+    vtkPolyData* pd2 = leaves2[cc];
+    if (pd1->GetNumberOfPoints() != pd2->GetNumberOfPoints() ||
+      pd1->GetNumberOfCells() != pd2->GetNumberOfCells() ||
+      !CompareArrays(pd1->GetPoints()->GetData(), pd2->GetPoints()->GetData()) ||
+      !CompareArrays(pd1->GetPointData()->GetArray("vtkCompositeIndex"),
+        pd2->GetPointData()->GetArray("vtkCompositeIndex")) ||
+      !CompareArrays(pd1->GetFieldData()->GetArray("vtkBlockColors"),
+        pd2->GetFieldData()->GetArray("vtkBlockColors")))
+    {
+      cerr << "Mismatched leaf " << cc << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPVGeometryFilterParallel(int argc, char* argv[])
+{
+  int max_count = 1;
+  int numBlocks = 64;
+  int size = 8;
+
+  // Use --blocks, --size and --count arguments to use this for benchmarking.
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument(
+    "--blocks", argT::EQUAL_ARGUMENT, &numBlocks, "Optionally specify the number of blocks.");
+  arg.AddArgument(
+    "--size", argT::EQUAL_ARGUMENT, &size, "Optionally specify the resolution of each block.");
+  arg.AddArgument("--count", argT::EQUAL_ARGUMENT, &max_count,
+    "Optionally specify the number of iterations.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return TEST_FAILED;
+  }
+
+  vtkNew<vtkCellTypeSource> cells;
+  cells->SetBlocksDimensions(size, size, size);
+  cells->SetCellType(VTK_TETRA);
+
+  // Each block is translated so that every leaf has its own points.
+  vtkNew<vtkMultiBlockDataSet> input;
+  for (int cc = 0; cc < numBlocks; ++cc)
+  {
+    vtkNew<vtkTransform> transform;
+    transform->Translate(cc * size, 0, 0);
+    vtkNew<vtkTransformFilter> translate;
+    translate->SetInputConnection(cells->GetOutputPort());
+    translate->SetTransform(transform);
+    translate->Update();
+    // leave a hole in the hierarchy to check that indices are preserved.
+    input->SetBlock(cc % 7 == 3 ? cc + numBlocks : cc, translate->GetOutputDataObject(0));
+  }
+
+  vtkNew<vtkPVGeometryFilter> serialFilter;
+  serialFilter->SetInputData(input);
+  serialFilter->ProcessBlocksInParallelOff();
+  serialFilter->GeneratePointNormalsOn();
+
+  vtkNew<vtkPVGeometryFilter> parallelFilter;
+  parallelFilter->SetInputData(input);
+  parallelFilter->ProcessBlocksInParallelOn();
+  parallelFilter->GeneratePointNormalsOn();
+
+  vtkNew<vtkTimerLog> timer;
+  double serialTime = 0;
+  double parallelTime = 0;
+  for (int cc = 0; cc < max_count; ++cc)
+  {
+    serialFilter->Modified();
+    timer->StartTimer();
+    serialFilter->Update();
+    timer->StopTimer();
+    serialTime += timer->GetElapsedTime();
+
+    parallelFilter->Modified();
+    timer->StartTimer();
+    parallelFilter->Update();
+    timer->StopTimer();
+    parallelTime += timer->GetElapsedTime();
+
+    if (!Compare(serialFilter->GetOutputDataObject(0), parallelFilter->GetOutputDataObject(0)))
+    {
+      return TEST_FAILED;
+    }
+  }
+
+  cout << numBlocks << " blocks of " << cells->GetOutput()->GetNumberOfCells() << " cells ("
+       << vtkSMPTools::GetBackend() << ", " << vtkSMPTools::GetEstimatedNumberOfThreads()
+       << " threads): serial: " << (serialTime / max_count)
+       << "s parallel: " << (parallelTime / max_count) << "s" << endl;
+  return TEST_SUCCESS;
+}
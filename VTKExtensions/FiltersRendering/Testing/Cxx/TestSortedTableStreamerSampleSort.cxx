@@ -0,0 +1,344 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMPIController.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkSMPTools.h"
+#include "vtkSortedTableStreamer.h"
+#include "vtkTable.h"
+#include "vtkTimerLog.h"
+#include "vtkTypeInt64Array.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct Row
+{
+  double Primary;
+  double Secondary;
+  vtkIdType Id;
+};
+
+// Uniform values, or 90% of zeros and a long tail of large values when skewed.
+vtkSmartPointer<vtkPartitionedDataSet> CreateInput(vtkIdType size, int rank, bool skewed)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> rand;
+  rand->SetSeed(1234 + rank);
+  vtkNew<vtkDoubleArray> primary;
+  primary->SetName("primary");
+  primary->SetNumberOfTuples(size);
+  vtkNew<vtkDoubleArray> secondary;
+  secondary->SetName("secondary");
+  secondary->SetNumberOfTuples(size);
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("id");
+  ids->SetNumberOfTuples(size);
+  for (vtkIdType cc = 0; cc < size; ++cc)
+  {
+    rand->Next();
+    const double value = rand->GetValue();
+    const double skewedValue = value < 0.9 ? 0.0 : std::exp(200.0 * (value - 0.9));
+    primary->SetValue(cc, skewed ? skewedValue : value);
+    rand->Next();
+    secondary->SetValue(cc, std::floor(rand->GetValue() * 16));
+    ids->SetValue(cc, rank * size + cc);
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(primary);
+  table->AddColumn(secondary);
+  table->AddColumn(ids);
+  auto input = vtkSmartPointer<vtkPartitionedDataSet>::New();
+  input->SetPartition(0, table);
+  return input;
+}
+
+// Collect the rows of the block on the root process, since only the process
+// that merged them has a non-empty output.
+void CollectBlock(vtkMultiProcessController* controller, vtkTable* output, std::vector<Row>& rows)
+{
+  const int rank = controller->GetLocalProcessId();
+  int owner = output->GetNumberOfRows() > 0 ? rank : -1;
+  int globalOwner = -1;
+  controller->AllReduce(&owner, &globalOwner, 1, vtkCommunicator::MAX_OP);
+  if (globalOwner < 0)
+  {
+    return;
+  }
+
+  vtkSmartPointer<vtkTable> block = output;
+  if (globalOwner != 0)
+  {
+    if (rank == globalOwner)
+    {
+      controller->Send(output, 0, 4242);
+    }
+    else if (rank == 0)
+    {
+      block = vtkSmartPointer<vtkTable>::New();
+      controller->Receive(block.GetPointer(), globalOwner, 4242);
+    }
+  }
+  if (rank == 0)
+  {
+    auto primary = vtkDoubleArray::SafeDownCast(block->GetColumnByName("primary"));
+    auto secondary = vtkDoubleArray::SafeDownCast(block->GetColumnByName("secondary"));
+    auto ids = vtkIdTypeArray::SafeDownCast(block->GetColumnByName("id"));
+    for (vtkIdType cc = 0; primary && secondary && ids && cc < block->GetNumberOfRows(); ++cc)
+    {
+      rows.push_back(Row{ primary->GetValue(cc), secondary->GetValue(cc), ids->GetValue(cc) });
+    }
+  }
+}
+
+bool Verify(const std::vector<Row>& rows, vtkIdType expected, bool compound)
+{
+  if (static_cast<vtkIdType>(rows.size()) != expected)
+  {
+    cerr << "Expected " << expected << " rows and got " << rows.size() << endl;
+    return false;
+  }
+  std::vector<bool> seen(expected, false);
+  for (size_t cc = 0; cc < rows.size(); ++cc)
+  {
+    if (rows[cc].Id < 0 || rows[cc].Id >= expected || seen[rows[cc].Id])
+    {
+      cerr << "Row " << rows[cc].Id << " is missing or duplicated." << endl;
+      return false;
+    }
+    seen[rows[cc].Id] = true;
+    if (cc == 0)
+    {
+      continue;
+    }
+    const Row& a = rows[cc - 1];
+    const Row& b = rows[cc];
+    const bool ordered = a.Primary < b.Primary ||
+      (a.Primary == b.Primary &&
+        (compound ? (a.Secondary < b.Secondary || (a.Secondary == b.Secondary && a.Id < b.Id))
+                  : a.Id < b.Id));
+    if (!ordered)
+    {
+      cerr << "Rows " << a.Id << " and " << b.Id << " are not in order." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SameRows(const std::vector<Row>& expected, const std::vector<Row>& rows)
+{
+  if (expected.size() != rows.size())
+  {
+    return false;
+  }
+  for (size_t cc = 0; cc < rows.size(); ++cc)
+  {
+    if (expected[cc].Primary != rows[cc].Primary || expected[cc].Secondary != rows[cc].Secondary ||
+      expected[cc].Id != rows[cc].Id)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Sorts 64-bit integers that are not representable as doubles: rounding them
+// would make consecutive values equal and break the expected order.
+bool TestLargeIntegers(vtkMultiProcessController* controller)
+{
+  const int rank = controller->GetLocalProcessId();
+  const vtkIdType size = 1000;
+  const vtkIdType total = size * controller->GetNumberOfProcesses();
+  vtkNew<vtkTypeInt64Array> values;
+  values->SetName("value");
+  values->SetNumberOfTuples(size);
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("id");
+  ids->SetNumberOfTuples(size);
+  for (vtkIdType cc = 0; cc < size; ++cc)
+  {
+    const vtkIdType id = rank * size + cc;
+    values->SetValue(cc, (vtkTypeInt64(1) << 53) + (total - 1 - id));
+    ids->SetValue(cc, id);
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(values);
+  table->AddColumn(ids);
+  vtkNew<vtkPartitionedDataSet> input;
+  input->SetPartition(0, table);
+
+  vtkNew<vtkSortedTableStreamer> streamer;
+  streamer->SetInputData(input);
+  streamer->SetController(controller);
+  streamer->SetSortAlgorithm(vtkSortedTableStreamer::SAMPLE_SORT);
+  streamer->SetColumnNameToSort("value");
+  streamer->SetBlockSize(total);
+  streamer->SetBlock(0);
+  streamer->Update();
+
+  // the rows are descending ids, on the process that merged the block.
+  auto output = streamer->GetOutput();
+  auto sortedIds = vtkIdTypeArray::SafeDownCast(output->GetColumnByName("id"));
+  vtkIdType numRows = output->GetNumberOfRows();
+  int valid = 1;
+  for (vtkIdType cc = 0; cc < numRows; ++cc)
+  {
+    if (!sortedIds || sortedIds->GetValue(cc) != total - 1 - cc)
+    {
+      valid = 0;
+      break;
+    }
+  }
+  vtkIdType globalRows = 0;
+  int globalValid = 0;
+  controller->AllReduce(&numRows, &globalRows, 1, vtkCommunicator::SUM_OP);
+  controller->AllReduce(&valid, &globalValid, 1, vtkCommunicator::MIN_OP);
+  if (globalRows != total || !globalValid)
+  {
+    if (rank == 0)
+    {
+      cerr << "Large 64-bit integers are not sorted exactly." << endl;
+    }
+    return false;
+  }
+  return true;
+}
+}
+
+// Sorts uniform and heavily skewed data with the histogram and the sample sort
+// algorithms and checks the order of the rows given by the sample sort, by one
+// and two columns. The rows sorted with several threads must be the ones
+// sorted with a single thread. Run it with different numbers of processes and
+// use --size, --threads and --benchmark to use it as a scaling benchmark.
+// Integer keys too large to be represented as doubles must be sorted exactly.
+int TestSortedTableStreamerSampleSort(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv, 0);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+  const int numRanks = controller->GetNumberOfProcesses();
+
+  int size = 20000;
+  int blockSize = 1024;
+  int threads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  bool benchmark = false;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument(
+    "--size", argT::EQUAL_ARGUMENT, &size, "Optionally specify the number of rows per process.");
+  arg.AddArgument("--block-size", argT::EQUAL_ARGUMENT, &blockSize,
+    "Optionally specify the number of rows per block.");
+  arg.AddArgument("--threads", argT::EQUAL_ARGUMENT, &threads,
+    "Optionally specify the maximum number of threads.");
+  arg.AddBooleanArgument("--benchmark", &benchmark, "Print the time taken by the sorts.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse() || size < 1 || blockSize < 1 || threads < 1)
+  {
+    cerr << "Problem parsing arguments" << endl;
+    controller->Finalize();
+    return EXIT_FAILURE;
+  }
+
+  const vtkIdType total = static_cast<vtkIdType>(size) * numRanks;
+  const vtkIdType numBlocks = (total + blockSize - 1) / blockSize;
+  int success = 1;
+  for (const bool skewed : { false, true })
+  {
+    auto input = CreateInput(size, rank, skewed);
+    // rows sorted with a single thread, for each algorithm and number of keys.
+    std::map<std::pair<int, bool>, std::vector<Row>> serialRows;
+    for (int numThreads = 1; numThreads <= threads; numThreads *= 2)
+    {
+      for (const int algorithm :
+        { vtkSortedTableStreamer::HISTOGRAM_SORT, vtkSortedTableStreamer::SAMPLE_SORT })
+      {
+        for (const bool compound : { false, true })
+        {
+          if (compound && algorithm == vtkSortedTableStreamer::HISTOGRAM_SORT)
+          {
+            continue;
+          }
+          vtkNew<vtkSortedTableStreamer> streamer;
+          streamer->SetInputData(input);
+          streamer->SetController(controller);
+          streamer->SetSortAlgorithm(algorithm);
+          streamer->SetColumnNameToSort("primary");
+          if (compound)
+          {
+            streamer->AddSecondaryColumnToSort("secondary");
+          }
+          streamer->SetBlockSize(blockSize);
+
+          std::vector<Row> rows;
+          double sortTime = 0;
+          vtkNew<vtkTimerLog> timer;
+          vtkSMPTools::LocalScope(vtkSMPTools::Config{ numThreads }, [&]() {
+            for (vtkIdType block = 0; block < numBlocks; ++block)
+            {
+              controller->Barrier();
+              timer->StartTimer();
+              streamer->SetBlock(block);
+              streamer->Update();
+              timer->StopTimer();
+              if (block == 0)
+              {
+                sortTime = timer->GetElapsedTime();
+              }
+              CollectBlock(controller, streamer->GetOutput(), rows);
+            }
+          });
+
+          if (rank == 0)
+          {
+            const char* name =
+              algorithm == vtkSortedTableStreamer::SAMPLE_SORT ? "sample" : "histogram";
+            if (benchmark)
+            {
+              cout << (skewed ? "skewed" : "uniform") << " " << name
+                   << (compound ? " (2 keys)" : "") << ": " << numRanks << " ranks, "
+                   << numThreads << " threads, first block " << sortTime << " s, last block "
+                   << timer->GetElapsedTime() << " s" << endl;
+            }
+            if (algorithm == vtkSortedTableStreamer::SAMPLE_SORT &&
+              !Verify(rows, total, compound))
+            {
+              success = 0;
+            }
+            auto& serial = serialRows[std::make_pair(algorithm, compound)];
+            if (numThreads == 1)
+            {
+              serial = std::move(rows);
+            }
+            else if (!SameRows(serial, rows))
+            {
+              cerr << "The " << name << " sort with " << numThreads
+                   << " threads differs from the sort with a single thread." << endl;
+              success = 0;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  if (!TestLargeIntegers(controller))
+  {
+    success = 0;
+  }
+
+  controller->Broadcast(&success, 1, 0);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -11,8 +11,11 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkMPIMoveData.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVDataObjectMarshaller.h"
 #include "vtkPVSession.h"
 #include "vtkPolyData.h"
 #include "vtkProcessModule.h"
@@ -23,6 +26,16 @@
 
 #include <sstream>
 
+namespace
+{
+// Format flag sent ahead of non-selection data objects.
+enum
+{
+  LEGACY_MARSHALLING = 0,
+  BINARY_MARSHALLING = 1
+};
+}
+
 vtkStandardNewMacro(vtkClientServerMoveData);
 vtkCxxSetObjectMacro(vtkClientServerMoveData, Controller, vtkMultiProcessController);
 //-----------------------------------------------------------------------------
@@ -227,6 +240,23 @@ int vtkClientServerMoveData::SendData(vtkDataObject* input, vtkMultiProcessContr
     }
   }
 
+  vtkNew<vtkPVDataObjectMarshaller> marshaller;
+  int format = LEGACY_MARSHALLING;
+  if (vtkMPIMoveData::GetUseBinaryMarshalling() && marshaller->Marshal(input))
+  {
+    format = BINARY_MARSHALLING;
+  }
+  if (!controller->Send(&format, 1, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT))
+  {
+    return 0;
+  }
+  if (format == BINARY_MARSHALLING)
+  {
+    return marshaller->Send(
+             controller->GetCommunicator(), 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT)
+      ? 1
+      : 0;
+  }
   return controller->Send(input, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
 }
 
@@ -256,7 +286,23 @@ vtkDataObject* vtkClientServerMoveData::ReceiveData(vtkMultiProcessController* c
   }
   else
   {
-    data = controller->ReceiveDataObject(1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    int format = LEGACY_MARSHALLING;
+    controller->Receive(&format, 1, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    if (format == BINARY_MARSHALLING)
+    {
+      auto received = vtkPVDataObjectMarshaller::Receive(
+        controller->GetCommunicator(), 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+      if (received)
+      {
+        // callers own the returned data object.
+        received->Register(nullptr);
+        data = received;
+      }
+    }
+    else
+    {
+      data = controller->ReceiveDataObject(1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    }
   }
   return data;
 }
@@ -6,9 +6,198 @@
 
 #include "vtkCommand.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <vector>
+
+namespace
+{
+// Delta frame layout:
+// [DeltaFrameHeader][DeltaRectangle x NumberOfRectangles][compressed payload]
+// where the payload holds the pixels of all rectangles, one after the other.
+// Key frames have a single rectangle covering the whole image.
+constexpr vtkTypeInt32 DeltaFrameMagic = 0x41544c44; // "DLTA"
+
+struct DeltaFrameHeader
+{
+  vtkTypeInt32 Magic;
+  vtkTypeInt32 KeyFrame;
+  vtkTypeInt32 Width;
+  vtkTypeInt32 Height;
+  vtkTypeInt32 NumberOfComponents;
+  vtkTypeInt32 NumberOfRectangles;
+};
+
+// Pixel range [X0, X1) x [Y0, Y1).
+struct DeltaRectangle
+{
+  vtkTypeInt32 X0;
+  vtkTypeInt32 Y0;
+  vtkTypeInt32 X1;
+  vtkTypeInt32 Y1;
+
+  vtkIdType GetNumberOfPixels() const
+  {
+    return static_cast<vtkIdType>(this->X1 - this->X0) * (this->Y1 - this->Y0);
+  }
+};
+
+// Size of the blocks used to detect changes.
+constexpr int DeltaBlockSize = 32;
+
+// Beyond these, a key frame is cheaper than a delta frame.
+constexpr double DeltaMaximumChangedFraction = 0.5;
+constexpr size_t DeltaMaximumNumberOfRectangles = 256;
+
+// Copies pixels between a frame and a packed buffer holding the rectangles one
+// after the other.
+void PackRectangles(const std::vector<DeltaRectangle>& rects, const unsigned char* frame,
+  int width, int numComps, unsigned char* packed)
+{
+  for (const auto& rect : rects)
+  {
+    const size_t rowSize = static_cast<size_t>(rect.X1 - rect.X0) * numComps;
+    for (int y = rect.Y0; y < rect.Y1; ++y)
+    {
+      memcpy(packed, frame + (static_cast<vtkIdType>(y) * width + rect.X0) * numComps, rowSize);
+      packed += rowSize;
+    }
+  }
+}
+
+void UnpackRectangles(const std::vector<DeltaRectangle>& rects, const unsigned char* packed,
+  int width, int numComps, unsigned char* frame)
+{
+  for (const auto& rect : rects)
+  {
+    const size_t rowSize = static_cast<size_t>(rect.X1 - rect.X0) * numComps;
+    for (int y = rect.Y0; y < rect.Y1; ++y)
+    {
+      memcpy(frame + (static_cast<vtkIdType>(y) * width + rect.X0) * numComps, packed, rowSize);
+      packed += rowSize;
+    }
+  }
+}
+}
+
+class vtkImageCompressor::vtkDeltaInternals
+{
+public:
+  std::vector<unsigned char> PreviousFrame;
+  int Width = 0;
+  int Height = 0;
+  int NumberOfComponents = 0;
+  int LossLessMode = -1;
+  bool Valid = false;
+  int FramesSinceKeyFrame = 0;
+  vtkNew<vtkUnsignedCharArray> Packed;
+  vtkNew<vtkUnsignedCharArray> Payload;
+
+  bool IsCompatible(int width, int height, int numComps) const
+  {
+    return this->Valid && this->Width == width && this->Height == height &&
+      this->NumberOfComponents == numComps;
+  }
+
+  void Store(const unsigned char* frame, int width, int height, int numComps)
+  {
+    this->Width = width;
+    this->Height = height;
+    this->NumberOfComponents = numComps;
+    this->PreviousFrame.assign(
+      frame, frame + static_cast<vtkIdType>(width) * height * numComps);
+    this->Valid = true;
+  }
+
+  // Returns the rectangles that changed compared to the previous frame by
+  // merging changed blocks row by row. Returns false if a key frame should be
+  // sent instead.
+  bool ComputeChangedRectangles(const unsigned char* frame, std::vector<DeltaRectangle>& rects)
+  {
+    const int blocksX = (this->Width + DeltaBlockSize - 1) / DeltaBlockSize;
+    const int blocksY = (this->Height + DeltaBlockSize - 1) / DeltaBlockSize;
+    std::vector<char> changed(static_cast<size_t>(blocksX) * blocksY, 0);
+    const unsigned char* previous = this->PreviousFrame.data();
+    const int numComps = this->NumberOfComponents;
+    const int width = this->Width;
+    const int height = this->Height;
+    vtkSMPTools::For(0, blocksY, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType by = begin; by < end; ++by)
+      {
+        const int y0 = static_cast<int>(by) * DeltaBlockSize;
+        const int y1 = std::min(y0 + DeltaBlockSize, height);
+        for (int bx = 0; bx < blocksX; ++bx)
+        {
+          const int x0 = bx * DeltaBlockSize;
+          const size_t rowSize =
+            static_cast<size_t>(std::min(x0 + DeltaBlockSize, width) - x0) * numComps;
+          for (int y = y0; y < y1; ++y)
+          {
+            const vtkIdType offset = (static_cast<vtkIdType>(y) * width + x0) * numComps;
+            if (memcmp(frame + offset, previous + offset, rowSize) != 0)
+            {
+              changed[by * blocksX + bx] = 1;
+              break;
+            }
+          }
+        }
+      }
+    });
+
+    const vtkIdType numChanged = std::count(changed.begin(), changed.end(), 1);
+    if (numChanged > DeltaMaximumChangedFraction * changed.size())
+    {
+      return false;
+    }
+
+    // Runs of changed blocks in a block row extend the rectangle with the same
+    // horizontal range from the row above, if any.
+    rects.clear();
+    std::vector<size_t> open, nextOpen;
+    for (int by = 0; by < blocksY; ++by)
+    {
+      nextOpen.clear();
+      for (int bx = 0; bx < blocksX;)
+      {
+        if (!changed[by * blocksX + bx])
+        {
+          ++bx;
+          continue;
+        }
+        int bxEnd = bx;
+        while (bxEnd < blocksX && changed[by * blocksX + bxEnd])
+        {
+          ++bxEnd;
+        }
+        const int x0 = bx * DeltaBlockSize;
+        const int x1 = std::min(bxEnd * DeltaBlockSize, width);
+        const int y1 = std::min((by + 1) * DeltaBlockSize, height);
+        auto iter = std::find_if(open.begin(), open.end(),
+          [&](size_t idx) { return rects[idx].X0 == x0 && rects[idx].X1 == x1; });
+        if (iter != open.end())
+        {
+          rects[*iter].Y1 = y1;
+          nextOpen.push_back(*iter);
+        }
+        else
+        {
+          rects.push_back(DeltaRectangle{ x0, by * DeltaBlockSize, x1, y1 });
+          nextOpen.push_back(rects.size() - 1);
+        }
+        bx = bxEnd;
+      }
+      std::swap(open, nextOpen);
+    }
+    return rects.size() <= DeltaMaximumNumberOfRectangles;
+  }
+};
 
 //-----------------------------------------------------------------------------
 vtkCxxSetObjectMacro(vtkImageCompressor, Output, vtkUnsignedCharArray);
@@ -22,6 +211,14 @@ vtkImageCompressor::vtkImageCompressor()
   , Input(nullptr)
   , LossLessMode(0)
   , Configuration(nullptr)
+  , DeltaMode(false)
+  , KeyFrameInterval(30)
+  , LastFrameSize(0)
+  , LastFrameDeltaSize(0)
+  , LastFrameCompressedSize(0)
+  , LastFrameNumberOfRectangles(0)
+  , LastFrameIsKeyFrame(false)
+  , DeltaInternals(new vtkImageCompressor::vtkDeltaInternals())
 {
   // Always allocate output array as a convenience.
   vtkUnsignedCharArray* data = vtkUnsignedCharArray::New();
@@ -40,6 +237,208 @@ vtkImageCompressor::~vtkImageCompressor()
 //-----------------------------------------------------------------------------
 void vtkImageCompressor::SetImageResolution(int, int) {}
 
+//-----------------------------------------------------------------------------
+void vtkImageCompressor::SetDeltaMode(bool mode)
+{
+  if (this->DeltaMode != mode)
+  {
+    this->DeltaMode = mode;
+    this->ResetDeltaFrame();
+    this->Modified();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkImageCompressor::ResetDeltaFrame()
+{
+  this->DeltaInternals->Valid = false;
+  this->DeltaInternals->PreviousFrame.clear();
+}
+
+//-----------------------------------------------------------------------------
+int vtkImageCompressor::CompressFrame(int width, int height)
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot compress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  const int numComps = this->Input->GetNumberOfComponents();
+  this->LastFrameSize = this->Input->GetNumberOfValues();
+  this->LastFrameDeltaSize = this->LastFrameSize;
+  this->LastFrameNumberOfRectangles = 1;
+  this->LastFrameIsKeyFrame = true;
+  if (!this->DeltaMode || !this->SupportsDeltaMode())
+  {
+    const int status = this->Compress();
+    this->LastFrameCompressedSize = this->Output->GetNumberOfValues();
+    return status;
+  }
+
+  auto& internals = (*this->DeltaInternals);
+  if (static_cast<vtkIdType>(width) * height != this->Input->GetNumberOfTuples())
+  {
+    vtkErrorMacro("Image resolution does not match the input.");
+    return VTK_ERROR;
+  }
+
+  std::vector<DeltaRectangle> rects;
+  const unsigned char* frame = this->Input->GetPointer(0);
+  const bool keyFrame = !internals.IsCompatible(width, height, numComps) ||
+    internals.LossLessMode != this->LossLessMode ||
+    internals.FramesSinceKeyFrame + 1 >= this->KeyFrameInterval ||
+    !internals.ComputeChangedRectangles(frame, rects);
+  if (keyFrame)
+  {
+    rects.assign(1, DeltaRectangle{ 0, 0, width, height });
+  }
+
+  vtkIdType numPixels = 0;
+  for (const auto& rect : rects)
+  {
+    numPixels += rect.GetNumberOfPixels();
+  }
+
+  int status = VTK_OK;
+  vtkIdType payloadSize = 0;
+  if (numPixels > 0)
+  {
+    vtkSmartPointer<vtkUnsignedCharArray> input = this->Input;
+    if (!keyFrame)
+    {
+      internals.Packed->SetNumberOfComponents(numComps);
+      internals.Packed->SetNumberOfTuples(numPixels);
+      ::PackRectangles(rects, frame, width, numComps, internals.Packed->GetPointer(0));
+      this->SetInput(internals.Packed);
+    }
+    status = this->Compress();
+    this->SetInput(input);
+    payloadSize = this->Output->GetNumberOfValues();
+  }
+
+  // prepend the delta header to the compressed payload.
+  const vtkIdType headerSize =
+    static_cast<vtkIdType>(sizeof(DeltaFrameHeader) + sizeof(DeltaRectangle) * rects.size());
+  const DeltaFrameHeader header = { DeltaFrameMagic, keyFrame ? 1 : 0, width, height, numComps,
+    static_cast<vtkTypeInt32>(rects.size()) };
+  this->Output->SetNumberOfComponents(1);
+  this->Output->SetNumberOfTuples(headerSize + payloadSize);
+  unsigned char* output = this->Output->GetPointer(0);
+  memmove(output + headerSize, output, payloadSize);
+  memcpy(output, &header, sizeof(header));
+  memcpy(output + sizeof(header), rects.data(), sizeof(DeltaRectangle) * rects.size());
+
+  internals.Store(frame, width, height, numComps);
+  internals.LossLessMode = this->LossLessMode;
+  internals.FramesSinceKeyFrame = keyFrame ? 0 : internals.FramesSinceKeyFrame + 1;
+  internals.Valid = (status == VTK_OK);
+
+  this->LastFrameDeltaSize = numPixels * numComps;
+  this->LastFrameCompressedSize = headerSize + payloadSize;
+  this->LastFrameNumberOfRectangles = static_cast<int>(rects.size());
+  this->LastFrameIsKeyFrame = keyFrame;
+  return status;
+}
+
+//-----------------------------------------------------------------------------
+int vtkImageCompressor::DecompressFrame(int width, int height)
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot decompress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  const int numComps = this->Output->GetNumberOfComponents();
+  this->LastFrameSize = this->Output->GetNumberOfValues();
+  this->LastFrameDeltaSize = this->LastFrameSize;
+  this->LastFrameCompressedSize = this->Input->GetNumberOfValues();
+  this->LastFrameNumberOfRectangles = 1;
+  this->LastFrameIsKeyFrame = true;
+  if (!this->DeltaMode || !this->SupportsDeltaMode())
+  {
+    return this->Decompress();
+  }
+
+  auto& internals = (*this->DeltaInternals);
+  unsigned char* input = this->Input->GetPointer(0);
+  const vtkIdType inputSize = this->Input->GetNumberOfValues();
+  DeltaFrameHeader header;
+  if (inputSize < static_cast<vtkIdType>(sizeof(header)))
+  {
+    vtkErrorMacro("Invalid delta frame.");
+    return VTK_ERROR;
+  }
+  memcpy(&header, input, sizeof(header));
+  const vtkIdType headerSize = static_cast<vtkIdType>(
+    sizeof(DeltaFrameHeader) + sizeof(DeltaRectangle) * header.NumberOfRectangles);
+  if (header.Magic != DeltaFrameMagic || header.NumberOfRectangles < 0 ||
+    headerSize > inputSize || header.Width != width || header.Height != height ||
+    header.NumberOfComponents != numComps)
+  {
+    vtkErrorMacro("Delta frame does not match the output image.");
+    return VTK_ERROR;
+  }
+  if (!header.KeyFrame && !internals.IsCompatible(width, height, numComps))
+  {
+    vtkErrorMacro("Delta frame received without a previous frame.");
+    return VTK_ERROR;
+  }
+
+  std::vector<DeltaRectangle> rects(header.NumberOfRectangles);
+  memcpy(rects.data(), input + sizeof(header), sizeof(DeltaRectangle) * rects.size());
+  vtkIdType numPixels = 0;
+  for (const auto& rect : rects)
+  {
+    if (rect.X0 < 0 || rect.Y0 < 0 || rect.X1 > width || rect.Y1 > height ||
+      rect.X0 > rect.X1 || rect.Y0 > rect.Y1)
+    {
+      vtkErrorMacro("Invalid delta frame rectangle.");
+      return VTK_ERROR;
+    }
+    numPixels += rect.GetNumberOfPixels();
+  }
+
+  int status = VTK_OK;
+  if (numPixels > 0)
+  {
+    // let the subclass decompress the payload, without copying it.
+    internals.Payload->SetArray(input + headerSize, inputSize - headerSize, /*save=*/1);
+    vtkSmartPointer<vtkUnsignedCharArray> received = this->Input;
+    vtkSmartPointer<vtkUnsignedCharArray> output = this->Output;
+    this->SetInput(internals.Payload);
+    if (!header.KeyFrame)
+    {
+      internals.Packed->SetNumberOfComponents(numComps);
+      internals.Packed->SetNumberOfTuples(numPixels);
+      this->SetOutput(internals.Packed);
+    }
+    status = this->Decompress();
+    this->SetInput(received);
+    this->SetOutput(output);
+    internals.Payload->SetArray(nullptr, 0, /*save=*/1);
+  }
+
+  unsigned char* frame = this->Output->GetPointer(0);
+  if (header.KeyFrame)
+  {
+    internals.Store(frame, width, height, numComps);
+  }
+  else
+  {
+    ::UnpackRectangles(
+      rects, internals.Packed->GetPointer(0), width, numComps, internals.PreviousFrame.data());
+    memcpy(frame, internals.PreviousFrame.data(), internals.PreviousFrame.size());
+  }
+  internals.Valid = (status == VTK_OK);
+
+  this->LastFrameDeltaSize = numPixels * numComps;
+  this->LastFrameNumberOfRectangles = static_cast<int>(rects.size());
+  this->LastFrameIsKeyFrame = header.KeyFrame != 0;
+  return status;
+}
+
 //-----------------------------------------------------------------------------
 void vtkImageCompressor::SaveConfiguration(vtkMultiProcessStream* stream)
 {
@@ -94,5 +493,7 @@ void vtkImageCompressor::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Input:          " << this->Input << endl
      << indent << "Output:         " << this->Output << endl
-     << indent << "LossLessMode: " << this->LossLessMode << endl;
+     << indent << "LossLessMode: " << this->LossLessMode << endl
+     << indent << "DeltaMode: " << this->DeltaMode << endl
+     << indent << "KeyFrameInterval: " << this->KeyFrameInterval << endl;
 }
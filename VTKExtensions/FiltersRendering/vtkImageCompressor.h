@@ -13,6 +13,15 @@
  * the LossLessMode ivar, which is used by the composite manager to force
  * loss less compression during a still render. Additionally compressors
  * must be able to seriealize and restore their setting from a stream.
+ *
+ * When `DeltaMode` is enabled, `CompressFrame` and `DecompressFrame` keep the
+ * previous frame on both the compressing and the decompressing side and only
+ * the rectangles that changed since the previous frame are compressed by the
+ * subclass implementation and transmitted. A complete key frame is sent every
+ * `KeyFrameInterval` frames, when the image resolution or the loss-less mode
+ * changes, or when most of the image changed. This requires every frame
+ * compressed with `CompressFrame` to be decompressed with `DecompressFrame` by
+ * the peer compressor.
  */
 
 #ifndef vtkImageCompressor_h
@@ -21,6 +30,8 @@
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
 
+#include <memory> // for std::unique_ptr
+
 class vtkUnsignedCharArray;
 class vtkMultiProcessStream;
 
@@ -72,6 +83,66 @@ public:
    */
   virtual void SetImageResolution(int width, int height);
 
+  ///@{
+  /**
+   * When set, `CompressFrame` and `DecompressFrame` only transmit the parts of
+   * the image that changed since the previous frame. Off by default.
+   */
+  void SetDeltaMode(bool);
+  vtkGetMacro(DeltaMode, bool);
+  vtkBooleanMacro(DeltaMode, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set the number of frames between two complete key frames when `DeltaMode`
+   * is enabled. Default is 30.
+   */
+  vtkSetClampMacro(KeyFrameInterval, int, 1, VTK_INT_MAX);
+  vtkGetMacro(KeyFrameInterval, int);
+  ///@}
+
+  /**
+   * Returns false for compressors that cannot be used with `DeltaMode`, in
+   * which case `CompressFrame` and `DecompressFrame` ignore it.
+   */
+  virtual bool SupportsDeltaMode() { return true; }
+
+  ///@{
+  /**
+   * Compresses/decompresses a `width` x `height` frame. When `DeltaMode` is
+   * disabled, this simply calls `Compress` or `Decompress`, otherwise only the
+   * rectangles that changed since the previous frame are passed to them.
+   */
+  int CompressFrame(int width, int height);
+  int DecompressFrame(int width, int height);
+  ///@}
+
+  /**
+   * Discards the previous frame kept for `DeltaMode` so that the next frame is
+   * a key frame.
+   */
+  void ResetDeltaFrame();
+
+  ///@{
+  /**
+   * Statistics about the last frame processed by `CompressFrame` or
+   * `DecompressFrame`: the uncompressed size of the full frame, the
+   * uncompressed size of the parts that were actually compressed, the number
+   * of bytes saved by delta encoding (their difference), the compressed size,
+   * the number of changed rectangles and whether it was a key frame.
+   */
+  vtkGetMacro(LastFrameSize, vtkIdType);
+  vtkGetMacro(LastFrameDeltaSize, vtkIdType);
+  vtkIdType GetLastFrameBytesSaved() const
+  {
+    return this->LastFrameSize - this->LastFrameDeltaSize;
+  }
+  vtkGetMacro(LastFrameCompressedSize, vtkIdType);
+  vtkGetMacro(LastFrameNumberOfRectangles, int);
+  vtkGetMacro(LastFrameIsKeyFrame, bool);
+  ///@}
+
   /**
    * Serialize compressor configuration (but not the data) into the stream.
    */
@@ -115,9 +186,20 @@ protected:
   vtkSetStringMacro(Configuration);
   char* Configuration;
 
+  bool DeltaMode;
+  int KeyFrameInterval;
+  vtkIdType LastFrameSize;
+  vtkIdType LastFrameDeltaSize;
+  vtkIdType LastFrameCompressedSize;
+  int LastFrameNumberOfRectangles;
+  bool LastFrameIsKeyFrame;
+
 private:
   vtkImageCompressor(const vtkImageCompressor&) = delete;
   void operator=(const vtkImageCompressor&) = delete;
+
+  class vtkDeltaInternals;
+  std::unique_ptr<vtkDeltaInternals> DeltaInternals;
 };
 
 #endif
@@ -17,8 +17,10 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessControllerHelper.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutlineFilter.h"
+#include "vtkPVDataObjectMarshaller.h"
 #include "vtkPVLogger.h"
 #include "vtkPVSession.h"
 #include "vtkPointData.h"
@@ -30,13 +32,22 @@
 #include "vtkTimerLog.h"
 
 #include "vtk_zlib.h"
+#include <vtksys/SystemTools.hxx>
+
+#include <memory>
 #include <sstream>
 #include <vector>
 
 bool vtkMPIMoveData::UseZLibCompression = false;
+bool vtkMPIMoveData::UseBinaryMarshalling =
+  vtksys::SystemTools::GetEnv("PV_BINARY_MARSHALLING") != nullptr;
 
 namespace
 {
+// Sent instead of the number of buffers when the data follows as a binary
+// marshalled stream (see vtkMPIMoveData::SendMarshalledData).
+constexpr int MARSHALLED_DATA_STREAM = -1;
+
 bool vtkMPIMoveDataMerge(std::vector<vtkSmartPointer<vtkDataObject>>& pieces, vtkDataObject* result)
 {
   return vtkMultiProcessControllerHelper::MergePieces(pieces, result);
@@ -164,6 +175,18 @@ bool vtkMPIMoveData::GetUseZLibCompression()
   return vtkMPIMoveData::UseZLibCompression;
 }
 
+//----------------------------------------------------------------------------
+void vtkMPIMoveData::SetUseBinaryMarshalling(bool b)
+{
+  vtkMPIMoveData::UseBinaryMarshalling = b;
+}
+
+//----------------------------------------------------------------------------
+bool vtkMPIMoveData::GetUseBinaryMarshalling()
+{
+  return vtkMPIMoveData::UseBinaryMarshalling;
+}
+
 //----------------------------------------------------------------------------
 int vtkMPIMoveData::FillInputPortInformation(int, vtkInformation* info)
 {
@@ -687,6 +710,10 @@ void vtkMPIMoveData::DataServerSendToRenderServer(vtkDataObject* output)
   }
 
   vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "send-to-renderserver");
+  if (this->SendMarshalledData(com, output, 23480, 23482))
+  {
+    return;
+  }
 
   // int fixme;
   // We might be able to eliminate this marshal.
@@ -713,6 +740,12 @@ void vtkMPIMoveData::RenderServerReceiveFromDataServer(vtkDataObject* output)
 
   this->ClearBuffer();
   com->Receive(&(this->NumberOfBuffers), 1, 1, 23480);
+  if (this->NumberOfBuffers == MARSHALLED_DATA_STREAM)
+  {
+    this->NumberOfBuffers = 0;
+    this->ReceiveMarshalledData(com, output, 23482);
+    return;
+  }
   this->BufferLengths = new vtkIdType[this->NumberOfBuffers];
   com->Receive(this->BufferLengths, this->NumberOfBuffers, 1, 23481);
   // Compute additional buffer information.
@@ -748,6 +781,10 @@ void vtkMPIMoveData::DataServerZeroSendToRenderServerZero(vtkDataObject* data)
     }
 
     vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "send-to-renderserver-root");
+    if (this->SendMarshalledData(com, data, 23480, 23482))
+    {
+      return;
+    }
 
     // int fixme;
     // We might be able to eliminate this marshal.
@@ -779,6 +816,12 @@ void vtkMPIMoveData::RenderServerZeroReceiveFromDataServerZero(vtkDataObject* da
 
     this->ClearBuffer();
     com->Receive(&(this->NumberOfBuffers), 1, 1, 23480);
+    if (this->NumberOfBuffers == MARSHALLED_DATA_STREAM)
+    {
+      this->NumberOfBuffers = 0;
+      this->ReceiveMarshalledData(com, data, 23482);
+      return;
+    }
     this->BufferLengths = new vtkIdType[this->NumberOfBuffers];
     com->Receive(this->BufferLengths, this->NumberOfBuffers, 1, 23481);
     // Compute additional buffer information.
@@ -812,6 +855,12 @@ void vtkMPIMoveData::DataServerSendToClient(vtkDataObject* output)
   {
     vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "send-to-client");
     vtkTimerLog::MarkStartEvent("Dataserver sending to client");
+    if (this->SendMarshalledData(
+          this->ClientDataServerSocketController->GetCommunicator(), output, 23490, 23492))
+    {
+      vtkTimerLog::MarkEndEvent("Dataserver sending to client");
+      return;
+    }
     this->ClearBuffer();
     this->MarshalDataToBuffer(output);
     this->ClientDataServerSocketController->Send(&(this->NumberOfBuffers), 1, 1, 23490);
@@ -838,6 +887,12 @@ void vtkMPIMoveData::ClientReceiveFromDataServer(vtkDataObject* output)
 
   this->ClearBuffer();
   com->Receive(&(this->NumberOfBuffers), 1, 1, 23490);
+  if (this->NumberOfBuffers == MARSHALLED_DATA_STREAM)
+  {
+    this->NumberOfBuffers = 0;
+    this->ReceiveMarshalledData(com, output, 23492);
+    return;
+  }
   this->BufferLengths = new vtkIdType[this->NumberOfBuffers];
   com->Receive(this->BufferLengths, this->NumberOfBuffers, 1, 23491);
   // Compute additional buffer information.
@@ -943,25 +998,47 @@ void vtkMPIMoveData::MarshalDataToBuffer(vtkDataObject* data)
     this->NumberOfBuffers = 0;
   }
 
-  // Copy input to isolate reader from the pipeline.
-  vtkDataWriter* writer = vtkGenericDataObjectWriter::New();
-  writer->SetInputData(data);
-  if (imageData)
+  // Serialize the data either using the binary marshaller or the legacy writer.
+  // `raw` points to the serialized data, owned by `rawBuffer` or `writer`.
+  vtkNew<vtkGenericDataObjectWriter> writer;
+  std::unique_ptr<char[]> rawBuffer;
+  const char* raw = nullptr;
+  vtkIdType raw_length = 0;
+
+  vtkNew<vtkPVDataObjectMarshaller> marshaller;
+  if (vtkMPIMoveData::UseBinaryMarshalling && marshaller->Marshal(data))
   {
-    // We add the image extents to the header, since the writer doesn't preserve
-    // the extents.
-    int* extent = imageData->GetExtent();
-    double* origin = imageData->GetOrigin();
-    std::ostringstream stream;
-    stream << "EXTENT " << extent[0] << " " << extent[1] << " " << extent[2] << " " << extent[3]
-           << " " << extent[4] << " " << extent[5];
-    stream << " ORIGIN " << origin[0] << " " << origin[1] << " " << origin[2];
-    writer->SetHeader(stream.str().c_str());
+    vtkTimerLog::MarkStartEvent("Binary marshal");
+    raw_length = marshaller->GetMarshalledSize();
+    rawBuffer.reset(new char[raw_length]);
+    marshaller->CopyToBuffer(rawBuffer.get());
+    marshaller->Reset();
+    raw = rawBuffer.get();
+    vtkTimerLog::MarkEndEvent("Binary marshal");
   }
+  else
+  {
+    // Copy input to isolate reader from the pipeline.
+    writer->SetInputData(data);
+    if (imageData)
+    {
+      // We add the image extents to the header, since the writer doesn't preserve
+      // the extents.
+      int* extent = imageData->GetExtent();
+      double* origin = imageData->GetOrigin();
+      std::ostringstream stream;
+      stream << "EXTENT " << extent[0] << " " << extent[1] << " " << extent[2] << " " << extent[3]
+             << " " << extent[4] << " " << extent[5];
+      stream << " ORIGIN " << origin[0] << " " << origin[1] << " " << origin[2];
+      writer->SetHeader(stream.str().c_str());
+    }
 
-  writer->SetFileTypeToBinary();
-  writer->WriteToOutputStringOn();
-  writer->Write();
+    writer->SetFileTypeToBinary();
+    writer->WriteToOutputStringOn();
+    writer->Write();
+    raw = writer->GetOutputString();
+    raw_length = writer->GetOutputStringLength();
+  }
 
   char* buffer = nullptr;
   vtkIdType buffer_length = 0;
@@ -970,15 +1047,15 @@ void vtkMPIMoveData::MarshalDataToBuffer(vtkDataObject* data)
   {
     vtkTimerLog::MarkStartEvent("Zlib compress");
     // Use z-lib compression.
-    uLongf out_size = compressBound(writer->GetOutputStringLength());
+    uLongf out_size = compressBound(raw_length);
     buffer = new char[out_size + 8];
     memcpy(buffer, "zlib0000", 8);
 
     compress2(reinterpret_cast<Bytef*>(buffer + 8), &out_size,
-      reinterpret_cast<const Bytef*>(writer->GetOutputString()), writer->GetOutputStringLength(),
+      reinterpret_cast<const Bytef*>(raw), raw_length,
       /* compression_level */ Z_DEFAULT_COMPRESSION);
     vtkTimerLog::MarkEndEvent("Zlib compress");
-    int in_size = static_cast<int>(writer->GetOutputStringLength());
+    int in_size = static_cast<int>(raw_length);
     for (int cc = 0; cc < 4; cc++)
     {
       // the first 4 bytes in the header are "zlib" which helps the receiver
@@ -990,6 +1067,11 @@ void vtkMPIMoveData::MarshalDataToBuffer(vtkDataObject* data)
     }
     buffer_length = out_size + 8;
   }
+  else if (rawBuffer)
+  {
+    buffer_length = raw_length;
+    buffer = rawBuffer.release();
+  }
   else
   {
     buffer_length = writer->GetOutputStringLength();
@@ -1004,9 +1086,6 @@ void vtkMPIMoveData::MarshalDataToBuffer(vtkDataObject* data)
   this->BufferOffsets[0] = 0;
   this->Buffers = buffer;
   this->BufferTotalLength = this->BufferLengths[0];
-
-  writer->Delete();
-  writer = nullptr;
 }
 
 //-----------------------------------------------------------------------------
@@ -1049,6 +1128,23 @@ void vtkMPIMoveData::ReconstructDataFromBuffer(vtkDataObject* data)
       bufferLength = uncompressed_length;
     }
 
+    if (vtkPVDataObjectMarshaller::IsMarshalledBuffer(bufferArray, bufferLength))
+    {
+      // binary marshalling preserves image extents, no need for the header hack.
+      vtkTimerLog::MarkStartEvent("Binary unmarshal");
+      auto piece = vtkPVDataObjectMarshaller::Unmarshal(bufferArray, bufferLength);
+      vtkTimerLog::MarkEndEvent("Binary unmarshal");
+      if (piece)
+      {
+        // reconstructing data distributted on MPI node, so global ids are valid
+        unsetGlobalIdsAttribute(piece);
+        pieces.push_back(piece);
+      }
+      delete[] realBuffer;
+      realBuffer = nullptr;
+      continue;
+    }
+
     // Setup a reader.
     vtkDataReader* reader = vtkGenericDataObjectReader::New();
     reader->ReadFromInputStringOn();
@@ -1103,6 +1199,52 @@ void vtkMPIMoveData::ReconstructDataFromBuffer(vtkDataObject* data)
   vtkMPIMoveDataMerge(pieces, data);
 }
 
+//-----------------------------------------------------------------------------
+bool vtkMPIMoveData::SendMarshalledData(
+  vtkCommunicator* com, vtkDataObject* data, int countTag, int dataTag)
+{
+  // zlib compression needs the whole data in a single buffer.
+  if (!vtkMPIMoveData::UseBinaryMarshalling || vtkMPIMoveData::UseZLibCompression ||
+    com == nullptr || data == nullptr)
+  {
+    return false;
+  }
+
+  vtkNew<vtkPVDataObjectMarshaller> marshaller;
+  if (!marshaller->Marshal(data))
+  {
+    return false;
+  }
+
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "binary marshalling (%d buffers, %lld bytes)",
+    marshaller->GetNumberOfPayloads(), static_cast<long long>(marshaller->GetMarshalledSize()));
+  int count = MARSHALLED_DATA_STREAM;
+  com->Send(&count, 1, 1, countTag);
+  if (!marshaller->Send(com, 1, dataTag))
+  {
+    vtkErrorMacro("Failed to send marshalled data.");
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void vtkMPIMoveData::ReceiveMarshalledData(
+  vtkCommunicator* com, vtkDataObject* output, int dataTag)
+{
+  auto piece = vtkPVDataObjectMarshaller::Receive(com, 1, dataTag);
+  if (!piece)
+  {
+    vtkErrorMacro("Failed to receive marshalled data.");
+    output->Initialize();
+    return;
+  }
+
+  // reconstructing data distributted on MPI node, so global ids are valid
+  unsetGlobalIdsAttribute(piece);
+  std::vector<vtkSmartPointer<vtkDataObject>> pieces{ piece };
+  vtkMPIMoveDataMerge(pieces, output);
+}
+
 //-----------------------------------------------------------------------------
 void vtkMPIMoveData::PrintSelf(ostream& os, vtkIndent indent)
 {
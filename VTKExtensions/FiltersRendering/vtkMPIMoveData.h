@@ -18,6 +18,7 @@
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" //needed for exports
 #include "vtkPassInputTypeAlgorithm.h"
 
+class vtkCommunicator;
 class vtkMultiProcessController;
 class vtkSocketController;
 class vtkMPIMToNSocketConnection;
@@ -102,6 +103,21 @@ public:
   static bool GetUseZLibCompression();
   ///@}
 
+  ///@{
+  /**
+   * When set to true, data is marshalled using vtkPVDataObjectMarshaller i.e.
+   * as a binary header followed by the raw array buffers, instead of the legacy
+   * writer. When sending over sockets without zlib compression, the array
+   * buffers are sent directly without an intermediate buffer. Data types not
+   * supported by vtkPVDataObjectMarshaller silently use the legacy path. False
+   * by default, unless the `PV_BINARY_MARSHALLING` environment variable is set.
+   * Like `UseZLibCompression`, this only affects the sender; the receiver
+   * detects the format used. vtkClientServerMoveData uses this flag as well.
+   */
+  static void SetUseBinaryMarshalling(bool b);
+  static bool GetUseBinaryMarshalling();
+  ///@}
+
   /**
    * vtkMPIMoveData doesn't necessarily generate a valid output data on all the
    * involved processes (depending on the MoveMode and Server ivars). This
@@ -164,6 +180,21 @@ protected:
   void MarshalDataToBuffer(vtkDataObject* data);
   void ReconstructDataFromBuffer(vtkDataObject* data);
 
+  /**
+   * Sends `data` over `com` using the binary marshalling with one message per
+   * array buffer. `countTag` is the tag used to send the number of buffers in
+   * the buffer based path, `dataTag` the one used for the buffers themselves.
+   * Returns false without sending anything if binary marshalling is disabled,
+   * zlib compression is enabled or `data` is not supported, in which case the
+   * caller must use the buffer based path.
+   */
+  bool SendMarshalledData(vtkCommunicator* com, vtkDataObject* data, int countTag, int dataTag);
+
+  /**
+   * Receives data sent with `SendMarshalledData` into `output`.
+   */
+  void ReceiveMarshalledData(vtkCommunicator* com, vtkDataObject* output, int dataTag);
+
   int MoveMode;
   int Server;
 
@@ -186,6 +217,7 @@ private:
   void operator=(const vtkMPIMoveData&) = delete;
 
   static bool UseZLibCompression;
+  static bool UseBinaryMarshalling;
 };
 
 #endif
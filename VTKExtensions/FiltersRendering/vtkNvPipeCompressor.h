@@ -45,6 +45,12 @@ public:
 
   void SetImageResolution(int img_width, int img_height);
 
+  /**
+   * NvPipe encodes frames of a fixed resolution and relies on its own
+   * inter-frame coding, delta mode is not supported.
+   */
+  bool SupportsDeltaMode() override { return false; }
+
   ///@{
   /// Description:
   /// Serialize/Restore compressor configuration (but not the data) into the stream.
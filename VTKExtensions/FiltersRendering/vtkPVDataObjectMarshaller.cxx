@@ -0,0 +1,712 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVDataObjectMarshaller.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCommunicator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataAssembly.h"
+#include "vtkDataObjectTypes.h"
+#include "vtkFieldData.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMatrix3x3.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace
+{
+// The header starts with a fixed size preamble:
+// [ 'p', 'v', 'b', 'm', version, sizeof(vtkIdType), 0, 0, header length (8 bytes) ]
+constexpr char MarshalMagic[4] = { 'p', 'v', 'b', 'm' };
+constexpr unsigned char MarshalVersion = 1;
+constexpr vtkIdType PreambleSize = 16;
+
+// Reads the next `size` bytes of payload into `dest`.
+using PayloadReader = std::function<bool(void* dest, vtkIdType size)>;
+
+vtkIdType GetPayloadSize(vtkDataArray* array)
+{
+  if (array->GetDataType() == VTK_BIT)
+  {
+    // bits are packed, GetDataTypeSize() returns 0.
+    return (array->GetNumberOfValues() + 7) / 8;
+  }
+  return array->GetNumberOfValues() * array->GetDataTypeSize();
+}
+
+bool ReadPreamble(const char* buffer, vtkIdType length, vtkTypeInt64& headerLength)
+{
+  if (buffer == nullptr || length < PreambleSize ||
+    strncmp(buffer, MarshalMagic, sizeof(MarshalMagic)) != 0)
+  {
+    return false;
+  }
+  if (static_cast<unsigned char>(buffer[4]) != MarshalVersion)
+  {
+    vtkGenericWarningMacro("Unsupported binary marshalling version " << static_cast<int>(buffer[4]));
+    return false;
+  }
+  if (static_cast<unsigned char>(buffer[5]) != sizeof(vtkIdType))
+  {
+    vtkGenericWarningMacro("Binary marshalled data uses a different vtkIdType size.");
+    return false;
+  }
+  memcpy(&headerLength, buffer + 8, sizeof(headerLength));
+  return headerLength >= 0 && headerLength <= length - PreambleSize;
+}
+
+//----------------------------------------------------------------------------
+// Decoding.
+//----------------------------------------------------------------------------
+class Decoder
+{
+public:
+  Decoder(vtkMultiProcessStream& stream, const PayloadReader& reader)
+    : Stream(stream)
+    , Reader(reader)
+  {
+  }
+
+  vtkSmartPointer<vtkDataObject> DecodeDataObject()
+  {
+    int type = -1;
+    this->Stream >> type;
+    if (type < 0)
+    {
+      return nullptr;
+    }
+
+    auto dobj = vtk::TakeSmartPointer(vtkDataObjectTypes::NewDataObject(type));
+    if (!dobj)
+    {
+      vtkGenericWarningMacro("Cannot create data object of type " << type);
+      this->Valid = false;
+      return nullptr;
+    }
+
+    if (auto pd = vtkPolyData::SafeDownCast(dobj))
+    {
+      pd->SetPoints(this->DecodePoints());
+      pd->SetVerts(this->DecodeCells());
+      pd->SetLines(this->DecodeCells());
+      pd->SetPolys(this->DecodeCells());
+      pd->SetStrips(this->DecodeCells());
+    }
+    else if (auto ug = vtkUnstructuredGrid::SafeDownCast(dobj))
+    {
+      ug->SetPoints(this->DecodePoints());
+      auto types = this->DecodeArray();
+      auto cells = this->DecodeCells();
+      if (vtkUnsignedCharArray::SafeDownCast(types) && cells)
+      {
+        ug->SetCells(vtkUnsignedCharArray::SafeDownCast(types), cells);
+      }
+    }
+    else if (auto id = vtkImageData::SafeDownCast(dobj))
+    {
+      int extent[6];
+      double origin[3], spacing[3], direction[9];
+      this->Stream >> extent[0] >> extent[1] >> extent[2] >> extent[3] >> extent[4] >> extent[5];
+      this->Stream >> origin[0] >> origin[1] >> origin[2];
+      this->Stream >> spacing[0] >> spacing[1] >> spacing[2];
+      for (int cc = 0; cc < 9; ++cc)
+      {
+        this->Stream >> direction[cc];
+      }
+      id->SetExtent(extent);
+      id->SetOrigin(origin);
+      id->SetSpacing(spacing);
+      id->SetDirectionMatrix(direction);
+    }
+    else if (auto rg = vtkRectilinearGrid::SafeDownCast(dobj))
+    {
+      int extent[6];
+      this->Stream >> extent[0] >> extent[1] >> extent[2] >> extent[3] >> extent[4] >> extent[5];
+      rg->SetExtent(extent);
+      rg->SetXCoordinates(this->DecodeArray());
+      rg->SetYCoordinates(this->DecodeArray());
+      rg->SetZCoordinates(this->DecodeArray());
+    }
+    else if (auto sg = vtkStructuredGrid::SafeDownCast(dobj))
+    {
+      int extent[6];
+      this->Stream >> extent[0] >> extent[1] >> extent[2] >> extent[3] >> extent[4] >> extent[5];
+      sg->SetExtent(extent);
+      sg->SetPoints(this->DecodePoints());
+    }
+    else if (auto mb = vtkMultiBlockDataSet::SafeDownCast(dobj))
+    {
+      unsigned int numBlocks = 0;
+      this->Stream >> numBlocks;
+      mb->SetNumberOfBlocks(numBlocks);
+      for (unsigned int cc = 0; cc < numBlocks && this->Valid; ++cc)
+      {
+        std::string name;
+        if (this->DecodeName(name))
+        {
+          mb->GetMetaData(cc)->Set(vtkCompositeDataSet::NAME(), name.c_str());
+        }
+        mb->SetBlock(cc, this->DecodeDataObject());
+      }
+    }
+    else if (auto ptd = vtkPartitionedDataSet::SafeDownCast(dobj))
+    {
+      unsigned int numPartitions = 0;
+      this->Stream >> numPartitions;
+      ptd->SetNumberOfPartitions(numPartitions);
+      for (unsigned int cc = 0; cc < numPartitions && this->Valid; ++cc)
+      {
+        ptd->SetPartition(cc, this->DecodeDataObject());
+      }
+    }
+    else if (auto pdc = vtkPartitionedDataSetCollection::SafeDownCast(dobj))
+    {
+      unsigned int numPartitionedDataSets = 0;
+      this->Stream >> numPartitionedDataSets;
+      pdc->SetNumberOfPartitionedDataSets(numPartitionedDataSets);
+      for (unsigned int cc = 0; cc < numPartitionedDataSets && this->Valid; ++cc)
+      {
+        std::string name;
+        if (this->DecodeName(name))
+        {
+          pdc->GetMetaData(cc)->Set(vtkCompositeDataSet::NAME(), name.c_str());
+        }
+        pdc->SetPartitionedDataSet(
+          cc, vtkPartitionedDataSet::SafeDownCast(this->DecodeDataObject()));
+      }
+      std::string assemblyXML;
+      if (this->DecodeName(assemblyXML))
+      {
+        vtkNew<vtkDataAssembly> assembly;
+        assembly->InitializeFromXML(assemblyXML.c_str());
+        pdc->SetDataAssembly(assembly);
+      }
+    }
+
+    if (auto ds = vtkDataSet::SafeDownCast(dobj))
+    {
+      this->DecodeFieldData(ds->GetPointData());
+      this->DecodeFieldData(ds->GetCellData());
+    }
+    this->DecodeFieldData(dobj->GetFieldData());
+    return this->Valid ? dobj : nullptr;
+  }
+
+  bool IsValid() const { return this->Valid; }
+
+private:
+  bool DecodeName(std::string& name)
+  {
+    int hasName = 0;
+    this->Stream >> hasName;
+    if (hasName)
+    {
+      this->Stream >> name;
+    }
+    return hasName != 0;
+  }
+
+  vtkSmartPointer<vtkDataArray> DecodeArray()
+  {
+    int isValid = 0;
+    this->Stream >> isValid;
+    if (!isValid || !this->Valid)
+    {
+      return nullptr;
+    }
+
+    std::string name;
+    const bool hasName = this->DecodeName(name);
+    int dataType = 0, numComponents = 0;
+    vtkTypeInt64 numTuples = 0;
+    this->Stream >> dataType >> numComponents >> numTuples;
+
+    auto array = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(dataType));
+    if (!array)
+    {
+      vtkGenericWarningMacro("Cannot create array of type " << dataType);
+      this->Valid = false;
+      return nullptr;
+    }
+    if (hasName)
+    {
+      array->SetName(name.c_str());
+    }
+    array->SetNumberOfComponents(numComponents);
+    array->SetNumberOfTuples(static_cast<vtkIdType>(numTuples));
+
+    const vtkIdType size = ::GetPayloadSize(array);
+    if (size > 0 && !this->Reader(array->GetVoidPointer(0), size))
+    {
+      vtkGenericWarningMacro("Failed to read array buffer (" << size << " bytes).");
+      this->Valid = false;
+      return nullptr;
+    }
+    return array;
+  }
+
+  vtkSmartPointer<vtkPoints> DecodePoints()
+  {
+    auto data = this->DecodeArray();
+    if (!data)
+    {
+      return nullptr;
+    }
+    vtkNew<vtkPoints> points;
+    points->SetData(data);
+    return points.Get();
+  }
+
+  vtkSmartPointer<vtkCellArray> DecodeCells()
+  {
+    auto offsets = this->DecodeArray();
+    auto connectivity = this->DecodeArray();
+    if (!offsets || !connectivity)
+    {
+      return nullptr;
+    }
+    vtkNew<vtkCellArray> cells;
+    if (!cells->SetData(offsets, connectivity))
+    {
+      vtkGenericWarningMacro("Invalid cell arrays.");
+      this->Valid = false;
+      return nullptr;
+    }
+    return cells.Get();
+  }
+
+  void DecodeFieldData(vtkFieldData* fd)
+  {
+    auto dsa = vtkDataSetAttributes::SafeDownCast(fd);
+    int numArrays = 0;
+    this->Stream >> numArrays;
+    for (int cc = 0; cc < numArrays && this->Valid; ++cc)
+    {
+      int attributeType = -1;
+      this->Stream >> attributeType;
+      if (auto array = this->DecodeArray())
+      {
+        const int idx = fd->AddArray(array);
+        if (dsa && attributeType >= 0)
+        {
+          dsa->SetActiveAttribute(idx, attributeType);
+        }
+      }
+    }
+  }
+
+  vtkMultiProcessStream& Stream;
+  const PayloadReader& Reader;
+  bool Valid = true;
+};
+
+vtkSmartPointer<vtkDataObject> DecodeHeader(
+  const char* header, vtkTypeInt64 headerLength, const PayloadReader& reader)
+{
+  vtkMultiProcessStream stream;
+  stream.SetRawData(reinterpret_cast<const unsigned char*>(header + PreambleSize),
+    static_cast<unsigned int>(headerLength));
+  Decoder decoder(stream, reader);
+  return decoder.DecodeDataObject();
+}
+}
+
+//----------------------------------------------------------------------------
+// Encoding.
+//----------------------------------------------------------------------------
+class vtkPVDataObjectMarshaller::vtkInternals
+{
+public:
+  std::vector<unsigned char> Header;
+  std::vector<vtkSmartPointer<vtkDataArray>> Payloads;
+
+  bool EncodeDataObject(vtkMultiProcessStream& stream, vtkDataObject* dobj)
+  {
+    if (dobj == nullptr)
+    {
+      stream << -1;
+      return true;
+    }
+
+    stream << dobj->GetDataObjectType();
+    bool status = true;
+    if (auto pd = vtkPolyData::SafeDownCast(dobj))
+    {
+      status = this->EncodePoints(stream, pd->GetPoints()) &&
+        this->EncodeCells(stream, pd->GetVerts()) && this->EncodeCells(stream, pd->GetLines()) &&
+        this->EncodeCells(stream, pd->GetPolys()) && this->EncodeCells(stream, pd->GetStrips());
+    }
+    else if (auto ug = vtkUnstructuredGrid::SafeDownCast(dobj))
+    {
+      vtkUnsignedCharArray* types = ug->GetCellTypesArray();
+      if (types)
+      {
+        // polyhedral cells need the face streams, let the legacy path handle them.
+        const unsigned char* begin = types->GetPointer(0);
+        const unsigned char* end = begin + types->GetNumberOfValues();
+        if (std::find(begin, end, static_cast<unsigned char>(VTK_POLYHEDRON)) != end)
+        {
+          return false;
+        }
+      }
+      status = this->EncodePoints(stream, ug->GetPoints()) && this->EncodeArray(stream, types) &&
+        this->EncodeCells(stream, ug->GetCells());
+    }
+    else if (auto id = vtkImageData::SafeDownCast(dobj))
+    {
+      const int* extent = id->GetExtent();
+      const double* origin = id->GetOrigin();
+      const double* spacing = id->GetSpacing();
+      const double* direction = id->GetDirectionMatrix()->GetData();
+      stream << extent[0] << extent[1] << extent[2] << extent[3] << extent[4] << extent[5];
+      stream << origin[0] << origin[1] << origin[2];
+      stream << spacing[0] << spacing[1] << spacing[2];
+      for (int cc = 0; cc < 9; ++cc)
+      {
+        stream << direction[cc];
+      }
+    }
+    else if (auto rg = vtkRectilinearGrid::SafeDownCast(dobj))
+    {
+      const int* extent = rg->GetExtent();
+      stream << extent[0] << extent[1] << extent[2] << extent[3] << extent[4] << extent[5];
+      status = this->EncodeArray(stream, rg->GetXCoordinates()) &&
+        this->EncodeArray(stream, rg->GetYCoordinates()) &&
+        this->EncodeArray(stream, rg->GetZCoordinates());
+    }
+    else if (auto sg = vtkStructuredGrid::SafeDownCast(dobj))
+    {
+      const int* extent = sg->GetExtent();
+      stream << extent[0] << extent[1] << extent[2] << extent[3] << extent[4] << extent[5];
+      status = this->EncodePoints(stream, sg->GetPoints());
+    }
+    else if (auto mb = vtkMultiBlockDataSet::SafeDownCast(dobj))
+    {
+      const unsigned int numBlocks = mb->GetNumberOfBlocks();
+      stream << numBlocks;
+      for (unsigned int cc = 0; cc < numBlocks && status; ++cc)
+      {
+        this->EncodeName(stream, mb->HasMetaData(cc) ? mb->GetMetaData(cc) : nullptr);
+        status = this->EncodeDataObject(stream, mb->GetBlock(cc));
+      }
+    }
+    else if (auto ptd = vtkPartitionedDataSet::SafeDownCast(dobj))
+    {
+      const unsigned int numPartitions = ptd->GetNumberOfPartitions();
+      stream << numPartitions;
+      for (unsigned int cc = 0; cc < numPartitions && status; ++cc)
+      {
+        status = this->EncodeDataObject(stream, ptd->GetPartitionAsDataObject(cc));
+      }
+    }
+    else if (auto pdc = vtkPartitionedDataSetCollection::SafeDownCast(dobj))
+    {
+      const unsigned int numPartitionedDataSets = pdc->GetNumberOfPartitionedDataSets();
+      stream << numPartitionedDataSets;
+      for (unsigned int cc = 0; cc < numPartitionedDataSets && status; ++cc)
+      {
+        this->EncodeName(stream, pdc->HasMetaData(cc) ? pdc->GetMetaData(cc) : nullptr);
+        status = this->EncodeDataObject(stream, pdc->GetPartitionedDataSet(cc));
+      }
+      if (auto assembly = pdc->GetDataAssembly())
+      {
+        stream << 1 << assembly->SerializeToXML(vtkIndent());
+      }
+      else
+      {
+        stream << 0;
+      }
+    }
+    else
+    {
+      // unsupported type, e.g. AMR, hyper-tree grids, tables, graphs.
+      return false;
+    }
+
+    if (status)
+    {
+      if (auto ds = vtkDataSet::SafeDownCast(dobj))
+      {
+        status = this->EncodeFieldData(stream, ds->GetPointData()) &&
+          this->EncodeFieldData(stream, ds->GetCellData());
+      }
+    }
+    return status && this->EncodeFieldData(stream, dobj->GetFieldData());
+  }
+
+private:
+  void EncodeName(vtkMultiProcessStream& stream, vtkInformation* metadata)
+  {
+    if (metadata && metadata->Has(vtkCompositeDataSet::NAME()))
+    {
+      stream << 1 << std::string(metadata->Get(vtkCompositeDataSet::NAME()));
+    }
+    else
+    {
+      stream << 0;
+    }
+  }
+
+  bool EncodeArray(vtkMultiProcessStream& stream, vtkAbstractArray* abstractArray)
+  {
+    if (abstractArray == nullptr)
+    {
+      stream << 0;
+      return true;
+    }
+
+    vtkSmartPointer<vtkDataArray> array = vtkDataArray::SafeDownCast(abstractArray);
+    if (!array)
+    {
+      // string and variant arrays are left to the legacy path.
+      return false;
+    }
+    if (!array->HasStandardMemoryLayout())
+    {
+      // SOA or implicit arrays: flatten to the AOS layout the receiver allocates.
+      auto aos = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(array->GetDataType()));
+      aos->DeepCopy(array);
+      array = aos;
+    }
+
+    stream << 1;
+    if (const char* name = array->GetName())
+    {
+      stream << 1 << std::string(name);
+    }
+    else
+    {
+      stream << 0;
+    }
+    stream << array->GetDataType() << array->GetNumberOfComponents()
+           << static_cast<vtkTypeInt64>(array->GetNumberOfTuples());
+    this->Payloads.push_back(array);
+    return true;
+  }
+
+  bool EncodePoints(vtkMultiProcessStream& stream, vtkPoints* points)
+  {
+    return this->EncodeArray(stream, points ? points->GetData() : nullptr);
+  }
+
+  bool EncodeCells(vtkMultiProcessStream& stream, vtkCellArray* cells)
+  {
+    if (cells == nullptr)
+    {
+      stream << 0 << 0;
+      return true;
+    }
+    return this->EncodeArray(stream, cells->GetOffsetsArray()) &&
+      this->EncodeArray(stream, cells->GetConnectivityArray());
+  }
+
+  bool EncodeFieldData(vtkMultiProcessStream& stream, vtkFieldData* fd)
+  {
+    auto dsa = vtkDataSetAttributes::SafeDownCast(fd);
+    const int numArrays = fd ? fd->GetNumberOfArrays() : 0;
+    stream << numArrays;
+    for (int cc = 0; cc < numArrays; ++cc)
+    {
+      stream << (dsa ? dsa->IsArrayAnAttribute(cc) : -1);
+      if (!this->EncodeArray(stream, fd->GetAbstractArray(cc)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+vtkStandardNewMacro(vtkPVDataObjectMarshaller);
+//----------------------------------------------------------------------------
+vtkPVDataObjectMarshaller::vtkPVDataObjectMarshaller()
+  : Internals(new vtkPVDataObjectMarshaller::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVDataObjectMarshaller::~vtkPVDataObjectMarshaller() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVDataObjectMarshaller::Reset()
+{
+  auto& internals = (*this->Internals);
+  internals.Header.clear();
+  internals.Payloads.clear();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataObjectMarshaller::Marshal(vtkDataObject* dobj)
+{
+  this->Reset();
+
+  auto& internals = (*this->Internals);
+  vtkMultiProcessStream stream;
+  if (!internals.EncodeDataObject(stream, dobj))
+  {
+    vtkDebugMacro("Data object not supported by binary marshalling.");
+    this->Reset();
+    return false;
+  }
+
+  std::vector<unsigned char> raw;
+  stream.GetRawData(raw);
+
+  const vtkTypeInt64 headerLength = static_cast<vtkTypeInt64>(raw.size());
+  internals.Header.resize(PreambleSize + raw.size(), 0);
+  memcpy(internals.Header.data(), MarshalMagic, sizeof(MarshalMagic));
+  internals.Header[4] = MarshalVersion;
+  internals.Header[5] = static_cast<unsigned char>(sizeof(vtkIdType));
+  memcpy(internals.Header.data() + 8, &headerLength, sizeof(headerLength));
+  std::copy(raw.begin(), raw.end(), internals.Header.begin() + PreambleSize);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkPVDataObjectMarshaller::GetMarshalledSize() const
+{
+  const auto& internals = (*this->Internals);
+  vtkIdType size = static_cast<vtkIdType>(internals.Header.size());
+  for (const auto& array : internals.Payloads)
+  {
+    size += ::GetPayloadSize(array);
+  }
+  return size;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVDataObjectMarshaller::GetNumberOfPayloads() const
+{
+  return static_cast<int>(this->Internals->Payloads.size());
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataObjectMarshaller::CopyToBuffer(char* buffer) const
+{
+  const auto& internals = (*this->Internals);
+  memcpy(buffer, internals.Header.data(), internals.Header.size());
+  buffer += internals.Header.size();
+  for (const auto& array : internals.Payloads)
+  {
+    const vtkIdType size = ::GetPayloadSize(array);
+    if (size > 0)
+    {
+      memcpy(buffer, array->GetVoidPointer(0), size);
+      buffer += size;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataObjectMarshaller::Send(vtkCommunicator* comm, int remoteHandle, int tag) const
+{
+  const auto& internals = (*this->Internals);
+  if (comm == nullptr || internals.Header.empty())
+  {
+    return false;
+  }
+
+  vtkIdType headerSize = static_cast<vtkIdType>(internals.Header.size());
+  if (!comm->Send(&headerSize, 1, remoteHandle, tag) ||
+    !comm->Send(
+      reinterpret_cast<const char*>(internals.Header.data()), headerSize, remoteHandle, tag))
+  {
+    return false;
+  }
+
+  for (const auto& array : internals.Payloads)
+  {
+    const vtkIdType size = ::GetPayloadSize(array);
+    if (size > 0 &&
+      !comm->Send(static_cast<const char*>(array->GetVoidPointer(0)), size, remoteHandle, tag))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkPVDataObjectMarshaller::Receive(
+  vtkCommunicator* comm, int remoteHandle, int tag)
+{
+  vtkIdType headerSize = 0;
+  if (comm == nullptr || !comm->Receive(&headerSize, 1, remoteHandle, tag) ||
+    headerSize < PreambleSize)
+  {
+    return nullptr;
+  }
+
+  std::vector<char> header(headerSize);
+  vtkTypeInt64 headerLength = 0;
+  if (!comm->Receive(header.data(), headerSize, remoteHandle, tag) ||
+    !::ReadPreamble(header.data(), headerSize, headerLength))
+  {
+    vtkGenericWarningMacro("Invalid binary marshalling header.");
+    return nullptr;
+  }
+
+  PayloadReader reader = [&](void* dest, vtkIdType size) {
+    return comm->Receive(static_cast<char*>(dest), size, remoteHandle, tag) != 0;
+  };
+  return ::DecodeHeader(header.data(), headerLength, reader);
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataObjectMarshaller::IsMarshalledBuffer(const char* buffer, vtkIdType length)
+{
+  return buffer != nullptr && length >= PreambleSize &&
+    strncmp(buffer, MarshalMagic, sizeof(MarshalMagic)) == 0;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkPVDataObjectMarshaller::Unmarshal(
+  const char* buffer, vtkIdType length)
+{
+  vtkTypeInt64 headerLength = 0;
+  if (!::ReadPreamble(buffer, length, headerLength))
+  {
+    vtkGenericWarningMacro("Invalid binary marshalling header.");
+    return nullptr;
+  }
+
+  vtkIdType offset = PreambleSize + headerLength;
+  PayloadReader reader = [&](void* dest, vtkIdType size) {
+    if (offset + size > length)
+    {
+      return false;
+    }
+    memcpy(dest, buffer + offset, size);
+    offset += size;
+    return true;
+  };
+  return ::DecodeHeader(buffer, headerLength, reader);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataObjectMarshaller::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "HeaderSize: " << this->Internals->Header.size() << endl;
+  os << indent << "NumberOfPayloads: " << this->GetNumberOfPayloads() << endl;
+  os << indent << "MarshalledSize: " << this->GetMarshalledSize() << endl;
+}
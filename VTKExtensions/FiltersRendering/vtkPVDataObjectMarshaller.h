@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPVDataObjectMarshaller
+ * @brief   binary, array-level marshalling of data objects.
+ *
+ * vtkPVDataObjectMarshaller serializes a data object as a small header
+ * describing its structure (type, extents, array names, types and sizes,
+ * composite hierarchy) followed by the raw buffers of each of its arrays.
+ * Unlike the legacy writer based marshalling used by
+ * `vtkCommunicator::MarshalDataObject`, arrays are never converted to an
+ * intermediate string: `Send` transmits the header and then each array buffer
+ * directly from the array memory, while `Receive` allocates the arrays once the
+ * header is known and receives directly into them.
+ *
+ * Supported types are vtkPolyData, vtkUnstructuredGrid (without polyhedral
+ * cells), vtkImageData (and subclasses), vtkRectilinearGrid, vtkStructuredGrid,
+ * vtkMultiBlockDataSet, vtkPartitionedDataSet and
+ * vtkPartitionedDataSetCollection, with arrays that are vtkDataArray
+ * subclasses. `Marshal` returns false for anything else so that callers can
+ * fall back to the legacy path.
+ *
+ * The binary representation is only meant to be exchanged between processes
+ * of the same ParaView build; it is not a file format.
+ */
+
+#ifndef vtkPVDataObjectMarshaller_h
+#define vtkPVDataObjectMarshaller_h
+
+#include "vtkObject.h"
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
+#include "vtkSmartPointer.h"                          // for vtkSmartPointer
+
+#include <memory> // for std::unique_ptr
+
+class vtkCommunicator;
+class vtkDataObject;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkPVDataObjectMarshaller : public vtkObject
+{
+public:
+  static vtkPVDataObjectMarshaller* New();
+  vtkTypeMacro(vtkPVDataObjectMarshaller, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Builds the header for `dobj` and keeps references to the arrays to
+   * transmit. Arrays are not copied, unless they do not use the standard
+   * contiguous memory layout. Returns false if `dobj` (or one of its blocks or
+   * arrays) is not supported, in which case the marshaller is left empty.
+   */
+  bool Marshal(vtkDataObject* dobj);
+
+  /**
+   * Releases the header and the references to the arrays.
+   */
+  void Reset();
+
+  /**
+   * Returns the number of bytes needed by `CopyToBuffer`, i.e. the size of the
+   * header plus the size of all the array buffers. Returns 0 if nothing has
+   * been marshalled.
+   */
+  vtkIdType GetMarshalledSize() const;
+
+  /**
+   * Returns the number of array buffers referenced by the marshaller.
+   */
+  int GetNumberOfPayloads() const;
+
+  /**
+   * Writes the contiguous representation of the marshalled data object into
+   * `buffer` which must be at least `GetMarshalledSize()` bytes long. This is
+   * needed for collective operations (gather, broadcast) that require a single
+   * buffer.
+   */
+  void CopyToBuffer(char* buffer) const;
+
+  /**
+   * Sends the marshalled data object to `remoteHandle` with one message for
+   * the header followed by one message per non-empty array buffer. Each buffer
+   * is sent directly from the array memory.
+   */
+  bool Send(vtkCommunicator* comm, int remoteHandle, int tag) const;
+
+  /**
+   * Receives a data object sent using `Send`. Arrays are allocated from the
+   * header and receive their buffer directly. Returns nullptr on error.
+   */
+  static vtkSmartPointer<vtkDataObject> Receive(vtkCommunicator* comm, int remoteHandle, int tag);
+
+  /**
+   * Returns true if `buffer` starts with the header written by `CopyToBuffer`.
+   */
+  static bool IsMarshalledBuffer(const char* buffer, vtkIdType length);
+
+  /**
+   * Reconstructs a data object from a buffer filled by `CopyToBuffer`.
+   * Returns nullptr on error.
+   */
+  static vtkSmartPointer<vtkDataObject> Unmarshal(const char* buffer, vtkIdType length);
+
+protected:
+  vtkPVDataObjectMarshaller();
+  ~vtkPVDataObjectMarshaller() override;
+
+private:
+  vtkPVDataObjectMarshaller(const vtkPVDataObjectMarshaller&) = delete;
+  void operator=(const vtkPVDataObjectMarshaller&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
@@ -49,6 +49,8 @@
 #include "vtkRecoverGeometryWireframe.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridOutlineFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
@@ -61,11 +63,13 @@
 #include "vtkUnstructuredGridGeometryFilter.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace details
@@ -837,6 +841,104 @@ vtkSmartPointer<vtkDataObjectTree> vtkPVGeometryFilter::GetDataObjectTreeInput(
   return tempInput;
 }
 
+//----------------------------------------------------------------------------
+// Functor used to extract the surface of several leaves concurrently. Internal
+// filters are not thread-safe, hence each thread uses its own
+// vtkPVGeometryFilter configured like the filter being executed.
+class vtkPVGeometryFilter::ExecuteLeavesFunctor
+{
+public:
+  ExecuteLeavesFunctor(vtkPVGeometryFilter* self, const std::vector<vtkDataObject*>& leaves,
+    const std::vector<bool>& concurrent, std::vector<vtkSmartPointer<vtkPolyData>>& outputs,
+    const int* wholeExtent, std::atomic<unsigned int>& numberOfDoneLeaves)
+    : Self(self)
+    , Leaves(leaves)
+    , Concurrent(concurrent)
+    , Outputs(outputs)
+    , WholeExtent(wholeExtent)
+    , NumberOfDoneLeaves(numberOfDoneLeaves)
+  {
+  }
+
+  void Initialize()
+  {
+    auto& worker = this->Workers.Local();
+    worker = vtk::TakeSmartPointer(vtkPVGeometryFilter::New());
+    this->Self->CopyExecutionSettings(worker);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkPVGeometryFilter* worker = this->Workers.Local();
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      if (!this->Concurrent[cc] || this->Self->GetAbortExecute())
+      {
+        continue;
+      }
+      vtkNew<vtkPolyData> leafOutput;
+      worker->ExecuteLeaf(this->Leaves[cc], leafOutput, this->WholeExtent);
+      this->Outputs[cc] = leafOutput;
+
+      const unsigned int numberOfDoneLeaves = ++this->NumberOfDoneLeaves;
+      if (isFirst)
+      {
+        this->Self->UpdateProgress(
+          static_cast<double>(numberOfDoneLeaves) / this->Leaves.size());
+      }
+    }
+  }
+
+  void Reduce() {}
+
+private:
+  vtkPVGeometryFilter* Self;
+  const std::vector<vtkDataObject*>& Leaves;
+  const std::vector<bool>& Concurrent;
+  std::vector<vtkSmartPointer<vtkPolyData>>& Outputs;
+  const int* WholeExtent;
+  std::atomic<unsigned int>& NumberOfDoneLeaves;
+  vtkSMPThreadLocal<vtkSmartPointer<vtkPVGeometryFilter>> Workers;
+};
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::CopyExecutionSettings(vtkPVGeometryFilter* worker)
+{
+  worker->SetController(this->Controller);
+  worker->UseOutline = this->UseOutline;
+  worker->Triangulate = this->Triangulate;
+  worker->GenerateProcessIds = this->GenerateProcessIds;
+  worker->HideInternalAMRFaces = this->HideInternalAMRFaces;
+  worker->UseNonOverlappingAMRMetaDataForOutlines = this->UseNonOverlappingAMRMetaDataForOutlines;
+  // use the setters for the settings forwarded to the internal filters.
+  worker->SetGenerateFeatureEdges(this->GenerateFeatureEdges);
+  worker->SetGenerateCellNormals(this->GenerateCellNormals);
+  worker->SetGeneratePointNormals(this->GeneratePointNormals);
+  worker->SetSplitting(this->Splitting);
+  worker->SetFeatureAngle(this->FeatureAngle);
+  worker->SetPassThroughCellIds(this->PassThroughCellIds);
+  worker->SetPassThroughPointIds(this->PassThroughPointIds);
+  worker->SetNonlinearSubdivisionLevel(this->NonlinearSubdivisionLevel);
+  worker->SetMatchBoundariesIgnoringCellOrder(this->MatchBoundariesIgnoringCellOrder);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeometryFilter::ExecuteLeaf(
+  vtkDataObject* input, vtkPolyData* output, const int* wholeExtent)
+{
+  auto inputHTG = vtkHyperTreeGrid::SafeDownCast(input);
+  if (this->GenerateFeatureEdges && inputHTG)
+  {
+    this->GenerateFeatureEdgesHTG(inputHTG, output);
+  }
+  else
+  {
+    this->ExecuteBlock(input, output, 0, 0, 1, 0, wholeExtent);
+    this->CleanupOutputData(output);
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkPVGeometryFilter::RequestDataObjectTree(
   vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -865,42 +967,72 @@ int vtkPVGeometryFilter::RequestDataObjectTree(
   inIter->VisitOnlyLeavesOn();
   inIter->SkipEmptyNodesOn();
 
-  // get a block count for progress scaling.
-  unsigned int totalNumberOfBlocks = 0;
+  std::vector<vtkDataObject*> leaves;
   for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
   {
-    ++totalNumberOfBlocks;
+    leaves.push_back(inIter->GetCurrentDataObject());
   }
+  const unsigned int totalNumberOfBlocks = static_cast<unsigned int>(leaves.size());
 
-  int* wholeExtent =
-    vtkStreamingDemandDrivenPipeline::GetWholeExtent(inputVector[0]->GetInformationObject(0));
-  int numInputs = 0;
-  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
+  // Leaves are processed concurrently only if they are datasets referenced
+  // once in the tree: the internal filters may build links or cells on their
+  // input, which must not happen from two threads for the same object.
+  std::vector<bool> concurrent(leaves.size(), false);
+  if (this->ProcessBlocksInParallel && leaves.size() > 1)
   {
-    vtkDataObject* block = inIter->GetCurrentDataObject();
-    if (!block)
+    std::unordered_set<vtkDataObject*> seen;
+    std::unordered_set<vtkDataObject*> duplicates;
+    for (auto leaf : leaves)
     {
-      continue;
+      if (leaf && !seen.insert(leaf).second)
+      {
+        duplicates.insert(leaf);
+      }
     }
-
-    vtkNew<vtkPolyData> tmpOut;
-    auto blockHTG = vtkHyperTreeGrid::SafeDownCast(block);
-    if (this->GenerateFeatureEdges && blockHTG)
+    for (size_t cc = 0; cc < leaves.size(); ++cc)
     {
-      this->GenerateFeatureEdgesHTG(blockHTG, tmpOut);
+      auto ds = vtkDataSet::SafeDownCast(leaves[cc]);
+      concurrent[cc] = ds != nullptr && duplicates.find(ds) == duplicates.end();
+      if (concurrent[cc])
+      {
+        // compute the bounds now since blocks may share their points.
+        double bounds[6];
+        ds->GetBounds(bounds);
+      }
     }
-    else
+  }
+
+  int* wholeExtent =
+    vtkStreamingDemandDrivenPipeline::GetWholeExtent(inputVector[0]->GetInformationObject(0));
+  std::vector<vtkSmartPointer<vtkPolyData>> leafOutputs(leaves.size());
+  std::atomic<unsigned int> numInputs(0);
+  if (std::find(concurrent.begin(), concurrent.end(), true) != concurrent.end())
+  {
+    ExecuteLeavesFunctor functor(this, leaves, concurrent, leafOutputs, wholeExtent, numInputs);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(leaves.size()), 1, functor);
+  }
+  for (size_t cc = 0; cc < leaves.size(); ++cc)
+  {
+    if (!leaves[cc] || concurrent[cc])
     {
-      this->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, wholeExtent);
-      this->CleanupOutputData(tmpOut);
+      continue;
     }
+    leafOutputs[cc] = vtkSmartPointer<vtkPolyData>::New();
+    this->ExecuteLeaf(leaves[cc], leafOutputs[cc], wholeExtent);
+    this->UpdateProgress(static_cast<float>(++numInputs) / totalNumberOfBlocks);
+  }
+
+  // assemble the output in the input order.
+  size_t leafIdx = 0;
+  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem(), ++leafIdx)
+  {
+    vtkPolyData* tmpOut = leafOutputs[leafIdx];
     // skip empty nodes.
-    if (tmpOut->GetNumberOfPoints() > 0)
+    if (tmpOut && tmpOut->GetNumberOfPoints() > 0)
     {
       output->SetDataSet(inIter, tmpOut);
       this->AddCompositeIndex(tmpOut, inIter->GetCurrentFlatIndex());
     }
-    this->UpdateProgress(static_cast<float>(++numInputs) / totalNumberOfBlocks);
   }
   vtkTimerLog::MarkEndEvent("vtkPVGeometryFilter::ExecuteCompositeDataSet");
 
@@ -1721,6 +1853,8 @@ void vtkPVGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "HideInternalAMRFaces: " << (this->HideInternalAMRFaces ? "on" : "off") << endl;
   os << indent << "UseNonOverlappingAMRMetaDataForOutlines: "
      << (this->UseNonOverlappingAMRMetaDataForOutlines ? "on" : "off") << endl;
+  os << indent << "ProcessBlocksInParallel: " << (this->ProcessBlocksInParallel ? "on" : "off")
+     << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -228,6 +228,21 @@ public:
   vtkBooleanMacro(UseNonOverlappingAMRMetaDataForOutlines, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set, the leaves of a composite dataset (other than AMR) are processed
+   * concurrently using vtkSMPTools. Each thread uses its own set of internal
+   * filters and the results are assembled in the original leaf order, so the
+   * output is identical to the one produced when processing the leaves
+   * serially. Leaves that share their points or arrays with other leaves must
+   * not be processed concurrently, since the internal filters may modify them,
+   * hence this is only safe when the blocks own their data. Default is false.
+   */
+  vtkSetMacro(ProcessBlocksInParallel, bool);
+  vtkGetMacro(ProcessBlocksInParallel, bool);
+  vtkBooleanMacro(ProcessBlocksInParallel, bool);
+  ///@}
+
   // These keys are put in the output composite-data metadata for multipieces
   // since this filter merges multipieces together.
   PARAVIEW_DEPRECATED_IN_5_13_0("They are not used anymore.")
@@ -354,6 +369,7 @@ protected:
   bool HideInternalAMRFaces;
   bool UseNonOverlappingAMRMetaDataForOutlines;
   bool GenerateFeatureEdges;
+  bool ProcessBlocksInParallel = false;
 
 private:
   vtkPVGeometryFilter(const vtkPVGeometryFilter&) = delete;
@@ -372,6 +388,20 @@ private:
   class BoundsReductionOperation;
   ///@}
 
+  /**
+   * Extracts the surface of a single leaf of a composite dataset, without
+   * communicating with other processes.
+   */
+  void ExecuteLeaf(vtkDataObject* input, vtkPolyData* output, const int* wholeExtent);
+
+  /**
+   * Copies the settings affecting the surface extraction to `worker`, which is
+   * used to process leaves on another thread.
+   */
+  void CopyExecutionSettings(vtkPVGeometryFilter* worker);
+
+  class ExecuteLeavesFunctor;
+
   /**
    * Generate feature edges for the input hyper tree grid.
    * We need this dedicated function because generating feature edges
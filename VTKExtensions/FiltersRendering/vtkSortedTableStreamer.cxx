@@ -3,14 +3,17 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkSortedTableStreamer.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellArray.h"
 #include "vtkCommunicator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkDataTabulator.h"
 #include "vtkDoubleArray.h"
 #include "vtkExtractSelection.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -18,14 +21,22 @@
 #include "vtkMath.h"
 #include "vtkMinimalStandardRandomSequence.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
+#include "vtkTypeUInt64Array.h"
 #include "vtkUnsignedIntArray.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <map>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -177,6 +188,79 @@ public:
       }
     }
   }
+  // --------------------------------------------------------------------------
+  void DecorateTable(vtkTable* input, vtkTable* output, int mergePid)
+  {
+    // Check if it is a structured grid
+    if (input->GetFieldData()->GetArray("STRUCTURED_DIMENSIONS"))
+    {
+      int localDimensions[3] = { 0, 0, 0 };
+      int* dimensions = new int[3 * this->NumProcs];
+      vtkIntArray::SafeDownCast(input->GetFieldData()->GetArray("STRUCTURED_DIMENSIONS"))
+        ->GetTypedTuple(0, localDimensions);
+
+      this->MPI->Gather(localDimensions, dimensions, 3, mergePid);
+
+      if (output)
+      {
+        vtkIdTypeArray* structuredIndices = vtkIdTypeArray::New();
+        structuredIndices->SetNumberOfComponents(3);
+        structuredIndices->Allocate(output->GetNumberOfRows() * 3);
+        structuredIndices->SetName("Structured Coordinates");
+
+        vtkIdTypeArray* idsArray =
+          vtkIdTypeArray::SafeDownCast(output->GetColumnByName("vtkOriginalIndices"));
+        vtkIdTypeArray* pidsArray =
+          vtkIdTypeArray::SafeDownCast(output->GetColumnByName("vtkOriginalProcessIds"));
+
+        for (vtkIdType idx = 0; idx < output->GetNumberOfRows(); idx++)
+        {
+          vtkIdType id = idsArray->GetValue(idx);
+          vtkIdType pid = pidsArray ? pidsArray->GetValue(idx) : 0;
+
+          //          if(pid < 0 || pid >= this->NumProcs)
+          //            {
+          //            cout << "Error invalid pid " << pid << " at idx " << idx << " mergePid " <<
+          //            mergePid << " me " << this->Me << endl;
+          //            WaitForGDB();
+          //            }
+
+          structuredIndices->InsertNextTuple3((id % dimensions[3 * pid]),
+            (id / dimensions[3 * pid]) % dimensions[3 * pid + 1],
+            (id / static_cast<double>((dimensions[3 * pid] * dimensions[3 * pid + 1]))));
+        }
+        output->GetRowData()->AddArray(structuredIndices);
+        structuredIndices->FastDelete();
+      }
+      delete[] dimensions;
+    }
+  }
+  // --------------------------------------------------------------------------
+  int GetMergingProcessId(vtkTable* localTable)
+  {
+    if (this->NumProcs == 1)
+      return 0;
+    vtkIdType* tableSizes = new vtkIdType[this->NumProcs];
+    vtkIdType localTableSize = localTable ? localTable->GetNumberOfRows() : 0;
+    this->MPI->AllGather(&localTableSize, tableSizes, 1);
+    vtkIdType maxSize = 0;
+    int winner = 0;
+    for (int pid = 0; pid < this->NumProcs; pid++)
+    {
+      if (maxSize < tableSizes[pid])
+      {
+        maxSize = tableSizes[pid];
+        winner = pid;
+      }
+    }
+    delete[] tableSizes;
+    return winner;
+  }
+  // --------------------------------------------------------------------------
+protected:
+  int Me = 0;                     // Current process ID
+  int NumProcs = 1;               // Number of processes involved
+  vtkCommunicator* MPI = nullptr; // MPI communicator to send/receive/gather
 };
 //----------------------------------------------------------------------------
 template <class T>
@@ -629,6 +713,13 @@ public:
   // --------------------------------------------------------------------------
   bool IsSortable() override
   {
+    // The answer only depends on the data to sort and the selected component,
+    // so it is kept until the cache is invalidated.
+    if (this->Sortable >= 0)
+    {
+      return this->Sortable == 1;
+    }
+
     // See if one process is able to sort the table,
     // if not then just say NOT sortable
     int localCanSort = (this->DataToSort == nullptr) ? 0 : 1;
@@ -636,6 +727,7 @@ public:
     this->MPI->AllReduce(&localCanSort, &globalCanSort, 1, vtkCommunicator::MAX_OP);
     if (globalCanSort == 0)
     {
+      this->Sortable = 0;
       return false;
     }
 
@@ -690,6 +782,7 @@ public:
     this->CommonRange[0] -= epsilon;
     this->CommonRange[1] += epsilon;
 
+    this->Sortable = sortable ? 1 : 0;
     return sortable;
   }
 
@@ -698,6 +791,7 @@ public:
   {
     // We are building the cache so no need to build it next time
     this->NeedToBuildCache = false;
+    this->PageBoundaries.clear();
 
     // Communication buffer
     vtkIdType* bufferHistogramValues = new vtkIdType[this->NumProcs * HISTOGRAM_SIZE];
@@ -900,29 +994,69 @@ public:
     }
 
     // ------------------------------------------------------------------------
-    // Search for lower bound
+    // In serial the local sorted array is the global one
     // ------------------------------------------------------------------------
+    const vtkIdType first = block * blockSize;
+    if (this->NumProcs == 1)
+    {
+      vtkSmartPointer<vtkTable> subset;
+      subset.TakeReference(this->NewSubsetTable(input, this->LocalSorter, first, blockSize));
+      this->DecorateTable(input, subset.GetPointer(), 0);
+      output->ShallowCopy(subset.GetPointer());
+      return 1;
+    }
+
+    const vtkIdType last = vtkMath::Min(this->GlobalHistogram->TotalValues, first + blockSize);
+    const auto lowerBoundary =
+      first < last ? this->PageBoundaries.find(first) : this->PageBoundaries.end();
+    const auto upperBoundary =
+      first < last ? this->PageBoundaries.find(last) : this->PageBoundaries.end();
+    bool trimFromTail = false;
+
     vtkIdType nbElementsToRemoveFromHead = 0;
     vtkIdType localOffset = 0;
-    vtkIdType nbElementsInBar = 0;
-    this->SearchGlobalIndexLocation((block * blockSize), this->LocalSorter->Histo,
-      this->GlobalHistogram, nbElementsToRemoveFromHead, localOffset, nbElementsInBar);
+    vtkIdType localSize = 0;
+    if (lowerBoundary != this->PageBoundaries.end())
+    {
+      // ----------------------------------------------------------------------
+      // Lower bound known from a previous request: the block is within the
+      // next (last - first) local elements of each process.
+      // ----------------------------------------------------------------------
+      localOffset = lowerBoundary->second;
+      localSize = last - first;
+    }
+    else if (upperBoundary != this->PageBoundaries.end())
+    {
+      // ----------------------------------------------------------------------
+      // Upper bound known from a previous request: the block is within the
+      // previous (last - first) local elements of each process.
+      // ----------------------------------------------------------------------
+      localOffset = vtkMath::Max(static_cast<vtkIdType>(0), upperBoundary->second - (last - first));
+      localSize = upperBoundary->second - localOffset;
+      trimFromTail = true;
+    }
+    else
+    {
+      // ----------------------------------------------------------------------
+      // Search for lower bound
+      // ----------------------------------------------------------------------
+      vtkIdType nbElementsInBar = 0;
+      this->SearchGlobalIndexLocation(first, this->LocalSorter->Histo, this->GlobalHistogram,
+        nbElementsToRemoveFromHead, localOffset, nbElementsInBar);
 
-    // ------------------------------------------------------------------------
-    // Search for upper bound
-    // ------------------------------------------------------------------------
-    vtkIdType upperOffset = 0;
-    vtkIdType globalUpperOffset = 0;
-    vtkIdType searchIdx = (this->GlobalHistogram->TotalValues < (block + 1) * blockSize)
-      ? this->GlobalHistogram->TotalValues
-      : ((block + 1) * blockSize);
-    searchIdx--; // It is not a size it is an index (so -1)
+      // ----------------------------------------------------------------------
+      // Search for upper bound
+      // ----------------------------------------------------------------------
+      vtkIdType upperOffset = 0;
+      vtkIdType globalUpperOffset = 0;
+      vtkIdType searchIdx = last - 1; // It is not a size it is an index (so -1)
 
-    this->SearchGlobalIndexLocation(searchIdx, this->LocalSorter->Histo, this->GlobalHistogram,
-      globalUpperOffset, upperOffset, nbElementsInBar);
+      this->SearchGlobalIndexLocation(searchIdx, this->LocalSorter->Histo, this->GlobalHistogram,
+        globalUpperOffset, upperOffset, nbElementsInBar);
 
-    // We have to include our searched index (so +1)
-    vtkIdType localSize = (upperOffset + nbElementsInBar) - localOffset + 1;
+      // We have to include our searched index (so +1)
+      localSize = (upperOffset + nbElementsInBar) - localOffset + 1;
+    }
 
     // ------------------------------------------------------------------------
     // Build local subset table
@@ -976,10 +1110,13 @@ public:
       }
 
       // Sort new table/array
+      std::vector<vtkIdType> boundaries(2 * this->NumProcs + 1, 0);
       if (!this->DataToSort)
       {
         // This mean that no output can be provided
         // cout << "ERROR the merge process have no DataArray." << endl;
+        this->MPI->Broadcast(
+          boundaries.data(), static_cast<vtkIdType>(boundaries.size()), mergePid);
         return 1;
       }
       vtkDataArray* subsetArray =
@@ -995,6 +1132,31 @@ public:
         subsetArray->GetNumberOfTuples(), subsetArray->GetNumberOfComponents(),
         this->SelectedComponent, HISTOGRAM_SIZE, this->CommonRange, revertOrder);
 
+      if (trimFromTail)
+      {
+        nbElementsToRemoveFromHead =
+          vtkMath::Max(static_cast<vtkIdType>(0), sorter.ArraySize - (last - first));
+      }
+
+      // Count, for each process, the elements removed from the head and the
+      // ones kept so that everybody knows where the block starts and ends in
+      // its local sorted array.
+      vtkIdTypeArray* processIds =
+        vtkIdTypeArray::SafeDownCast(localSubset->GetColumnByName("vtkOriginalProcessIds"));
+      if (processIds && first < last)
+      {
+        boundaries[0] = 1;
+        const vtkIdType end =
+          vtkMath::Min(sorter.ArraySize, nbElementsToRemoveFromHead + (last - first));
+        for (vtkIdType idx = 0; idx < end; ++idx)
+        {
+          const vtkIdType pid = processIds->GetValue(sorter.Array[idx].OriginalIndex);
+          ++boundaries[1 + pid + (idx < nbElementsToRemoveFromHead ? 0 : this->NumProcs)];
+        }
+      }
+      this->MPI->Broadcast(boundaries.data(), static_cast<vtkIdType>(boundaries.size()), mergePid);
+      this->AddPageBoundaries(first, localOffset, boundaries);
+
       // trim it (remove head and tail that don't belong to the result)
       localSubset.TakeReference(this->NewSubsetTable(
         localSubset.GetPointer(), &sorter, nbElementsToRemoveFromHead, blockSize));
@@ -1007,6 +1169,10 @@ public:
     }
     else
     {
+      std::vector<vtkIdType> boundaries(2 * this->NumProcs + 1, 0);
+      this->MPI->Broadcast(boundaries.data(), static_cast<vtkIdType>(boundaries.size()), mergePid);
+      this->AddPageBoundaries(first, localOffset, boundaries);
+
       // Ask other processes to provide metadata for table decoration
       this->DecorateTable(input, nullptr, mergePid);
     }
@@ -1014,6 +1180,32 @@ public:
     return 1;
   }
 
+  // --------------------------------------------------------------------------
+  // Remember where the block starting at the global index first starts and
+  // ends in the local sorted array. boundaries holds a validity flag followed
+  // by the number of elements of each process that precede the block in the
+  // merged subset and the number of elements of each process in the block.
+  void AddPageBoundaries(
+    vtkIdType first, vtkIdType localOffset, const std::vector<vtkIdType>& boundaries)
+  {
+    if (boundaries[0] == 0)
+    {
+      return;
+    }
+    vtkIdType blockSize = 0;
+    for (int pid = 0; pid < this->NumProcs; ++pid)
+    {
+      blockSize += boundaries[1 + this->NumProcs + pid];
+    }
+    if (this->PageBoundaries.size() >= MAX_PAGE_BOUNDARIES)
+    {
+      this->PageBoundaries.clear();
+    }
+    const vtkIdType lower = localOffset + boundaries[1 + this->Me];
+    this->PageBoundaries[first] = lower;
+    this->PageBoundaries[first + blockSize] = lower + boundaries[1 + this->NumProcs + this->Me];
+  }
+
   // --------------------------------------------------------------------------
   // nbGlobalToSkip is the number of elements that should be skipped at the end
   // if you exactly want to reach the searchedGlobalIndex.
@@ -1144,62 +1336,27 @@ public:
   }
 
   // --------------------------------------------------------------------------
-  void InvalidateCache() override { this->NeedToBuildCache = true; }
-
-  // --------------------------------------------------------------------------
-  bool IsInvalid(vtkTable* input, vtkDataArray* dataToProcess) override
+  void InvalidateCache() override
   {
-    return !dataToProcess || input->GetMTime() != this->InputMTime ||
-      dataToProcess->GetMTime() != this->DataMTime;
+    this->NeedToBuildCache = true;
+    this->Sortable = -1;
+    this->PageBoundaries.clear();
   }
 
   // --------------------------------------------------------------------------
-  void DecorateTable(vtkTable* input, vtkTable* output, int mergePid)
+  bool IsInvalid(vtkTable* input, vtkDataArray* dataToProcess) override
   {
-    // Check if it is a structured grid
-    if (input->GetFieldData()->GetArray("STRUCTURED_DIMENSIONS"))
+    if (input->GetMTime() != this->InputMTime)
     {
-      int localDimensions[3] = { 0, 0, 0 };
-      int* dimensions = new int[3 * this->NumProcs];
-      vtkIntArray::SafeDownCast(input->GetFieldData()->GetArray("STRUCTURED_DIMENSIONS"))
-        ->GetTypedTuple(0, localDimensions);
-
-      this->MPI->Gather(localDimensions, dimensions, 3, mergePid);
-
-      if (output)
-      {
-        vtkIdTypeArray* structuredIndices = vtkIdTypeArray::New();
-        structuredIndices->SetNumberOfComponents(3);
-        structuredIndices->Allocate(output->GetNumberOfRows() * 3);
-        structuredIndices->SetName("Structured Coordinates");
-
-        vtkIdTypeArray* idsArray =
-          vtkIdTypeArray::SafeDownCast(output->GetColumnByName("vtkOriginalIndices"));
-        vtkIdTypeArray* pidsArray =
-          vtkIdTypeArray::SafeDownCast(output->GetColumnByName("vtkOriginalProcessIds"));
-
-        for (vtkIdType idx = 0; idx < output->GetNumberOfRows(); idx++)
-        {
-          vtkIdType id = idsArray->GetValue(idx);
-          vtkIdType pid = pidsArray ? pidsArray->GetValue(idx) : 0;
-
-          //          if(pid < 0 || pid >= this->NumProcs)
-          //            {
-          //            cout << "Error invalid pid " << pid << " at idx " << idx << " mergePid " <<
-          //            mergePid << " me " << this->Me << endl;
-          //            WaitForGDB();
-          //            }
-
-          structuredIndices->InsertNextTuple3((id % dimensions[3 * pid]),
-            (id / dimensions[3 * pid]) % dimensions[3 * pid + 1],
-            (id / static_cast<double>((dimensions[3 * pid] * dimensions[3 * pid + 1]))));
-        }
-        output->GetRowData()->AddArray(structuredIndices);
-        structuredIndices->FastDelete();
-      }
-      delete[] dimensions;
+      return true;
+    }
+    if (!dataToProcess)
+    {
+      return this->DataToSort != nullptr;
     }
+    return dataToProcess != this->DataToSort || dataToProcess->GetMTime() != this->DataMTime;
   }
+
   // --------------------------------------------------------------------------
   bool TestInternalClasses() override
   {
@@ -1330,27 +1487,6 @@ public:
     return true;
   }
   // --------------------------------------------------------------------------
-  int GetMergingProcessId(vtkTable* localTable)
-  {
-    if (this->NumProcs == 1)
-      return 0;
-    vtkIdType* tableSizes = new vtkIdType[this->NumProcs];
-    vtkIdType localTableSize = localTable ? localTable->GetNumberOfRows() : 0;
-    this->MPI->AllGather(&localTableSize, tableSizes, 1);
-    vtkIdType maxSize = 0;
-    int winner = 0;
-    for (int pid = 0; pid < this->NumProcs; pid++)
-    {
-      if (maxSize < tableSizes[pid])
-      {
-        maxSize = tableSizes[pid];
-        winner = pid;
-      }
-    }
-    delete[] tableSizes;
-    return winner;
-  }
-  // --------------------------------------------------------------------------
 private:
   vtkMTimeType InputMTime;    // Keep the original input MTime
   vtkMTimeType DataMTime;     // Keep the original data MTime
@@ -1358,14 +1494,17 @@ private:
   ArraySorter* LocalSorter;   // Local ArraySorter based on global range
   Histogram* GlobalHistogram; // Globaly merged Histogram based on global range
   double CommonRange[2];      // Scalar range used across processes
-  int Me;                     // Current process ID
-  int NumProcs;               // Number of processes involved
-  vtkCommunicator* MPI;       // MPI communicator to send/receive/gather
   int SelectedComponent;      // Component used to sort array
+  int Sortable = -1;          // Cached result of IsSortable(), -1 if unknown
   bool NeedToBuildCache;
   bool Debug;
 
+  // Global index of the block boundaries already found mapped to the
+  // corresponding index in the local sorted array.
+  std::map<vtkIdType, vtkIdType> PageBoundaries;
+
   const static int VTK_TABLE_EXCHANGE_TAG = 50;
+  const static std::size_t MAX_PAGE_BOUNDARIES = 4096;
   // HISTOGRAM_SIZE could be computed dynamically based on the type of the
   // array to sort but to make sure that unsigned char won't be distributed
   // correctly we set the histogram size to be their max number of element
@@ -1375,79 +1514,685 @@ private:
   const static int HISTOGRAM_SIZE = 256;
 };
 //****************************************************************************
-vtkStandardNewMacro(vtkSortedTableStreamer);
-vtkCxxSetObjectMacro(vtkSortedTableStreamer, Controller, vtkMultiProcessController);
-//----------------------------------------------------------------------------
-vtkSortedTableStreamer::vtkSortedTableStreamer()
-{
-  this->InvertOrder = 0;
-  this->Controller = nullptr;
-  this->SetNumberOfInputPorts(1);
-  this->ColumnToSort = nullptr;
-  this->SetColumnToSort("");
-  this->Block = 0;
-  this->BlockSize = 1024;
-  this->Internal = nullptr;
-  this->SelectedComponent = 0;
-  this->SetController(vtkMultiProcessController::GetGlobalController());
-}
-
-//----------------------------------------------------------------------------
-vtkSortedTableStreamer::~vtkSortedTableStreamer()
+// Distributed sample sort of the rows on one or more keys. Every row is
+// described by a record made of its keys followed by its process id and row
+// index, which makes all the records distinct and the order stable. Integer
+// keys are kept as integers, so that large values are not rounded.
+class vtkSortedTableStreamer::SampleSortInternals : public vtkSortedTableStreamer::InternalsBase
 {
-  this->SetColumnToSort(nullptr);
-  this->SetController(nullptr);
-  if (this->Internal)
+public:
+  SampleSortInternals(
+    vtkTable* input, const std::vector<std::string>& columns, vtkMultiProcessController* controller)
+    : Columns(columns)
   {
-    delete this->Internal;
-    this->Internal = nullptr;
+    this->MPI = controller->GetCommunicator();
+    this->NumProcs = controller->GetNumberOfProcesses();
+    this->Me = controller->GetLocalProcessId();
+    this->InputMTime = input->GetMTime();
+    for (const auto& column : this->Columns)
+    {
+      auto array = vtkDataArray::SafeDownCast(input->GetColumnByName(column.c_str()));
+      this->Arrays.push_back(array);
+      this->ArrayMTimes.push_back(array ? array->GetMTime() : 0);
+    }
   }
-}
-
-//----------------------------------------------------------------------------
-int vtkSortedTableStreamer::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
-{
-  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPartitionedDataSet");
-  return 1;
-}
 
-//----------------------------------------------------------------------------
-vtkSmartPointer<vtkTable> vtkSortedTableStreamer::MergeBlocks(vtkPartitionedDataSet* ptd)
-{
-  if (ptd->GetNumberOfPartitions() == 1)
+  // --------------------------------------------------------------------------
+  void SetSelectedComponent(int newValue) override
   {
-    return vtkTable::SafeDownCast(ptd->GetPartitionAsDataObject(0));
+    if (this->SelectedComponent != newValue)
+    {
+      this->InvalidateCache();
+      this->SelectedComponent = newValue;
+    }
   }
 
-  auto result = vtkSmartPointer<vtkTable>::New();
-  const vtkIdType allocationSize = ptd->GetNumberOfElements(vtkDataObject::ROW);
-  for (unsigned int cc = 0, max = ptd->GetNumberOfPartitions(); cc < max; ++cc)
+  // --------------------------------------------------------------------------
+  void InvalidateCache() override { this->NeedToBuildCache = true; }
+
+  // --------------------------------------------------------------------------
+  bool IsInvalid(vtkTable* input, vtkDataArray* vtkNotUsed(dataToProcess)) override
   {
-    if (auto partition = vtkTable::SafeDownCast(ptd->GetPartitionAsDataObject(cc)))
+    if (input->GetMTime() != this->InputMTime)
     {
-      InternalsBase::MergeTable(-1, partition, result.GetPointer(), allocationSize);
+      return true;
     }
-    else if (auto dobj = ptd->GetPartitionAsDataObject(cc))
+    for (size_t cc = 0; cc < this->Columns.size(); ++cc)
     {
-      vtkWarningMacro(
-        "Incompatible data type in the input : " << dobj->GetClassName() << " " << cc);
+      auto array = vtkDataArray::SafeDownCast(input->GetColumnByName(this->Columns[cc].c_str()));
+      if (array != this->Arrays[cc] || (array && array->GetMTime() != this->ArrayMTimes[cc]))
+      {
+        return true;
+      }
     }
+    return false;
   }
-  return result;
-}
 
-//----------------------------------------------------------------------------
-void vtkSortedTableStreamer::PopulateFieldDataArrays(
-  vtkPartitionedDataSet* ptd, vtkSmartPointer<vtkTable> outTable)
-{
-  vtkIdType tableOffset = 0;
+  // --------------------------------------------------------------------------
+  // Rows without keys keep the order of the processes and of the input.
+  bool IsSortable() override { return true; }
 
-  const vtkIdType allocationSize = ptd->GetNumberOfElements(vtkDataObject::ROW);
-  for (unsigned int cc = 0, max = ptd->GetNumberOfPartitions(); cc < max; ++cc)
+  // --------------------------------------------------------------------------
+  bool TestInternalClasses() override { return true; }
+
+  // --------------------------------------------------------------------------
+  int Extract(vtkTable* input, vtkTable* output, vtkIdType block, vtkIdType blockSize,
+    bool revertOrder) override
   {
-    auto table = vtkTable::SafeDownCast(ptd->GetPartitionAsDataObject(cc));
-    if (!table)
-    {
+    return this->Compute(input, output, block, blockSize, revertOrder);
+  }
+
+  // --------------------------------------------------------------------------
+  int Compute(vtkTable* input, vtkTable* output, vtkIdType block, vtkIdType blockSize,
+    bool revertOrder) override
+  {
+    if (this->NeedToBuildCache || this->Inverted != revertOrder)
+    {
+      this->BuildCache(input, revertOrder);
+    }
+
+    // ------------------------------------------------------------------------
+    // Find the part of the block owned by this process
+    // ------------------------------------------------------------------------
+    const vtkIdType total = this->Offsets.back();
+    const vtkIdType last = vtkMath::Min(total, (block + 1) * blockSize);
+    const vtkIdType first = vtkMath::Min(last, block * blockSize);
+    const vtkIdType localSize = static_cast<vtkIdType>(this->RowIds.size());
+    const vtkIdType begin = vtkMath::ClampValue(
+      first - this->Offsets[this->Me], static_cast<vtkIdType>(0), localSize);
+    const vtkIdType end =
+      vtkMath::ClampValue(last - this->Offsets[this->Me], static_cast<vtkIdType>(0), localSize);
+
+    if (this->NumProcs == 1)
+    {
+      std::vector<vtkIdType> rows(this->RowIds.begin() + begin, this->RowIds.begin() + end);
+      vtkSmartPointer<vtkTable> subset;
+      subset.TakeReference(NewSubsetTable(input, rows));
+      this->DecorateTable(input, subset.GetPointer(), 0);
+      output->ShallowCopy(subset.GetPointer());
+      return 1;
+    }
+
+    // ------------------------------------------------------------------------
+    // Share the process id and row index of every row of the block, which are
+    // received in the global order since processes own consecutive ranges.
+    // ------------------------------------------------------------------------
+    vtkNew<vtkIdTypeArray> localBlock;
+    localBlock->SetNumberOfValues(2 * (end - begin));
+    for (vtkIdType idx = begin; idx < end; ++idx)
+    {
+      localBlock->SetValue(2 * (idx - begin), this->ProcessIds[idx]);
+      localBlock->SetValue(2 * (idx - begin) + 1, this->RowIds[idx]);
+    }
+    vtkNew<vtkIdTypeArray> globalBlock;
+    this->MPI->AllGatherV(localBlock, globalBlock);
+    const vtkIdType blockLength = globalBlock->GetNumberOfValues() / 2;
+
+    std::vector<vtkIdType> counts(this->NumProcs, 0);
+    std::vector<vtkIdType> rows;
+    for (vtkIdType idx = 0; idx < blockLength; ++idx)
+    {
+      const vtkIdType pid = globalBlock->GetValue(2 * idx);
+      ++counts[pid];
+      if (pid == this->Me)
+      {
+        rows.push_back(globalBlock->GetValue(2 * idx + 1));
+      }
+    }
+    const auto maxCount = std::max_element(counts.begin(), counts.end());
+    const int mergePid = static_cast<int>(std::distance(counts.begin(), maxCount));
+
+    vtkSmartPointer<vtkTable> localSubset;
+    localSubset.TakeReference(NewSubsetTable(input, rows));
+
+    if (this->Me != mergePid)
+    {
+      this->MPI->Send(localSubset.GetPointer(), mergePid, VTK_TABLE_EXCHANGE_TAG);
+      this->DecorateTable(input, nullptr, mergePid);
+      return 1;
+    }
+
+    // ------------------------------------------------------------------------
+    // Merge the rows of every process and put them in the global order
+    // ------------------------------------------------------------------------
+    vtkNew<vtkIdTypeArray> processIdArray;
+    processIdArray->SetName("vtkOriginalProcessIds");
+    processIdArray->Allocate(blockLength);
+    for (vtkIdType idx = 0; idx < localSubset->GetNumberOfRows(); idx++)
+    {
+      processIdArray->InsertNextTuple1(mergePid);
+    }
+    localSubset->GetRowData()->AddArray(processIdArray);
+
+    std::vector<vtkIdType> mergedOffsets(this->NumProcs, 0);
+    vtkIdType mergedRows = counts[mergePid];
+    vtkNew<vtkTable> tmp;
+    for (int i = 0; i < this->NumProcs; i++)
+    {
+      if (i == mergePid)
+        continue;
+
+      this->MPI->Receive(tmp.GetPointer(), i, VTK_TABLE_EXCHANGE_TAG);
+      this->MergeTable(i, tmp.GetPointer(), localSubset.GetPointer(), blockLength);
+      mergedOffsets[i] = mergedRows;
+      mergedRows += counts[i];
+    }
+
+    std::vector<vtkIdType> order(blockLength);
+    for (vtkIdType idx = 0; idx < blockLength; ++idx)
+    {
+      order[idx] = mergedOffsets[globalBlock->GetValue(2 * idx)]++;
+    }
+    vtkSmartPointer<vtkTable> result;
+    result.TakeReference(NewSubsetTable(localSubset.GetPointer(), order));
+
+    // Add extra information such as structured indices, block number...
+    this->DecorateTable(input, result.GetPointer(), mergePid);
+    output->ShallowCopy(result.GetPointer());
+    return 1;
+  }
+
+  // --------------------------------------------------------------------------
+  // Sort the rows of every process and exchange their records so that the
+  // i-th process holds the i-th range of the global order.
+  void BuildCache(vtkTable* input, bool invertOrder)
+  {
+    this->NeedToBuildCache = false;
+    this->Inverted = invertOrder;
+    this->NumberOfKeys = static_cast<int>(this->Columns.size());
+
+    // ------------------------------------------------------------------------
+    // Build and sort the local records
+    // ------------------------------------------------------------------------
+    const int stride = this->NumberOfKeys + 2;
+    const vtkIdType numRows = input->GetNumberOfRows();
+    this->UpdateKeyTypes(numRows);
+    std::vector<Field> records(numRows * stride);
+    vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType row = begin; row < end; ++row)
+      {
+        records[row * stride + this->NumberOfKeys].Id = this->Me;
+        records[row * stride + this->NumberOfKeys + 1].Id = row;
+      }
+    });
+    for (int key = 0; key < this->NumberOfKeys; ++key)
+    {
+      this->FillKeys(
+        this->Arrays[key], this->GetKeyComponent(key), key, numRows, records.data(), stride);
+    }
+
+    std::vector<vtkIdType> order(numRows);
+    std::iota(order.begin(), order.end(), 0);
+    vtkSMPTools::Sort(order.begin(), order.end(), [&](vtkIdType a, vtkIdType b) {
+      return this->Less(&records[a * stride], &records[b * stride]);
+    });
+
+    if (this->NumProcs == 1)
+    {
+      this->RowIds = std::move(order);
+      this->Offsets = { 0, numRows };
+      return;
+    }
+
+    // ------------------------------------------------------------------------
+    // Pick the splitters from a regular sample of every sorted local array
+    // ------------------------------------------------------------------------
+    const vtkIdType numSamples = vtkMath::Min(numRows, static_cast<vtkIdType>(this->NumProcs));
+    vtkNew<vtkTypeUInt64Array> localSamples;
+    localSamples->SetNumberOfValues(numSamples * stride);
+    for (vtkIdType sample = 0; sample < numSamples; ++sample)
+    {
+      const vtkIdType row = order[((2 * sample + 1) * numRows) / (2 * numSamples)];
+      std::memcpy(
+        localSamples->GetPointer(sample * stride), &records[row * stride], stride * sizeof(Field));
+    }
+    vtkNew<vtkTypeUInt64Array> globalSamples;
+    this->MPI->AllGatherV(localSamples, globalSamples);
+
+    const std::vector<Field> samples = ToFields(globalSamples);
+    std::vector<vtkIdType> sampleOrder(samples.size() / stride);
+    std::iota(sampleOrder.begin(), sampleOrder.end(), 0);
+    std::sort(sampleOrder.begin(), sampleOrder.end(), [&](vtkIdType a, vtkIdType b) {
+      return this->Less(&samples[a * stride], &samples[b * stride]);
+    });
+
+    // Records lower than the i-th splitter go to the processes before i.
+    std::vector<vtkIdType> bucketBegin(this->NumProcs + 1, numRows);
+    bucketBegin[0] = 0;
+    const vtkIdType totalSamples = static_cast<vtkIdType>(sampleOrder.size());
+    for (int pid = 1; pid < this->NumProcs && totalSamples > 0; ++pid)
+    {
+      const vtkIdType splitterIdx = sampleOrder[(pid * totalSamples) / this->NumProcs];
+      const Field* splitter = &samples[splitterIdx * stride];
+      bucketBegin[pid] = std::distance(order.begin(),
+        std::lower_bound(order.begin(), order.end(), splitter,
+          [&](vtkIdType row, const Field* value) {
+            return this->Less(&records[row * stride], value);
+          }));
+    }
+
+    // ------------------------------------------------------------------------
+    // Exchange the records, one gather per destination process
+    // ------------------------------------------------------------------------
+    vtkNew<vtkTypeUInt64Array> received;
+    for (int pid = 0; pid < this->NumProcs; ++pid)
+    {
+      vtkNew<vtkTypeUInt64Array> send;
+      send->SetNumberOfValues((bucketBegin[pid + 1] - bucketBegin[pid]) * stride);
+      for (vtkIdType idx = bucketBegin[pid]; idx < bucketBegin[pid + 1]; ++idx)
+      {
+        std::memcpy(send->GetPointer((idx - bucketBegin[pid]) * stride),
+          &records[order[idx] * stride], stride * sizeof(Field));
+      }
+      vtkNew<vtkTypeUInt64Array> recv;
+      this->MPI->GatherV(send, recv, pid);
+      if (pid == this->Me)
+      {
+        received->ShallowCopy(recv);
+      }
+    }
+    records = ToFields(received);
+    received->Initialize();
+
+    // ------------------------------------------------------------------------
+    // Sort the received records and share the size of each range
+    // ------------------------------------------------------------------------
+    const vtkIdType bucketSize = static_cast<vtkIdType>(records.size()) / stride;
+    order.resize(bucketSize);
+    std::iota(order.begin(), order.end(), 0);
+    vtkSMPTools::Sort(order.begin(), order.end(), [&](vtkIdType a, vtkIdType b) {
+      return this->Less(&records[a * stride], &records[b * stride]);
+    });
+    this->ProcessIds.resize(bucketSize);
+    this->RowIds.resize(bucketSize);
+    for (vtkIdType idx = 0; idx < bucketSize; ++idx)
+    {
+      this->ProcessIds[idx] = records[order[idx] * stride + stride - 2].Id;
+      this->RowIds[idx] = records[order[idx] * stride + stride - 1].Id;
+    }
+
+    std::vector<vtkIdType> sizes(this->NumProcs);
+    this->MPI->AllGather(&bucketSize, sizes.data(), 1);
+    this->Offsets.assign(1, 0);
+    for (const auto size : sizes)
+    {
+      this->Offsets.push_back(this->Offsets.back() + size);
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  static vtkTable* NewSubsetTable(vtkTable* srcTable, const std::vector<vtkIdType>& rows)
+  {
+    vtkTable* subTable = vtkTable::New();
+    vtkNew<vtkIdList> ids;
+    ids->SetNumberOfIds(static_cast<vtkIdType>(rows.size()));
+    std::copy(rows.begin(), rows.end(), ids->GetPointer(0));
+    for (vtkIdType colIdx = 0; colIdx < srcTable->GetNumberOfColumns(); ++colIdx)
+    {
+      vtkAbstractArray* srcArray = srcTable->GetColumn(colIdx);
+      vtkAbstractArray* subArray = srcArray->NewInstance();
+      subArray->SetNumberOfComponents(srcArray->GetNumberOfComponents());
+      subArray->SetName(srcArray->GetName());
+      if (auto sinfo = srcArray->GetInformation())
+      {
+        subArray->CopyInformation(sinfo);
+      }
+      subArray->SetNumberOfTuples(ids->GetNumberOfIds());
+      srcArray->GetTuples(ids, subArray);
+      subTable->GetRowData()->AddArray(subArray);
+      subArray->FastDelete();
+    }
+    return subTable;
+  }
+
+private:
+  // --------------------------------------------------------------------------
+  // A field of a record: a key, stored with the type of the key, or the
+  // process id or row index of the row.
+  union Field
+  {
+    double Real;
+    vtkTypeInt64 Signed;
+    vtkTypeUInt64 Unsigned;
+    vtkIdType Id;
+  };
+  static_assert(sizeof(Field) == sizeof(vtkTypeUInt64), "Records are exchanged as 64-bit values");
+
+  // Types of the keys, or'ed over all the processes. Missing arrays have none.
+  enum KeyType
+  {
+    SIGNED_KEY = 0x1,
+    UNSIGNED_KEY = 0x2,
+    REAL_KEY = 0x4
+  };
+
+  // --------------------------------------------------------------------------
+  static std::vector<Field> ToFields(vtkTypeUInt64Array* array)
+  {
+    std::vector<Field> fields(array->GetNumberOfValues());
+    if (!fields.empty())
+    {
+      std::memcpy(fields.data(), array->GetPointer(0), fields.size() * sizeof(Field));
+    }
+    return fields;
+  }
+
+  // --------------------------------------------------------------------------
+  // Component of the array used by the key-th key, negative for the magnitude.
+  int GetKeyComponent(int key) const
+  {
+    auto array = this->Arrays[key];
+    if (array && array->GetNumberOfComponents() == 1)
+    {
+      return 0;
+    }
+    const int component = key == 0 ? this->SelectedComponent : -1;
+    return array && component < array->GetNumberOfComponents() ? component : -1;
+  }
+
+  // --------------------------------------------------------------------------
+  // Every process must use the same type for a key: integer keys stay
+  // integers unless signed and unsigned values are mixed, or some process
+  // has real values or sorts by the magnitude.
+  void UpdateKeyTypes(vtkIdType numRows)
+  {
+    std::vector<int> localTypes(this->NumberOfKeys, 0);
+    for (int key = 0; key < this->NumberOfKeys; ++key)
+    {
+      auto array = this->Arrays[key];
+      if (array == nullptr || array->GetNumberOfTuples() < numRows)
+      {
+        continue;
+      }
+      const int dataType = array->GetDataType();
+      if (this->GetKeyComponent(key) < 0 || dataType == VTK_FLOAT || dataType == VTK_DOUBLE)
+      {
+        localTypes[key] = REAL_KEY;
+      }
+      else
+      {
+        localTypes[key] = array->GetDataTypeMin() < 0 ? SIGNED_KEY : UNSIGNED_KEY;
+      }
+    }
+    this->KeyTypes = localTypes;
+    if (this->NumProcs > 1 && this->NumberOfKeys > 0)
+    {
+      this->MPI->AllReduce(localTypes.data(), this->KeyTypes.data(), this->NumberOfKeys,
+        vtkCommunicator::BITWISE_OR_OP);
+    }
+    for (auto& type : this->KeyTypes)
+    {
+      if (type != SIGNED_KEY && type != UNSIGNED_KEY)
+      {
+        type = REAL_KEY;
+      }
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  template <typename T>
+  static int Compare(T a, T b)
+  {
+    return a < b ? -1 : (b < a ? 1 : 0);
+  }
+
+  // --------------------------------------------------------------------------
+  // NaN values are greater than any other value.
+  static int CompareKeys(const Field& a, const Field& b, int type)
+  {
+    switch (type)
+    {
+      case SIGNED_KEY:
+        return Compare(a.Signed, b.Signed);
+      case UNSIGNED_KEY:
+        return Compare(a.Unsigned, b.Unsigned);
+      default:
+        break;
+    }
+    const int order = Compare(a.Real, b.Real);
+    if (order != 0)
+    {
+      return order;
+    }
+    const bool aIsNaN = std::isnan(a.Real);
+    return aIsNaN == std::isnan(b.Real) ? 0 : (aIsNaN ? 1 : -1);
+  }
+
+  // --------------------------------------------------------------------------
+  bool Less(const Field* a, const Field* b) const
+  {
+    for (int key = 0; key < this->NumberOfKeys; ++key)
+    {
+      const int order = CompareKeys(a[key], b[key], this->KeyTypes[key]);
+      if (order != 0)
+      {
+        return this->Inverted ? order > 0 : order < 0;
+      }
+    }
+    // Process id then row index
+    if (a[this->NumberOfKeys].Id != b[this->NumberOfKeys].Id)
+    {
+      return a[this->NumberOfKeys].Id < b[this->NumberOfKeys].Id;
+    }
+    return a[this->NumberOfKeys + 1].Id < b[this->NumberOfKeys + 1].Id;
+  }
+
+  // --------------------------------------------------------------------------
+  // Copy the selected component, or the magnitude if component is negative,
+  // of array into the key-th key of the records.
+  struct FillKeysWorker
+  {
+    template <typename ArrayT>
+    void operator()(ArrayT* array, int component, int key, int type, Field* records, int stride)
+    {
+      const auto tuples = vtk::DataArrayTupleRange(array);
+      vtkSMPTools::For(0, tuples.size(), [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType row = begin; row < end; ++row)
+        {
+          const auto tuple = tuples[row];
+          Field& field = records[row * stride + key];
+          if (component < 0)
+          {
+            double value = 0;
+            for (const auto comp : tuple)
+            {
+              value += static_cast<double>(comp) * static_cast<double>(comp);
+            }
+            field.Real = std::sqrt(value);
+          }
+          else if (type == SIGNED_KEY)
+          {
+            field.Signed = static_cast<vtkTypeInt64>(tuple[component]);
+          }
+          else if (type == UNSIGNED_KEY)
+          {
+            field.Unsigned = static_cast<vtkTypeUInt64>(tuple[component]);
+          }
+          else
+          {
+            field.Real = static_cast<double>(tuple[component]);
+          }
+        }
+      });
+    }
+  };
+
+  void FillKeys(
+    vtkDataArray* array, int component, int key, vtkIdType numRows, Field* records, int stride)
+  {
+    const int type = this->KeyTypes[key];
+    if (array == nullptr || array->GetNumberOfTuples() < numRows)
+    {
+      // Missing values are sorted last, with the largest integer values.
+      vtkSMPTools::For(0, numRows, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType row = begin; row < end; ++row)
+        {
+          Field& field = records[row * stride + key];
+          if (type == SIGNED_KEY)
+          {
+            field.Signed = VTK_TYPE_INT64_MAX;
+          }
+          else if (type == UNSIGNED_KEY)
+          {
+            field.Unsigned = VTK_TYPE_UINT64_MAX;
+          }
+          else
+          {
+            field.Real = vtkMath::Nan();
+          }
+        }
+      });
+      return;
+    }
+    FillKeysWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(array, worker, component, key, type, records, stride))
+    {
+      worker(array, component, key, type, records, stride);
+    }
+  }
+
+  std::vector<std::string> Columns;      // Names of the columns to sort by
+  std::vector<vtkDataArray*> Arrays;     // Arrays to sort by, may be nullptr
+  std::vector<vtkMTimeType> ArrayMTimes; // Keep the original arrays MTime
+  vtkMTimeType InputMTime;               // Keep the original input MTime
+  int SelectedComponent = 0;             // Component of the first array
+  int NumberOfKeys = 0;
+  std::vector<int> KeyTypes; // KeyType of every key
+  bool Inverted = false;
+  bool NeedToBuildCache = true;
+
+  // Process id and row index of the rows of the range of the global order
+  // owned by this process, and the first global index of every range.
+  std::vector<vtkIdType> ProcessIds;
+  std::vector<vtkIdType> RowIds;
+  std::vector<vtkIdType> Offsets = { 0, 0 };
+
+  const static int VTK_TABLE_EXCHANGE_TAG = 51;
+};
+//****************************************************************************
+struct vtkSortedTableStreamer::SortCache
+{
+  struct Entry
+  {
+    std::string Column;
+    std::vector<std::string> SecondaryColumns;
+    int Component;
+    int InvertOrder;
+    int Algorithm;
+    InternalsBase* Internal;
+  };
+
+  // Most recently used first
+  std::list<Entry> Entries;
+
+  // Merged input and the state it was built from
+  vtkSmartPointer<vtkTable> Input;
+  vtkMTimeType InputMTime = 0;
+  bool ShowFieldData = false;
+
+  ~SortCache() { this->Clear(); }
+
+  void Clear()
+  {
+    for (auto& entry : this->Entries)
+    {
+      delete entry.Internal;
+    }
+    this->Entries.clear();
+  }
+};
+
+namespace
+{
+// Returns the most recent modification time of the partitioned dataset or of
+// one of its partitions.
+vtkMTimeType GetPartitionsMTime(vtkPartitionedDataSet* ptd)
+{
+  vtkMTimeType mtime = ptd->GetMTime();
+  for (unsigned int cc = 0, max = ptd->GetNumberOfPartitions(); cc < max; ++cc)
+  {
+    if (auto partition = ptd->GetPartitionAsDataObject(cc))
+    {
+      mtime = std::max(mtime, partition->GetMTime());
+    }
+  }
+  return mtime;
+}
+}
+
+//****************************************************************************
+vtkStandardNewMacro(vtkSortedTableStreamer);
+vtkCxxSetObjectMacro(vtkSortedTableStreamer, Controller, vtkMultiProcessController);
+//----------------------------------------------------------------------------
+vtkSortedTableStreamer::vtkSortedTableStreamer()
+{
+  this->InvertOrder = 0;
+  this->Controller = nullptr;
+  this->SetNumberOfInputPorts(1);
+  this->ColumnToSort = nullptr;
+  this->SetColumnToSort("");
+  this->Block = 0;
+  this->BlockSize = 1024;
+  this->Internal = nullptr;
+  this->Cache = new SortCache();
+  this->SelectedComponent = 0;
+  this->SetController(vtkMultiProcessController::GetGlobalController());
+}
+
+//----------------------------------------------------------------------------
+vtkSortedTableStreamer::~vtkSortedTableStreamer()
+{
+  this->SetColumnToSort(nullptr);
+  this->SetController(nullptr);
+  this->Internal = nullptr;
+  delete this->Cache;
+  this->Cache = nullptr;
+}
+
+//----------------------------------------------------------------------------
+int vtkSortedTableStreamer::FillInputPortInformation(int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPartitionedDataSet");
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkTable> vtkSortedTableStreamer::MergeBlocks(vtkPartitionedDataSet* ptd)
+{
+  if (ptd->GetNumberOfPartitions() == 1)
+  {
+    return vtkTable::SafeDownCast(ptd->GetPartitionAsDataObject(0));
+  }
+
+  auto result = vtkSmartPointer<vtkTable>::New();
+  const vtkIdType allocationSize = ptd->GetNumberOfElements(vtkDataObject::ROW);
+  for (unsigned int cc = 0, max = ptd->GetNumberOfPartitions(); cc < max; ++cc)
+  {
+    if (auto partition = vtkTable::SafeDownCast(ptd->GetPartitionAsDataObject(cc)))
+    {
+      InternalsBase::MergeTable(-1, partition, result.GetPointer(), allocationSize);
+    }
+    else if (auto dobj = ptd->GetPartitionAsDataObject(cc))
+    {
+      vtkWarningMacro(
+        "Incompatible data type in the input : " << dobj->GetClassName() << " " << cc);
+    }
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+void vtkSortedTableStreamer::PopulateFieldDataArrays(
+  vtkPartitionedDataSet* ptd, vtkSmartPointer<vtkTable> outTable)
+{
+  vtkIdType tableOffset = 0;
+
+  const vtkIdType allocationSize = ptd->GetNumberOfElements(vtkDataObject::ROW);
+  for (unsigned int cc = 0, max = ptd->GetNumberOfPartitions(); cc < max; ++cc)
+  {
+    auto table = vtkTable::SafeDownCast(ptd->GetPartitionAsDataObject(cc));
+    if (!table)
+    {
       continue;
     }
     InternalsBase::MergeFieldDataInTable(table, outTable.GetPointer(), allocationSize, tableOffset);
@@ -1611,18 +2356,35 @@ vtkSmartPointer<vtkIdTypeArray> vtkSortedTableStreamer::GenerateBlockIndicesArra
 }
 
 //----------------------------------------------------------------------------
-int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
-  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+vtkTable* vtkSortedTableStreamer::PrepareInput(vtkPartitionedDataSet* ptd)
 {
-  // Manage multiblock dataset by merging data into a single vtkTable
-  auto inputPTD = vtkPartitionedDataSet::GetData(inputVector[0], 0);
+  // The merged table is rebuilt only when the input changes so that the sorted
+  // indices, which are bound to it, can be reused across requests. The
+  // decision must be collective since building it involves communication.
+  int changed = this->Cache->Input == nullptr ||
+    this->Cache->InputMTime != ::GetPartitionsMTime(ptd) ||
+    this->Cache->ShowFieldData != this->ShowFieldData;
+  if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+  {
+    int globalChanged;
+    this->Controller->AllReduce(&changed, &globalChanged, 1, vtkCommunicator::MAX_OP);
+    changed = globalChanged;
+  }
+  if (!changed)
+  {
+    return this->Cache->Input;
+  }
 
-  vtkSmartPointer<vtkTable> input = this->MergeBlocks(inputPTD);
+  // The sorted indices refer to the arrays of the previous table
+  this->Internal = nullptr;
+  this->Cache->Clear();
+
+  vtkSmartPointer<vtkTable> input = this->MergeBlocks(ptd);
   if (this->ShowFieldData)
   {
-    this->PopulateFieldDataArrays(inputPTD, input);
+    this->PopulateFieldDataArrays(ptd, input);
   }
-  int hasCompositeIds = vtkDataTabulator::HasInputCompositeIds(inputPTD);
+  int hasCompositeIds = vtkDataTabulator::HasInputCompositeIds(ptd);
   if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
   {
     int globalHasCompositeIds;
@@ -1634,7 +2396,7 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
   {
     if (input->GetColumnByName("vtkCompositeIndexArray") == nullptr)
     {
-      auto array = this->GenerateCompositeIndexArray(inputPTD, input->GetNumberOfRows());
+      auto array = this->GenerateCompositeIndexArray(ptd, input->GetNumberOfRows());
       input->GetRowData()->AddArray(array);
     }
     int hasBlockNames = input->GetFieldData()->GetAbstractArray("vtkBlockNames") != nullptr;
@@ -1647,19 +2409,33 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
     if (!hasBlockNames)
     {
       // add name array.
-      auto blockNamesArray = this->GenerateBlockNameArray(inputPTD);
+      auto blockNamesArray = this->GenerateBlockNameArray(ptd);
       input->GetFieldData()->AddArray(blockNamesArray);
     }
     if (!input->GetColumnByName("vtkBlockNameIndices"))
     {
       // add name indices array.
-      auto blockIndicesArray = this->GenerateBlockIndicesArray(inputPTD,
+      auto blockIndicesArray = this->GenerateBlockIndicesArray(ptd,
         vtkStringArray::SafeDownCast(input->GetFieldData()->GetAbstractArray("vtkBlockNames")),
         input->GetNumberOfRows());
       input->GetRowData()->AddArray(blockIndicesArray);
     }
   }
 
+  this->Cache->Input = input;
+  this->Cache->InputMTime = ::GetPartitionsMTime(ptd);
+  this->Cache->ShowFieldData = this->ShowFieldData;
+  return input;
+}
+
+//----------------------------------------------------------------------------
+int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // Manage multiblock dataset by merging data into a single vtkTable
+  auto inputPTD = vtkPartitionedDataSet::GetData(inputVector[0], 0);
+  vtkTable* input = this->PrepareInput(inputPTD);
+
   // Get input data
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
   vtkTable* output = vtkTable::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
@@ -1675,15 +2451,13 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
   // single point/cell.
   // --------------------------------------------------------------------------
 
-  // Delete internal object if the input has change (table or array to sort)
-  if (this->Internal && this->Internal->IsInvalid(input, arrayToProcess))
+  // Make sure that an internal object is available for the column to sort,
+  // reusing the cached one if the input has not changed (table or array to sort)
+  this->CreateInternalIfNeeded(input, arrayToProcess);
+  if (!this->Internal)
   {
-    delete this->Internal;
-    this->Internal = nullptr;
+    return 0;
   }
-
-  // Make sure that an internal object is available
-  this->CreateInternalIfNeeded(input, arrayToProcess);
   int realComponent =
     (!arrayToProcess) ? 0 : this->GetSelectedComponent() % arrayToProcess->GetNumberOfComponents();
   this->Internal->SetSelectedComponent(realComponent);
@@ -1712,6 +2486,13 @@ void vtkSortedTableStreamer::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Sorting column: " << (this->ColumnToSort ? this->ColumnToSort : "(none)")
      << endl;
+  for (const auto& column : this->SecondaryColumnsToSort)
+  {
+    os << indent << "Secondary sorting column: " << column << endl;
+  }
+  os << indent << "SortAlgorithm: "
+     << (this->SortAlgorithm == SAMPLE_SORT ? "SAMPLE_SORT" : "HISTOGRAM_SORT") << endl;
+  os << indent << "MaximumNumberOfCachedSorts: " << this->MaximumNumberOfCachedSorts << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -1723,30 +2504,36 @@ const char* vtkSortedTableStreamer::GetColumnNameToSort()
 void vtkSortedTableStreamer::SetColumnNameToSort(const char* columnName)
 {
   this->SetColumnToSort(columnName);
-  if (strcmp("vtkOriginalProcessIds", this->GetColumnToSort()) != 0)
+  // The sorted index of the previous column stays in the cache.
+  this->Internal = nullptr;
+}
+//----------------------------------------------------------------------------
+void vtkSortedTableStreamer::SetInvertOrder(int newValue)
+{
+  if (this->InvertOrder != newValue)
   {
-    if (this->Internal)
-    {
-      delete this->Internal;
-      this->Internal = nullptr;
-    }
+    this->Internal = nullptr;
+    this->InvertOrder = newValue;
+    this->Modified();
   }
 }
 //----------------------------------------------------------------------------
-void vtkSortedTableStreamer::SetInvertOrder(int newValue)
+void vtkSortedTableStreamer::AddSecondaryColumnToSort(const char* columnName)
 {
-  bool changed = this->InvertOrder != newValue;
-  bool removeInternal = changed && strcmp("vtkOriginalProcessIds", this->GetColumnToSort()) != 0;
-
-  if (removeInternal && this->Internal)
+  if (columnName)
   {
-    delete this->Internal;
+    this->SecondaryColumnsToSort.emplace_back(columnName);
     this->Internal = nullptr;
+    this->Modified();
   }
-
-  if (changed)
+}
+//----------------------------------------------------------------------------
+void vtkSortedTableStreamer::RemoveAllSecondaryColumnsToSort()
+{
+  if (!this->SecondaryColumnsToSort.empty())
   {
-    this->InvertOrder = newValue;
+    this->SecondaryColumnsToSort.clear();
+    this->Internal = nullptr;
     this->Modified();
   }
 }
@@ -1766,24 +2553,73 @@ vtkDataArray* vtkSortedTableStreamer::GetDataArrayToProcess(vtkTable* input)
 //----------------------------------------------------------------------------
 void vtkSortedTableStreamer::CreateInternalIfNeeded(vtkTable* input, vtkDataArray* data)
 {
-  if (!this->Internal)
+  const std::string column = this->ColumnToSort ? this->ColumnToSort : "";
+  const int algorithm = this->SecondaryColumnsToSort.empty() ? this->SortAlgorithm : SAMPLE_SORT;
+  auto& entries = this->Cache->Entries;
+  auto iter = std::find_if(entries.begin(), entries.end(), [&](const SortCache::Entry& entry) {
+    return entry.Column == column && entry.SecondaryColumns == this->SecondaryColumnsToSort &&
+      entry.Component == this->SelectedComponent && entry.InvertOrder == this->InvertOrder &&
+      entry.Algorithm == algorithm;
+  });
+
+  // All processes must agree since building the cache is collective.
+  int invalid = (iter == entries.end() || iter->Internal->IsInvalid(input, data)) ? 1 : 0;
+  if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+  {
+    int globalInvalid;
+    this->Controller->AllReduce(&invalid, &globalInvalid, 1, vtkCommunicator::MAX_OP);
+    invalid = globalInvalid;
+  }
+
+  if (iter != entries.end())
   {
-    if (data)
+    if (!invalid)
     {
-      switch (data->GetDataType())
-      {
-        vtkTemplateMacro(
-          this->Internal = new Internals<VTK_TT>(input, data, this->GetController()););
-        default:
-          vtkErrorMacro("Array type not supported: " << data->GetClassName());
-      }
+      entries.splice(entries.begin(), entries, iter);
+      this->Internal = entries.front().Internal;
+      return;
     }
-    else
+    delete iter->Internal;
+    entries.erase(iter);
+  }
+
+  this->Internal = nullptr;
+  if (algorithm == SAMPLE_SORT)
+  {
+    // Sorting by process id is the order of the rows without keys
+    std::vector<std::string> columns;
+    if (!column.empty() && column != "vtkOriginalProcessIds")
+    {
+      columns.push_back(column);
+    }
+    columns.insert(
+      columns.end(), this->SecondaryColumnsToSort.begin(), this->SecondaryColumnsToSort.end());
+    this->Internal = new SampleSortInternals(input, columns, this->GetController());
+  }
+  else if (data)
+  {
+    switch (data->GetDataType())
     {
-      // Provide an empty data
-      this->Internal = new Internals<double>(input, nullptr, this->GetController());
+      vtkTemplateMacro(
+        this->Internal = new Internals<VTK_TT>(input, data, this->GetController()););
+      default:
+        vtkErrorMacro("Array type not supported: " << data->GetClassName());
+        return;
     }
   }
+  else
+  {
+    // Provide an empty data
+    this->Internal = new Internals<double>(input, nullptr, this->GetController());
+  }
+
+  entries.push_front({ column, this->SecondaryColumnsToSort, this->SelectedComponent,
+    this->InvertOrder, algorithm, this->Internal });
+  while (static_cast<int>(entries.size()) > this->MaximumNumberOfCachedSorts)
+  {
+    delete entries.back().Internal;
+    entries.pop_back();
+  }
 }
 //----------------------------------------------------------------------------
 void vtkSortedTableStreamer::PrintInfo(vtkTable* input)
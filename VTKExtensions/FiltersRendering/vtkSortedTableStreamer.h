@@ -9,6 +9,19 @@
  * This filter is used quickly get a sorted subset of a given vtkTable.
  * By sorted we mean a subset build from a global sort even if some optimisation
  * allow us to skip a global table sorting.
+ *
+ * The locally sorted index of a column is built once and kept until the input
+ * changes, so that requesting another block does not sort the table again. The
+ * indices of the most recently sorted columns are cached, see
+ * SetMaximumNumberOfCachedSorts(). In serial, a block is directly extracted
+ * from the sorted index. In parallel, the location of the block boundaries in
+ * each process are remembered so that the next and previous blocks can be
+ * extracted without searching for them in the distributed histogram.
+ *
+ * Two sort algorithms are available, see SetSortAlgorithm(). The default one
+ * builds a histogram of the sorted column to locate the requested block. The
+ * sample sort orders all the rows globally once, which is not affected by the
+ * distribution of the values, and supports sorting by several columns.
  */
 
 #ifndef vtkSortedTableStreamer_h
@@ -17,7 +30,9 @@
 #include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
 #include "vtkSmartPointer.h"                          // for vtkSmartPointer
 #include "vtkTableAlgorithm.h"
+#include <string>  // for std::string
 #include <utility> // for std::pair
+#include <vector>  // for std::vector
 
 class vtkDataArray;
 class vtkIdTypeArray;
@@ -33,7 +48,10 @@ private:
   class InternalsBase;
   template <class T>
   class Internals;
+  class SampleSortInternals;
+  struct SortCache;
   InternalsBase* Internal;
+  SortCache* Cache;
 
 public:
   static void PrintInfo(vtkTable* input);
@@ -107,6 +125,55 @@ public:
   void SetInvertOrder(int newValue);
   vtkGetMacro(InvertOrder, int);
 
+  enum SortAlgorithms
+  {
+    HISTOGRAM_SORT = 0,
+    SAMPLE_SORT = 1
+  };
+
+  ///@{
+  /**
+   * Choose the algorithm used to sort the rows across processes.
+   *
+   * HISTOGRAM_SORT (default) sorts the rows locally and iteratively refines a
+   * histogram of the sorted column, shared by all processes, to find the rows
+   * of the requested block, which are then gathered and sorted again.
+   *
+   * SAMPLE_SORT sorts the rows locally using vtkSMPTools, picks splitters from
+   * a regular sample of the sorted keys of every process and exchanges the
+   * keys, but not the rows, so that each process owns a contiguous range of
+   * the global order. Any block is then found without communicating the keys
+   * again. Ties are ordered by process id and row index, so the sort is stable
+   * and long runs of equal values are split between processes.
+   *
+   * Sorting by secondary columns always uses SAMPLE_SORT.
+   */
+  vtkSetClampMacro(SortAlgorithm, int, HISTOGRAM_SORT, SAMPLE_SORT);
+  vtkGetMacro(SortAlgorithm, int);
+  ///@}
+
+  ///@{
+  /**
+   * Add columns used to order the rows that have the same value in the column
+   * to sort, in the order they are added. Secondary columns are compared by
+   * value for single component arrays and by magnitude otherwise, in the same
+   * order as the column to sort.
+   */
+  void AddSecondaryColumnToSort(const char* columnName);
+  void RemoveAllSecondaryColumnsToSort();
+  ///@}
+
+  ///@{
+  /**
+   * Set the maximum number of sorted indices, one per sorted column, component
+   * and order, to keep in memory. Switching back to a cached column does not
+   * require sorting it again. Each index uses about 16 bytes per row.
+   * Default is 2.
+   */
+  vtkSetClampMacro(MaximumNumberOfCachedSorts, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumNumberOfCachedSorts, int);
+  ///@}
+
 protected:
   vtkSortedTableStreamer();
   ~vtkSortedTableStreamer() override;
@@ -132,6 +199,9 @@ protected:
   bool ShowFieldData = false;
   int SelectedComponent;
   int InvertOrder;
+  int MaximumNumberOfCachedSorts = 2;
+  int SortAlgorithm = HISTOGRAM_SORT;
+  std::vector<std::string> SecondaryColumnsToSort;
 
 private:
   vtkSortedTableStreamer(const vtkSortedTableStreamer&) = delete;
@@ -139,6 +209,13 @@ private:
 
   vtkSmartPointer<vtkTable> MergeBlocks(vtkPartitionedDataSet* cd);
 
+  /**
+   * Merge the partitions and add the composite and block name columns. The
+   * result is reused as long as the input does not change so that the sorted
+   * indices built for it stay valid.
+   */
+  vtkTable* PrepareInput(vtkPartitionedDataSet* ptd);
+
   /**
    * Add field data columns defined by block to the output table.
    */
@@ -0,0 +1,489 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkTiledImageCompressor.h"
+
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
+
+#include "vtk_lz4.h"
+#include "vtk_zlib.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+// Compressed stream layout:
+// [TiledImageHeader][vtkTypeInt32 size x NumberOfTiles][tile payloads...]
+// where the size of a tile identical to the previous frame is UNCHANGED_TILE.
+struct TiledImageHeader
+{
+  vtkTypeInt32 Width;
+  vtkTypeInt32 Height;
+  vtkTypeInt32 NumberOfComponents;
+  vtkTypeInt32 TileSize;
+  vtkTypeInt32 Codec;
+  vtkTypeInt32 NumberOfTiles;
+};
+
+constexpr vtkTypeInt32 UNCHANGED_TILE = -1;
+
+struct TileLayout
+{
+  int Width;
+  int Height;
+  int NumberOfComponents;
+  int TileSize;
+  int TilesX;
+  int TilesY;
+
+  TileLayout(int width, int height, int numComps, int tileSize)
+    : Width(width)
+    , Height(height)
+    , NumberOfComponents(numComps)
+    , TileSize(tileSize)
+    , TilesX((width + tileSize - 1) / tileSize)
+    , TilesY((height + tileSize - 1) / tileSize)
+  {
+  }
+
+  int GetNumberOfTiles() const { return this->TilesX * this->TilesY; }
+
+  vtkIdType GetFrameSize() const
+  {
+    return static_cast<vtkIdType>(this->Width) * this->Height * this->NumberOfComponents;
+  }
+
+  // Returns the tile pixel range as [x0, x1) x [y0, y1).
+  void GetTileExtent(vtkIdType tile, int& x0, int& x1, int& y0, int& y1) const
+  {
+    x0 = static_cast<int>(tile % this->TilesX) * this->TileSize;
+    y0 = static_cast<int>(tile / this->TilesX) * this->TileSize;
+    x1 = std::min(x0 + this->TileSize, this->Width);
+    y1 = std::min(y0 + this->TileSize, this->Height);
+  }
+
+  vtkIdType GetOffset(int x, int y) const
+  {
+    return (static_cast<vtkIdType>(y) * this->Width + x) * this->NumberOfComponents;
+  }
+
+  bool operator==(const TileLayout& other) const
+  {
+    return this->Width == other.Width && this->Height == other.Height &&
+      this->NumberOfComponents == other.NumberOfComponents && this->TileSize == other.TileSize;
+  }
+};
+
+bool CompressTile(const std::vector<unsigned char>& source, std::vector<unsigned char>& dest,
+  int codec, int level, vtkTypeInt32& size)
+{
+  if (codec == vtkTiledImageCompressor::ZLIB)
+  {
+    uLongf destSize = compressBound(static_cast<uLong>(source.size()));
+    dest.resize(destSize);
+    const int status = compress2(reinterpret_cast<Bytef*>(dest.data()), &destSize,
+      reinterpret_cast<const Bytef*>(source.data()), static_cast<uLong>(source.size()), level);
+    size = static_cast<vtkTypeInt32>(destSize);
+    return status == Z_OK;
+  }
+
+  const int bound = LZ4_compressBound(static_cast<int>(source.size()));
+  dest.resize(bound);
+  size = LZ4_compress_fast(reinterpret_cast<const char*>(source.data()),
+    reinterpret_cast<char*>(dest.data()), static_cast<int>(source.size()), bound,
+    /*acceleration=*/10 - level);
+  return size > 0;
+}
+
+bool DecompressTile(
+  const unsigned char* source, vtkTypeInt32 sourceSize, unsigned char* dest, size_t destSize, int codec)
+{
+  if (codec == vtkTiledImageCompressor::ZLIB)
+  {
+    uLongf size = static_cast<uLongf>(destSize);
+    const int status = uncompress(reinterpret_cast<Bytef*>(dest), &size,
+      reinterpret_cast<const Bytef*>(source), static_cast<uLong>(sourceSize));
+    return status == Z_OK && size == destSize;
+  }
+
+  const int size = LZ4_decompress_safe(reinterpret_cast<const char*>(source),
+    reinterpret_cast<char*>(dest), sourceSize, static_cast<int>(destSize));
+  return size == static_cast<int>(destSize);
+}
+}
+
+class vtkTiledImageCompressor::vtkInternals
+{
+public:
+  // Previous frame, used to skip unchanged tiles.
+  std::vector<unsigned char> PreviousFrame;
+  TileLayout PreviousLayout{ 0, 0, 0, 1 };
+  bool PreviousFrameValid = false;
+
+  // Per-tile compressed data and sizes, kept to avoid reallocations.
+  std::vector<std::vector<unsigned char>> Payloads;
+  std::vector<vtkTypeInt32> Sizes;
+  vtkSMPThreadLocal<std::vector<unsigned char>> Scratch;
+
+  bool HasPreviousFrame(const TileLayout& layout) const
+  {
+    return this->PreviousFrameValid && this->PreviousLayout == layout;
+  }
+
+  void PreparePreviousFrame(const TileLayout& layout)
+  {
+    if (!(this->PreviousLayout == layout))
+    {
+      this->PreviousFrameValid = false;
+      this->PreviousLayout = layout;
+    }
+    this->PreviousFrame.resize(layout.GetFrameSize());
+  }
+};
+
+vtkStandardNewMacro(vtkTiledImageCompressor);
+//----------------------------------------------------------------------------
+vtkTiledImageCompressor::vtkTiledImageCompressor()
+  : Codec(vtkTiledImageCompressor::LZ4)
+  , CompressionLevel(5)
+  , TileSize(128)
+  , SkipUnchangedTiles(true)
+  , ImageWidth(0)
+  , ImageHeight(0)
+  , NumberOfTiles(0)
+  , NumberOfChangedTiles(0)
+  , Internals(new vtkTiledImageCompressor::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkTiledImageCompressor::~vtkTiledImageCompressor() = default;
+
+//----------------------------------------------------------------------------
+void vtkTiledImageCompressor::SetImageResolution(int width, int height)
+{
+  if (this->ImageWidth != width || this->ImageHeight != height)
+  {
+    this->ImageWidth = width;
+    this->ImageHeight = height;
+    this->ResetPreviousFrame();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkTiledImageCompressor::ResetPreviousFrame()
+{
+  this->Internals->PreviousFrameValid = false;
+}
+
+//----------------------------------------------------------------------------
+int vtkTiledImageCompressor::Compress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot compress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  auto& internals = (*this->Internals);
+  const vtkIdType numPixels = this->Input->GetNumberOfTuples();
+  int width = this->ImageWidth;
+  int height = this->ImageHeight;
+  if (static_cast<vtkIdType>(width) * height != numPixels)
+  {
+    // resolution unknown, treat the input as a single row.
+    width = static_cast<int>(numPixels);
+    height = 1;
+  }
+
+  const TileLayout layout(width, height, this->Input->GetNumberOfComponents(), this->TileSize);
+  const int numTiles = layout.GetNumberOfTiles();
+  const bool keepPrevious = this->SkipUnchangedTiles;
+  const bool skipUnchanged = keepPrevious && internals.HasPreviousFrame(layout);
+  if (keepPrevious)
+  {
+    internals.PreparePreviousFrame(layout);
+  }
+
+  internals.Payloads.resize(numTiles);
+  internals.Sizes.resize(numTiles);
+
+  const unsigned char* input = this->Input->GetPointer(0);
+  unsigned char* previous = keepPrevious ? internals.PreviousFrame.data() : nullptr;
+  const int codec = this->Codec;
+  const int level = this->CompressionLevel;
+  std::atomic<bool> failed(false);
+  vtkSMPTools::For(0, numTiles, [&](vtkIdType begin, vtkIdType end) {
+    auto& scratch = internals.Scratch.Local();
+    for (vtkIdType tile = begin; tile < end; ++tile)
+    {
+      int x0, x1, y0, y1;
+      layout.GetTileExtent(tile, x0, x1, y0, y1);
+      const size_t rowSize = static_cast<size_t>(x1 - x0) * layout.NumberOfComponents;
+
+      if (skipUnchanged)
+      {
+        bool unchanged = true;
+        for (int y = y0; y < y1 && unchanged; ++y)
+        {
+          const vtkIdType offset = layout.GetOffset(x0, y);
+          unchanged = memcmp(input + offset, previous + offset, rowSize) == 0;
+        }
+        if (unchanged)
+        {
+          internals.Sizes[tile] = UNCHANGED_TILE;
+          continue;
+        }
+      }
+
+      scratch.resize(rowSize * (y1 - y0));
+      for (int y = y0; y < y1; ++y)
+      {
+        const vtkIdType offset = layout.GetOffset(x0, y);
+        memcpy(scratch.data() + (y - y0) * rowSize, input + offset, rowSize);
+        if (previous)
+        {
+          memcpy(previous + offset, input + offset, rowSize);
+        }
+      }
+      if (!::CompressTile(scratch, internals.Payloads[tile], codec, level, internals.Sizes[tile]))
+      {
+        failed = true;
+      }
+    }
+  });
+
+  internals.PreviousFrameValid = keepPrevious && !failed;
+  if (failed)
+  {
+    vtkErrorMacro("Tile compression failed.");
+    return VTK_ERROR;
+  }
+
+  // compute where each tile goes in the output stream.
+  std::vector<vtkIdType> offsets(numTiles);
+  vtkIdType totalSize =
+    static_cast<vtkIdType>(sizeof(TiledImageHeader) + sizeof(vtkTypeInt32) * numTiles);
+  this->NumberOfTiles = numTiles;
+  this->NumberOfChangedTiles = 0;
+  for (int tile = 0; tile < numTiles; ++tile)
+  {
+    offsets[tile] = totalSize;
+    if (internals.Sizes[tile] != UNCHANGED_TILE)
+    {
+      totalSize += internals.Sizes[tile];
+      ++this->NumberOfChangedTiles;
+    }
+  }
+
+  const TiledImageHeader header = { width, height, layout.NumberOfComponents, this->TileSize,
+    codec, numTiles };
+  this->Output->SetNumberOfComponents(1);
+  this->Output->SetNumberOfTuples(totalSize);
+  unsigned char* output = this->Output->GetPointer(0);
+  memcpy(output, &header, sizeof(header));
+  memcpy(output + sizeof(header), internals.Sizes.data(), sizeof(vtkTypeInt32) * numTiles);
+  vtkSMPTools::For(0, numTiles, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType tile = begin; tile < end; ++tile)
+    {
+      if (internals.Sizes[tile] != UNCHANGED_TILE)
+      {
+        memcpy(output + offsets[tile], internals.Payloads[tile].data(), internals.Sizes[tile]);
+      }
+    }
+  });
+  return VTK_OK;
+}
+
+//----------------------------------------------------------------------------
+int vtkTiledImageCompressor::Decompress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot decompress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  auto& internals = (*this->Internals);
+  const unsigned char* input = this->Input->GetPointer(0);
+  const vtkIdType inputSize = this->Input->GetNumberOfTuples() * this->Input->GetNumberOfComponents();
+  TiledImageHeader header;
+  if (inputSize < static_cast<vtkIdType>(sizeof(header)))
+  {
+    vtkErrorMacro("Invalid compressed stream.");
+    return VTK_ERROR;
+  }
+  memcpy(&header, input, sizeof(header));
+
+  const TileLayout layout(header.Width, header.Height, header.NumberOfComponents, header.TileSize);
+  const int numTiles = header.NumberOfTiles;
+  if (header.TileSize <= 0 || numTiles != layout.GetNumberOfTiles() ||
+    layout.GetFrameSize() !=
+      this->Output->GetNumberOfTuples() * this->Output->GetNumberOfComponents() ||
+    inputSize < static_cast<vtkIdType>(sizeof(header) + sizeof(vtkTypeInt32) * numTiles))
+  {
+    vtkErrorMacro("Compressed stream does not match the output image.");
+    return VTK_ERROR;
+  }
+
+  internals.Sizes.resize(numTiles);
+  memcpy(internals.Sizes.data(), input + sizeof(header), sizeof(vtkTypeInt32) * numTiles);
+
+  std::vector<vtkIdType> offsets(numTiles);
+  vtkIdType totalSize =
+    static_cast<vtkIdType>(sizeof(TiledImageHeader) + sizeof(vtkTypeInt32) * numTiles);
+  bool hasUnchanged = false;
+  this->NumberOfTiles = numTiles;
+  this->NumberOfChangedTiles = 0;
+  for (int tile = 0; tile < numTiles; ++tile)
+  {
+    offsets[tile] = totalSize;
+    if (internals.Sizes[tile] == UNCHANGED_TILE)
+    {
+      hasUnchanged = true;
+    }
+    else
+    {
+      totalSize += internals.Sizes[tile];
+      ++this->NumberOfChangedTiles;
+    }
+  }
+  if (totalSize > inputSize)
+  {
+    vtkErrorMacro("Truncated compressed stream.");
+    return VTK_ERROR;
+  }
+  if (hasUnchanged && !internals.HasPreviousFrame(layout))
+  {
+    vtkErrorMacro("Compressed stream refers to a previous frame that is not available.");
+    return VTK_ERROR;
+  }
+
+  const bool keepPrevious = this->SkipUnchangedTiles || hasUnchanged;
+  if (keepPrevious)
+  {
+    internals.PreparePreviousFrame(layout);
+  }
+
+  unsigned char* output = this->Output->GetPointer(0);
+  unsigned char* previous = keepPrevious ? internals.PreviousFrame.data() : nullptr;
+  std::atomic<bool> failed(false);
+  vtkSMPTools::For(0, numTiles, [&](vtkIdType begin, vtkIdType end) {
+    auto& scratch = internals.Scratch.Local();
+    for (vtkIdType tile = begin; tile < end; ++tile)
+    {
+      int x0, x1, y0, y1;
+      layout.GetTileExtent(tile, x0, x1, y0, y1);
+      const size_t rowSize = static_cast<size_t>(x1 - x0) * layout.NumberOfComponents;
+
+      if (internals.Sizes[tile] == UNCHANGED_TILE)
+      {
+        for (int y = y0; y < y1; ++y)
+        {
+          const vtkIdType offset = layout.GetOffset(x0, y);
+          memcpy(output + offset, previous + offset, rowSize);
+        }
+        continue;
+      }
+
+      scratch.resize(rowSize * (y1 - y0));
+      if (!::DecompressTile(input + offsets[tile], internals.Sizes[tile], scratch.data(),
+            scratch.size(), header.Codec))
+      {
+        failed = true;
+        continue;
+      }
+      for (int y = y0; y < y1; ++y)
+      {
+        const vtkIdType offset = layout.GetOffset(x0, y);
+        memcpy(output + offset, scratch.data() + (y - y0) * rowSize, rowSize);
+        if (previous)
+        {
+          memcpy(previous + offset, output + offset, rowSize);
+        }
+      }
+    }
+  });
+
+  internals.PreviousFrameValid = keepPrevious && !failed;
+  if (failed)
+  {
+    vtkErrorMacro("Tile decompression failed.");
+    return VTK_ERROR;
+  }
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+void vtkTiledImageCompressor::SaveConfiguration(vtkMultiProcessStream* stream)
+{
+  this->Superclass::SaveConfiguration(stream);
+  *stream << this->Codec << this->CompressionLevel << this->TileSize
+          << (this->SkipUnchangedTiles ? 1 : 0);
+}
+
+//-----------------------------------------------------------------------------
+bool vtkTiledImageCompressor::RestoreConfiguration(vtkMultiProcessStream* stream)
+{
+  if (this->Superclass::RestoreConfiguration(stream))
+  {
+    int codec, level, tileSize, skipUnchanged;
+    *stream >> codec >> level >> tileSize >> skipUnchanged;
+    this->SetCodec(codec);
+    this->SetCompressionLevel(level);
+    this->SetTileSize(tileSize);
+    this->SetSkipUnchangedTiles(skipUnchanged != 0);
+    this->ResetPreviousFrame();
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkTiledImageCompressor::SaveConfiguration()
+{
+  std::ostringstream oss;
+  oss << this->Superclass::SaveConfiguration() << " " << this->Codec << " "
+      << this->CompressionLevel << " " << this->TileSize << " "
+      << (this->SkipUnchangedTiles ? 1 : 0);
+  this->SetConfiguration(oss.str().c_str());
+  return this->Configuration;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkTiledImageCompressor::RestoreConfiguration(const char* stream)
+{
+  stream = this->Superclass::RestoreConfiguration(stream);
+  if (stream)
+  {
+    std::istringstream iss(stream);
+    int codec, level, tileSize, skipUnchanged;
+    iss >> codec >> level >> tileSize >> skipUnchanged;
+    this->SetCodec(codec);
+    this->SetCompressionLevel(level);
+    this->SetTileSize(tileSize);
+    this->SetSkipUnchangedTiles(skipUnchanged != 0);
+    this->ResetPreviousFrame();
+    return stream + iss.tellg();
+  }
+  return nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkTiledImageCompressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Codec: " << this->Codec << endl;
+  os << indent << "CompressionLevel: " << this->CompressionLevel << endl;
+  os << indent << "TileSize: " << this->TileSize << endl;
+  os << indent << "SkipUnchangedTiles: " << this->SkipUnchangedTiles << endl;
+  os << indent << "NumberOfTiles: " << this->NumberOfTiles << endl;
+  os << indent << "NumberOfChangedTiles: " << this->NumberOfChangedTiles << endl;
+}
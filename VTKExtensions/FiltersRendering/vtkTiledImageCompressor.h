@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkTiledImageCompressor
+ * @brief   Image compressor/decompressor that compresses tiles in parallel.
+ *
+ * vtkTiledImageCompressor splits the image in square tiles of `TileSize`
+ * pixels which are compressed, and decompressed, concurrently using
+ * vtkSMPTools. Each tile is compressed with the selected `Codec`: LZ4 for
+ * speed or zlib when bandwidth matters more than latency.
+ *
+ * When `SkipUnchangedTiles` is enabled, the compressor keeps a copy of the
+ * previous frame and tiles identical to the previous frame are not
+ * transmitted. The decompressor keeps the previous frame as well and fills
+ * these tiles from it. This requires that every compressed frame is
+ * decompressed by the peer compressor, which is the case for
+ * vtkPVClientServerSynchronizedRenderers. The previous frame is discarded
+ * whenever the image resolution or the configuration changes.
+ *
+ * Compression is always loss-less.
+ */
+
+#ifndef vtkTiledImageCompressor_h
+#define vtkTiledImageCompressor_h
+
+#include "vtkImageCompressor.h"
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for exports
+
+#include <memory> // for std::unique_ptr
+
+class vtkMultiProcessStream;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkTiledImageCompressor : public vtkImageCompressor
+{
+public:
+  static vtkTiledImageCompressor* New();
+  vtkTypeMacro(vtkTiledImageCompressor, vtkImageCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum Codecs
+  {
+    LZ4 = 0,
+    ZLIB = 1
+  };
+
+  ///@{
+  /**
+   * Set the codec used to compress each tile. Default is LZ4.
+   */
+  vtkSetClampMacro(Codec, int, LZ4, ZLIB);
+  vtkGetMacro(Codec, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set the compression level between 1 (fastest) and 9 (smallest). For zlib
+   * this is the zlib compression level, for LZ4 it controls the acceleration
+   * factor (9 being the default LZ4 compression). Default is 5.
+   */
+  vtkSetClampMacro(CompressionLevel, int, 1, 9);
+  vtkGetMacro(CompressionLevel, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set the tile size in pixels. Default is 128.
+   */
+  vtkSetClampMacro(TileSize, int, 16, 4096);
+  vtkGetMacro(TileSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * When enabled, tiles that did not change since the previous frame are not
+   * transmitted. Default is true.
+   */
+  vtkSetMacro(SkipUnchangedTiles, bool);
+  vtkGetMacro(SkipUnchangedTiles, bool);
+  vtkBooleanMacro(SkipUnchangedTiles, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Returns the number of tiles, and the number of tiles transmitted, for the
+   * last compressed or decompressed frame.
+   */
+  vtkGetMacro(NumberOfTiles, int);
+  vtkGetMacro(NumberOfChangedTiles, int);
+  ///@}
+
+  ///@{
+  /**
+   * Compress/Decompress data array on the objects input with results
+   * in the objects output. See also Set/GetInput/Output.
+   */
+  int Compress() override;
+  int Decompress() override;
+  ///@}
+
+  /**
+   * Overridden to discard the previous frame when the resolution changes.
+   */
+  void SetImageResolution(int width, int height) override;
+
+  /**
+   * Discard the previous frame so that the next frame is sent in full.
+   */
+  void ResetPreviousFrame();
+
+  ///@{
+  /**
+   * Serialize/Restore compressor configuration (but not the data) into the stream.
+   * The format is: [ClassName, LossLessMode, Codec, CompressionLevel, TileSize,
+   * SkipUnchangedTiles].
+   */
+  void SaveConfiguration(vtkMultiProcessStream* stream) override;
+  bool RestoreConfiguration(vtkMultiProcessStream* stream) override;
+  const char* SaveConfiguration() override;
+  const char* RestoreConfiguration(const char* stream) override;
+  ///@}
+
+protected:
+  vtkTiledImageCompressor();
+  ~vtkTiledImageCompressor() override;
+
+  int Codec;
+  int CompressionLevel;
+  int TileSize;
+  bool SkipUnchangedTiles;
+  int ImageWidth;
+  int ImageHeight;
+  int NumberOfTiles;
+  int NumberOfChangedTiles;
+
+private:
+  vtkTiledImageCompressor(const vtkTiledImageCompressor&) = delete;
+  void operator=(const vtkTiledImageCompressor&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
@@ -44,5 +44,20 @@ int TestPEnSightBinaryGoldReader(int argc, char* argv[])
     }
   }
 
+  // reading through a file stream instead of memory-mapped files must
+  // produce the same output.
+  vtkNew<vtkPGenericEnSightReader> streamReader;
+  streamReader->SetCaseFileName(fname);
+  streamReader->UseMemoryMappedFilesOff();
+  streamReader->Update();
+  vtkUnstructuredGrid* streamUG =
+    vtkUnstructuredGrid::SafeDownCast(streamReader->GetOutput()->GetBlock(0));
+  if (!streamUG || streamUG->GetNumberOfPoints() != ug->GetNumberOfPoints() ||
+    streamUG->GetNumberOfCells() != ug->GetNumberOfCells())
+  {
+    std::cerr << "Memory-mapped and stream reads differ." << std::endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
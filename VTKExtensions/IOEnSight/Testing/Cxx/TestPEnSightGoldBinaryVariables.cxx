@@ -0,0 +1,378 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCell.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkInformation.h"
+#include "vtkMPIController.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPEnSightGoldBinaryReader.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkMultiBlockDataSet> Read(const char* fname)
+{
+  vtkNew<vtkPEnSightGoldBinaryReader> reader;
+  reader->SetCaseFileName(fname);
+  reader->Update();
+  return reader->GetOutput();
+}
+
+// Reads fname count times and returns the time taken by a read.
+double TimeRead(const char* fname, int count)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  for (int cc = 0; cc < count; ++cc)
+  {
+    Read(fname);
+  }
+  timer->StopTimer();
+  return timer->GetElapsedTime() / count;
+}
+
+class BinaryFile
+{
+public:
+  explicit BinaryFile(const std::string& fname)
+    : Stream(fname.c_str(), std::ios::out | std::ios::binary)
+  {
+  }
+
+  void Line(const std::string& line)
+  {
+    char buffer[80] = {};
+    strncpy(buffer, line.c_str(), 79);
+    this->Stream.write(buffer, 80);
+  }
+
+  void Int(int value) { this->Stream.write(reinterpret_cast<const char*>(&value), sizeof(int)); }
+
+  template <typename T>
+  void Values(const std::vector<T>& values)
+  {
+    this->Stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+  }
+
+private:
+  vtksys::ofstream Stream;
+};
+
+// Writes a case with parts of size^3 hexahedra, side by side along x, a
+// scalar per node equal to x - 2y + 3z and a vector per element equal to the
+// lowest corner of the element. Returns the name of the case file.
+std::string WriteCase(const std::string& directory, int parts, int size)
+{
+  const int n = size + 1;
+  const int numPts = n * n * n;
+  const int numCells = size * size * size;
+
+  BinaryFile geometry(directory + "/synthetic.geo");
+  geometry.Line("C Binary");
+  geometry.Line("synthetic multi-part case");
+  geometry.Line("written by TestPEnSightGoldBinaryVariables");
+  geometry.Line("node id off");
+  geometry.Line("element id off");
+  BinaryFile scalars(directory + "/synthetic.scl");
+  scalars.Line("pressure");
+  BinaryFile vectors(directory + "/synthetic.vel");
+  vectors.Line("velocity");
+
+  for (int part = 0; part < parts; ++part)
+  {
+    std::vector<float> x(numPts), y(numPts), z(numPts), pressure(numPts);
+    for (int k = 0; k < n; ++k)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        for (int i = 0; i < n; ++i)
+        {
+          const int pt = i + n * (j + n * k);
+          x[pt] = static_cast<float>(i + part * (n + 1));
+          y[pt] = static_cast<float>(j);
+          z[pt] = static_cast<float>(k);
+          pressure[pt] = x[pt] - 2 * y[pt] + 3 * z[pt];
+        }
+      }
+    }
+    std::vector<int> connectivity;
+    std::vector<float> vx, vy, vz;
+    for (int k = 0; k < size; ++k)
+    {
+      for (int j = 0; j < size; ++j)
+      {
+        for (int i = 0; i < size; ++i)
+        {
+          const int pt = 1 + i + n * (j + n * k); // EnSight starts #ing at 1.
+          for (int offset : { 0, 1, n + 1, n, n * n, n * n + 1, n * n + n + 1, n * n + n })
+          {
+            connectivity.push_back(pt + offset);
+          }
+          vx.push_back(x[pt - 1]);
+          vy.push_back(y[pt - 1]);
+          vz.push_back(z[pt - 1]);
+        }
+      }
+    }
+
+    geometry.Line("part");
+    geometry.Int(part + 1);
+    geometry.Line("part " + std::to_string(part));
+    geometry.Line("coordinates");
+    geometry.Int(numPts);
+    geometry.Values(x);
+    geometry.Values(y);
+    geometry.Values(z);
+    geometry.Line("hexa8");
+    geometry.Int(numCells);
+    geometry.Values(connectivity);
+
+    scalars.Line("part");
+    scalars.Int(part + 1);
+    scalars.Line("coordinates");
+    scalars.Values(pressure);
+
+    vectors.Line("part");
+    vectors.Int(part + 1);
+    vectors.Line("hexa8");
+    vectors.Values(vx);
+    vectors.Values(vy);
+    vectors.Values(vz);
+  }
+
+  const std::string caseName = directory + "/synthetic.case";
+  vtksys::ofstream caseFile(caseName.c_str());
+  caseFile << "FORMAT\n"
+           << "type: ensight gold\n\n"
+           << "GEOMETRY\n"
+           << "model: synthetic.geo\n\n"
+           << "VARIABLE\n"
+           << "scalar per node: pressure synthetic.scl\n"
+           << "vector per element: velocity synthetic.vel\n";
+  return caseName;
+}
+
+// Checks the parts and variables read from the case written by WriteCase,
+// whatever the part of the points and cells read by this process.
+bool VerifySynthetic(vtkMultiBlockDataSet* output, int parts)
+{
+  if (!output || static_cast<int>(output->GetNumberOfBlocks()) != parts)
+  {
+    cerr << "Expected " << parts << " parts." << endl;
+    return false;
+  }
+  for (int part = 0; part < parts; ++part)
+  {
+    const std::string name = "part " + std::to_string(part);
+    auto ds = vtkDataSet::SafeDownCast(output->GetBlock(part));
+    const char* blockName = output->GetMetaData(part)->Get(vtkCompositeDataSet::NAME());
+    if (!ds || !blockName || name != blockName)
+    {
+      cerr << "Part " << part << " is missing or misnamed." << endl;
+      return false;
+    }
+    vtkDataArray* pressure = ds->GetPointData()->GetArray("pressure");
+    vtkDataArray* velocity = ds->GetCellData()->GetArray("velocity");
+    if (!pressure || !velocity || pressure->GetNumberOfTuples() != ds->GetNumberOfPoints() ||
+      velocity->GetNumberOfTuples() != ds->GetNumberOfCells())
+    {
+      cerr << "Variables of part " << part << " are missing." << endl;
+      return false;
+    }
+    for (vtkIdType pt = 0; pt < ds->GetNumberOfPoints(); ++pt)
+    {
+      double p[3];
+      ds->GetPoint(pt, p);
+      if (pressure->GetComponent(pt, 0) != p[0] - 2 * p[1] + 3 * p[2])
+      {
+        cerr << "Wrong pressure at point " << pt << " of part " << part << endl;
+        return false;
+      }
+    }
+    for (vtkIdType cell = 0; cell < ds->GetNumberOfCells(); ++cell)
+    {
+      double bounds[6];
+      ds->GetCell(cell)->GetBounds(bounds);
+      double v[3];
+      velocity->GetTuple(cell, v);
+      if (v[0] != bounds[0] || v[1] != bounds[2] || v[2] != bounds[4])
+      {
+        cerr << "Wrong velocity at cell " << cell << " of part " << part << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool CompareArrays(vtkFieldData* expected, vtkFieldData* actual)
+{
+  if (expected->GetNumberOfArrays() != actual->GetNumberOfArrays())
+  {
+    cerr << "Different number of arrays." << endl;
+    return false;
+  }
+  for (int idx = 0; idx < expected->GetNumberOfArrays(); ++idx)
+  {
+    vtkDataArray* array1 = expected->GetArray(idx);
+    vtkDataArray* array2 = actual->GetArray(array1 ? array1->GetName() : nullptr);
+    if (!array1 || !array2 || array1->GetNumberOfValues() != array2->GetNumberOfValues() ||
+      array1->GetNumberOfComponents() != array2->GetNumberOfComponents())
+    {
+      cerr << "Array " << idx << " differs." << endl;
+      return false;
+    }
+    for (vtkIdType cc = 0; cc < array1->GetNumberOfValues(); ++cc)
+    {
+      if (array1->GetVariantValue(cc) != array2->GetVariantValue(cc))
+      {
+        cerr << "Value " << cc << " of array '" << array1->GetName() << "' differs." << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Compares the variables read with a single thread with the ones read with
+// the default vtkSMPTools backend.
+bool CompareReads(const char* fname)
+{
+  vtkSmartPointer<vtkMultiBlockDataSet> expected;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { expected = Read(fname); });
+  vtkSmartPointer<vtkMultiBlockDataSet> actual = Read(fname);
+
+  if (!expected || !actual || expected->GetNumberOfBlocks() != actual->GetNumberOfBlocks())
+  {
+    cerr << "Different outputs." << endl;
+    return false;
+  }
+  int numberOfArrays = 0;
+  for (unsigned int idx = 0; idx < expected->GetNumberOfBlocks(); ++idx)
+  {
+    auto ds1 = vtkDataSet::SafeDownCast(expected->GetBlock(idx));
+    auto ds2 = vtkDataSet::SafeDownCast(actual->GetBlock(idx));
+    if ((ds1 == nullptr) != (ds2 == nullptr))
+    {
+      cerr << "Block " << idx << " differs." << endl;
+      return false;
+    }
+    if (ds1 &&
+      (ds1->GetNumberOfPoints() != ds2->GetNumberOfPoints() ||
+        ds1->GetNumberOfCells() != ds2->GetNumberOfCells() ||
+        !CompareArrays(ds1->GetPointData(), ds2->GetPointData()) ||
+        !CompareArrays(ds1->GetCellData(), ds2->GetCellData())))
+    {
+      cerr << "Variables of block " << idx << " differ." << endl;
+      return false;
+    }
+    if (ds1)
+    {
+      numberOfArrays +=
+        ds1->GetPointData()->GetNumberOfArrays() + ds1->GetCellData()->GetNumberOfArrays();
+    }
+  }
+  if (numberOfArrays == 0)
+  {
+    cerr << "No variables were read." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+// Compares the reads of TEST_bin.case and of a synthetic multi-part case with
+// a single thread and with the default vtkSMPTools backend, and checks the
+// values read from the synthetic case. Use --parts, --size, --count and
+// --benchmark to time the reads of the synthetic case with 1, 2, 4... threads.
+int TestPEnSightGoldBinaryVariables(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv, 0);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+
+  int parts = 16;
+  int size = 20;
+  int count = 1;
+  bool benchmark = false;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument(
+    "--parts", argT::EQUAL_ARGUMENT, &parts, "Optionally specify the number of parts.");
+  arg.AddArgument("--size", argT::EQUAL_ARGUMENT, &size,
+    "Optionally specify the number of hexahedra along each side of a part.");
+  arg.AddArgument(
+    "--count", argT::EQUAL_ARGUMENT, &count, "Optionally specify the number of timed reads.");
+  arg.AddBooleanArgument("--benchmark", &benchmark, "Print the time taken by the reads.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse() || parts < 2 || size < 1 || count < 1)
+  {
+    cerr << "Problem parsing arguments" << endl;
+    controller->Finalize();
+    return EXIT_FAILURE;
+  }
+
+  char* fname =
+    vtkTestUtilities::ExpandDataFileName(argc, argv, "Testing/Data/EnSight/TEST_bin.case");
+  int success = CompareReads(fname) ? 1 : 0;
+  delete[] fname;
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string directory = std::string(tempDir) + "/TestPEnSightGoldBinaryVariables";
+  delete[] tempDir;
+  std::string caseName = directory + "/synthetic.case";
+  if (rank == 0)
+  {
+    vtksys::SystemTools::MakeDirectory(directory);
+    caseName = WriteCase(directory, parts, size);
+  }
+  controller->Barrier();
+
+  if (!CompareReads(caseName.c_str()) || !VerifySynthetic(Read(caseName.c_str()), parts))
+  {
+    success = 0;
+  }
+
+  if (benchmark)
+  {
+    const int maxThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+    for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+      double time = 0;
+      controller->Barrier();
+      vtkSMPTools::LocalScope(
+        vtkSMPTools::Config{ numThreads }, [&]() { time = TimeRead(caseName.c_str(), count); });
+      if (rank == 0)
+      {
+        cout << parts << " parts of " << size << "^3 hexahedra, "
+             << controller->GetNumberOfProcesses() << " ranks, " << numThreads
+             << " threads: " << time << " s" << endl;
+      }
+    }
+  }
+
+  int globalSuccess = 0;
+  controller->AllReduce(&success, &globalSuccess, 1, vtkCommunicator::MIN_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return globalSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
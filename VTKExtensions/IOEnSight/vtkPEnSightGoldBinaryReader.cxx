@@ -8,21 +8,210 @@
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkLogger.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include "vtksys/Encoding.hxx"
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <atomic>
 #include <cctype>
+#include <set>
+#include <sstream>
+#include <streambuf>
 #include <string>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+//============================================================================
+// Read-only stream buffer over a memory-mapped file. Seeking only moves the
+// get pointer, and reading copies from the mapping, so skipping parts of the
+// file does not issue any I/O request.
+class vtkMappedFileBuffer : public std::streambuf
+{
+public:
+  explicit vtkMappedFileBuffer(const char* filename)
+  {
+#ifdef _WIN32
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(filename).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return;
+    }
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+    {
+      HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mapping != nullptr)
+      {
+        this->Data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        this->Size = this->Data ? static_cast<size_t>(size.QuadPart) : 0;
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return;
+    }
+    struct stat fs;
+    if (fstat(fd, &fs) == 0 && fs.st_size > 0)
+    {
+      void* data = mmap(nullptr, static_cast<size_t>(fs.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED)
+      {
+        this->Data = static_cast<char*>(data);
+        this->Size = static_cast<size_t>(fs.st_size);
+      }
+    }
+    close(fd);
+#endif
+    if (this->Data)
+    {
+      this->setg(this->Data, this->Data, this->Data + this->Size);
+    }
+  }
+
+  ~vtkMappedFileBuffer() override
+  {
+    if (this->Data)
+    {
+#ifdef _WIN32
+      UnmapViewOfFile(this->Data);
+#else
+      munmap(this->Data, this->Size);
+#endif
+    }
+  }
+
+  bool IsMapped() const { return this->Data != nullptr; }
+
+protected:
+  pos_type seekoff(off_type offset, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+  {
+    if (!(which & std::ios_base::in))
+    {
+      return pos_type(off_type(-1));
+    }
+    off_type position = offset;
+    if (dir == std::ios_base::cur)
+    {
+      position += this->gptr() - this->eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+      position += static_cast<off_type>(this->Size);
+    }
+    if (position < 0 || position > static_cast<off_type>(this->Size))
+    {
+      return pos_type(off_type(-1));
+    }
+    this->setg(this->Data, this->Data + position, this->Data + this->Size);
+    return pos_type(position);
+  }
+
+  pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+  {
+    return this->seekoff(off_type(position), std::ios_base::beg, which);
+  }
+
+private:
+  vtkMappedFileBuffer(const vtkMappedFileBuffer&) = delete;
+  void operator=(const vtkMappedFileBuffer&) = delete;
+
+  char* Data = nullptr;
+  size_t Size = 0;
+};
+
+//============================================================================
+// istream owning its vtkMappedFileBuffer, so that it can be used as IFile.
+class vtkMappedFileStream : public std::istream
+{
+public:
+  explicit vtkMappedFileStream(const char* filename)
+    : std::istream(nullptr)
+    , Buffer(filename)
+  {
+    this->init(&this->Buffer);
+  }
+
+  bool IsMapped() const { return this->Buffer.IsMapped(); }
+
+private:
+  vtkMappedFileBuffer Buffer;
+};
+
+const char* FileOffsetsIndexHeader = "# EnSight Gold binary file offsets v1";
+
+enum GeometryPartType
+{
+  UNSTRUCTURED_PART,
+  STRUCTURED_PART,
+  RECTILINEAR_PART,
+  IMAGE_PART
+};
+
+// Returns the type of the part whose first line, following its description,
+// is line.
+GeometryPartType GetGeometryPartType(const char* line)
+{
+  char subLine[80];
+  if (strncmp(line, "block", 5) != 0)
+  {
+    return UNSTRUCTURED_PART;
+  }
+  if (sscanf(line, " %*s %s", subLine) == 1)
+  {
+    if (strncmp(subLine, "rectilinear", 11) == 0)
+    {
+      return RECTILINEAR_PART;
+    }
+    if (strncmp(subLine, "uniform", 7) == 0)
+    {
+      return IMAGE_PART;
+    }
+  }
+  return STRUCTURED_PART;
+}
+}
+
+//============================================================================
+struct vtkPEnSightGoldBinaryReader::GeometryPart
+{
+  int RealId;
+  std::string Name;
+  // Position of the line following the part description.
+  long Offset;
+  GeometryPartType Type;
+  // Index of the point and cell ids of the part.
+  int IdsIndex;
+};
+
 vtkStandardNewMacro(vtkPEnSightGoldBinaryReader);
 
 // This is half the precision of an int.
@@ -79,11 +268,28 @@ int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
     // Find out how big the file is.
     this->FileSize = (long)(fs.st_size);
 
+    if (this->UseMemoryMappedFiles)
+    {
+      vtkMappedFileStream* stream = new vtkMappedFileStream(filename);
+      if (stream->IsMapped())
+      {
+        this->IFile = stream;
+      }
+      else
+      {
+        vtkDebugMacro(<< "Could not map " << filename << ", using a file stream.");
+        delete stream;
+      }
+    }
+
+    if (this->IFile == nullptr)
+    {
 #ifdef _WIN32
-    this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
+      this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
 #else
-    this->IFile = new vtksys::ifstream(filename, ios::in);
+      this->IFile = new vtksys::ifstream(filename, ios::in);
 #endif
+    }
   }
   else
   {
@@ -325,6 +531,27 @@ int vtkPEnSightGoldBinaryReader::ReadGeometryFile(
     lineRead = this->ReadLine(line); // "part"
   }
 
+  // Fortran files, whose records are not skipped the way they are read, and
+  // files whose parts cannot be located are read part after part.
+  if (lineRead > 0 && strncmp(line, "part", 4) == 0 && !this->Fortran)
+  {
+    const long firstPartOffset = static_cast<long>(this->IFile->tellg()) - 80;
+    std::vector<GeometryPart> parts;
+    if (this->IndexGeometryParts(line, parts) >= 0 && parts.size() > 1)
+    {
+      const int result = this->ReadGeometryParts(this->GetFullFileName(fileName), parts, output);
+      if (result >= 0)
+      {
+        delete this->IFile;
+        this->IFile = nullptr;
+        return result;
+      }
+    }
+    this->IFile->clear();
+    this->IFile->seekg(firstPartOffset, ios::beg);
+    lineRead = this->ReadLine(line); // "part"
+  }
+
   while (lineRead > 0 && strncmp(line, "part", 4) == 0)
   {
     this->ReadPartId(&partId);
@@ -404,6 +631,200 @@ int vtkPEnSightGoldBinaryReader::ReadGeometryFile(
   return 1;
 }
 
+//----------------------------------------------------------------------------
+int vtkPEnSightGoldBinaryReader::IndexGeometryParts(
+  char line[80], std::vector<GeometryPart>& parts)
+{
+  int lineRead = 1;
+  while (lineRead > 0 && strncmp(line, "part", 4) == 0)
+  {
+    GeometryPart part;
+    int partId;
+    if (!this->ReadPartId(&partId))
+    {
+      return -1;
+    }
+    partId--; // EnSight starts #ing at 1.
+    if (partId < 0 || partId >= MAXIMUM_PART_ID)
+    {
+      return -1;
+    }
+    part.RealId = this->InsertNewPartId(partId);
+
+    this->ReadLine(line); // part description line
+    part.Name = line;
+    part.Offset = static_cast<long>(this->IFile->tellg());
+    this->ReadLine(line);
+    part.Type = ::GetGeometryPartType(line);
+    part.IdsIndex = -1;
+    switch (part.Type)
+    {
+      case RECTILINEAR_PART:
+        lineRead = this->SkipRectilinearGrid(line);
+        break;
+      case IMAGE_PART:
+        lineRead = this->SkipImageData(line);
+        break;
+      case STRUCTURED_PART:
+        lineRead = this->SkipStructuredGrid(line);
+        break;
+      default:
+        lineRead = this->SkipUnstructuredGrid(line);
+        break;
+    }
+    if (lineRead < 0)
+    {
+      return -1;
+    }
+    parts.push_back(part);
+  }
+  return lineRead;
+}
+
+//----------------------------------------------------------------------------
+int vtkPEnSightGoldBinaryReader::ReadGeometryParts(
+  const std::string& fileName, std::vector<GeometryPart>& parts, vtkMultiBlockDataSet* output)
+{
+  // Register the parts as the Create methods do, keeping the previous ids to
+  // restore them if the parts must be read one after the other, such as parts
+  // sharing their ids, which overwrite each other.
+  vtkNew<vtkIdList> previousUnstructuredPartIds;
+  previousUnstructuredPartIds->DeepCopy(this->UnstructuredPartIds);
+  vtkNew<vtkIdList> previousStructuredPartIds;
+  previousStructuredPartIds->DeepCopy(this->StructuredPartIds);
+  auto restorePartIds = [&]()
+  {
+    this->UnstructuredPartIds->DeepCopy(previousUnstructuredPartIds);
+    this->StructuredPartIds->DeepCopy(previousStructuredPartIds);
+    return -1;
+  };
+  std::set<int> idsIndices;
+  for (auto& part : parts)
+  {
+    if (part.Type == UNSTRUCTURED_PART)
+    {
+      vtkDataSet* ds = this->GetDataSetFromBlock(output, part.RealId);
+      if (ds == nullptr || !ds->IsA("vtkUnstructuredGrid"))
+      {
+        this->UnstructuredPartIds->InsertNextId(part.RealId);
+      }
+      part.IdsIndex = this->UnstructuredPartIds->IsId(part.RealId);
+    }
+    else
+    {
+      if (this->StructuredPartIds->IsId(part.RealId) == -1)
+      {
+        this->StructuredPartIds->InsertNextId(part.RealId);
+      }
+      part.IdsIndex = part.RealId;
+    }
+    if (!idsIndices.insert(part.IdsIndex).second)
+    {
+      return restorePartIds();
+    }
+  }
+
+  // Create the ids of all parts now, so that their containers are not resized
+  // while the ids of the parts read are moved to them.
+  for (const auto& part : parts)
+  {
+    if (!this->GetPointIds(part.IdsIndex) ||
+      !this->GetCellIds(part.IdsIndex, vtkPEnSightReader::NUMBER_OF_ELEMENT_TYPES - 1))
+    {
+      return restorePartIds();
+    }
+  }
+  const int localProcessId = this->GetMultiProcessLocalProcessId();
+  const int numberOfProcesses = this->GetMultiProcessNumberOfProcesses();
+
+  vtkNew<vtkPartitionedDataSetCollection> collection;
+  collection->SetNumberOfPartitionedDataSets(static_cast<unsigned int>(parts.size()));
+  for (unsigned int cc = 0; cc < parts.size(); ++cc)
+  {
+    vtkNew<vtkPartitionedDataSet> partition;
+    partition->SetNumberOfPartitions(1);
+    collection->SetPartitionedDataSet(cc, partition);
+    collection->GetMetaData(cc)->Set(vtkCompositeDataSet::NAME(), parts[cc].Name.c_str());
+  }
+
+  std::atomic<bool> failed(false);
+  std::atomic<int> numberOfNewOutputs(0);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(parts.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      // Each range of parts is read by a reader of its own, with its own file
+      // stream, buffers and copies of the ids of the parts.
+      vtkNew<vtkPEnSightGoldBinaryReader> reader;
+      reader->ByteOrder = this->ByteOrder;
+      reader->UseMemoryMappedFiles = this->UseMemoryMappedFiles;
+      reader->MultiProcessLocalProcessId = localProcessId;
+      reader->MultiProcessNumberOfProcesses = numberOfProcesses;
+      reader->GhostLevels = this->GhostLevels;
+      reader->UnstructuredPartIds->DeepCopy(this->UnstructuredPartIds);
+      reader->StructuredPartIds->DeepCopy(this->StructuredPartIds);
+      if (!reader->OpenFile(fileName.c_str()))
+      {
+        failed = true;
+        return;
+      }
+      reader->NodeIdsListed = this->NodeIdsListed;
+      reader->ElementIdsListed = this->ElementIdsListed;
+
+      for (vtkIdType cc = begin; cc < end && !failed; ++cc)
+      {
+        const GeometryPart& part = parts[cc];
+        vtkNew<vtkMultiBlockDataSet> partOutput;
+        char line[80];
+        int lineRead = -1;
+        reader->IFile->clear();
+        reader->IFile->seekg(part.Offset, ios::beg);
+        if (reader->ReadLine(line))
+        {
+          const char* name = part.Name.c_str();
+          switch (part.Type)
+          {
+            case RECTILINEAR_PART:
+              lineRead = reader->CreateRectilinearGridOutput(part.RealId, line, name, partOutput);
+              break;
+            case IMAGE_PART:
+              lineRead = reader->CreateImageDataOutput(part.RealId, line, name, partOutput);
+              break;
+            case STRUCTURED_PART:
+              lineRead = reader->CreateStructuredGridOutput(part.RealId, line, name, partOutput);
+              break;
+            default:
+              lineRead = reader->CreateUnstructuredGridOutput(part.RealId, line, name, partOutput);
+              break;
+          }
+        }
+        vtkDataSet* ds = reader->GetDataSetFromBlock(partOutput, part.RealId);
+        if (lineRead < 0 || ds == nullptr)
+        {
+          failed = true;
+          break;
+        }
+        collection->GetPartitionedDataSet(static_cast<unsigned int>(cc))->SetPartition(0, ds);
+        reader->SwapPartIds(this, part.IdsIndex);
+      }
+      numberOfNewOutputs += reader->NumberOfNewOutputs;
+    });
+  if (failed)
+  {
+    vtkErrorMacro("error reading the parts of " << fileName);
+    return 0;
+  }
+
+  for (unsigned int cc = 0; cc < parts.size(); ++cc)
+  {
+    const GeometryPart& part = parts[cc];
+    output->SetBlock(part.RealId, collection->GetPartitionedDataSet(cc)->GetPartition(0));
+    this->SetBlockName(output, part.RealId, part.Name.c_str());
+  }
+  this->NumberOfGeometryParts += static_cast<int>(parts.size());
+  this->NumberOfNewOutputs += numberOfNewOutputs;
+  return 1;
+}
+
 //----------------------------------------------------------------------------
 int vtkPEnSightGoldBinaryReader::CountTimeSteps()
 {
@@ -571,6 +992,18 @@ int vtkPEnSightGoldBinaryReader::SkipStructuredGrid(char line[256])
 
   // reading next line to check for EOF
   lineRead = this->ReadLine(line);
+
+  if (lineRead && strncmp(line, "node_ids", 8) == 0)
+  { // skip node ids.
+    this->IFile->seekg(numPts * sizeof(int), ios::cur);
+    lineRead = this->ReadLine(line);
+  }
+  if (lineRead && strncmp(line, "element_ids", 11) == 0)
+  { // skip element ids.
+    int numElements = (dimensions[0] - 1) * (dimensions[1] - 1) * (dimensions[2] - 1);
+    this->IFile->seekg(numElements * sizeof(int), ios::cur);
+    lineRead = this->ReadLine(line);
+  }
   return lineRead;
 }
 
@@ -663,7 +1096,7 @@ int vtkPEnSightGoldBinaryReader::SkipUnstructuredGrid(char line[256])
       }
 
       // Skip nodeIdList.
-      this->IFile->seekg(sizeof(int) * 2 * numElements, ios::cur);
+      this->IFile->seekg(sizeof(int) * 3 * numElements, ios::cur);
     }
     else if (strncmp(line, "nsided", 6) == 0 || strncmp(line, "g_nsided", 8) == 0)
     {
@@ -1398,11 +1831,8 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
       // For complex scalars, there is a file for the real part and another
       // file for the imaginary part, but we are storing them as a 2-component
       // array.
-      for (i = 0; i < numPts; i++)
-      {
-        this->InsertVariableComponent(
-          scalars, i, component, &(scalarsRead[i]), partId, 0, SCALAR_PER_NODE);
-      }
+      this->InsertVariableComponents(
+        scalars, numPts, component, { scalarsRead }, partId, 0, SCALAR_PER_NODE);
       scalars->SetName(description);
       output->GetPointData()->AddArray(scalars);
       if (!output->GetPointData()->GetScalars())
@@ -1419,6 +1849,8 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
     return 1;
   }
 
+  // The values of the parts are inserted once all of them are read.
+  std::vector<PartVariableComponents> insertions;
   lineRead = this->ReadLine(line);
   while (lineRead && strncmp(line, "part", 4) == 0)
   {
@@ -1443,14 +1875,9 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
         scalars = (vtkFloatArray*)(output->GetPointData()->GetArray(description));
       }
 
-      scalarsRead = new float[numPts];
-      this->ReadFloatArray(scalarsRead, numPts);
-
-      for (i = 0; i < numPts; i++)
-      {
-        this->InsertVariableComponent(
-          scalars, i, component, &(scalarsRead[i]), realId, 0, SCALAR_PER_NODE);
-      }
+      auto& values = this->QueueVariableComponents(
+        insertions, scalars, numPts, component, 1, realId, 0, SCALAR_PER_NODE);
+      this->ReadFloatArray(values.Components[0].data(), numPts);
       if (component == 0)
       {
         scalars->SetName(description);
@@ -1465,7 +1892,6 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
       {
         output->GetPointData()->AddArray(scalars);
       }
-      delete[] scalarsRead;
     }
 
     this->IFile->peek();
@@ -1476,6 +1902,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
     }
     lineRead = this->ReadLine(line);
   }
+  this->InsertVariableComponents(insertions);
 
   delete this->IFile;
   this->IFile = nullptr;
@@ -1490,8 +1917,6 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
   char line[80];
   int partId, realId, numPts, i, lineRead;
   vtkFloatArray* vectors;
-  float tuple[3];
-  float *comp1, *comp2, *comp3;
   float* vectorsRead;
   vtkDataSet* output;
 
@@ -1635,6 +2060,8 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
     return 1;
   }
 
+  // The values of the parts are inserted once all of them are read.
+  std::vector<PartVariableComponents> insertions;
   lineRead = this->ReadLine(line);
   while (lineRead && strncmp(line, "part", 4) == 0)
   {
@@ -1649,18 +2076,11 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
       this->ReadLine(line); // "coordinates" or "block"
       vectors->SetNumberOfComponents(3);
       vectors->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
-      comp1 = new float[numPts];
-      comp2 = new float[numPts];
-      comp3 = new float[numPts];
-      this->ReadFloatArray(comp1, numPts);
-      this->ReadFloatArray(comp2, numPts);
-      this->ReadFloatArray(comp3, numPts);
-      for (i = 0; i < numPts; i++)
+      auto& values = this->QueueVariableComponents(
+        insertions, vectors, numPts, -1, 3, realId, 0, VECTOR_PER_NODE);
+      for (auto& component : values.Components)
       {
-        tuple[0] = comp1[i];
-        tuple[1] = comp2[i];
-        tuple[2] = comp3[i];
-        this->InsertVariableComponent(vectors, i, -1, tuple, realId, 0, VECTOR_PER_NODE);
+        this->ReadFloatArray(component.data(), numPts);
       }
       vectors->SetName(description);
       output->GetPointData()->AddArray(vectors);
@@ -1669,9 +2089,6 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
         output->GetPointData()->SetVectors(vectors);
       }
       vectors->Delete();
-      delete[] comp1;
-      delete[] comp2;
-      delete[] comp3;
     }
 
     this->IFile->peek();
@@ -1682,6 +2099,7 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
     }
     lineRead = this->ReadLine(line);
   }
+  this->InsertVariableComponents(insertions);
 
   delete this->IFile;
   this->IFile = nullptr;
@@ -1696,8 +2114,6 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
   char line[80];
   int partId, realId, numPts, i, lineRead;
   vtkFloatArray* tensors;
-  float *comp1, *comp2, *comp3, *comp4, *comp5, *comp6;
-  float tuple[6];
   vtkDataSet* output;
 
   // Initialize
@@ -1787,6 +2203,8 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
   this->ReadLine(line); // skip the description line
   lineRead = this->ReadLine(line);
 
+  // The values of the parts are inserted once all of them are read.
+  std::vector<PartVariableComponents> insertions;
   while (lineRead && strncmp(line, "part", 4) == 0)
   {
     this->ReadPartId(&partId);
@@ -1800,37 +2218,16 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
       this->ReadLine(line); // "coordinates" or "block"
       tensors->SetNumberOfComponents(6);
       tensors->SetNumberOfTuples(this->GetPointIds(realId)->GetLocalNumberOfIds());
-      comp1 = new float[numPts];
-      comp2 = new float[numPts];
-      comp3 = new float[numPts];
-      comp4 = new float[numPts];
-      comp5 = new float[numPts];
-      comp6 = new float[numPts];
-      this->ReadFloatArray(comp1, numPts);
-      this->ReadFloatArray(comp2, numPts);
-      this->ReadFloatArray(comp3, numPts);
-      this->ReadFloatArray(comp4, numPts);
-      this->ReadFloatArray(comp6, numPts);
-      this->ReadFloatArray(comp5, numPts);
-      for (i = 0; i < numPts; i++)
+      auto& values = this->QueueVariableComponents(
+        insertions, tensors, numPts, -1, 6, realId, 0, TENSOR_SYMM_PER_NODE);
+      // The file lists the components in the order 11, 22, 33, 12, 13, 23.
+      for (int c : { 0, 1, 2, 3, 5, 4 })
       {
-        tuple[0] = comp1[i];
-        tuple[1] = comp2[i];
-        tuple[2] = comp3[i];
-        tuple[3] = comp4[i];
-        tuple[4] = comp5[i];
-        tuple[5] = comp6[i];
-        this->InsertVariableComponent(tensors, i, -1, tuple, realId, 0, TENSOR_SYMM_PER_NODE);
+        this->ReadFloatArray(values.Components[c].data(), numPts);
       }
       tensors->SetName(description);
       output->GetPointData()->AddArray(tensors);
       tensors->Delete();
-      delete[] comp1;
-      delete[] comp2;
-      delete[] comp3;
-      delete[] comp4;
-      delete[] comp5;
-      delete[] comp6;
     }
 
     this->IFile->peek();
@@ -1841,6 +2238,7 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
     }
     lineRead = this->ReadLine(line);
   }
+  this->InsertVariableComponents(insertions);
 
   delete this->IFile;
   this->IFile = nullptr;
@@ -1856,7 +2254,6 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
   char line[80];
   int partId, realId, numCells, numCellsPerElement, i, idx;
   vtkFloatArray* scalars;
-  float* scalarsRead;
   int lineRead, elementType;
   vtkDataSet* output;
 
@@ -1979,6 +2376,8 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
   this->ReadLine(line);            // skip the description line
   lineRead = this->ReadLine(line); // "part"
 
+  // The values of the parts are inserted once all of them are read.
+  std::vector<PartVariableComponents> insertions;
   while (lineRead && strncmp(line, "part", 4) == 0)
   {
     this->ReadPartId(&partId);
@@ -2004,13 +2403,9 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
       // type (and what their ids are) -- IF THIS IS NOT A BLOCK SECTION
       if (strncmp(line, "block", 5) == 0)
       {
-        scalarsRead = new float[numCells];
-        this->ReadFloatArray(scalarsRead, numCells);
-        for (i = 0; i < numCells; i++)
-        {
-          this->InsertVariableComponent(
-            scalars, i, component, &(scalarsRead[i]), realId, 0, SCALAR_PER_ELEMENT);
-        }
+        auto& values = this->QueueVariableComponents(
+          insertions, scalars, numCells, component, 1, realId, 0, SCALAR_PER_ELEMENT);
+        this->ReadFloatArray(values.Components[0].data(), numCells);
         if (this->IFile->eof())
         {
           lineRead = 0;
@@ -2019,7 +2414,6 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
         {
           lineRead = this->ReadLine(line);
         }
-        delete[] scalarsRead;
       }
       else
       {
@@ -2040,13 +2434,9 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
           }
           idx = this->UnstructuredPartIds->IsId(realId);
           numCellsPerElement = this->GetCellIds(idx, elementType)->GetNumberOfIds();
-          scalarsRead = new float[numCellsPerElement];
-          this->ReadFloatArray(scalarsRead, numCellsPerElement);
-          for (i = 0; i < numCellsPerElement; i++)
-          {
-            this->InsertVariableComponent(
-              scalars, i, component, &(scalarsRead[i]), idx, elementType, SCALAR_PER_ELEMENT);
-          }
+          auto& values = this->QueueVariableComponents(insertions, scalars, numCellsPerElement,
+            component, 1, idx, elementType, SCALAR_PER_ELEMENT);
+          this->ReadFloatArray(values.Components[0].data(), numCellsPerElement);
           this->IFile->peek();
           if (this->IFile->eof())
           {
@@ -2056,7 +2446,6 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
           {
             lineRead = this->ReadLine(line);
           }
-          delete[] scalarsRead;
         } // end while
       }   // end else
       if (component == 0)
@@ -2087,6 +2476,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
       }
     }
   }
+  this->InsertVariableComponents(insertions);
 
   delete this->IFile;
   this->IFile = nullptr;
@@ -2101,9 +2491,7 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
   char line[80];
   int partId, realId, numCells, numCellsPerElement, i, idx;
   vtkFloatArray* vectors;
-  float *comp1, *comp2, *comp3;
   int lineRead, elementType;
-  float tuple[3];
   vtkDataSet* output;
 
   // Initialize
@@ -2226,6 +2614,8 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
   this->ReadLine(line);            // skip the description line
   lineRead = this->ReadLine(line); // "part"
 
+  // The values of the parts are inserted once all of them are read.
+  std::vector<PartVariableComponents> insertions;
   while (lineRead && strncmp(line, "part", 4) == 0)
   {
     this->ReadPartId(&partId);
@@ -2243,18 +2633,11 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
       // type (and what their ids are) -- IF THIS IS NOT A BLOCK SECTION
       if (strncmp(line, "block", 5) == 0)
       {
-        comp1 = new float[numCells];
-        comp2 = new float[numCells];
-        comp3 = new float[numCells];
-        this->ReadFloatArray(comp1, numCells);
-        this->ReadFloatArray(comp2, numCells);
-        this->ReadFloatArray(comp3, numCells);
-        for (i = 0; i < numCells; i++)
+        auto& values = this->QueueVariableComponents(
+          insertions, vectors, numCells, -1, 3, realId, 0, VECTOR_PER_ELEMENT);
+        for (auto& component : values.Components)
         {
-          tuple[0] = comp1[i];
-          tuple[1] = comp2[i];
-          tuple[2] = comp3[i];
-          this->InsertVariableComponent(vectors, i, -1, tuple, realId, 0, VECTOR_PER_ELEMENT);
+          this->ReadFloatArray(component.data(), numCells);
         }
         this->IFile->peek();
         if (this->IFile->eof())
@@ -2265,9 +2648,6 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
         {
           lineRead = this->ReadLine(line);
         }
-        delete[] comp1;
-        delete[] comp2;
-        delete[] comp3;
       }
       else
       {
@@ -2284,19 +2664,11 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
           }
           idx = this->UnstructuredPartIds->IsId(realId);
           numCellsPerElement = this->GetCellIds(idx, elementType)->GetNumberOfIds();
-          comp1 = new float[numCellsPerElement];
-          comp2 = new float[numCellsPerElement];
-          comp3 = new float[numCellsPerElement];
-          this->ReadFloatArray(comp1, numCellsPerElement);
-          this->ReadFloatArray(comp2, numCellsPerElement);
-          this->ReadFloatArray(comp3, numCellsPerElement);
-          for (i = 0; i < numCellsPerElement; i++)
+          auto& values = this->QueueVariableComponents(insertions, vectors, numCellsPerElement, 0,
+            3, idx, elementType, VECTOR_PER_ELEMENT);
+          for (auto& component : values.Components)
           {
-            tuple[0] = comp1[i];
-            tuple[1] = comp2[i];
-            tuple[2] = comp3[i];
-            this->InsertVariableComponent(
-              vectors, i, 0, tuple, idx, elementType, VECTOR_PER_ELEMENT);
+            this->ReadFloatArray(component.data(), numCellsPerElement);
           }
           this->IFile->peek();
           if (this->IFile->eof())
@@ -2307,9 +2679,6 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
           {
             lineRead = this->ReadLine(line);
           }
-          delete[] comp1;
-          delete[] comp2;
-          delete[] comp3;
         } // end while
       }   // end else
       vectors->SetName(description);
@@ -2333,6 +2702,7 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
       }
     }
   }
+  this->InsertVariableComponents(insertions);
 
   delete this->IFile;
   this->IFile = nullptr;
@@ -2348,8 +2718,6 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
   int partId, realId, numCells, numCellsPerElement, i, idx;
   vtkFloatArray* tensors;
   int lineRead, elementType;
-  float *comp1, *comp2, *comp3, *comp4, *comp5, *comp6;
-  float tuple[6];
   vtkDataSet* output;
 
   // Initialize
@@ -2472,6 +2840,8 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
   this->ReadLine(line);            // skip the description line
   lineRead = this->ReadLine(line); // "part"
 
+  // The values of the parts are inserted once all of them are read.
+  std::vector<PartVariableComponents> insertions;
   while (lineRead && strncmp(line, "part", 4) == 0)
   {
     this->ReadPartId(&partId);
@@ -2490,27 +2860,12 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
       // type (and what their ids are) -- IF THIS IS NOT A BLOCK SECTION
       if (strncmp(line, "block", 5) == 0)
       {
-        comp1 = new float[numCells];
-        comp2 = new float[numCells];
-        comp3 = new float[numCells];
-        comp4 = new float[numCells];
-        comp5 = new float[numCells];
-        comp6 = new float[numCells];
-        this->ReadFloatArray(comp1, numCells);
-        this->ReadFloatArray(comp2, numCells);
-        this->ReadFloatArray(comp3, numCells);
-        this->ReadFloatArray(comp4, numCells);
-        this->ReadFloatArray(comp6, numCells);
-        this->ReadFloatArray(comp5, numCells);
-        for (i = 0; i < numCells; i++)
+        auto& values = this->QueueVariableComponents(
+          insertions, tensors, numCells, -1, 6, realId, 0, TENSOR_SYMM_PER_ELEMENT);
+        // The file lists the components in the order 11, 22, 33, 12, 13, 23.
+        for (int c : { 0, 1, 2, 3, 5, 4 })
         {
-          tuple[0] = comp1[i];
-          tuple[1] = comp2[i];
-          tuple[2] = comp3[i];
-          tuple[3] = comp4[i];
-          tuple[4] = comp5[i];
-          tuple[5] = comp6[i];
-          this->InsertVariableComponent(tensors, i, -1, tuple, realId, 0, TENSOR_SYMM_PER_ELEMENT);
+          this->ReadFloatArray(values.Components[c].data(), numCells);
         }
         this->IFile->peek();
         if (this->IFile->eof())
@@ -2521,12 +2876,6 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
         {
           lineRead = this->ReadLine(line);
         }
-        delete[] comp1;
-        delete[] comp2;
-        delete[] comp3;
-        delete[] comp4;
-        delete[] comp5;
-        delete[] comp6;
       }
       else
       {
@@ -2543,28 +2892,11 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
           }
           idx = this->UnstructuredPartIds->IsId(realId);
           numCellsPerElement = this->GetCellIds(idx, elementType)->GetNumberOfIds();
-          comp1 = new float[numCellsPerElement];
-          comp2 = new float[numCellsPerElement];
-          comp3 = new float[numCellsPerElement];
-          comp4 = new float[numCellsPerElement];
-          comp5 = new float[numCellsPerElement];
-          comp6 = new float[numCellsPerElement];
-          this->ReadFloatArray(comp1, numCellsPerElement);
-          this->ReadFloatArray(comp2, numCellsPerElement);
-          this->ReadFloatArray(comp3, numCellsPerElement);
-          this->ReadFloatArray(comp4, numCellsPerElement);
-          this->ReadFloatArray(comp6, numCellsPerElement);
-          this->ReadFloatArray(comp5, numCellsPerElement);
-          for (i = 0; i < numCellsPerElement; i++)
+          auto& values = this->QueueVariableComponents(insertions, tensors, numCellsPerElement, 0,
+            6, idx, elementType, TENSOR_SYMM_PER_ELEMENT);
+          for (int c : { 0, 1, 2, 3, 5, 4 })
           {
-            tuple[0] = comp1[i];
-            tuple[1] = comp2[i];
-            tuple[2] = comp3[i];
-            tuple[3] = comp4[i];
-            tuple[4] = comp5[i];
-            tuple[5] = comp6[i];
-            this->InsertVariableComponent(
-              tensors, i, 0, tuple, idx, elementType, TENSOR_SYMM_PER_ELEMENT);
+            this->ReadFloatArray(values.Components[c].data(), numCellsPerElement);
           }
           this->IFile->peek();
           if (this->IFile->eof())
@@ -2575,12 +2907,6 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
           {
             lineRead = this->ReadLine(line);
           }
-          delete[] comp1;
-          delete[] comp2;
-          delete[] comp3;
-          delete[] comp4;
-          delete[] comp5;
-          delete[] comp6;
         } // end while
       }   // end else
       tensors->SetName(description);
@@ -2600,6 +2926,7 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
       }
     }
   }
+  this->InsertVariableComponents(insertions);
 
   delete this->IFile;
   this->IFile = nullptr;
@@ -2828,7 +3155,7 @@ int vtkPEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       }
 
       // Skip nodeIdList.
-      this->IFile->seekg(sizeof(int) * 2 * numElements, ios::cur);
+      this->IFile->seekg(sizeof(int) * 3 * numElements, ios::cur);
     }
     else if (strncmp(line, "nsided", 6) == 0)
     {
@@ -4510,6 +4837,158 @@ void vtkPEnSightGoldBinaryReader::UpdateFloatBuffer()
   this->IFile->seekg(currentPosition);
 }
 
+//----------------------------------------------------------------------------
+int vtkPEnSightGoldBinaryReader::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (this->CacheFileOffsets)
+  {
+    this->LoadFileOffsets();
+  }
+
+  size_t numberOfOffsets = 0;
+  for (const auto& fileOffsets : this->FileOffsets)
+  {
+    numberOfOffsets += fileOffsets.second.size();
+  }
+
+  const int result = this->Superclass::RequestData(request, inputVector, outputVector);
+
+  if (this->CacheFileOffsets)
+  {
+    size_t newNumberOfOffsets = 0;
+    for (const auto& fileOffsets : this->FileOffsets)
+    {
+      newNumberOfOffsets += fileOffsets.second.size();
+    }
+    // only the first process writes the index, all processes find the same
+    // offsets.
+    if (newNumberOfOffsets != numberOfOffsets && this->GetMultiProcessLocalProcessId() <= 0)
+    {
+      this->SaveFileOffsets();
+    }
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+std::string vtkPEnSightGoldBinaryReader::GetFullFileName(const char* fileName)
+{
+  std::string fullName;
+  if (this->FilePath && *this->FilePath)
+  {
+    fullName = this->FilePath;
+    if (fullName.back() != '/')
+    {
+      fullName += "/";
+    }
+  }
+  fullName += fileName;
+  return fullName;
+}
+
+//----------------------------------------------------------------------------
+// The index is a text file with a header line followed by one line per data
+// file: its name, size, modification time, number of offsets and the
+// (timestep, offset) pairs.
+void vtkPEnSightGoldBinaryReader::LoadFileOffsets()
+{
+  if (!this->CaseFileName)
+  {
+    return;
+  }
+  const std::string indexName = this->GetFullFileName(this->CaseFileName) + ".offsets";
+  if (indexName == this->FileOffsetsIndexName)
+  {
+    return;
+  }
+  this->FileOffsetsIndexName = indexName;
+
+  vtksys::ifstream index(indexName.c_str());
+  std::string line;
+  if (!index || !std::getline(index, line) || line != FileOffsetsIndexHeader)
+  {
+    return;
+  }
+
+  while (std::getline(index, line))
+  {
+    std::istringstream entry(line);
+    std::string fileName;
+    unsigned long size;
+    long mtime;
+    size_t count;
+    if (!(entry >> fileName >> size >> mtime >> count))
+    {
+      break;
+    }
+    const std::string fullName = this->GetFullFileName(fileName.c_str());
+    if (vtksys::SystemTools::FileLength(fullName) != size ||
+      vtksys::SystemTools::ModifiedTime(fullName) != mtime)
+    {
+      vtkLogF(TRACE, "ignoring stale offsets for '%s'", fullName.c_str());
+      continue;
+    }
+    auto& offsets = this->FileOffsets[fileName];
+    int timeStep;
+    long offset;
+    for (size_t cc = 0; cc < count && (entry >> timeStep >> offset); ++cc)
+    {
+      offsets[timeStep] = offset;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightGoldBinaryReader::SaveFileOffsets()
+{
+  if (!this->CaseFileName || this->FileOffsets.empty())
+  {
+    return;
+  }
+  const std::string indexName = this->GetFullFileName(this->CaseFileName) + ".offsets";
+
+  // write to a temporary file first so that concurrent readers never see a
+  // partial index.
+  const std::string tmpName = indexName + ".tmp";
+  {
+    vtksys::ofstream index(tmpName.c_str());
+    if (!index)
+    {
+      return;
+    }
+    index << FileOffsetsIndexHeader << "\n";
+    for (const auto& fileOffsets : this->FileOffsets)
+    {
+      // names with whitespaces cannot be stored.
+      if (fileOffsets.first.find_first_of(" \t\n") != std::string::npos)
+      {
+        continue;
+      }
+      const std::string fullName = this->GetFullFileName(fileOffsets.first.c_str());
+      index << fileOffsets.first << " " << vtksys::SystemTools::FileLength(fullName) << " "
+            << vtksys::SystemTools::ModifiedTime(fullName) << " " << fileOffsets.second.size();
+      for (const auto& offset : fileOffsets.second)
+      {
+        index << " " << offset.first << " " << offset.second;
+      }
+      index << "\n";
+    }
+    if (!index)
+    {
+      index.close();
+      vtksys::SystemTools::RemoveFile(tmpName);
+      return;
+    }
+  }
+  if (!vtksys::SystemTools::RenameFile(tmpName, indexName))
+  {
+    vtksys::SystemTools::RemoveFile(tmpName);
+    return;
+  }
+  this->FileOffsetsIndexName = indexName;
+}
+
 //----------------------------------------------------------------------------
 void vtkPEnSightGoldBinaryReader::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -7,6 +7,18 @@
  *
  * Parallel vtkEnSightGoldBinaryReader.
  *
+ * The parts of the geometry file are located first, then decoded concurrently
+ * using vtkSMPTools, each range of parts by a reader of its own. Fortran files
+ * are read part after part. The values of the variables of the parts are read
+ * first, then inserted concurrently.
+ *
+ * Files are memory-mapped when UseMemoryMappedFiles is on, so that skipping
+ * the parts of the files that are not needed by the current process does not
+ * result in I/O requests. When CacheFileOffsets is on, the offsets of the
+ * timesteps in transient single files are saved in an index file beside the
+ * case file, so that later reads of the same dataset do not need to scan the
+ * files again.
+ *
  * \verbatim
  * This file has been developed as part of the CARRIOCAS (Distributed
  * computation over ultra high optical internet network ) project (
@@ -24,6 +36,9 @@
 #include "vtkPEnSightReader.h"
 #include "vtkPVVTKExtensionsIOEnSightModule.h" //needed for exports
 
+#include <string> // for std::string
+#include <vector> // for std::vector
+
 class vtkMultiBlockDataSet;
 class vtkUnstructuredGrid;
 class vtkPoints;
@@ -39,6 +54,24 @@ protected:
   vtkPEnSightGoldBinaryReader();
   ~vtkPEnSightGoldBinaryReader() override;
 
+  /**
+   * Overridden to load and save the index of file offsets.
+   */
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  ///@{
+  /**
+   * Load/save FileOffsets from/to the index file.
+   */
+  void LoadFileOffsets();
+  void SaveFileOffsets();
+  ///@}
+
+  /**
+   * Returns the path of a file listed in the case file.
+   */
+  std::string GetFullFileName(const char* fileName);
+
   // Returns 1 if successful.  Sets file size as a side action.
   int OpenFile(const char* filename);
 
@@ -51,6 +84,27 @@ protected:
    */
   int ReadGeometryFile(const char* fileName, int timeStep, vtkMultiBlockDataSet* output) override;
 
+  /**
+   * A part of the geometry file located by IndexGeometryParts.
+   */
+  struct GeometryPart;
+
+  /**
+   * Locates the parts of the geometry file, starting from the "part" line
+   * that was just read, by skipping their content. Returns -1 if a part
+   * cannot be skipped, otherwise the result of the last line read.
+   */
+  int IndexGeometryParts(char line[80], std::vector<GeometryPart>& parts);
+
+  /**
+   * Decodes the parts located by IndexGeometryParts concurrently into a
+   * vtkPartitionedDataSetCollection, then adds them to the output in the
+   * order of the file. Returns -1, without changing the output, if the parts
+   * must be read one after the other, 0 if an error occurred, otherwise 1.
+   */
+  int ReadGeometryParts(
+    const std::string& fileName, std::vector<GeometryPart>& parts, vtkMultiBlockDataSet* output);
+
   /**
    * Read the measured geometry file.  If an error occurred, 0 is returned;
    * otherwise 1.
@@ -189,6 +243,9 @@ protected:
   int SkipImageData(char line[256]);
   ///@}
 
+  // Path of the index file FileOffsets were last loaded from.
+  std::string FileOffsetsIndexName;
+
   int NodeIdsListed;
   int ElementIdsListed;
   int Fortran;
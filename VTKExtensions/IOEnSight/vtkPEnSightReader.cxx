@@ -19,6 +19,7 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredData.h"
@@ -29,6 +30,8 @@
 
 #include "vtksys/FStream.hxx"
 
+#include <utility>
+
 typedef std::vector<vtkPEnSightReader::vtkPEnSightReaderCellIds*> vtkPEnSightReaderCellIdsTypeBase;
 class vtkPEnSightReaderCellIdsType : public vtkPEnSightReaderCellIdsTypeBase
 {
@@ -2298,6 +2301,107 @@ void vtkPEnSightReader::InsertVariableComponent(vtkFloatArray* array, int i, int
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::InsertVariableComponents(vtkFloatArray* array, vtkIdType numberOfValues,
+  int component, const std::vector<const float*>& components, int partId, int ensightCellType,
+  int insertionType)
+{
+  // Ids are only looked up, and distinct nodes or elements have distinct
+  // real ids, so values can be inserted concurrently once the ids container,
+  // created on first access, exists.
+  if ((insertionType == SCALAR_PER_ELEMENT) || (insertionType == VECTOR_PER_ELEMENT) ||
+    (insertionType == TENSOR_SYMM_PER_ELEMENT))
+  {
+    this->GetCellIds(partId, ensightCellType);
+  }
+  else
+  {
+    this->GetPointIds(partId);
+  }
+
+  vtkSMPTools::For(0, numberOfValues,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      float content[9];
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        for (size_t c = 0; c < components.size(); ++c)
+        {
+          content[c] = components[c][i];
+        }
+        this->InsertVariableComponent(array, static_cast<int>(i), component, content, partId,
+          ensightCellType, insertionType);
+      }
+    });
+}
+
+//----------------------------------------------------------------------------
+vtkPEnSightReader::PartVariableComponents& vtkPEnSightReader::QueueVariableComponents(
+  std::vector<PartVariableComponents>& queue, vtkFloatArray* array, vtkIdType numberOfValues,
+  int component, int numberOfComponents, int partId, int ensightCellType, int insertionType)
+{
+  if ((insertionType == SCALAR_PER_ELEMENT) || (insertionType == VECTOR_PER_ELEMENT) ||
+    (insertionType == TENSOR_SYMM_PER_ELEMENT))
+  {
+    this->GetCellIds(partId, ensightCellType);
+  }
+  else
+  {
+    this->GetPointIds(partId);
+  }
+
+  PartVariableComponents values;
+  values.Array = array;
+  values.NumberOfValues = numberOfValues;
+  values.Component = component;
+  values.Components.resize(numberOfComponents, std::vector<float>(numberOfValues));
+  values.PartId = partId;
+  values.EnsightCellType = ensightCellType;
+  values.InsertionType = insertionType;
+  queue.push_back(std::move(values));
+  return queue.back();
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::InsertVariableComponents(std::vector<PartVariableComponents>& queue)
+{
+  // Entries insert into distinct arrays or at distinct ids. The values of an
+  // entry are split again when a single entry is queued, or when the backend
+  // runs nested loops in parallel.
+  vtkSMPTools::For(0, static_cast<vtkIdType>(queue.size()),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        const PartVariableComponents& values = queue[cc];
+        std::vector<const float*> components;
+        for (const auto& component : values.Components)
+        {
+          components.push_back(component.data());
+        }
+        this->InsertVariableComponents(values.Array, values.NumberOfValues, values.Component,
+          components, values.PartId, values.EnsightCellType, values.InsertionType);
+      }
+    });
+  queue.clear();
+}
+
+//----------------------------------------------------------------------------
+void vtkPEnSightReader::SwapPartIds(vtkPEnSightReader* other, int index)
+{
+  // make sure the containers of this reader hold the index.
+  if (!this->GetPointIds(index) || !this->GetCellIds(index, NUMBER_OF_ELEMENT_TYPES - 1))
+  {
+    return;
+  }
+  for (int cellType = 0; cellType < NUMBER_OF_ELEMENT_TYPES; ++cellType)
+  {
+    const size_t cellIdsIndex = static_cast<size_t>(index) * NUMBER_OF_ELEMENT_TYPES + cellType;
+    std::swap((*this->CellIds)[cellIdsIndex], (*other->CellIds)[cellIdsIndex]);
+  }
+  std::swap((*this->PointIds)[index], (*other->PointIds)[index]);
+}
+
 //----------------------------------------------------------------------------
 void vtkPEnSightReader::MapToGlobalIds(
   const vtkIdType* inputIds, vtkIdType numPoints, int partId, vtkIdType* globalIds)
@@ -25,6 +25,7 @@
 #include "vtkPVVTKExtensionsIOEnSightModule.h" //needed for exports
 
 #include "vtkIdTypeArray.h" // For ivars
+#include "vtkSmartPointer.h" // For PartVariableComponents
 #include <algorithm>        // For ivars
 #include <map>              // For ivars
 #include <string>           // For ivars
@@ -707,6 +708,55 @@ protected:
     int partId, int ensightCellType, int insertionType);
   ///@}
 
+  /**
+   * Calls InsertVariableComponent for the first numberOfValues nodes or
+   * elements, using vtkSMPTools. The content of value i is made of
+   * components[c][i] for each c, i.e. components holds one array of
+   * numberOfValues values per component in the file.
+   */
+  void InsertVariableComponents(vtkFloatArray* array, vtkIdType numberOfValues, int component,
+    const std::vector<const float*>& components, int partId, int ensightCellType,
+    int insertionType);
+
+  /**
+   * Values of a variable read for a part, waiting to be inserted by
+   * InsertVariableComponents. Components holds one array of NumberOfValues
+   * values per component in the file.
+   */
+  struct PartVariableComponents
+  {
+    vtkSmartPointer<vtkFloatArray> Array;
+    vtkIdType NumberOfValues;
+    int Component;
+    std::vector<std::vector<float>> Components;
+    int PartId;
+    int EnsightCellType;
+    int InsertionType;
+  };
+
+  /**
+   * Appends an entry with numberOfComponents arrays of numberOfValues values
+   * to queue and returns it, so that the values can be read into it. The ids
+   * containers used to insert the values are created here, so that queued
+   * entries can be inserted concurrently.
+   */
+  PartVariableComponents& QueueVariableComponents(std::vector<PartVariableComponents>& queue,
+    vtkFloatArray* array, vtkIdType numberOfValues, int component, int numberOfComponents,
+    int partId, int ensightCellType, int insertionType);
+
+  /**
+   * Inserts the queued entries, concurrently using vtkSMPTools, and clears
+   * the queue.
+   */
+  void InsertVariableComponents(std::vector<PartVariableComponents>& queue);
+
+  /**
+   * Exchanges the point and cell ids of the part at index with the ones of
+   * other, which must already hold ids for this index. Used to move the ids
+   * of parts read by another reader.
+   */
+  void SwapPartIds(vtkPEnSightReader* other, int index);
+
   /**
    * Convenience method to map the point ids from current rank to global ids.
    */
@@ -27,6 +27,31 @@ public:
   vtkTypeMacro(vtkPGenericEnSightReader, vtkGenericEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * When on, EnSight Gold binary files are memory-mapped instead of being
+   * read through a file stream. Files that cannot be mapped are read through
+   * a file stream. Only used in parallel. Default is on.
+   */
+  vtkSetMacro(UseMemoryMappedFiles, bool);
+  vtkGetMacro(UseMemoryMappedFiles, bool);
+  vtkBooleanMacro(UseMemoryMappedFiles, bool);
+  ///@}
+
+  ///@{
+  /**
+   * When on, the offsets of timesteps in transient single EnSight Gold binary
+   * files are loaded from and saved to an index file named after the case
+   * file with an additional ".offsets" extension. Entries for files whose size
+   * or modification time changed are ignored. The index is written by the
+   * first process only, and failures to write it are silently ignored.
+   * Only used in parallel. Default is off.
+   */
+  vtkSetMacro(CacheFileOffsets, bool);
+  vtkGetMacro(CacheFileOffsets, bool);
+  vtkBooleanMacro(CacheFileOffsets, bool);
+  ///@}
+
 protected:
   vtkPGenericEnSightReader();
   ~vtkPGenericEnSightReader() override;
@@ -45,6 +70,9 @@ protected:
   int MultiProcessLocalProcessId;
   int MultiProcessNumberOfProcesses;
 
+  bool UseMemoryMappedFiles;
+  bool CacheFileOffsets;
+
 private:
   vtkPGenericEnSightReader(const vtkPGenericEnSightReader&) = delete;
   void operator=(const vtkPGenericEnSightReader&) = delete;
@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkExtractHistogram.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPExtractHistogram.h"
+#include "vtkPointData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTable.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> CreateBlock(int size, int seed)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> rand;
+  rand->SetSeed(seed);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("int");
+  ints->SetNumberOfTuples(size);
+  vtkNew<vtkFloatArray> floats;
+  floats->SetName("float");
+  floats->SetNumberOfTuples(size);
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("vector");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(size);
+  for (vtkIdType cc = 0; cc < size; ++cc)
+  {
+    rand->Next();
+    ints->SetValue(cc, static_cast<int>(std::floor(rand->GetValue() * 100)));
+    rand->Next();
+    floats->SetValue(cc, static_cast<float>(rand->GetRangeValue(-5.0, 5.0)));
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      rand->Next();
+      vectors->SetComponent(cc, comp, rand->GetRangeValue(-1.0, 1.0));
+    }
+  }
+  auto block = vtkSmartPointer<vtkImageData>::New();
+  block->SetDimensions(size, 1, 1);
+  block->GetPointData()->AddArray(ints);
+  block->GetPointData()->AddArray(floats);
+  block->GetPointData()->AddArray(vectors);
+  return block;
+}
+
+vtkSmartPointer<vtkTable> Compute(vtkExtractHistogram* histogram, vtkDataObject* input,
+  const char* name, int component, bool center, double& time)
+{
+  histogram->SetInputData(input);
+  histogram->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, name);
+  histogram->SetComponent(component);
+  histogram->SetBinCount(10);
+  histogram->SetCenterBinsAroundMinAndMax(center);
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  histogram->Update();
+  timer->StopTimer();
+  time = timer->GetElapsedTime();
+  return histogram->GetOutput();
+}
+
+// Compares the bins. With a non-zero tolerance, checks that no value is lost
+// and that the fraction of values counted in another bin is below it.
+bool Compare(vtkTable* expected, vtkTable* actual, double tolerance)
+{
+  auto expectedExtents = vtkDataArray::SafeDownCast(expected->GetColumnByName("bin_extents"));
+  auto expectedValues = vtkDataArray::SafeDownCast(expected->GetColumnByName("bin_values"));
+  auto actualExtents = vtkDataArray::SafeDownCast(actual->GetColumnByName("bin_extents"));
+  auto actualValues = vtkDataArray::SafeDownCast(actual->GetColumnByName("bin_values"));
+  if (!expectedExtents || !expectedValues || !actualExtents || !actualValues ||
+    expectedValues->GetNumberOfTuples() != actualValues->GetNumberOfTuples())
+  {
+    cerr << "Missing or incomplete bins." << endl;
+    return false;
+  }
+
+  double total = 0;
+  double actualTotal = 0;
+  double difference = 0;
+  for (vtkIdType cc = 0; cc < expectedValues->GetNumberOfTuples(); ++cc)
+  {
+    const double extent = expectedExtents->GetTuple1(cc);
+    if (std::abs(extent - actualExtents->GetTuple1(cc)) > 1e-9 * (1.0 + std::abs(extent)))
+    {
+      cerr << "Extent of bin " << cc << " differs." << endl;
+      return false;
+    }
+    total += expectedValues->GetTuple1(cc);
+    actualTotal += actualValues->GetTuple1(cc);
+    difference += std::abs(expectedValues->GetTuple1(cc) - actualValues->GetTuple1(cc));
+  }
+  if (actualTotal != total || difference > tolerance * total)
+  {
+    cerr << "Bins differ: " << difference << " for " << total << " values." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+// Compares the histograms computed by vtkPExtractHistogram, exact, in single
+// pass and approximate, to the ones of vtkExtractHistogram for different array
+// types and for the magnitude, and the exact histograms computed with several
+// threads to the ones computed with a single thread. Use --size and
+// --benchmark to use this for benchmarking.
+int TestPExtractHistogram(int argc, char* argv[])
+{
+  int size = 100000;
+  bool benchmark = false;
+  vtksys::CommandLineArguments arg;
+  arg.Initialize(argc, argv);
+  typedef vtksys::CommandLineArguments argT;
+  arg.AddArgument(
+    "--size", argT::EQUAL_ARGUMENT, &size, "Optionally specify the number of values per block.");
+  arg.AddBooleanArgument(
+    "--benchmark", &benchmark, "Optionally print the time taken by each histogram.");
+  arg.StoreUnusedArguments(true);
+  if (!arg.Parse() || size < 1)
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkMultiBlockDataSet> input;
+  input->SetBlock(0, CreateBlock(size, 1));
+  input->SetBlock(1, CreateBlock(size / 2 + 1, 2));
+
+  struct TestCase
+  {
+    const char* Name;
+    int Component;
+    bool Center;
+  };
+  const TestCase cases[] = { { "int", 0, false }, { "int", 0, true }, { "float", 0, false },
+    { "vector", 1, false }, { "vector", 3, false } };
+  for (const auto& test : cases)
+  {
+    double serialTime = 0;
+    vtkNew<vtkExtractHistogram> reference;
+    auto expected = Compute(reference, input, test.Name, test.Component, test.Center, serialTime);
+
+    double smpTime = 0;
+    vtkNew<vtkPExtractHistogram> smp;
+    smp->SetController(nullptr);
+    auto actual = Compute(smp, input, test.Name, test.Component, test.Center, smpTime);
+    if (!Compare(expected, actual, 0))
+    {
+      cerr << "Failed for '" << test.Name << "' component " << test.Component << endl;
+      return EXIT_FAILURE;
+    }
+
+    vtkSmartPointer<vtkTable> singleThread;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() {
+      double singleThreadTime = 0;
+      vtkNew<vtkPExtractHistogram> serial;
+      serial->SetController(nullptr);
+      singleThread =
+        Compute(serial, input, test.Name, test.Component, test.Center, singleThreadTime);
+    });
+    if (!Compare(singleThread, actual, 0))
+    {
+      cerr << "Failed for '" << test.Name << "' component " << test.Component
+           << ": differs from the histogram computed with a single thread" << endl;
+      return EXIT_FAILURE;
+    }
+
+    double singlePassTime = 0;
+    vtkNew<vtkPExtractHistogram> singlePass;
+    singlePass->SetController(nullptr);
+    singlePass->SinglePassOn();
+    actual = Compute(singlePass, input, test.Name, test.Component, test.Center, singlePassTime);
+    if (!Compare(expected, actual, 0.1))
+    {
+      cerr << "Single pass failed for '" << test.Name << "' component " << test.Component
+           << endl;
+      return EXIT_FAILURE;
+    }
+
+    double approximateTime = 0;
+    vtkNew<vtkPExtractHistogram> approximate;
+    approximate->SetController(nullptr);
+    approximate->ApproximateOn();
+    actual = Compute(approximate, input, test.Name, test.Component, test.Center, approximateTime);
+    if (!Compare(expected, actual, 0.1))
+    {
+      cerr << "Approximation failed for '" << test.Name << "' component " << test.Component
+           << endl;
+      return EXIT_FAILURE;
+    }
+
+    if (benchmark)
+    {
+      cout << test.Name << " component " << test.Component << ": serial " << serialTime
+           << " s, with " << vtkSMPTools::GetEstimatedNumberOfThreads() << " threads "
+           << smpTime << " s, single pass " << singlePassTime << " s, approximate "
+           << approximateTime << " s" << endl;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
+#include "vtkQuantileSketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#define TEST_ASSERT(condition, message)                                                            \
+  if (!(condition))                                                                                \
+  {                                                                                                \
+    cerr << "ERROR: " << message << endl;                                                          \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+namespace
+{
+// Returns the largest difference between the estimated and the exact ranks of
+// the deciles.
+double GetMaximumRankError(vtkQuantileSketch* sketch, std::vector<double> values)
+{
+  std::sort(values.begin(), values.end());
+  double error = 0;
+  for (int cc = 1; cc < 10; ++cc)
+  {
+    const double quantile = sketch->GetQuantile(cc / 10.0);
+    const auto rank = std::upper_bound(values.begin(), values.end(), quantile) - values.begin();
+    error = std::max(error, std::abs(static_cast<double>(rank) / values.size() - cc / 10.0));
+  }
+  return error;
+}
+}
+
+// Checks the accuracy of sketches built from uniform and skewed values, split
+// across several sketches merged together, and their serialization.
+int TestQuantileSketch(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> rand;
+  rand->SetSeed(1);
+
+  const int numberOfSketches = 4;
+  const int valuesPerSketch = 50000;
+  std::vector<double> uniformValues;
+  std::vector<double> skewedValues;
+  vtkNew<vtkQuantileSketch> uniform;
+  vtkNew<vtkQuantileSketch> skewed;
+  for (int sketchId = 0; sketchId < numberOfSketches; ++sketchId)
+  {
+    vtkNew<vtkQuantileSketch> uniformPart;
+    vtkNew<vtkQuantileSketch> skewedPart;
+    for (int cc = 0; cc < valuesPerSketch; ++cc)
+    {
+      rand->Next();
+      const double value = rand->GetRangeValue(-1.0, 1.0);
+      uniformPart->Insert(value);
+      uniformValues.push_back(value);
+      skewedPart->Insert(std::exp(10.0 * value));
+      skewedValues.push_back(std::exp(10.0 * value));
+    }
+    uniform->Merge(uniformPart);
+    skewed->Merge(skewedPart);
+  }
+
+  const double tolerance = 2 * uniform->GetNormalizedRankError();
+  for (vtkQuantileSketch* sketch : { uniform.Get(), skewed.Get() })
+  {
+    const auto& values = sketch == uniform.Get() ? uniformValues : skewedValues;
+    TEST_ASSERT(sketch->GetCount() == static_cast<vtkIdType>(values.size()), "Wrong count.");
+    TEST_ASSERT(sketch->GetMinimum() == *std::min_element(values.begin(), values.end()) &&
+        sketch->GetMaximum() == *std::max_element(values.begin(), values.end()),
+      "Wrong range.");
+    const double error = GetMaximumRankError(sketch, values);
+    TEST_ASSERT(error <= tolerance, "Rank error " << error << " above " << tolerance);
+
+    std::vector<double> items;
+    std::vector<vtkIdType> weights;
+    sketch->GetItems(items, weights);
+    vtkIdType total = 0;
+    for (const vtkIdType weight : weights)
+    {
+      total += weight;
+    }
+    TEST_ASSERT(total == sketch->GetCount(), "Weights don't sum to the count.");
+    TEST_ASSERT(items.size() < static_cast<size_t>(5 * sketch->GetK()), "Sketch too large.");
+  }
+
+  const double median = uniform->GetQuantile(0.5);
+  TEST_ASSERT(std::abs(uniform->GetRank(median) - 0.5) <= tolerance, "Wrong rank.");
+
+  vtkMultiProcessStream stream;
+  skewed->Serialize(stream);
+  vtkNew<vtkQuantileSketch> copy;
+  TEST_ASSERT(copy->Deserialize(stream), "Deserialization failed.");
+  TEST_ASSERT(copy->GetCount() == skewed->GetCount(), "Wrong count after deserialization.");
+  for (int cc = 0; cc <= 10; ++cc)
+  {
+    TEST_ASSERT(copy->GetQuantile(cc / 10.0) == skewed->GetQuantile(cc / 10.0),
+      "Wrong quantile after deserialization.");
+  }
+
+  vtkNew<vtkQuantileSketch> empty;
+  TEST_ASSERT(std::isnan(empty->GetQuantile(0.5)), "Expected NaN for an empty sketch.");
+  return EXIT_SUCCESS;
+}
@@ -3,30 +3,542 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkPExtractHistogram.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkAttributeDataReductionFilter.h"
 #include "vtkCellData.h"
 #include "vtkCommunicator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkCompositeDataSetRange.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkIntArray.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkMultiProcessStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkQuantileSketch.h"
 #include "vtkReductionFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <string>
+#include <vector>
 #include <vtksys/RegularExpression.hxx>
 
+namespace
+{
+// Number of fine bins per output bin used in single pass mode.
+constexpr vtkIdType SINGLE_PASS_RESOLUTION = 64;
+
+// The array to bin in a dataset, or in a leaf of a composite dataset.
+struct vtkLeafArray
+{
+  vtkDataArray* Array;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostsToSkip;
+};
+
+// Maps a value to an output bin, -1 if the value is out of range. Like
+// vtkExtractHistogram, the maximum goes in the last bin.
+struct vtkBinning
+{
+  double Min;
+  double Delta;
+  int BinCount;
+
+  vtkIdType GetBin(double value) const
+  {
+    const double position = (value - this->Min) / this->Delta;
+    if (!(position > -1.0) || position >= this->BinCount + 1)
+    {
+      return -1;
+    }
+    const vtkIdType bin = static_cast<vtkIdType>(position);
+    return bin == this->BinCount ? bin - 1 : bin;
+  }
+};
+
+// Same bins as vtkExtractHistogram. When all the values are equal, the range
+// is widened around them.
+vtkBinning MakeBinning(const double range[2], int binCount, bool centerBins)
+{
+  binCount = std::max(binCount, 1);
+  double lo = range[0];
+  double hi = range[1];
+  if (lo == hi)
+  {
+    lo -= 0.5;
+    hi += 0.5;
+  }
+  else if (centerBins && binCount > 1)
+  {
+    const double halfDelta = (hi - lo) / (binCount - 1) / 2;
+    lo -= halfDelta;
+    hi += halfDelta;
+  }
+  return vtkBinning{ lo, (hi - lo) / binCount, binCount };
+}
+
+void FillOutput(vtkTable* output, const vtkBinning& binning, const std::vector<vtkIdType>& counts,
+  const char* extentsName, const char* valuesName)
+{
+  vtkNew<vtkDoubleArray> binExtents;
+  binExtents->SetName(extentsName);
+  binExtents->SetNumberOfTuples(binning.BinCount);
+  vtkNew<vtkIntArray> binValues;
+  binValues->SetName(valuesName);
+  binValues->SetNumberOfTuples(binning.BinCount);
+  for (int bin = 0; bin < binning.BinCount; ++bin)
+  {
+    binExtents->SetValue(bin, binning.Min + (bin + 0.5) * binning.Delta);
+    binValues->SetValue(bin, static_cast<int>(counts[bin]));
+  }
+  output->Initialize();
+  output->AddColumn(binExtents);
+  output->AddColumn(binValues);
+}
+
+// Calls visit() with the value to bin for each tuple in [begin, end): the
+// selected component, or the magnitude when the component is out of range.
+// Ghost tuples and non-finite values are skipped.
+template <typename ArrayT, typename VisitorT>
+void VisitValues(ArrayT* array, const vtkLeafArray& leaf, int component, vtkIdType begin,
+  vtkIdType end, VisitorT&& visit)
+{
+  const auto tuples = vtk::DataArrayTupleRange(array, begin, end);
+  const int numComps = static_cast<int>(tuples.GetTupleSize());
+  const bool magnitude = component >= numComps;
+  component = std::max(component, 0);
+  const unsigned char* ghosts = leaf.Ghosts ? leaf.Ghosts->GetPointer(0) : nullptr;
+  for (vtkIdType cc = begin; cc < end; ++cc)
+  {
+    if (ghosts && (ghosts[cc] & leaf.GhostsToSkip))
+    {
+      continue;
+    }
+    const auto tuple = tuples[cc - begin];
+    double value = 0.0;
+    if (magnitude)
+    {
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const double compValue = static_cast<double>(tuple[comp]);
+        value += compValue * compValue;
+      }
+      value = std::sqrt(value);
+    }
+    else
+    {
+      value = static_cast<double>(tuple[component]);
+    }
+    if (std::isfinite(value))
+    {
+      visit(value);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <typename ArrayT>
+struct RangeFunctor
+{
+  ArrayT* Array;
+  const vtkLeafArray& Leaf;
+  int Component;
+  double* Range;
+  vtkSMPThreadLocal<std::array<double, 2>> LocalRange;
+
+  RangeFunctor(ArrayT* array, const vtkLeafArray& leaf, int component, double* range)
+    : Array(array)
+    , Leaf(leaf)
+    , Component(component)
+    , Range(range)
+  {
+  }
+
+  void Initialize()
+  {
+    this->LocalRange.Local() = { std::numeric_limits<double>::max(),
+      std::numeric_limits<double>::lowest() };
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    auto& range = this->LocalRange.Local();
+    VisitValues(this->Array, this->Leaf, this->Component, begin, end,
+      [&range](double value)
+      {
+        range[0] = std::min(range[0], value);
+        range[1] = std::max(range[1], value);
+      });
+  }
+
+  void Reduce()
+  {
+    for (const auto& range : this->LocalRange)
+    {
+      this->Range[0] = std::min(this->Range[0], range[0]);
+      this->Range[1] = std::max(this->Range[1], range[1]);
+    }
+  }
+};
+
+struct RangeWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const vtkLeafArray& leaf, int component, double* range)
+  {
+    RangeFunctor<ArrayT> functor(array, leaf, component, range);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+  }
+};
+
+//-----------------------------------------------------------------------------
+template <typename ArrayT>
+struct BinFunctor
+{
+  ArrayT* Array;
+  const vtkLeafArray& Leaf;
+  int Component;
+  const vtkBinning& Binning;
+  std::vector<vtkIdType>& Counts;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> LocalCounts;
+
+  BinFunctor(ArrayT* array, const vtkLeafArray& leaf, int component, const vtkBinning& binning,
+    std::vector<vtkIdType>& counts)
+    : Array(array)
+    , Leaf(leaf)
+    , Component(component)
+    , Binning(binning)
+    , Counts(counts)
+  {
+  }
+
+  void Initialize() { this->LocalCounts.Local().assign(this->Binning.BinCount, 0); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    auto& counts = this->LocalCounts.Local();
+    const vtkBinning& binning = this->Binning;
+    VisitValues(this->Array, this->Leaf, this->Component, begin, end,
+      [&counts, &binning](double value)
+      {
+        const vtkIdType bin = binning.GetBin(value);
+        if (bin >= 0)
+        {
+          ++counts[bin];
+        }
+      });
+  }
+
+  void Reduce()
+  {
+    for (const auto& counts : this->LocalCounts)
+    {
+      for (size_t cc = 0; cc < counts.size(); ++cc)
+      {
+        this->Counts[cc] += counts[cc];
+      }
+    }
+  }
+};
+
+struct BinWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const vtkLeafArray& leaf, int component, const vtkBinning& binning,
+    std::vector<vtkIdType>& counts)
+  {
+    BinFunctor<ArrayT> functor(array, leaf, component, binning, counts);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Histogram used to discover the range while binning. The width of the bins
+// is a power of two and the origin a multiple of the width, so that when the
+// width doubles to cover new values, or when two histograms are merged, every
+// bin falls exactly in one of the new bins. Until two distinct values are
+// added there are no bins: all values are equal to Min.
+class FineHistogram
+{
+public:
+  double Min = std::numeric_limits<double>::max();
+  double Max = std::numeric_limits<double>::lowest();
+  vtkIdType Count = 0;
+
+  void Initialize(vtkIdType numberOfBins)
+  {
+    this->NumberOfBins = numberOfBins;
+    this->Counts.assign(numberOfBins, 0);
+    this->Origin = this->End = this->Width = 0.0;
+    this->Min = std::numeric_limits<double>::max();
+    this->Max = std::numeric_limits<double>::lowest();
+    this->Count = 0;
+  }
+
+  vtkIdType GetNumberOfBins() const { return this->NumberOfBins; }
+
+  void Add(double value, vtkIdType count = 1)
+  {
+    if (this->Width > 0 && value >= this->Origin && value < this->End)
+    {
+      this->Counts[this->GetBin(value)] += count;
+    }
+    else if (this->Width > 0 || (this->Count > 0 && value != this->Min))
+    {
+      this->Cover(std::min(value, this->Min), std::max(value, this->Max), 0.0);
+      this->Counts[this->GetBin(value)] += count;
+    }
+    this->Min = std::min(this->Min, value);
+    this->Max = std::max(this->Max, value);
+    this->Count += count;
+  }
+
+  void Merge(const FineHistogram& other)
+  {
+    if (other.Count == 0)
+    {
+      return;
+    }
+    if (other.Width == 0)
+    {
+      this->Add(other.Min, other.Count);
+      return;
+    }
+    if (this->Count == 0)
+    {
+      *this = other;
+      return;
+    }
+    this->Cover(std::min(this->Min, other.Min), std::max(this->Max, other.Max), other.Width);
+    for (vtkIdType cc = 0; cc < other.NumberOfBins; ++cc)
+    {
+      if (other.Counts[cc] > 0)
+      {
+        this->Counts[this->GetBin(other.Origin + cc * other.Width)] += other.Counts[cc];
+      }
+    }
+    this->Min = std::min(this->Min, other.Min);
+    this->Max = std::max(this->Max, other.Max);
+    this->Count += other.Count;
+  }
+
+  // Adds the counts to the output bins. All the values of a bin are assumed
+  // to be at its center, clamped to [Min, Max].
+  void Distribute(const vtkBinning& binning, std::vector<vtkIdType>& counts) const
+  {
+    if (this->Count == 0)
+    {
+      return;
+    }
+    if (this->Width == 0)
+    {
+      const vtkIdType bin = binning.GetBin(this->Min);
+      if (bin >= 0)
+      {
+        counts[bin] += this->Count;
+      }
+      return;
+    }
+    for (vtkIdType cc = 0; cc < this->NumberOfBins; ++cc)
+    {
+      if (this->Counts[cc] > 0)
+      {
+        const double center = std::min(
+          std::max(this->Origin + (cc + 0.5) * this->Width, this->Min), this->Max);
+        const vtkIdType bin = binning.GetBin(center);
+        if (bin >= 0)
+        {
+          counts[bin] += this->Counts[cc];
+        }
+      }
+    }
+  }
+
+private:
+  std::vector<vtkIdType> Counts;
+  vtkIdType NumberOfBins = 0;
+  double Origin = 0.0;
+  double End = 0.0;
+  double Width = 0.0;
+
+  vtkIdType GetBin(double value) const
+  {
+    const vtkIdType bin = static_cast<vtkIdType>((value - this->Origin) / this->Width);
+    return std::min(std::max(bin, vtkIdType(0)), this->NumberOfBins - 1);
+  }
+
+  // Changes the bins to cover [lo, hi] with a width of at least minWidth.
+  void Cover(double lo, double hi, double minWidth)
+  {
+    double width = this->Width;
+    if (width == 0)
+    {
+      // start with half of the bins covering the range.
+      int exponent;
+      std::frexp((hi - lo) / (this->NumberOfBins / 2), &exponent);
+      width = std::ldexp(1.0, exponent);
+    }
+    width = std::max(width, minWidth);
+    double origin = std::floor(lo / width) * width;
+    while (hi >= origin + this->NumberOfBins * width)
+    {
+      width *= 2;
+      origin = std::floor(lo / width) * width;
+    }
+
+    std::vector<vtkIdType> counts;
+    counts.swap(this->Counts);
+    this->Counts.assign(this->NumberOfBins, 0);
+    const double oldOrigin = this->Origin;
+    const double oldWidth = this->Width;
+    this->Origin = origin;
+    this->Width = width;
+    this->End = origin + this->NumberOfBins * width;
+    if (oldWidth == 0)
+    {
+      this->Counts[this->GetBin(this->Min)] += this->Count;
+      return;
+    }
+    for (vtkIdType cc = 0; cc < this->NumberOfBins; ++cc)
+    {
+      if (counts[cc] > 0)
+      {
+        this->Counts[this->GetBin(oldOrigin + cc * oldWidth)] += counts[cc];
+      }
+    }
+  }
+};
+
+template <typename ArrayT>
+struct FineHistogramFunctor
+{
+  ArrayT* Array;
+  const vtkLeafArray& Leaf;
+  int Component;
+  FineHistogram& Histogram;
+  vtkSMPThreadLocal<FineHistogram> LocalHistogram;
+
+  FineHistogramFunctor(
+    ArrayT* array, const vtkLeafArray& leaf, int component, FineHistogram& histogram)
+    : Array(array)
+    , Leaf(leaf)
+    , Component(component)
+    , Histogram(histogram)
+  {
+  }
+
+  void Initialize()
+  {
+    this->LocalHistogram.Local().Initialize(this->Histogram.GetNumberOfBins());
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    auto& histogram = this->LocalHistogram.Local();
+    VisitValues(this->Array, this->Leaf, this->Component, begin, end,
+      [&histogram](double value) { histogram.Add(value); });
+  }
+
+  void Reduce()
+  {
+    for (const auto& histogram : this->LocalHistogram)
+    {
+      this->Histogram.Merge(histogram);
+    }
+  }
+};
+
+struct FineHistogramWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const vtkLeafArray& leaf, int component, FineHistogram& histogram)
+  {
+    FineHistogramFunctor<ArrayT> functor(array, leaf, component, histogram);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+  }
+};
+
+//-----------------------------------------------------------------------------
+template <typename ArrayT>
+struct SketchFunctor
+{
+  ArrayT* Array;
+  const vtkLeafArray& Leaf;
+  int Component;
+  vtkQuantileSketch* Sketch;
+  vtkSMPThreadLocalObject<vtkQuantileSketch> LocalSketch;
+
+  SketchFunctor(ArrayT* array, const vtkLeafArray& leaf, int component, vtkQuantileSketch* sketch)
+    : Array(array)
+    , Leaf(leaf)
+    , Component(component)
+    , Sketch(sketch)
+  {
+  }
+
+  void Initialize() { this->LocalSketch.Local()->SetK(this->Sketch->GetK()); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkQuantileSketch* sketch = this->LocalSketch.Local();
+    VisitValues(this->Array, this->Leaf, this->Component, begin, end,
+      [sketch](double value) { sketch->Insert(value); });
+  }
+
+  void Reduce()
+  {
+    for (vtkQuantileSketch* sketch : this->LocalSketch)
+    {
+      this->Sketch->Merge(sketch);
+    }
+  }
+};
+
+struct SketchWorker
+{
+  template <typename ArrayT>
+  void operator()(
+    ArrayT* array, const vtkLeafArray& leaf, int component, vtkQuantileSketch* sketch)
+  {
+    SketchFunctor<ArrayT> functor(array, leaf, component, sketch);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+  }
+};
+
+//-----------------------------------------------------------------------------
+template <typename WorkerT, typename... Args>
+void DispatchArray(vtkDataArray* array, WorkerT& worker, Args&&... args)
+{
+  if (!vtkArrayDispatch::Dispatch::Execute(array, worker, args...))
+  {
+    worker(array, args...);
+  }
+}
+}
+
 vtkStandardNewMacro(vtkPExtractHistogram);
 vtkCxxSetObjectMacro(vtkPExtractHistogram, Controller, vtkMultiProcessController);
 //-----------------------------------------------------------------------------
 vtkPExtractHistogram::vtkPExtractHistogram()
 {
   this->Controller = nullptr;
+  this->SinglePass = false;
+  this->Approximate = false;
+  this->SketchSize = 200;
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
@@ -61,97 +573,319 @@ bool vtkPExtractHistogram::GetInputArrayRange(vtkInformationVector** inputVector
 }
 
 //-----------------------------------------------------------------------------
-int vtkPExtractHistogram::RequestData(
-  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+bool vtkPExtractHistogram::ComputeHistogram(vtkDataObject* input, vtkTable* output)
 {
-  // All processes generate the histogram.
-  // However we want to avoid the super class to normalize/accumulate the results, hence temporarily
-  // disable these functionalities.
-  bool tempNormalize = this->Normalize;
-  this->Normalize = false;
-  bool tempAccumulation = this->Accumulation;
-  this->Accumulation = false;
+  std::vector<vtkLeafArray> leaves;
+  auto addLeaf = [this, &leaves](vtkDataObject* dobj)
+  {
+    int association;
+    vtkDataArray* array = dobj ? this->GetInputArrayToProcess(0, dobj, association) : nullptr;
+    if (array)
+    {
+      vtkFieldData* fd = dobj->GetAttributesAsFieldData(association);
+      leaves.push_back(vtkLeafArray{ array, fd ? fd->GetGhostArray() : nullptr,
+        fd ? fd->GetGhostsToSkip() : static_cast<unsigned char>(0) });
+    }
+  };
+  if (auto cd = vtkCompositeDataSet::SafeDownCast(input))
+  {
+    for (vtkDataObject* leaf : vtk::Range(cd))
+    {
+      addLeaf(leaf);
+    }
+  }
+  else
+  {
+    addLeaf(input);
+  }
+
+  const int numProcs = this->Controller ? this->Controller->GetNumberOfProcesses() : 1;
+  const bool isRoot = !this->Controller || this->Controller->GetLocalProcessId() == 0;
+  const bool singlePass = this->SinglePass && !this->UseCustomBinRanges;
+
+  if (this->Approximate)
+  {
+    // Each process summarizes its values in a sketch, and the sketches are
+    // merged on the root node where the bins are computed.
+    vtkNew<vtkQuantileSketch> sketch;
+    sketch->SetK(this->SketchSize);
+    for (const auto& leaf : leaves)
+    {
+      SketchWorker worker;
+      DispatchArray(leaf.Array, worker, leaf, this->Component, sketch.GetPointer());
+    }
+    if (numProcs > 1)
+    {
+      vtkMultiProcessStream stream;
+      sketch->Serialize(stream);
+      std::vector<vtkMultiProcessStream> streams;
+      if (!this->Controller->Gather(stream, streams, 0))
+      {
+        vtkErrorMacro("Parallel communication error. Could not gather sketches.");
+        return false;
+      }
+      for (int cc = 1; isRoot && cc < numProcs; ++cc)
+      {
+        vtkNew<vtkQuantileSketch> other;
+        other->SetK(this->SketchSize);
+        if (other->Deserialize(streams[cc]))
+        {
+          sketch->Merge(other);
+        }
+      }
+    }
+    int hasValues = sketch->GetCount() > 0 ? 1 : 0;
+    if (numProcs > 1)
+    {
+      this->Controller->Broadcast(&hasValues, 1, 0);
+    }
+    if (!hasValues && !this->UseCustomBinRanges)
+    {
+      // no values anywhere, let the superclass report it.
+      return false;
+    }
+    if (!isRoot)
+    {
+      output->Initialize();
+      return true;
+    }
 
-  int superRequestData = this->Superclass::RequestData(request, inputVector, outputVector);
+    double range[2] = { sketch->GetMinimum(), sketch->GetMaximum() };
+    if (this->UseCustomBinRanges)
+    {
+      range[0] = this->CustomBinRanges[0];
+      range[1] = this->CustomBinRanges[1];
+    }
+    const vtkBinning binning = MakeBinning(
+      range, this->BinCount, this->CenterBinsAroundMinAndMax && !this->UseCustomBinRanges);
+    std::vector<double> values;
+    std::vector<vtkIdType> weights;
+    sketch->GetItems(values, weights);
+    std::vector<vtkIdType> counts(binning.BinCount, 0);
+    for (size_t cc = 0; cc < values.size(); ++cc)
+    {
+      const vtkIdType bin = binning.GetBin(values[cc]);
+      if (bin >= 0)
+      {
+        counts[bin] += weights[cc];
+      }
+    }
+    FillOutput(output, binning, counts, this->BinExtentsArrayName, this->BinValuesArrayName);
+    return true;
+  }
 
-  this->Normalize = tempNormalize;
-  this->Accumulation = tempAccumulation;
-  if (superRequestData == 0)
+  // Determine the range, binning the values at the same time in single pass
+  // mode. The range is reduced with a single MIN_OP on { min, -max }.
+  FineHistogram fineHistogram;
+  fineHistogram.Initialize(SINGLE_PASS_RESOLUTION * std::max(this->BinCount, 1));
+  double range[2] = { std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest() };
+  if (this->UseCustomBinRanges)
   {
-    return 0;
+    range[0] = this->CustomBinRanges[0];
+    range[1] = this->CustomBinRanges[1];
+  }
+  else
+  {
+    for (const auto& leaf : leaves)
+    {
+      if (singlePass)
+      {
+        FineHistogramWorker worker;
+        DispatchArray(leaf.Array, worker, leaf, this->Component, fineHistogram);
+      }
+      else
+      {
+        RangeWorker worker;
+        DispatchArray(leaf.Array, worker, leaf, this->Component, &range[0]);
+      }
+    }
+    if (singlePass && fineHistogram.Count > 0)
+    {
+      range[0] = fineHistogram.Min;
+      range[1] = fineHistogram.Max;
+    }
+    if (numProcs > 1)
+    {
+      double local[2] = { range[0], -range[1] };
+      double global[2];
+      if (!this->Controller->AllReduce(local, global, 2, vtkCommunicator::MIN_OP))
+      {
+        vtkErrorMacro("Parallel communication error. Could not reduce ranges.");
+        return false;
+      }
+      range[0] = global[0];
+      range[1] = -global[1];
+    }
+    if (range[0] > range[1])
+    {
+      // no values anywhere, let the superclass report it.
+      return false;
+    }
   }
 
-  bool isRoot = !this->Controller || (this->Controller->GetLocalProcessId() == 0);
+  const vtkBinning binning = MakeBinning(
+    range, this->BinCount, this->CenterBinsAroundMinAndMax && !this->UseCustomBinRanges);
+  const int binCount = binning.BinCount;
 
-  vtkTable* output = vtkTable::GetData(outputVector, 0);
+  std::vector<vtkIdType> counts(binCount, 0);
+  if (singlePass)
+  {
+    fineHistogram.Distribute(binning, counts);
+  }
+  else
+  {
+    for (const auto& leaf : leaves)
+    {
+      BinWorker worker;
+      DispatchArray(leaf.Array, worker, leaf, this->Component, binning, counts);
+    }
+  }
 
-  // Handle > 1 ranks
-  if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
+  if (numProcs > 1)
   {
-    vtkSmartPointer<vtkDataArray> oldExtents =
-      output->GetRowData()->GetArray(this->BinExtentsArrayName);
-    if (oldExtents == nullptr)
+    // Only the non-empty bins are sent, as (bin, count) pairs.
+    std::vector<vtkIdType> sparse;
+    for (int bin = 0; bin < binCount; ++bin)
+    {
+      if (counts[bin] > 0)
+      {
+        sparse.push_back(bin);
+        sparse.push_back(counts[bin]);
+      }
+    }
+    vtkIdType length = static_cast<vtkIdType>(sparse.size());
+    std::vector<vtkIdType> lengths(numProcs, 0);
+    std::vector<vtkIdType> offsets(numProcs, 0);
+    if (!this->Controller->Gather(&length, lengths.data(), 1, 0))
     {
-      // Nothing to do if there is no data
-      return 1;
+      vtkErrorMacro("Parallel communication error. Could not reduce bins.");
+      return false;
     }
-    // Now we need to collect and reduce data from all nodes on the root.
-    vtkSmartPointer<vtkReductionFilter> reduceFilter = vtkSmartPointer<vtkReductionFilter>::New();
-    reduceFilter->SetController(this->Controller);
+    for (int cc = 1; cc < numProcs; ++cc)
+    {
+      offsets[cc] = offsets[cc - 1] + lengths[cc - 1];
+    }
+    std::vector<vtkIdType> received(isRoot ? offsets.back() + lengths.back() : 0);
+    if (!this->Controller->GatherV(
+          sparse.data(), received.data(), length, lengths.data(), offsets.data(), 0))
+    {
+      vtkErrorMacro("Parallel communication error. Could not reduce bins.");
+      return false;
+    }
+    if (!isRoot)
+    {
+      output->Initialize();
+      return true;
+    }
+    std::fill(counts.begin(), counts.end(), 0);
+    for (size_t cc = 0; cc + 1 < received.size(); cc += 2)
+    {
+      counts[received[cc]] += received[cc + 1];
+    }
+  }
+
+  FillOutput(output, binning, counts, this->BinExtentsArrayName, this->BinValuesArrayName);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+int vtkPExtractHistogram::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  bool isRoot = !this->Controller || (this->Controller->GetLocalProcessId() == 0);
+
+  vtkTable* output = vtkTable::GetData(outputVector, 0);
+
+  // The averages of the other arrays are only computed by the superclass.
+  if (this->CalculateAverages ||
+    !this->ComputeHistogram(vtkDataObject::GetData(inputVector[0], 0), output))
+  {
+    // All processes generate the histogram.
+    // However we want to avoid the super class to normalize/accumulate the results, hence
+    // temporarily disable these functionalities.
+    bool tempNormalize = this->Normalize;
+    this->Normalize = false;
+    bool tempAccumulation = this->Accumulation;
+    this->Accumulation = false;
 
-    if (isRoot)
+    int superRequestData = this->Superclass::RequestData(request, inputVector, outputVector);
+
+    this->Normalize = tempNormalize;
+    this->Accumulation = tempAccumulation;
+    if (superRequestData == 0)
     {
-      // PostGatherHelper needs to be set only on the root node.
-      vtkSmartPointer<vtkAttributeDataReductionFilter> rf =
-        vtkSmartPointer<vtkAttributeDataReductionFilter>::New();
-      rf->SetAttributeType(vtkAttributeDataReductionFilter::ROW_DATA);
-      rf->SetReductionType(vtkAttributeDataReductionFilter::ADD);
-      reduceFilter->SetPostGatherHelper(rf);
+      return 0;
     }
 
-    vtkSmartPointer<vtkTable> copy = vtkSmartPointer<vtkTable>::New();
-    copy->ShallowCopy(output);
-    reduceFilter->SetInputData(copy);
-    reduceFilter->Update();
-    if (isRoot)
+    // Handle > 1 ranks
+    if (this->Controller && this->Controller->GetNumberOfProcesses() > 1)
     {
-      // We save the old bin extents and then revert to be restored later since
-      // the reduction reduces the bin extents as well.
-      output->ShallowCopy(reduceFilter->GetOutput());
-      if (output->GetRowData()->GetNumberOfArrays() == 0)
+      vtkSmartPointer<vtkDataArray> oldExtents =
+        output->GetRowData()->GetArray(this->BinExtentsArrayName);
+      if (oldExtents == nullptr)
+      {
+        // Nothing to do if there is no data
+        return 1;
+      }
+      // Now we need to collect and reduce data from all nodes on the root.
+      vtkSmartPointer<vtkReductionFilter> reduceFilter =
+        vtkSmartPointer<vtkReductionFilter>::New();
+      reduceFilter->SetController(this->Controller);
+
+      if (isRoot)
       {
-        vtkErrorMacro(<< "Reduced data has 0 arrays");
-        return 0;
+        // PostGatherHelper needs to be set only on the root node.
+        vtkSmartPointer<vtkAttributeDataReductionFilter> rf =
+          vtkSmartPointer<vtkAttributeDataReductionFilter>::New();
+        rf->SetAttributeType(vtkAttributeDataReductionFilter::ROW_DATA);
+        rf->SetReductionType(vtkAttributeDataReductionFilter::ADD);
+        reduceFilter->SetPostGatherHelper(rf);
       }
-      output->GetRowData()->GetArray(this->BinExtentsArrayName)->DeepCopy(oldExtents);
-      if (this->CalculateAverages)
+
+      vtkSmartPointer<vtkTable> copy = vtkSmartPointer<vtkTable>::New();
+      copy->ShallowCopy(output);
+      reduceFilter->SetInputData(copy);
+      reduceFilter->Update();
+      if (isRoot)
       {
-        vtkDataArray* bin_values = output->GetRowData()->GetArray(this->BinValuesArrayName);
-        vtksys::RegularExpression reg_ex("^(.*)_average$");
-        int numArrays = output->GetRowData()->GetNumberOfArrays();
-        for (int i = 0; i < numArrays; i++)
+        // We save the old bin extents and then revert to be restored later since
+        // the reduction reduces the bin extents as well.
+        output->ShallowCopy(reduceFilter->GetOutput());
+        if (output->GetRowData()->GetNumberOfArrays() == 0)
+        {
+          vtkErrorMacro(<< "Reduced data has 0 arrays");
+          return 0;
+        }
+        output->GetRowData()->GetArray(this->BinExtentsArrayName)->DeepCopy(oldExtents);
+        if (this->CalculateAverages)
         {
-          vtkDataArray* array = output->GetRowData()->GetArray(i);
-          if (array && reg_ex.find(array->GetName()))
+          vtkDataArray* bin_values = output->GetRowData()->GetArray(this->BinValuesArrayName);
+          vtksys::RegularExpression reg_ex("^(.*)_average$");
+          int numArrays = output->GetRowData()->GetNumberOfArrays();
+          for (int i = 0; i < numArrays; i++)
           {
-            int numComps = array->GetNumberOfComponents();
-            std::string name = reg_ex.match(1) + "_total";
-            vtkDataArray* tarray = output->GetRowData()->GetArray(name.c_str());
-            for (vtkIdType idx = 0; idx < this->BinCount; idx++)
+            vtkDataArray* array = output->GetRowData()->GetArray(i);
+            if (array && reg_ex.find(array->GetName()))
             {
-              for (int j = 0; j < numComps; j++)
+              int numComps = array->GetNumberOfComponents();
+              std::string name = reg_ex.match(1) + "_total";
+              vtkDataArray* tarray = output->GetRowData()->GetArray(name.c_str());
+              for (vtkIdType idx = 0; idx < this->BinCount; idx++)
               {
-                array->SetComponent(
-                  idx, j, tarray->GetComponent(idx, j) / bin_values->GetTuple1(idx));
+                for (int j = 0; j < numComps; j++)
+                {
+                  array->SetComponent(
+                    idx, j, tarray->GetComponent(idx, j) / bin_values->GetTuple1(idx));
+                }
               }
             }
           }
         }
       }
-    }
-    else
-    {
-      output->Initialize();
+      else
+      {
+        output->Initialize();
+      }
     }
   }
 
@@ -175,4 +909,7 @@ void vtkPExtractHistogram::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "SinglePass: " << this->SinglePass << endl;
+  os << indent << "Approximate: " << this->Approximate << endl;
+  os << indent << "SketchSize: " << this->SketchSize << endl;
 }
@@ -7,6 +7,19 @@
  *
  * vtkPExtractHistogram is vtkExtractHistogram subclass for parallel datasets.
  * It gathers the histogram data on the root node.
+ *
+ * Unless CalculateAverages is on, the range and the bins are computed with
+ * vtkSMPTools, using thread-local bins, for all the array types supported by
+ * vtkArrayDispatch. Ghost entries and non-finite values are skipped. Only the
+ * non-empty bins are sent to the root node.
+ *
+ * When SinglePass is on and the range of the array is not given by
+ * CustomBinRanges, the range is discovered while the values are binned, so the
+ * data is traversed only once. See SetSinglePass().
+ *
+ * When Approximate is on, each process summarizes its values in a
+ * vtkQuantileSketch and only the sketches are sent to the root node, which
+ * computes approximate bins from the merged sketch. See SetApproximate().
  */
 
 #ifndef vtkPExtractHistogram_h
@@ -16,6 +29,7 @@
 #include "vtkPVVTKExtensionsMiscModule.h" //needed for exports
 
 class vtkMultiProcessController;
+class vtkTable;
 
 class VTKPVVTKEXTENSIONSMISC_EXPORT vtkPExtractHistogram : public vtkExtractHistogram
 {
@@ -33,6 +47,48 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   ///@}
 
+  ///@{
+  /**
+   * When set to true, the range of the array and the bins are computed in a
+   * single traversal of the data. The values are first counted in fine bins
+   * whose width grows as new values extend the range, then the fine bins are
+   * distributed to the output bins once the range is known across all
+   * processes. The counts are then approximate: a value closer to a bin
+   * boundary than about 1/32 of the bin width may be counted in the
+   * neighbouring bin. This is meant for large datasets for which reading the
+   * values twice is the bottleneck. Ignored when UseCustomBinRanges or
+   * CalculateAverages is true. Default is false.
+   */
+  vtkSetMacro(SinglePass, bool);
+  vtkGetMacro(SinglePass, bool);
+  vtkBooleanMacro(SinglePass, bool);
+  ///@}
+
+  ///@{
+  /**
+   * When set to true, the bins are estimated from a vtkQuantileSketch of the
+   * values, in a single traversal of the data. The sketches of the processes
+   * are small and merged cheaply on the root node, which makes this suitable
+   * for interactive use on large datasets. The range is exact, and the count of
+   * each bin is within 2 * vtkQuantileSketch::GetNormalizedRankError() of the
+   * number of values with a high probability. Takes precedence over
+   * SinglePass and is ignored when CalculateAverages is true. Default is false.
+   */
+  vtkSetMacro(Approximate, bool);
+  vtkGetMacro(Approximate, bool);
+  vtkBooleanMacro(Approximate, bool);
+  ///@}
+
+  ///@{
+  /**
+   * K parameter of the sketch used when Approximate is true, which controls
+   * the accuracy of the bins. See vtkQuantileSketch. Default is 200, for an
+   * error of about 2.6% of the number of values per bin.
+   */
+  vtkSetClampMacro(SketchSize, int, 8, 65535);
+  vtkGetMacro(SketchSize, int);
+  ///@}
+
 protected:
   vtkPExtractHistogram();
   ~vtkPExtractHistogram() override;
@@ -47,10 +103,20 @@ protected:
     vtkInformationVector* outputVector) override;
 
   vtkMultiProcessController* Controller;
+  bool SinglePass;
+  bool Approximate;
+  int SketchSize;
 
 private:
   vtkPExtractHistogram(const vtkPExtractHistogram&) = delete;
   void operator=(const vtkPExtractHistogram&) = delete;
+
+  /**
+   * Computes the histogram using vtkSMPTools and reduces it on the root node.
+   * Returns false if the range of the array cannot be determined on any
+   * process, in which case the superclass implementation is used instead.
+   */
+  bool ComputeHistogram(vtkDataObject* input, vtkTable* output);
 };
 
 #endif
@@ -0,0 +1,329 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkQuantileSketch.h"
+
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+
+class vtkQuantileSketch::vtkInternals
+{
+public:
+  // Levels[h] holds values of weight 2^h.
+  std::vector<std::vector<double>> Levels;
+  vtkIdType Count = 0;
+  double Minimum = std::numeric_limits<double>::max();
+  double Maximum = std::numeric_limits<double>::lowest();
+  size_t Size = 0;
+  size_t MaxSize = 0;
+  std::minstd_rand Random;
+  int K;
+
+  vtkInternals(int k)
+    : K(k)
+  {
+    this->Levels.resize(1);
+    this->MaxSize = this->ComputeMaxSize();
+  }
+
+  // Capacities decrease geometrically from the top level down, with a factor
+  // of 2/3, and are at least 2.
+  size_t GetCapacity(size_t level) const
+  {
+    const size_t depth = this->Levels.size() - level - 1;
+    const double capacity = std::ceil(this->K * std::pow(2.0 / 3.0, static_cast<double>(depth)));
+    return std::max(static_cast<size_t>(2), static_cast<size_t>(capacity));
+  }
+
+  size_t ComputeMaxSize() const
+  {
+    size_t size = 0;
+    for (size_t level = 0; level < this->Levels.size(); ++level)
+    {
+      size += this->GetCapacity(level);
+    }
+    return size;
+  }
+
+  // Compacts the lowest full level: half of its values, every other one after
+  // sorting, move to the next level with twice the weight.
+  void Compress()
+  {
+    while (this->Size >= this->MaxSize)
+    {
+      for (size_t level = 0; level < this->Levels.size(); ++level)
+      {
+        if (this->Levels[level].size() < this->GetCapacity(level))
+        {
+          continue;
+        }
+        if (level + 1 == this->Levels.size())
+        {
+          this->Levels.emplace_back();
+          this->MaxSize = this->ComputeMaxSize();
+        }
+
+        auto& values = this->Levels[level];
+        std::sort(values.begin(), values.end());
+        // an odd value out stays on this level.
+        const size_t count = values.size() - (values.size() % 2);
+        const size_t offset = this->Random() % 2;
+        auto& next = this->Levels[level + 1];
+        for (size_t cc = offset; cc < count; cc += 2)
+        {
+          next.push_back(values[cc]);
+        }
+        values.erase(values.begin(), values.begin() + count);
+        this->Size -= count / 2;
+        break;
+      }
+    }
+  }
+
+  std::vector<std::pair<double, vtkIdType>> GetSortedItems() const
+  {
+    std::vector<std::pair<double, vtkIdType>> items;
+    items.reserve(this->Size);
+    for (size_t level = 0; level < this->Levels.size(); ++level)
+    {
+      for (const double value : this->Levels[level])
+      {
+        items.emplace_back(value, vtkIdType(1) << level);
+      }
+    }
+    std::sort(items.begin(), items.end());
+    return items;
+  }
+};
+
+vtkStandardNewMacro(vtkQuantileSketch);
+//----------------------------------------------------------------------------
+vtkQuantileSketch::vtkQuantileSketch()
+{
+  this->K = 200;
+  this->Internals = new vtkInternals(this->K);
+}
+
+//----------------------------------------------------------------------------
+vtkQuantileSketch::~vtkQuantileSketch()
+{
+  delete this->Internals;
+  this->Internals = nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkQuantileSketch::SetK(int k)
+{
+  k = std::max(k, 8);
+  if (this->K != k)
+  {
+    this->K = k;
+    this->Initialize();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+double vtkQuantileSketch::GetNormalizedRankError() const
+{
+  // empirical fit given by the authors of the Apache DataSketches library.
+  return 2.296 / std::pow(static_cast<double>(this->K), 0.9723);
+}
+
+//----------------------------------------------------------------------------
+void vtkQuantileSketch::Initialize()
+{
+  delete this->Internals;
+  this->Internals = new vtkInternals(this->K);
+}
+
+//----------------------------------------------------------------------------
+void vtkQuantileSketch::Insert(double value)
+{
+  if (std::isnan(value))
+  {
+    return;
+  }
+  auto& internals = *this->Internals;
+  internals.Levels[0].push_back(value);
+  internals.Minimum = std::min(internals.Minimum, value);
+  internals.Maximum = std::max(internals.Maximum, value);
+  internals.Count++;
+  if (++internals.Size >= internals.MaxSize)
+  {
+    internals.Compress();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkQuantileSketch::Merge(vtkQuantileSketch* other)
+{
+  if (!other || other == this || other->Internals->Count == 0)
+  {
+    return;
+  }
+  auto& internals = *this->Internals;
+  const auto& otherInternals = *other->Internals;
+  if (internals.Levels.size() < otherInternals.Levels.size())
+  {
+    internals.Levels.resize(otherInternals.Levels.size());
+    internals.MaxSize = internals.ComputeMaxSize();
+  }
+  for (size_t level = 0; level < otherInternals.Levels.size(); ++level)
+  {
+    const auto& values = otherInternals.Levels[level];
+    internals.Levels[level].insert(internals.Levels[level].end(), values.begin(), values.end());
+  }
+  internals.Size += otherInternals.Size;
+  internals.Count += otherInternals.Count;
+  internals.Minimum = std::min(internals.Minimum, otherInternals.Minimum);
+  internals.Maximum = std::max(internals.Maximum, otherInternals.Maximum);
+  internals.Compress();
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkQuantileSketch::GetCount() const
+{
+  return this->Internals->Count;
+}
+
+//----------------------------------------------------------------------------
+double vtkQuantileSketch::GetMinimum() const
+{
+  return this->Internals->Minimum;
+}
+
+//----------------------------------------------------------------------------
+double vtkQuantileSketch::GetMaximum() const
+{
+  return this->Internals->Maximum;
+}
+
+//----------------------------------------------------------------------------
+double vtkQuantileSketch::GetQuantile(double fraction) const
+{
+  const auto& internals = *this->Internals;
+  if (internals.Count == 0)
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  if (fraction <= 0.0)
+  {
+    return internals.Minimum;
+  }
+  if (fraction >= 1.0)
+  {
+    return internals.Maximum;
+  }
+
+  const double target = fraction * internals.Count;
+  vtkIdType cumulative = 0;
+  for (const auto& item : internals.GetSortedItems())
+  {
+    cumulative += item.second;
+    if (cumulative >= target)
+    {
+      return item.first;
+    }
+  }
+  return internals.Maximum;
+}
+
+//----------------------------------------------------------------------------
+double vtkQuantileSketch::GetRank(double value) const
+{
+  const auto& internals = *this->Internals;
+  if (internals.Count == 0)
+  {
+    return 0.0;
+  }
+  vtkIdType cumulative = 0;
+  for (size_t level = 0; level < internals.Levels.size(); ++level)
+  {
+    for (const double item : internals.Levels[level])
+    {
+      if (item <= value)
+      {
+        cumulative += vtkIdType(1) << level;
+      }
+    }
+  }
+  return static_cast<double>(cumulative) / internals.Count;
+}
+
+//----------------------------------------------------------------------------
+void vtkQuantileSketch::GetItems(std::vector<double>& values, std::vector<vtkIdType>& weights) const
+{
+  values.clear();
+  weights.clear();
+  for (const auto& item : this->Internals->GetSortedItems())
+  {
+    values.push_back(item.first);
+    weights.push_back(item.second);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkQuantileSketch::Serialize(vtkMultiProcessStream& stream) const
+{
+  const auto& internals = *this->Internals;
+  stream << this->K << static_cast<vtkTypeInt64>(internals.Count) << internals.Minimum
+         << internals.Maximum << static_cast<unsigned int>(internals.Levels.size());
+  for (const auto& values : internals.Levels)
+  {
+    stream << static_cast<unsigned int>(values.size());
+    for (const double value : values)
+    {
+      stream << value;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkQuantileSketch::Deserialize(vtkMultiProcessStream& stream)
+{
+  int k;
+  vtkTypeInt64 count;
+  double minimum, maximum;
+  unsigned int numLevels;
+  stream >> k >> count >> minimum >> maximum >> numLevels;
+  if (k != this->K)
+  {
+    vtkErrorMacro("Cannot deserialize a sketch with a different K (" << k << ").");
+    return false;
+  }
+
+  this->Initialize();
+  auto& internals = *this->Internals;
+  internals.Levels.resize(std::max(numLevels, 1u));
+  for (unsigned int level = 0; level < numLevels; ++level)
+  {
+    unsigned int size;
+    stream >> size;
+    internals.Levels[level].resize(size);
+    for (unsigned int cc = 0; cc < size; ++cc)
+    {
+      stream >> internals.Levels[level][cc];
+    }
+    internals.Size += size;
+  }
+  internals.Count = static_cast<vtkIdType>(count);
+  internals.Minimum = minimum;
+  internals.Maximum = maximum;
+  internals.MaxSize = internals.ComputeMaxSize();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkQuantileSketch::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "K: " << this->K << endl;
+  os << indent << "Count: " << this->Internals->Count << endl;
+  os << indent << "Retained values: " << this->Internals->Size << endl;
+}
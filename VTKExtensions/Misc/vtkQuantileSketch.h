@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkQuantileSketch
+ * @brief   mergeable summary of a distribution of values.
+ *
+ * vtkQuantileSketch implements the KLL sketch (Karnin, Lang and Liberty,
+ * "Optimal Quantile Approximation in Streams", 2016). It keeps a small
+ * number of the inserted values, each standing for a power of two of the
+ * original values, from which the quantiles and the ranks of the whole
+ * distribution can be estimated. Sketches built independently, on different
+ * threads or processes, can be merged with the same guarantees as if all the
+ * values had been inserted in a single sketch.
+ *
+ * The accuracy and the size of the sketch are controlled by K. The rank of a
+ * value, i.e. the fraction of values smaller than it, is estimated within
+ * GetNormalizedRankError() with a high probability. With the default K of
+ * 200, this is about 1.3% and the sketch retains about 3 K values whatever the
+ * number of values inserted. The minimum, the maximum and the number of
+ * values are exact.
+ *
+ * The sketch uses a pseudo-random generator with a fixed seed, so the results
+ * are reproducible for a given sequence of insertions and merges.
+ *
+ * @sa
+ * vtkPExtractHistogram
+ */
+
+#ifndef vtkQuantileSketch_h
+#define vtkQuantileSketch_h
+
+#include "vtkObject.h"
+#include "vtkPVVTKExtensionsMiscModule.h" // needed for export macro
+
+#include <vector> // needed for std::vector
+
+class vtkMultiProcessStream;
+
+class VTKPVVTKEXTENSIONSMISC_EXPORT vtkQuantileSketch : public vtkObject
+{
+public:
+  static vtkQuantileSketch* New();
+  vtkTypeMacro(vtkQuantileSketch, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Controls the accuracy and the size of the sketch. Changing K resets the
+   * sketch. Default is 200.
+   */
+  void SetK(int k);
+  vtkGetMacro(K, int);
+  ///@}
+
+  /**
+   * Returns the expected error on the normalized rank of a value for the
+   * current K, e.g. 0.013 for K = 200.
+   */
+  double GetNormalizedRankError() const;
+
+  /**
+   * Removes all the values.
+   */
+  void Initialize();
+
+  /**
+   * Adds a value to the sketch. NaNs are ignored.
+   */
+  void Insert(double value);
+
+  /**
+   * Adds all the values summarized by another sketch.
+   */
+  void Merge(vtkQuantileSketch* other);
+
+  ///@{
+  /**
+   * Exact number of values, minimum and maximum.
+   */
+  vtkIdType GetCount() const;
+  double GetMinimum() const;
+  double GetMaximum() const;
+  ///@}
+
+  /**
+   * Returns an estimate of the value below which the given fraction, in [0,
+   * 1], of the values lies. Returns the exact minimum and maximum for 0 and 1.
+   */
+  double GetQuantile(double fraction) const;
+
+  /**
+   * Returns an estimate of the fraction of values lower or equal to `value`.
+   */
+  double GetRank(double value) const;
+
+  /**
+   * Returns the values retained by the sketch and the number of original
+   * values each stands for. The weights sum to GetCount().
+   */
+  void GetItems(std::vector<double>& values, std::vector<vtkIdType>& weights) const;
+
+  ///@{
+  /**
+   * Serializes the sketch to send it to another process.
+   */
+  void Serialize(vtkMultiProcessStream& stream) const;
+  bool Deserialize(vtkMultiProcessStream& stream);
+  ///@}
+
+protected:
+  vtkQuantileSketch();
+  ~vtkQuantileSketch() override;
+
+  int K;
+
+private:
+  vtkQuantileSketch(const vtkQuantileSketch&) = delete;
+  void operator=(const vtkQuantileSketch&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
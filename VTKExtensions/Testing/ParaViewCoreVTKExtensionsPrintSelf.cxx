@@ -114,6 +114,7 @@
 #include "vtkPlotEdges.h"
 #include "vtkPointHandleRepresentationSphere.h"
 #include "vtkPolyLineToRectilinearGridFilter.h"
+#include "vtkQuantileSketch.h"
 #include "vtkRectilinearGridConnectivity.h"
 #include "vtkReductionFilter.h"
 #include "vtkSciVizStatistics.h"
@@ -286,6 +287,7 @@ int ParaViewCoreVTKExtensionsPrintSelf(int, char*[])
   PRINT_SELF(vtkPVTransform);
   PRINT_SELF(vtkPVTrivialProducer);
   PRINT_SELF(vtkPVUpdateSuppressor);
+  PRINT_SELF(vtkQuantileSketch);
   PRINT_SELF(vtkQuerySelectionSource);
   PRINT_SELF(vtkRectilinearGridConnectivity);
   PRINT_SELF(vtkReductionFilter);
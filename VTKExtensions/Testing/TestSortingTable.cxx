@@ -6,7 +6,10 @@
 
 #include "vtkDoubleArray.h"
 #include "vtkDummyController.h"
+#include "vtkMinimalStandardRandomSequence.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortedTableStreamer.h"
 #include "vtkTable.h"
@@ -14,6 +17,7 @@
 #include "vtkUnsignedCharArray.h"
 
 #include <cfloat>
+#include <vector>
 // ----------------------------------------------------------------------------
 void fillArray(vtkDoubleArray* array, double* dataPointer, int dataSize, const char* name)
 {
@@ -153,6 +157,76 @@ int sortMagnitudeOnUnsignedCharVector()
   return EXIT_SUCCESS;
 }
 
+// ----------------------------------------------------------------------------
+// Request every block, switching to another column in between, to make sure
+// that the cached sorted indices give the same result as a fresh sort.
+int sortBlocksWithCachedIndex(bool debug)
+{
+  const int size = 500;
+  const int blockSize = 64;
+  vtkNew<vtkMinimalStandardRandomSequence> rand;
+  vtkNew<vtkPartitionedDataSet> input;
+  for (unsigned int partition = 0; partition < 2; ++partition)
+  {
+    std::vector<double> a(size), b(size);
+    for (int i = 0; i < size; i++)
+    {
+      rand->Next();
+      a[i] = rand->GetValue();
+      rand->Next();
+      b[i] = rand->GetValue();
+    }
+    vtkNew<vtkDoubleArray> arrayA;
+    fillArray(arrayA, a.data(), size, "a");
+    vtkNew<vtkDoubleArray> arrayB;
+    fillArray(arrayB, b.data(), size, "b");
+    vtkNew<vtkTable> table;
+    table->AddColumn(arrayA);
+    table->AddColumn(arrayB);
+    input->SetPartition(partition, table);
+  }
+
+  vtkNew<vtkSortedTableStreamer> sortingfilter;
+  sortingfilter->SetInputData(input);
+  sortingfilter->SetSelectedComponent(0);
+  sortingfilter->SetBlockSize(blockSize);
+
+  std::vector<double> sorted;
+  for (int block = 0; block * blockSize < 2 * size; ++block)
+  {
+    sortingfilter->SetColumnNameToSort("b");
+    sortingfilter->SetBlock(0);
+    sortingfilter->Update();
+
+    sortingfilter->SetColumnNameToSort("a");
+    sortingfilter->SetBlock(block);
+    sortingfilter->Update();
+    auto array = vtkDoubleArray::SafeDownCast(sortingfilter->GetOutput()->GetColumnByName("a"));
+    for (vtkIdType i = 0; array && i < array->GetNumberOfTuples(); i++)
+    {
+      sorted.push_back(array->GetValue(i));
+    }
+  }
+
+  if (sorted.size() != static_cast<size_t>(2 * size))
+  {
+    cout << "Expected " << 2 * size << " values and got " << sorted.size() << endl;
+    return EXIT_FAILURE;
+  }
+  for (size_t i = 1; i < sorted.size(); i++)
+  {
+    if (debug)
+      cout << "Sorted value: " << sorted[i] << endl;
+    if (sorted[i - 1] > sorted[i])
+    {
+      cout << "Values " << i - 1 << " and " << i << " are not sorted." << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
 // ----------------------------------------------------------------------------
 int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
 {
@@ -172,6 +246,9 @@ int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
   cout << "Testing sorting with magnitude on unsigned char: "
        << ((result += sortMagnitudeOnUnsignedCharVector()) ? "FAILED" : "SUCCESS") << endl;
   // --------------------------------------------------------------------------
+  cout << "Testing sorting blocks with cached index: "
+       << ((result += sortBlocksWithCachedIndex(debug)) ? "FAILED" : "SUCCESS") << endl;
+  // --------------------------------------------------------------------------
   // --------------------------------------------------------------------------
 
   // Delete Fake MPI controller
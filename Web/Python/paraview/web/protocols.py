@@ -2801,10 +2801,10 @@ class ParaViewWebProxyManager(ParaViewWebProtocol):
             arrayData.append(data)
 
         # Get field data information
-        fdInfo = dataInfo.DataInformation.GetFieldDataInformation()
+        fdInfo = proxy.GetFieldDataInformation()
         numFieldDataArrays = fdInfo.GetNumberOfArrays()
         for idx in xrange(numFieldDataArrays):
-            array = fdInfo.GetArrayInformation(idx)
+            array = fdInfo.GetArray(idx)
             numComps = array.GetNumberOfComponents()
             typeStr = ParaViewWebProxyManager.VTK_DATA_TYPES[array.GetDataType()]
             data = {
@@ -2815,7 +2815,7 @@ class ParaViewWebProxyManager(ParaViewWebProtocol):
             }
             rangeList = []
             for i in range(numComps):
-                ithrange = array.GetComponentRange(i)
+                ithrange = array.GetRange(i)
                 rangeList.append(
                     {
                         "name": array.GetComponentName(i),
@@ -1570,7 +1570,10 @@ class ArrayInformation(object):
 
     def __getattr__(self, name):
         """Forward unknown methods to vtkPVArrayInformation"""
-        array = self.FieldData.GetFieldData().GetArrayInformation(self.Name)
+        if "Range" in name:
+            array = self.FieldData.GetArrayInformationWithRanges(self.Name)
+        else:
+            array = self.FieldData.GetFieldData().GetArrayInformation(self.Name)
         if not array: return None
         return getattr(array, name)
 
@@ -1580,7 +1583,7 @@ class ArrayInformation(object):
 
     def GetRange(self, component=0):
         """Given a component, returns its value range as a tuple of 2 values."""
-        array = self.FieldData.GetFieldData().GetArrayInformation(self.Name)
+        array = self.FieldData.GetArrayInformationWithRanges(self.Name)
         range = array.GetComponentRange(component)
         return (range[0], range[1])
 
@@ -1651,6 +1654,13 @@ class FieldDataInformation(object):
         vtkPVDataSetAttributesInformation"""
         return getattr(self.Proxy.GetDataInformation(self.OutputPort), "Get%sInformation" % self.FieldData)()
 
+    def GetArrayInformationWithRanges(self, name):
+        """Returns the vtkPVArrayInformation of the given array with its
+        component ranges, requesting them from the server if the data
+        information was gathered without ranges."""
+        association = self.GetFieldData().GetFieldAssociation()
+        return self.Proxy.GetArrayInformationWithRanges(self.OutputPort, name, association)
+
     def GetNumberOfArrays(self):
         """Returns the number of arrays."""
         self.Proxy.UpdatePipeline()